@@ -40,11 +40,15 @@ namespace Beyond {
 
 	void RenderThread::Terminate()
 	{
-		m_IsRunning = false;
-		Pump();
+		// Headless applications never start it, there's no renderer to pump
+		if (m_IsRunning)
+		{
+			m_IsRunning = false;
+			Pump();
 
-		if (m_ThreadingPolicy == ThreadingPolicy::MultiThreaded)
-			m_RenderThread.Join();
+			if (m_ThreadingPolicy == ThreadingPolicy::MultiThreaded)
+				m_RenderThread.Join();
+		}
 	}
 
 	void RenderThread::Wait(State waitForState)
@@ -22,6 +22,11 @@ project "Beyond"
 		"vendor/FastNoise/**.cpp",
 		"vendor/simdutf/**.cpp",
 
+		-- zstd that ships with Tracy, used to compress asset packs
+		"vendor/tracy/tracy/zstd/common/*.c",
+		"vendor/tracy/tracy/zstd/compress/*.c",
+		"vendor/tracy/tracy/zstd/decompress/*.c",
+
 		"vendor/rtxgi-sdk/include/**.h",
 		"vendor/rtxgi-sdk/src/**.cpp",
 
@@ -50,14 +55,14 @@ project "Beyond"
 
 	IncludeDependencies()
 	
-	defines { "GLM_FORCE_DEPTH_ZERO_TO_ONE", "VK_NO_PROTOTYPES", "RTXGI_COORDINATE_SYSTEM=2", "RTXGI_DDGI_RESOURCE_MANAGEMENT=1", "RTXGI_GFX_NAME_OBJECTS=1" }
+	defines { "GLM_FORCE_DEPTH_ZERO_TO_ONE", "VK_NO_PROTOTYPES", "RTXGI_COORDINATE_SYSTEM=2", "RTXGI_DDGI_RESOURCE_MANAGEMENT=1", "RTXGI_GFX_NAME_OBJECTS=1", "ZSTD_DISABLE_ASM" }
 
 	excludes { 
 		"vendor/rtxgi-sdk/include/VulkanExtensions.h",
 		"vendor/rtxgi-sdk/src/VulkanExtensions.cpp",
 	}
 
-	filter "files:vendor/FastNoise/**.cpp or files:vendor/simdutf/**.cpp or files:vendor/yaml-cpp/src/**.cpp or files:vendor/imgui/misc/cpp/imgui_stdlib.cpp or files:src/Beyond/Tiering/TieringSerializer.cpp or files:src/Beyond/Core/ApplicationSettings.cpp or files:vendor/rtxgi-sdk/src/**.cpp"
+	filter "files:vendor/FastNoise/**.cpp or files:vendor/simdutf/**.cpp or files:vendor/yaml-cpp/src/**.cpp or files:vendor/imgui/misc/cpp/imgui_stdlib.cpp or files:src/Beyond/Tiering/TieringSerializer.cpp or files:src/Beyond/Core/ApplicationSettings.cpp or files:vendor/rtxgi-sdk/src/**.cpp or files:vendor/tracy/tracy/zstd/**.c"
 		flags { "NoPCH" }
 
 
@@ -0,0 +1,180 @@
+#include "pch.h"
+#include "AnimationSampler.h"
+
+#include "PoseTrackWriter.h"
+
+#include "Beyond/Debug/Profiler.h"
+
+#include <acl/decompression/decompress.h>
+
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+namespace Beyond::AnimationSampler {
+
+	namespace {
+
+		using DecompressionContext = acl::decompression_context<acl::default_transform_decompression_settings>;
+
+		struct SampleKey
+		{
+			const Animation* Clip;
+			int32_t Sample;
+			const std::vector<bool>* SkippedBones;
+
+			bool operator==(const SampleKey& other) const { return Clip == other.Clip && Sample == other.Sample && SkippedBones == other.SkippedBones; }
+		};
+
+		struct SampleKeyHash
+		{
+			size_t operator()(const SampleKey& key) const
+			{
+				const uint64_t hash = (uint64_t)(uintptr_t)key.Clip ^ ((uint64_t)(uint32_t)key.Sample * 0x9E3779B97F4A7C15ull) ^ ((uint64_t)(uintptr_t)key.SkippedBones >> 4);
+				return (size_t)(hash ^ (hash >> 29));
+			}
+		};
+
+		// Cache is split into shards, each with its own lock, so that graphs processed on different workers rarely wait on each other
+		struct CacheShard
+		{
+			std::mutex Mutex;
+			std::unordered_map<SampleKey, uint32_t, SampleKeyHash> Lookup; // Index into Samples
+			std::vector<std::vector<LocalTransform>> Samples;             // Kept around between frames so they don't reallocate
+			uint32_t NumSamples = 0;
+		};
+
+		constexpr uint32_t NumShards = 16;
+		CacheShard s_Shards[NumShards];
+
+		std::atomic<uint32_t> s_CachedSamples = 0;
+		std::atomic<uint32_t> s_Hits = 0;
+		std::atomic<uint32_t> s_Misses = 0;
+		Statistics s_LastFrameStatistics;
+
+		thread_local DecompressionContext s_Context;
+		thread_local const std::vector<bool>* s_SkippedBones = nullptr;
+
+
+		// ACL still unpacks tracks four at a time, skipped tracks save their conversion and store to the pose
+		struct SkippingPoseTrackWriter : public PoseTrackWriter
+		{
+			SkippingPoseTrackWriter(Pose* pose, const std::vector<bool>& skippedBones) : PoseTrackWriter(pose), m_SkippedBones(skippedBones) {}
+
+			bool skip_track_rotation(uint32_t track_index) const { return IsSkipped(track_index); }
+			bool skip_track_translation(uint32_t track_index) const { return IsSkipped(track_index); }
+			bool skip_track_scale(uint32_t track_index) const { return track_index == 0 || IsSkipped(track_index); }
+
+		private:
+			bool IsSkipped(uint32_t track_index) const { return track_index > 0 && track_index - 1 < m_SkippedBones.size() && m_SkippedBones[track_index - 1]; }
+
+			const std::vector<bool>& m_SkippedBones;
+		};
+
+
+		void Decompress(DecompressionContext& context, const Animation* animation, const float time, Pose* pose, const std::vector<bool>* skippedBones)
+		{
+			const auto& tracks = *static_cast<const acl::compressed_tracks*>(animation->GetData());
+			if (!context.is_bound_to(tracks))
+				context.initialize(tracks);
+
+			context.seek(time, acl::sample_rounding_policy::none);
+			if (skippedBones)
+			{
+				SkippingPoseTrackWriter writer(pose, *skippedBones);
+				context.decompress_tracks(writer);
+			}
+			else
+			{
+				PoseTrackWriter writer(pose);
+				context.decompress_tracks(writer);
+			}
+		}
+
+
+		// Same tracks as PoseTrackWriter writes, i.e. everything but the scale of the root motion track
+		void CopyTracks(const LocalTransform* source, LocalTransform* destination, const uint32_t numTracks)
+		{
+			destination[0].Translation = source[0].Translation;
+			destination[0].Rotation = source[0].Rotation;
+			std::copy(source + 1, source + numTracks, destination + 1);
+		}
+
+	}
+
+
+	void Sample(const Animation* animation, const float sampleTime, Pose* pose)
+	{
+		BEY_PROFILE_FUNC();
+
+		const uint32_t numTracks = glm::min(animation->GetNumTracks(), Animation::MAXBONES);
+		const float duration = animation->GetDuration();
+		const int32_t sampleIndex = (int32_t)glm::round(glm::clamp(sampleTime, 0.0f, duration) / SampleTimeQuantum);
+		const SampleKey key = { animation, sampleIndex, s_SkippedBones };
+
+		CacheShard& shard = s_Shards[SampleKeyHash()(key) % NumShards];
+		{
+			std::scoped_lock lock(shard.Mutex);
+			if (auto it = shard.Lookup.find(key); it != shard.Lookup.end())
+			{
+				CopyTracks(shard.Samples[it->second].data(), pose->BoneTransforms.data(), numTracks);
+				s_Hits.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+		}
+
+		// Decompressing outside of the lock, another thread might be doing the same sample at the same time.  That's fine, only one of them gets cached.
+		s_Misses.fetch_add(1, std::memory_order_relaxed);
+		Decompress(s_Context, animation, glm::min((float)sampleIndex * SampleTimeQuantum, duration), pose, s_SkippedBones);
+
+		if (s_CachedSamples.load(std::memory_order_relaxed) >= MaxCachedSamples)
+			return;
+
+		std::scoped_lock lock(shard.Mutex);
+		if (shard.Lookup.contains(key))
+			return;
+
+		if (shard.NumSamples == shard.Samples.size())
+			shard.Samples.emplace_back();
+
+		shard.Samples[shard.NumSamples].assign(pose->BoneTransforms.data(), pose->BoneTransforms.data() + numTracks);
+		shard.Lookup.emplace(key, shard.NumSamples++);
+		s_CachedSamples.fetch_add(1, std::memory_order_relaxed);
+	}
+
+
+	SkippedBonesScope::SkippedBonesScope(const std::vector<bool>* skippedBones)
+		: m_Previous(s_SkippedBones)
+	{
+		s_SkippedBones = skippedBones;
+	}
+
+
+	SkippedBonesScope::~SkippedBonesScope()
+	{
+		s_SkippedBones = m_Previous;
+	}
+
+
+	void NewFrame()
+	{
+		BEY_PROFILE_FUNC();
+
+		s_LastFrameStatistics.Hits = s_Hits.exchange(0);
+		s_LastFrameStatistics.Misses = s_Misses.exchange(0);
+		s_LastFrameStatistics.CachedSamples = s_CachedSamples.exchange(0);
+
+		for (CacheShard& shard : s_Shards)
+		{
+			std::scoped_lock lock(shard.Mutex);
+			shard.Lookup.clear();
+			shard.NumSamples = 0;
+		}
+	}
+
+
+	Statistics GetStatistics()
+	{
+		return s_LastFrameStatistics;
+	}
+
+}
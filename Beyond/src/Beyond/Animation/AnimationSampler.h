@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Animation.h"
+
+namespace Beyond::AnimationSampler {
+
+	// Decompresses the animation clip at the given time (in seconds) into pose->BoneTransforms[0, animation->GetNumTracks()).
+	// Scale of track 0 (root motion) is left as it is.
+	//
+	// Sample time is quantized to SampleTimeQuantum, and samples are cached for the rest of the frame keyed by (clip, quantized time),
+	// so characters playing the same clip in step decompress it only once.
+	// Decompression contexts are pooled, one per thread, rather than owned by every node of every graph instance.
+	// Safe to call from any number of threads.
+	void Sample(const Animation* animation, const float sampleTime, Pose* pose);
+
+	// Leaves bones out of the samples taken on this thread for as long as the scope is alive, e.g. the leaf bones of far away characters.
+	// skippedBones[i] is for bone i, i.e. track i + 1, root motion is always sampled. The skipped tracks aren't decompressed and
+	// hold nothing meaningful afterwards. Samples taken with a mask are cached apart from the full ones, keyed by the mask's address,
+	// so it has to outlive the frame (Skeleton::GetLeafBones() does).
+	class SkippedBonesScope
+	{
+	public:
+		explicit SkippedBonesScope(const std::vector<bool>* skippedBones);
+		~SkippedBonesScope();
+
+		SkippedBonesScope(const SkippedBonesScope&) = delete;
+		SkippedBonesScope& operator=(const SkippedBonesScope&) = delete;
+
+	private:
+		const std::vector<bool>* m_Previous;
+	};
+
+	// Throws away the samples cached so far.  Called once per frame, before any of the graphs are processed.
+	void NewFrame();
+
+	struct Statistics
+	{
+		uint32_t Hits = 0;
+		uint32_t Misses = 0;
+		uint32_t CachedSamples = 0;
+	};
+
+	// Cache statistics of the last frame
+	Statistics GetStatistics();
+
+	constexpr float SampleTimeQuantum = 1.0f / 240.0f;
+	constexpr uint32_t MaxCachedSamples = 1024;
+
+}
@@ -2,6 +2,7 @@
 #include "AnimationNodes.h"
 
 #include "Beyond/Animation/Animation.h"
+#include "Beyond/Animation/AnimationSampler.h"
 #include "Beyond/Asset/AssetManager.h"
 #include "Beyond/Debug/Profiler.h"
 
@@ -9,7 +10,6 @@ namespace Beyond::AnimationGraph {
 
 	AnimationPlayer::AnimationPlayer(const char* dbgName, UUID id)
 	: NodeProcessor(dbgName, id)
-	, m_TrackWriter(static_cast<Pose*>(out_Pose.getRawData()))
 	{
 		EndpointUtilities::RegisterEndpoints(this);
 	}
@@ -46,7 +46,6 @@ namespace Beyond::AnimationGraph {
 			}
 			if (m_Animation)
 			{
-				context.initialize(*static_cast<const acl::compressed_tracks*>(m_Animation->GetData()));
 				m_RootTranslationStart = m_Animation->GetRootTranslationStart();
 				m_RootRotationStart = m_Animation->GetRootRotationStart();
 				m_RootTranslationEnd = m_Animation->GetRootTranslationEnd();
@@ -108,8 +107,7 @@ namespace Beyond::AnimationGraph {
 				}
 			}
 
-			context.seek(m_AnimationTimePos * pose->AnimationDuration, acl::sample_rounding_policy::none);
-			context.decompress_tracks(m_TrackWriter);
+			AnimationSampler::Sample(m_Animation, m_AnimationTimePos * pose->AnimationDuration, pose);
 
 			// Work out root motion by looking at change in pose of root bone.
 			// Bear in mind some tricky cases:
@@ -166,7 +164,6 @@ namespace Beyond::AnimationGraph {
 
 	SampleAnimation::SampleAnimation(const char* dbgName, UUID id)
 	: NodeProcessor(dbgName, id)
-	, m_TrackWriter(static_cast<Pose*>(out_Pose.getRawData()))
 	{
 		EndpointUtilities::RegisterEndpoints(this);
 	}
@@ -199,7 +196,6 @@ namespace Beyond::AnimationGraph {
 			}
 			if (m_Animation)
 			{
-				context.initialize(*static_cast<const acl::compressed_tracks*>(m_Animation->GetData()));
 				pose->AnimationDuration = m_Animation->GetDuration();
 				pose->NumBones = m_Animation->GetNumTracks();
 			}
@@ -209,8 +205,7 @@ namespace Beyond::AnimationGraph {
 		float timePos = glm::clamp(*in_Ratio, 0.0f, 1.0f);
 		if (m_Animation)
 		{
-			context.seek(timePos * pose->AnimationDuration, acl::sample_rounding_policy::none);
-			context.decompress_tracks(m_TrackWriter);
+			AnimationSampler::Sample(m_Animation, timePos * pose->AnimationDuration, pose);
 		}
 		pose->AnimationTimePos = timePos;
 		return 0.0f;
@@ -2,9 +2,7 @@
 #include "Beyond/Animation/Animation.h"
 #include "Beyond/Animation/NodeDescriptor.h"
 #include "Beyond/Animation/NodeProcessor.h"
-#include "Beyond/Animation/PoseTrackWriter.h"
 
-#include <acl/decompression/decompress.h>
 #include <glm/glm.hpp>
 
 #define DECLARE_ID(name) static constexpr Identifier name{ #name }
@@ -47,9 +45,6 @@ namespace Beyond::AnimationGraph {
 		OutputEvent out_OnLoop;
 
 	private:
-		PoseTrackWriter m_TrackWriter;
-		acl::decompression_context<acl::default_transform_decompression_settings> context;
-
 		glm::vec3 m_RootTranslationStart;
 		glm::vec3 m_RootTranslationEnd;
 		glm::quat m_RootRotationStart;
@@ -86,9 +81,6 @@ namespace Beyond::AnimationGraph {
 		choc::value::Value out_Pose = choc::value::Value(PoseType);
 
 	private:
-		PoseTrackWriter m_TrackWriter;
-		acl::decompression_context<acl::default_transform_decompression_settings> context;
-
 		AssetHandle m_PreviousAnimation = 0;
 		const Beyond::Animation* m_Animation = nullptr;
 	};
@@ -2,6 +2,8 @@
 #include "BlendNodes.h"
 
 #include "Beyond/Animation/Animation.h"
+#include "Beyond/Animation/AnimationSampler.h"
+#include "Beyond/Animation/PoseBlending.h"
 #include "Beyond/Asset/AssetManager.h"
 #include "Beyond/Debug/Profiler.h"
 
@@ -10,45 +12,45 @@
 namespace Beyond::AnimationGraph {
 
 
-	void BlendBoneTransforms(const Pose* pose0, const Pose* pose1, const float w, const Skeleton* skeleton, const uint32_t blendRootBone, Pose* result)
+	// Bones that are blended: all of the bones if blendRootBone is 0, otherwise blendRootBone and its descendants.
+	// Returns [first, last) range of the bones in pose order.
+	std::pair<uint32_t, uint32_t> GetBlendedBones(const Skeleton* skeleton, const uint32_t blendRootBone, const uint32_t N)
 	{
-		BEY_CORE_ASSERT(pose0->NumBones == pose1->NumBones, "Poses have different number of bones");
-
-		uint32_t i = 0;
-		uint32_t N = glm::min(pose0->NumBones, pose1->NumBones);
-
 		if (blendRootBone == 0)
-		{
-			for (; i < N; ++i)
-			{
-				result->BoneTransforms[i].Translation = glm::mix(pose0->BoneTransforms[i].Translation, pose1->BoneTransforms[i].Translation, w);
-				result->BoneTransforms[i].Rotation = glm::slerp(pose0->BoneTransforms[i].Rotation, pose1->BoneTransforms[i].Rotation, w);
-				result->BoneTransforms[i].Scale = glm::mix(pose0->BoneTransforms[i].Scale, pose1->BoneTransforms[i].Scale, w);
-			}
-			return;
-		}
-
-		for (; i < blendRootBone; ++i)
-		{
-			result->BoneTransforms[i] = pose0->BoneTransforms[i];
-		}
+			return { 0, N };
 
 		uint32_t parentBoneIndex = skeleton->GetParentBoneIndex(blendRootBone - 1) + 1;
 
+		uint32_t i = blendRootBone;
 		for (; i < N; ++i)
 		{
-			if ((skeleton->GetParentBoneIndex(i-1) + 1 <= parentBoneIndex) && (i > blendRootBone))
+			if ((skeleton->GetParentBoneIndex(i - 1) + 1 <= parentBoneIndex) && (i > blendRootBone))
 				break;
-
-			result->BoneTransforms[i].Translation = glm::mix(pose0->BoneTransforms[i].Translation, pose1->BoneTransforms[i].Translation, w);
-			result->BoneTransforms[i].Rotation = glm::slerp(pose0->BoneTransforms[i].Rotation, pose1->BoneTransforms[i].Rotation, w);
-			result->BoneTransforms[i].Scale = glm::mix(pose0->BoneTransforms[i].Scale, pose1->BoneTransforms[i].Scale, w);
 		}
+		return { glm::min(blendRootBone, N), glm::min(i, N) };
+	}
 
-		for (; i < N; ++i)
-		{
-			result->BoneTransforms[i] = pose0->BoneTransforms[i];
-		}
+
+	// Bones outside of the blended range are copied from pose0
+	void CopyUnblendedBones(const Pose* pose0, const uint32_t first, const uint32_t last, const uint32_t N, Pose* result)
+	{
+		if (result == pose0)
+			return;
+
+		std::copy_n(pose0->BoneTransforms.begin(), first, result->BoneTransforms.begin());
+		std::copy(pose0->BoneTransforms.begin() + last, pose0->BoneTransforms.begin() + N, result->BoneTransforms.begin() + last);
+	}
+
+
+	void BlendBoneTransforms(const Pose* pose0, const Pose* pose1, const float w, const Skeleton* skeleton, const uint32_t blendRootBone, Pose* result)
+	{
+		BEY_CORE_ASSERT(pose0->NumBones == pose1->NumBones, "Poses have different number of bones");
+
+		uint32_t N = glm::min(pose0->NumBones, pose1->NumBones);
+		const auto [first, last] = GetBlendedBones(skeleton, blendRootBone, N);
+
+		CopyUnblendedBones(pose0, first, last, N, result);
+		PoseBlending::Blend(&pose0->BoneTransforms[first], &pose1->BoneTransforms[first], w, &result->BoneTransforms[first], last - first);
 	}
 
 
@@ -64,52 +66,29 @@ namespace Beyond::AnimationGraph {
 	{
 		BEY_CORE_ASSERT(pose0->NumBones == pose1->NumBones, "Poses have different number of bones");
 
-		uint32_t i = 0;
 		uint32_t N = glm::min(pose0->NumBones, pose1->NumBones);
+		auto [first, last] = GetBlendedBones(skeleton, blendRootBone, N);
 
-		if (blendRootBone == 0)
-		{
-			result->BoneTransforms[i].Translation = pose0->BoneTransforms[i].Translation + w * pose1->BoneTransforms[i].Translation;
-			glm::quat weightedRotation = glm::slerp(glm::identity<glm::quat>(), pose1->BoneTransforms[i].Rotation, w);
-			result->BoneTransforms[i].Rotation = pose0->BoneTransforms[i].Rotation * weightedRotation;
-			result->BoneTransforms[i].Scale = pose0->BoneTransforms[i].Scale + w * (pose1->BoneTransforms[i].Scale - glm::one<glm::vec3>());
-			++i;
-			for (; i < N; ++i)
-			{
-				// result is pose0 + w(pose1 - restPose)
-				result->BoneTransforms[i].Translation = pose0->BoneTransforms[i].Translation + w * (pose1->BoneTransforms[i].Translation - skeleton->GetBoneTranslations().at(i-1));
-				glm::quat restRotation = skeleton->GetBoneRotations().at(i - 1);
-				glm::quat weightedRotation = glm::slerp(restRotation, pose1->BoneTransforms[i].Rotation, w);
-				result->BoneTransforms[i].Rotation = pose0->BoneTransforms[i].Rotation * glm::conjugate(restRotation) * weightedRotation;
-				result->BoneTransforms[i].Scale = pose0->BoneTransforms[i].Scale + w * (pose1->BoneTransforms[i].Scale - skeleton->GetBoneScales().at(i-1));
-			}
-			return;
-		}
+		CopyUnblendedBones(pose0, first, last, N, result);
 
-		for (; i < blendRootBone; ++i)
+		if (first == 0 && last > 0)
 		{
-			result->BoneTransforms[i] = pose0->BoneTransforms[i];
+			// Artificial root bone at index 0 has identity rest pose
+			static const glm::vec3 zero = glm::zero<glm::vec3>();
+			static const glm::quat identity = glm::identity<glm::quat>();
+			static const glm::vec3 one = glm::one<glm::vec3>();
+			PoseBlending::AdditiveBlend(&pose0->BoneTransforms[0], &pose1->BoneTransforms[0], &zero, &identity, &one, w, &result->BoneTransforms[0], 1);
+			++first;
 		}
 
-		uint32_t parentBoneIndex = skeleton->GetParentBoneIndex(blendRootBone - 1) + 1;
-
-		for (; i < N; ++i)
-		{
-			if ((skeleton->GetParentBoneIndex(i - 1) + 1 <= parentBoneIndex) && (i > blendRootBone))
-				break;
-
-			// result is pose0 + w(pose1 - restPose)
-			result->BoneTransforms[i].Translation = pose0->BoneTransforms[i].Translation + w * (pose1->BoneTransforms[i].Translation - skeleton->GetBoneTranslations().at(i - 1));
-			glm::quat restRotation = skeleton->GetBoneRotations().at(i - 1);
-			glm::quat weightedRotation = glm::slerp(restRotation, pose1->BoneTransforms[i].Rotation, w);
-			result->BoneTransforms[i].Rotation = pose0->BoneTransforms[i].Rotation * glm::conjugate(restRotation) * weightedRotation;
-			result->BoneTransforms[i].Scale = pose0->BoneTransforms[i].Scale + w * (pose1->BoneTransforms[i].Scale - skeleton->GetBoneScales().at(i - 1));
-		}
+		if (first >= last)
+			return;
 
-		for (; i < N; ++i)
-		{
-			result->BoneTransforms[i] = pose0->BoneTransforms[i];
-		}
+		// result is pose0 + w(pose1 - restPose)
+		// Note: skeleton bone i - 1 is pose bone i
+		PoseBlending::AdditiveBlend(&pose0->BoneTransforms[first], &pose1->BoneTransforms[first],
+			&skeleton->GetBoneTranslations()[first - 1], &skeleton->GetBoneRotations()[first - 1], &skeleton->GetBoneScales()[first - 1],
+			w, &result->BoneTransforms[first], last - first);
 	}
 
 
@@ -123,7 +102,6 @@ namespace Beyond::AnimationGraph {
 
 	BlendSpaceVertex::BlendSpaceVertex(const char* dbgName, UUID id)
 	: NodeProcessor(dbgName, id)
-	, m_TrackWriter(static_cast<Pose*>(out_Pose.getRawData()))
 	{
 		// Inputs
 		EndpointUtilities::RegisterEndpoints(this);
@@ -155,7 +133,6 @@ namespace Beyond::AnimationGraph {
 			}
 			if (m_Animation)
 			{
-				context.initialize(*static_cast<const acl::compressed_tracks*>(m_Animation->GetData()));
 				m_RootTranslationStart = m_Animation->GetRootTranslationStart();
 				m_RootRotationStart = m_Animation->GetRootRotationStart();
 				m_RootTranslationEnd = m_Animation->GetRootTranslationEnd();
@@ -200,8 +177,7 @@ namespace Beyond::AnimationGraph {
 			m_AnimationTimePos += timestep / m_Animation->GetDuration();
 			m_AnimationTimePos -= floorf(m_AnimationTimePos);
 
-			context.seek(m_AnimationTimePos * pose->AnimationDuration, acl::sample_rounding_policy::none);
-			context.decompress_tracks(m_TrackWriter);
+			AnimationSampler::Sample(m_Animation, m_AnimationTimePos * pose->AnimationDuration, pose);
 
 			// Work out root motion by looking at change in pose of root bone.
 			glm::vec3 newRootTranslation = pose->BoneTransforms[0].Translation;
@@ -595,12 +571,9 @@ namespace Beyond::AnimationGraph {
 		BEY_CORE_ASSERT((poseA->NumBones == poseB->NumBones) && (poseA->NumBones == poseC->NumBones), "Poses have different number of bones");
 
 		auto v1 = v / (u + v);
-		for (uint32_t i = 0, N = glm::min(glm::min(poseA->NumBones, poseB->NumBones), poseC->NumBones); i < N; i++)
-		{
-			result->BoneTransforms[i].Translation = glm::mix(glm::mix(poseA->BoneTransforms[i].Translation, poseB->BoneTransforms[i].Translation, v1), poseC->BoneTransforms[i].Translation, w);
-			result->BoneTransforms[i].Rotation = glm::slerp(glm::slerp(poseA->BoneTransforms[i].Rotation, poseB->BoneTransforms[i].Rotation, v1), poseC->BoneTransforms[i].Rotation, w);
-			result->BoneTransforms[i].Scale = glm::mix(glm::mix(poseA->BoneTransforms[i].Scale, poseB->BoneTransforms[i].Scale, v1), poseC->BoneTransforms[i].Scale, w);
-		}
+		const uint32_t N = glm::min(glm::min(poseA->NumBones, poseB->NumBones), poseC->NumBones);
+		PoseBlending::Blend(poseA->BoneTransforms.data(), poseB->BoneTransforms.data(), v1, result->BoneTransforms.data(), N);
+		PoseBlending::Blend(result->BoneTransforms.data(), poseC->BoneTransforms.data(), w, result->BoneTransforms.data(), N);
 		result->RootMotion.Translation = glm::mix(glm::mix(poseA->RootMotion.Translation, poseB->RootMotion.Translation, v1), poseC->RootMotion.Translation, w);
 		result->RootMotion.Rotation = glm::slerp(glm::slerp(poseA->RootMotion.Rotation, poseB->RootMotion.Rotation, v1), poseC->RootMotion.Rotation, w);
 		result->RootMotion.Scale = glm::mix(glm::mix(poseA->RootMotion.Scale, poseB->RootMotion.Scale, v1), poseC->RootMotion.Scale, w);
@@ -1075,8 +1048,6 @@ namespace Beyond::AnimationGraph {
 
 	RangedBlend::RangedBlend(const char* dbgName, UUID id)
 	: NodeProcessor(dbgName, id)
-	, m_TrackWriterA(static_cast<Pose*>(&m_PoseA))
-	, m_TrackWriterB(static_cast<Pose*>(&m_PoseB))
 	{
 		EndpointUtilities::RegisterEndpoints(this);
 	}
@@ -1115,7 +1086,6 @@ namespace Beyond::AnimationGraph {
 			}
 			if (m_AnimationA)
 			{
-				contextA.initialize(*static_cast<const acl::compressed_tracks*>(m_AnimationA->GetData()));
 				m_RootTranslationStartA = m_AnimationA->GetRootTranslationStart();
 				m_RootRotationStartA = m_AnimationA->GetRootRotationStart();
 				m_RootTranslationEndA = m_AnimationA->GetRootTranslationEnd();
@@ -1139,7 +1109,6 @@ namespace Beyond::AnimationGraph {
 			}
 			if (m_AnimationB)
 			{
-				contextB.initialize(*static_cast<const acl::compressed_tracks*>(m_AnimationB->GetData()));
 				m_RootTranslationStartB = m_AnimationB->GetRootTranslationStart();
 				m_RootRotationStartB = m_AnimationB->GetRootRotationStart();
 				m_RootTranslationEndB = m_AnimationB->GetRootTranslationEnd();
@@ -1212,8 +1181,7 @@ namespace Beyond::AnimationGraph {
 			glm::vec3 previousRootTranslationA = m_PoseA.BoneTransforms[0].Translation;
 			glm::quat previousRootRotationA = m_PoseA.BoneTransforms[0].Rotation;
 
-			contextA.seek(m_AnimationTimePosA* m_PoseA.AnimationDuration, acl::sample_rounding_policy::none);
-			contextA.decompress_tracks(m_TrackWriterA);
+			AnimationSampler::Sample(m_AnimationA, m_AnimationTimePosA * m_PoseA.AnimationDuration, &m_PoseA);
 
 			// Work out root motion by looking at change in pose of root bone.
 			// Bear in mind some tricky cases:
@@ -1297,8 +1265,7 @@ namespace Beyond::AnimationGraph {
 			glm::vec3 previousRootTranslationB = m_PoseB.BoneTransforms[0].Translation;
 			glm::quat previousRootRotationB = m_PoseB.BoneTransforms[0].Rotation;
 
-			contextB.seek(m_AnimationTimePosB * m_PoseB.AnimationDuration, acl::sample_rounding_policy::none);
-			contextB.decompress_tracks(m_TrackWriterB);
+			AnimationSampler::Sample(m_AnimationB, m_AnimationTimePosB * m_PoseB.AnimationDuration, &m_PoseB);
 
 			// Work out root motion by looking at change in pose of root bone.
 			// Bear in mind some tricky cases:
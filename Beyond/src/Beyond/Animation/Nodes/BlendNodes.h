@@ -2,9 +2,7 @@
 #include "Beyond/Animation/Animation.h"
 #include "Beyond/Animation/AnimationGraph.h"
 #include "Beyond/Animation/NodeDescriptor.h"
-#include "Beyond/Animation/PoseTrackWriter.h"
 
-#include <acl/decompression/decompress.h>
 #include <CDT/CDT.h>
 #include <glm/glm.hpp>
 
@@ -41,9 +39,6 @@ namespace Beyond::AnimationGraph {
 		float Y = 0.0f;
 
 	private:
-		PoseTrackWriter m_TrackWriter;
-		acl::decompression_context<acl::default_transform_decompression_settings> context;
-
 		glm::vec3 m_RootTranslationStart;
 		glm::vec3 m_RootTranslationEnd;
 		glm::quat m_RootRotationStart;
@@ -265,12 +260,6 @@ namespace Beyond::AnimationGraph {
 		Pose m_PoseA;
 		Pose m_PoseB;
 
-		PoseTrackWriter m_TrackWriterA;
-		acl::decompression_context<acl::default_transform_decompression_settings> contextA;
-
-		PoseTrackWriter m_TrackWriterB;
-		acl::decompression_context<acl::default_transform_decompression_settings> contextB;
-
 		glm::vec3 m_RootTranslationStartA;
 		glm::vec3 m_RootTranslationEndA;
 		glm::quat m_RootRotationStartA;
@@ -2,6 +2,8 @@
 #include "StateMachineNodes.h"
 
 #include "Beyond/Animation/Animation.h"
+#include "Beyond/Animation/AnimationSampler.h"
+#include "Beyond/Animation/PoseBlending.h"
 #include "Beyond/Asset/AssetManager.h"
 #include "Beyond/Debug/Profiler.h"
 
@@ -87,12 +89,7 @@ namespace Beyond::AnimationGraph {
 		BEY_CORE_ASSERT(poseA->NumBones == poseB->NumBones, "Poses have different number of bones");
 
 		Pose* result = static_cast<Pose*>(out_Pose.getRawData());
-		for (uint32_t i = 0, N = glm::min(poseA->NumBones, poseB->NumBones); i < N; i++)
-		{
-			result->BoneTransforms[i].Translation = glm::mix(poseA->BoneTransforms[i].Translation, poseB->BoneTransforms[i].Translation, w);
-			result->BoneTransforms[i].Rotation = glm::slerp(poseA->BoneTransforms[i].Rotation, poseB->BoneTransforms[i].Rotation, w);
-			result->BoneTransforms[i].Scale = glm::mix(poseA->BoneTransforms[i].Scale, poseB->BoneTransforms[i].Scale, w);
-		}
+		PoseBlending::Blend(poseA->BoneTransforms.data(), poseB->BoneTransforms.data(), w, result->BoneTransforms.data(), glm::min(poseA->NumBones, poseB->NumBones));
 		result->RootMotion.Translation = glm::mix(poseA->RootMotion.Translation, poseB->RootMotion.Translation, w);
 		result->RootMotion.Rotation = glm::slerp(poseA->RootMotion.Rotation, poseB->RootMotion.Rotation, w);
 		result->RootMotion.Scale = glm::mix(poseA->RootMotion.Scale, poseB->RootMotion.Scale, w);
@@ -290,7 +287,6 @@ namespace Beyond::AnimationGraph {
 
 	QuickState::QuickState(std::string_view dbgName, UUID id)
 	: StateBase(dbgName, id)
-	, m_TrackWriter(static_cast<Pose*>(out_Pose.getRawData()))
 	{
 		EndpointUtilities::RegisterEndpoints(this);
 	}
@@ -330,7 +326,6 @@ namespace Beyond::AnimationGraph {
 			}
 			if (m_Animation)
 			{
-				context.initialize(*static_cast<const acl::compressed_tracks*>(m_Animation->GetData()));
 				m_RootTranslationStart = m_Animation->GetRootTranslationStart();
 				m_RootRotationStart = m_Animation->GetRootRotationStart();
 				m_RootTranslationEnd = m_Animation->GetRootTranslationEnd();
@@ -354,8 +349,7 @@ namespace Beyond::AnimationGraph {
 			m_AnimationTimePos += timestep / m_Animation->GetDuration();
 			m_AnimationTimePos -= floorf(m_AnimationTimePos);
 
-			context.seek(m_AnimationTimePos * pose->AnimationDuration, acl::sample_rounding_policy::none);
-			context.decompress_tracks(m_TrackWriter);
+			AnimationSampler::Sample(m_Animation, m_AnimationTimePos * pose->AnimationDuration, pose);
 
 			// Work out root motion by looking at change in pose of root bone.
 			// Bear in mind some tricky cases:
@@ -3,9 +3,7 @@
 #include "Beyond/Animation/Animation.h"
 #include "Beyond/Animation/AnimationGraph.h"
 #include "Beyond/Animation/NodeDescriptor.h"
-#include "Beyond/Animation/PoseTrackWriter.h"
 
-#include <acl/decompression/decompress.h>
 #include <glm/glm.hpp>
 
 #define DECLARE_ID(name) static constexpr Identifier name{ #name }
@@ -179,9 +177,6 @@ namespace Beyond::AnimationGraph {
 		inline static int64_t DefaultAnimation = 0;
 
 	private:
-		PoseTrackWriter m_TrackWriter;
-		acl::decompression_context<acl::default_transform_decompression_settings> context;
-
 		glm::vec3 m_RootTranslationStart;
 		glm::vec3 m_RootTranslationEnd;
 		glm::quat m_RootRotationStart;
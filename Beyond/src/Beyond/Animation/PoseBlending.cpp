@@ -0,0 +1,199 @@
+#include "pch.h"
+#include "PoseBlending.h"
+
+#include <rtm/macros.h>
+#include <rtm/vector4f.h>
+
+#include <glm/gtc/type_ptr.hpp>
+
+namespace Beyond::PoseBlending {
+
+	namespace {
+
+		// Four bone transforms, transposed so that each register holds one component of all four bones
+		struct BoneLanes
+		{
+			rtm::vector4f TX, TY, TZ;
+			rtm::vector4f QX, QY, QZ, QW;
+			rtm::vector4f SX, SY, SZ;
+		};
+
+
+		RTM_FORCE_INLINE void LoadLanes(const LocalTransform* bones, BoneLanes& lanes)
+		{
+			const rtm::vector4f t0 = rtm::vector_load3(glm::value_ptr(bones[0].Translation));
+			const rtm::vector4f t1 = rtm::vector_load3(glm::value_ptr(bones[1].Translation));
+			const rtm::vector4f t2 = rtm::vector_load3(glm::value_ptr(bones[2].Translation));
+			const rtm::vector4f t3 = rtm::vector_load3(glm::value_ptr(bones[3].Translation));
+			RTM_MATRIXF_TRANSPOSE_4X3(t0, t1, t2, t3, lanes.TX, lanes.TY, lanes.TZ);
+
+			const rtm::vector4f q0 = rtm::vector_load(glm::value_ptr(bones[0].Rotation));
+			const rtm::vector4f q1 = rtm::vector_load(glm::value_ptr(bones[1].Rotation));
+			const rtm::vector4f q2 = rtm::vector_load(glm::value_ptr(bones[2].Rotation));
+			const rtm::vector4f q3 = rtm::vector_load(glm::value_ptr(bones[3].Rotation));
+			RTM_MATRIXF_TRANSPOSE_4X4(q0, q1, q2, q3, lanes.QX, lanes.QY, lanes.QZ, lanes.QW);
+
+			const rtm::vector4f s0 = rtm::vector_load3(glm::value_ptr(bones[0].Scale));
+			const rtm::vector4f s1 = rtm::vector_load3(glm::value_ptr(bones[1].Scale));
+			const rtm::vector4f s2 = rtm::vector_load3(glm::value_ptr(bones[2].Scale));
+			const rtm::vector4f s3 = rtm::vector_load3(glm::value_ptr(bones[3].Scale));
+			RTM_MATRIXF_TRANSPOSE_4X3(s0, s1, s2, s3, lanes.SX, lanes.SY, lanes.SZ);
+		}
+
+
+		RTM_FORCE_INLINE void StoreLanes(const BoneLanes& lanes, LocalTransform* bones)
+		{
+			rtm::vector4f b0, b1, b2, b3;
+
+			RTM_MATRIXF_TRANSPOSE_3X4(lanes.TX, lanes.TY, lanes.TZ, b0, b1, b2, b3);
+			rtm::vector_store3(b0, glm::value_ptr(bones[0].Translation));
+			rtm::vector_store3(b1, glm::value_ptr(bones[1].Translation));
+			rtm::vector_store3(b2, glm::value_ptr(bones[2].Translation));
+			rtm::vector_store3(b3, glm::value_ptr(bones[3].Translation));
+
+			RTM_MATRIXF_TRANSPOSE_4X4(lanes.QX, lanes.QY, lanes.QZ, lanes.QW, b0, b1, b2, b3);
+			rtm::vector_store(b0, glm::value_ptr(bones[0].Rotation));
+			rtm::vector_store(b1, glm::value_ptr(bones[1].Rotation));
+			rtm::vector_store(b2, glm::value_ptr(bones[2].Rotation));
+			rtm::vector_store(b3, glm::value_ptr(bones[3].Rotation));
+
+			RTM_MATRIXF_TRANSPOSE_3X4(lanes.SX, lanes.SY, lanes.SZ, b0, b1, b2, b3);
+			rtm::vector_store3(b0, glm::value_ptr(bones[0].Scale));
+			rtm::vector_store3(b1, glm::value_ptr(bones[1].Scale));
+			rtm::vector_store3(b2, glm::value_ptr(bones[2].Scale));
+			rtm::vector_store3(b3, glm::value_ptr(bones[3].Scale));
+		}
+
+
+		// Normalized lerp of four rotations from (ax, ay, az, aw) to (bx, by, bz, bw), along the shortest path
+		RTM_FORCE_INLINE void RTM_SIMD_CALL NLerpLanes(rtm::vector4f_arg0 ax, rtm::vector4f_arg1 ay, rtm::vector4f_arg2 az, rtm::vector4f_arg3 aw,
+		                                                rtm::vector4f_arg4 bx, rtm::vector4f_arg5 by, rtm::vector4f_arg6 bz, rtm::vector4f_arg7 bw,
+		                                                const float w, rtm::vector4f& x, rtm::vector4f& y, rtm::vector4f& z, rtm::vector4f& qw)
+		{
+			const rtm::vector4f dot = rtm::vector_mul_add(aw, bw, rtm::vector_mul_add(az, bz, rtm::vector_mul_add(ay, by, rtm::vector_mul(ax, bx))));
+
+			// Negate the weight of b where the rotations are more than 180 degrees apart
+			const rtm::vector4f weightA = rtm::vector_set(1.0f - w);
+			const rtm::vector4f weightB = rtm::vector_select(rtm::vector_less_than(dot, rtm::vector_zero()), rtm::vector_set(-w), rtm::vector_set(w));
+
+			x = rtm::vector_mul_add(bx, weightB, rtm::vector_mul(ax, weightA));
+			y = rtm::vector_mul_add(by, weightB, rtm::vector_mul(ay, weightA));
+			z = rtm::vector_mul_add(bz, weightB, rtm::vector_mul(az, weightA));
+			qw = rtm::vector_mul_add(bw, weightB, rtm::vector_mul(aw, weightA));
+
+			const rtm::vector4f lengthSquared = rtm::vector_mul_add(qw, qw, rtm::vector_mul_add(z, z, rtm::vector_mul_add(y, y, rtm::vector_mul(x, x))));
+			const rtm::vector4f inverseLength = rtm::vector_div(rtm::vector_set(1.0f), rtm::vector_sqrt(lengthSquared));
+			x = rtm::vector_mul(x, inverseLength);
+			y = rtm::vector_mul(y, inverseLength);
+			z = rtm::vector_mul(z, inverseLength);
+			qw = rtm::vector_mul(qw, inverseLength);
+		}
+
+
+		// Same as NLerpLanes(), for the bones that don't fill a whole set of lanes
+		glm::quat NLerp(const glm::quat& a, const glm::quat& b, const float w)
+		{
+			const float weightB = glm::dot(a, b) < 0.0f ? -w : w;
+			return glm::normalize(a * (1.0f - w) + b * weightB);
+		}
+
+	}
+
+
+	void Blend(const LocalTransform* pose0, const LocalTransform* pose1, const float w, LocalTransform* result, const uint32_t count)
+	{
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			BoneLanes a, b;
+			LoadLanes(pose0 + i, a);
+			LoadLanes(pose1 + i, b);
+
+			BoneLanes r;
+			r.TX = rtm::vector_lerp(a.TX, b.TX, w);
+			r.TY = rtm::vector_lerp(a.TY, b.TY, w);
+			r.TZ = rtm::vector_lerp(a.TZ, b.TZ, w);
+			NLerpLanes(a.QX, a.QY, a.QZ, a.QW, b.QX, b.QY, b.QZ, b.QW, w, r.QX, r.QY, r.QZ, r.QW);
+			r.SX = rtm::vector_lerp(a.SX, b.SX, w);
+			r.SY = rtm::vector_lerp(a.SY, b.SY, w);
+			r.SZ = rtm::vector_lerp(a.SZ, b.SZ, w);
+
+			StoreLanes(r, result + i);
+		}
+
+		for (; i < count; ++i)
+		{
+			result[i].Translation = glm::mix(pose0[i].Translation, pose1[i].Translation, w);
+			result[i].Rotation = NLerp(pose0[i].Rotation, pose1[i].Rotation, w);
+			result[i].Scale = glm::mix(pose0[i].Scale, pose1[i].Scale, w);
+		}
+	}
+
+
+	void AdditiveBlend(const LocalTransform* pose0, const LocalTransform* pose1, const glm::vec3* restTranslations, const glm::quat* restRotations, const glm::vec3* restScales, const float w, LocalTransform* result, const uint32_t count)
+	{
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			BoneLanes a, b;
+			LoadLanes(pose0 + i, a);
+			LoadLanes(pose1 + i, b);
+
+			rtm::vector4f restX, restY, restZ, restW;
+
+			const rtm::vector4f t0 = rtm::vector_load3(glm::value_ptr(restTranslations[i + 0]));
+			const rtm::vector4f t1 = rtm::vector_load3(glm::value_ptr(restTranslations[i + 1]));
+			const rtm::vector4f t2 = rtm::vector_load3(glm::value_ptr(restTranslations[i + 2]));
+			const rtm::vector4f t3 = rtm::vector_load3(glm::value_ptr(restTranslations[i + 3]));
+			RTM_MATRIXF_TRANSPOSE_4X3(t0, t1, t2, t3, restX, restY, restZ);
+
+			BoneLanes r;
+			r.TX = rtm::vector_mul_add(rtm::vector_sub(b.TX, restX), w, a.TX);
+			r.TY = rtm::vector_mul_add(rtm::vector_sub(b.TY, restY), w, a.TY);
+			r.TZ = rtm::vector_mul_add(rtm::vector_sub(b.TZ, restZ), w, a.TZ);
+
+			const rtm::vector4f s0 = rtm::vector_load3(glm::value_ptr(restScales[i + 0]));
+			const rtm::vector4f s1 = rtm::vector_load3(glm::value_ptr(restScales[i + 1]));
+			const rtm::vector4f s2 = rtm::vector_load3(glm::value_ptr(restScales[i + 2]));
+			const rtm::vector4f s3 = rtm::vector_load3(glm::value_ptr(restScales[i + 3]));
+			RTM_MATRIXF_TRANSPOSE_4X3(s0, s1, s2, s3, restX, restY, restZ);
+
+			r.SX = rtm::vector_mul_add(rtm::vector_sub(b.SX, restX), w, a.SX);
+			r.SY = rtm::vector_mul_add(rtm::vector_sub(b.SY, restY), w, a.SY);
+			r.SZ = rtm::vector_mul_add(rtm::vector_sub(b.SZ, restZ), w, a.SZ);
+
+			const rtm::vector4f q0 = rtm::vector_load(glm::value_ptr(restRotations[i + 0]));
+			const rtm::vector4f q1 = rtm::vector_load(glm::value_ptr(restRotations[i + 1]));
+			const rtm::vector4f q2 = rtm::vector_load(glm::value_ptr(restRotations[i + 2]));
+			const rtm::vector4f q3 = rtm::vector_load(glm::value_ptr(restRotations[i + 3]));
+			RTM_MATRIXF_TRANSPOSE_4X4(q0, q1, q2, q3, restX, restY, restZ, restW);
+
+			// weighted = nlerp(rest, pose1, w)
+			rtm::vector4f wx, wy, wz, ww;
+			NLerpLanes(restX, restY, restZ, restW, b.QX, b.QY, b.QZ, b.QW, w, wx, wy, wz, ww);
+
+			// c = pose0 * conjugate(rest)
+			const rtm::vector4f cw = rtm::vector_mul_add(a.QZ, restZ, rtm::vector_mul_add(a.QY, restY, rtm::vector_mul_add(a.QX, restX, rtm::vector_mul(a.QW, restW))));
+			const rtm::vector4f cx = rtm::vector_mul_add(a.QZ, restY, rtm::vector_neg_mul_sub(a.QY, restZ, rtm::vector_neg_mul_sub(a.QW, restX, rtm::vector_mul(a.QX, restW))));
+			const rtm::vector4f cy = rtm::vector_mul_add(a.QX, restZ, rtm::vector_neg_mul_sub(a.QZ, restX, rtm::vector_neg_mul_sub(a.QW, restY, rtm::vector_mul(a.QY, restW))));
+			const rtm::vector4f cz = rtm::vector_mul_add(a.QY, restX, rtm::vector_neg_mul_sub(a.QX, restY, rtm::vector_neg_mul_sub(a.QW, restZ, rtm::vector_mul(a.QZ, restW))));
+
+			// result = c * weighted
+			r.QW = rtm::vector_neg_mul_sub(cz, wz, rtm::vector_neg_mul_sub(cy, wy, rtm::vector_neg_mul_sub(cx, wx, rtm::vector_mul(cw, ww))));
+			r.QX = rtm::vector_neg_mul_sub(cz, wy, rtm::vector_mul_add(cy, wz, rtm::vector_mul_add(cx, ww, rtm::vector_mul(cw, wx))));
+			r.QY = rtm::vector_neg_mul_sub(cx, wz, rtm::vector_mul_add(cz, wx, rtm::vector_mul_add(cy, ww, rtm::vector_mul(cw, wy))));
+			r.QZ = rtm::vector_neg_mul_sub(cy, wx, rtm::vector_mul_add(cx, wy, rtm::vector_mul_add(cz, ww, rtm::vector_mul(cw, wz))));
+
+			StoreLanes(r, result + i);
+		}
+
+		for (; i < count; ++i)
+		{
+			result[i].Translation = pose0[i].Translation + w * (pose1[i].Translation - restTranslations[i]);
+			const glm::quat weightedRotation = NLerp(restRotations[i], pose1[i].Rotation, w);
+			result[i].Rotation = pose0[i].Rotation * glm::conjugate(restRotations[i]) * weightedRotation;
+			result[i].Scale = pose0[i].Scale + w * (pose1[i].Scale - restScales[i]);
+		}
+	}
+
+}
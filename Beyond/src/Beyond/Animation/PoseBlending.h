@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Animation.h"
+
+namespace Beyond::PoseBlending {
+
+	// Kernels blending runs of bone transforms.
+	// Four bones at a time are transposed into structure-of-arrays lanes (one SIMD register per component),
+	// so that each instruction works on the same component of four bones.
+	// Rotations are blended with normalized lerp along the shortest path.
+	// result may be the same as any of the inputs.
+
+	// result = mix(pose0, pose1, w)
+	void Blend(const LocalTransform* pose0, const LocalTransform* pose1, const float w, LocalTransform* result, const uint32_t count);
+
+	// result = pose0 + w(pose1 - restPose)
+	// Rest pose is given as separate arrays, the way Skeleton stores it.
+	void AdditiveBlend(const LocalTransform* pose0, const LocalTransform* pose1, const glm::vec3* restTranslations, const glm::quat* restRotations, const glm::vec3* restScales, const float w, LocalTransform* result, const uint32_t count);
+
+}
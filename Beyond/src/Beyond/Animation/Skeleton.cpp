@@ -14,6 +14,7 @@ namespace Beyond {
 		m_BoneTranslations.reserve(size);
 		m_BoneRotations.reserve(size);
 		m_BoneScales.reserve(size);
+		m_IsLeafBone.reserve(size);
 	}
 
 
@@ -27,6 +28,13 @@ namespace Beyond {
 		m_BoneScales.emplace_back();
 		Math::DecomposeTransform(transform, m_BoneTranslations.back(), m_BoneRotations.back(), m_BoneScales.back());
 
+		m_IsLeafBone.push_back(true);
+		if (parentIndex != NullIndex && parentIndex < index && m_IsLeafBone[parentIndex])
+		{
+			m_IsLeafBone[parentIndex] = false;
+			m_NonLeafBones.insert(std::lower_bound(m_NonLeafBones.begin(), m_NonLeafBones.end(), parentIndex), parentIndex);
+		}
+
 		return index;
 	}
 
@@ -55,6 +63,20 @@ namespace Beyond {
 		m_BoneTranslations = std::move(boneTranslations);
 		m_BoneRotations = std::move(boneRotations);
 		m_BoneScales = std::move(boneScales);
+
+		m_IsLeafBone.assign(m_BoneNames.size(), true);
+		for (uint32_t parentIndex : m_ParentBoneIndices)
+		{
+			if (parentIndex < m_IsLeafBone.size())
+				m_IsLeafBone[parentIndex] = false;
+		}
+
+		m_NonLeafBones.clear();
+		for (uint32_t i = 0; i < (uint32_t)m_IsLeafBone.size(); ++i)
+		{
+			if (!m_IsLeafBone[i])
+				m_NonLeafBones.push_back(i);
+		}
 	}
 
 
@@ -43,6 +43,10 @@ namespace Beyond {
 		const std::vector<glm::quat>& GetBoneRotations() const { return m_BoneRotations; }
 		const std::vector<glm::vec3>& GetBoneScales() const { return m_BoneScales; }
 
+		// Bones that no other bone has as parent (fingers, toes, twist bones...), and the rest of them in ascending order
+		const std::vector<bool>& GetLeafBones() const { return m_IsLeafBone; }
+		const std::vector<uint32_t>& GetNonLeafBones() const { return m_NonLeafBones; }
+
 		void SetBones(std::vector<std::string> boneNames, std::vector<uint32_t> parentBoneIndices, std::vector<glm::vec3> boneTranslations, std::vector<glm::quat> boneRotations, std::vector<glm::vec3> boneScales);
 	private:
 		std::vector<std::string> m_BoneNames;
@@ -52,6 +56,9 @@ namespace Beyond {
 		std::vector<glm::vec3> m_BoneTranslations;
 		std::vector<glm::quat> m_BoneRotations;
 		std::vector<glm::vec3> m_BoneScales;
+
+		std::vector<bool> m_IsLeafBone;
+		std::vector<uint32_t> m_NonLeafBones;
 	};
 
 	// Wraps a Skeleton as an "asset"
@@ -94,7 +94,7 @@ namespace Beyond {
 	}
 
 
-	bool SkeletonAssetSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const
+	bool SkeletonAssetSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const
 	{
 		Ref<SkeletonAsset> skeleton = AssetManager::GetAsset<SkeletonAsset>(handle);
 		std::string yamlString = SerializeToYAML(skeleton);
@@ -106,7 +106,7 @@ namespace Beyond {
 	}
 
 
-	Ref<Asset> SkeletonAssetSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
+	Ref<Asset> SkeletonAssetSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
 	{
 		stream.SetStreamPosition(assetInfo.PackedOffset);
 		std::string yamlString;
@@ -218,7 +218,7 @@ namespace Beyond {
 	}
 
 
-	bool AnimationAssetSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const
+	bool AnimationAssetSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const
 	{
 		Ref<AnimationAsset> animationAsset = AssetManager::GetAsset<AnimationAsset>(handle);
 		std::string yamlString = SerializeToYAML(animationAsset);
@@ -230,7 +230,7 @@ namespace Beyond {
 	}
 
 
-	Ref<Asset> AnimationAssetSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
+	Ref<Asset> AnimationAssetSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
 	{
 		stream.SetStreamPosition(assetInfo.PackedOffset);
 		std::string yamlString;
@@ -641,7 +641,7 @@ namespace Beyond {
 	}
 
 
-	bool AnimationGraphAssetSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const
+	bool AnimationGraphAssetSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const
 	{
 		Ref<AnimationGraphAsset> animationGraph = AssetManager::GetAsset<AnimationGraphAsset>(handle);
 		std::string yamlString = SerializeToYAML(animationGraph);
@@ -653,7 +653,7 @@ namespace Beyond {
 	}
 
 
-	Ref<Asset> AnimationGraphAssetSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
+	Ref<Asset> AnimationGraphAssetSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
 	{
 		stream.SetStreamPosition(assetInfo.PackedOffset);
 		std::string yamlString;
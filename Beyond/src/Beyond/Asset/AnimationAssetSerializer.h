@@ -14,8 +14,8 @@ namespace Beyond {
 		virtual void Serialize(const AssetMetadata& metadata, const Ref<Asset>& asset) const override;
 		virtual bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset) const override;
 		
-		virtual bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const;
-		virtual Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
+		virtual bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const;
+		virtual Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
 	};
 
 	class AnimationAssetSerializer : public AssetSerializer
@@ -24,8 +24,8 @@ namespace Beyond {
 		virtual void Serialize(const AssetMetadata& metadata, const Ref<Asset>& asset) const override;
 		virtual bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset) const override;
 
-		virtual bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const override;
-		virtual Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const override;
+		virtual bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const override;
+		virtual Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const override;
 	};
 
 	class AnimationGraphAssetSerializer : public AssetSerializer
@@ -34,8 +34,8 @@ namespace Beyond {
 		virtual void Serialize(const AssetMetadata& metadata, const Ref<Asset>& asset) const override;
 		virtual bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset) const override;
 
-		virtual bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const override;
-		virtual Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const override;
+		virtual bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const override;
+		virtual Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const override;
 
 		static bool TryLoadData(const std::filesystem::path& path, Ref<AnimationGraphAsset>& asset);
 	};
@@ -59,7 +59,14 @@ namespace Beyond {
 		return s_Serializers[metadata.Type]->TryLoadData(metadata, asset);
 	}
 
-	bool AssetImporter::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo)
+	void AssetImporter::GetDependencies(const AssetMetadata& metadata, std::vector<AssetHandle>& outDependencies)
+	{
+		auto it = s_Serializers.find(metadata.Type);
+		if (it != s_Serializers.end())
+			it->second->GetDependencies(metadata, outDependencies);
+	}
+
+	bool AssetImporter::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo)
 	{
 		outInfo.Size = 0;
 
@@ -76,7 +83,7 @@ namespace Beyond {
 		return s_Serializers[metadata.Type]->SerializeToAssetPack(handle, stream, outInfo);
 	}
 
-	Ref<Asset> AssetImporter::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo)
+	Ref<Asset> AssetImporter::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo)
 	{
 		AssetType assetType = (AssetType)assetInfo.Type;
 		if (s_Serializers.find(assetType) == s_Serializers.end())
@@ -85,7 +92,7 @@ namespace Beyond {
 		return s_Serializers[assetType]->DeserializeFromAssetPack(stream, assetInfo);
 	}
 
-	Ref<Scene> AssetImporter::DeserializeSceneFromAssetPack(FileStreamReader& stream, const AssetPackFile::SceneInfo& sceneInfo)
+	Ref<Scene> AssetImporter::DeserializeSceneFromAssetPack(StreamReader& stream, const AssetPackFile::SceneInfo& sceneInfo)
 	{
 		AssetType assetType = AssetType::Scene;
 		if (s_Serializers.find(assetType) == s_Serializers.end())
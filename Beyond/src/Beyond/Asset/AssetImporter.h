@@ -13,10 +13,11 @@ namespace Beyond {
 		static void Serialize(const AssetMetadata& metadata, const Ref<Asset>& asset);
 		static void Serialize(const Ref<Asset>& asset);
 		static bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset);
+		static void GetDependencies(const AssetMetadata& metadata, std::vector<AssetHandle>& outDependencies);
 		
-		static bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo);
-		static Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo);
-		static Ref<Scene> DeserializeSceneFromAssetPack(FileStreamReader& stream, const AssetPackFile::SceneInfo& assetInfo);
+		static bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo);
+		static Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo);
+		static Ref<Scene> DeserializeSceneFromAssetPack(StreamReader& stream, const AssetPackFile::SceneInfo& assetInfo);
 	private:
 		static std::unordered_map<AssetType, Scope<AssetSerializer>> s_Serializers;
 	};
@@ -3,4 +3,20 @@
 
 namespace Beyond {
 
+	static std::unordered_map<AssetType, Ref<Asset>> s_PlaceholderAssets;
+
+	void AssetManager::SetPlaceholderAsset(AssetType type, Ref<Asset> asset)
+	{
+		if (asset)
+			s_PlaceholderAssets[type] = asset;
+		else
+			s_PlaceholderAssets.erase(type);
+	}
+
+	Ref<Asset> AssetManager::GetPlaceholderAsset(AssetType type)
+	{
+		auto it = s_PlaceholderAssets.find(type);
+		return it != s_PlaceholderAssets.end() ? it->second : nullptr;
+	}
+
 }
@@ -2,6 +2,7 @@
 
 #include "Beyond/Asset/Asset.h"
 #include "Beyond/Asset/AssetTypes.h"
+#include "Beyond/Asset/AssetManager/AssetLoader.h"
 #include "Beyond/Project/Project.h"
 #include "Beyond/Utilities/FileSystem.h"
 
@@ -11,6 +12,9 @@
 
 namespace Beyond {
 
+	template<typename T>
+	class AsyncAssetResult;
+
 	class AssetManager
 	{
 	public:
@@ -30,14 +34,34 @@ namespace Beyond {
 			return asset.As<T>();
 		}
 
+		// Loads the asset and its dependencies on background threads, see AssetManagerBase::GetAssetAsync
+		template<typename T>
+		static AsyncAssetResult<T> GetAssetAsync(AssetHandle assetHandle, AssetLoadPriority priority = AssetLoadPriority::Normal)
+		{
+			return AsyncAssetResult<T>(Project::GetAssetManager()->GetAssetAsync(assetHandle, priority));
+		}
+
+		static void CancelAssetLoad(const Ref<AssetLoadRequest>& request)
+		{
+			if (Ref<AssetManagerBase> assetManager = Project::GetAssetManager())
+				assetManager->CancelAssetLoad(request);
+		}
+
+		static AssetLoaderStatistics GetAsyncLoadStatistics() { return Project::GetAssetManager()->GetAsyncLoadStatistics(); }
+
+		// Stand-in for assets of the type while they are loading asynchronously or when they failed to load.
+		// Set during initialization (e.g. the renderer registers its white texture).
+		static void SetPlaceholderAsset(AssetType type, Ref<Asset> asset);
+		static Ref<Asset> GetPlaceholderAsset(AssetType type);
+
 		template<typename T>
 		static std::unordered_set<AssetHandle> GetAllAssetsWithType()
 		{
 			return Project::GetAssetManager()->GetAllAssetsWithType(T::GetStaticType());
 		}
 
-		static const std::unordered_map<AssetHandle, Ref<Asset>>& GetLoadedAssets() { return Project::GetAssetManager()->GetLoadedAssets(); }
-		static const std::unordered_map<AssetHandle, Ref<Asset>>& GetMemoryOnlyAssets() { return Project::GetAssetManager()->GetMemoryOnlyAssets(); }
+		static std::unordered_map<AssetHandle, Ref<Asset>> GetLoadedAssets() { return Project::GetAssetManager()->GetLoadedAssets(); }
+		static std::unordered_map<AssetHandle, Ref<Asset>> GetMemoryOnlyAssets() { return Project::GetAssetManager()->GetMemoryOnlyAssets(); }
 
 		template<typename TAsset, typename... TArgs>
 		static AssetHandle CreateMemoryOnlyAsset(TArgs&&... args)
@@ -93,4 +117,46 @@ namespace Beyond {
 		}
 	};
 
+	/// Result of AssetManager::GetAssetAsync
+	template<typename T>
+	class AsyncAssetResult
+	{
+	public:
+		AsyncAssetResult() = default;
+		explicit AsyncAssetResult(Ref<AssetLoadRequest> request)
+			: m_Request(std::move(request))
+		{
+		}
+
+		bool IsValid() const { return (bool)m_Request; }
+		bool IsReady() const { return m_Request && m_Request->IsLoaded(); }
+		bool IsDone() const { return !m_Request || m_Request->IsDone(); }
+
+		AssetHandle GetHandle() const { return m_Request ? m_Request->GetHandle() : AssetHandle(0); }
+		AssetLoadState GetState() const { return m_Request ? m_Request->GetState() : AssetLoadState::Cancelled; }
+
+		// The loaded asset, nullptr until the load has finished
+		Ref<T> Get() const { return IsReady() ? m_Request->GetAsset().As<T>() : nullptr; }
+
+		// The loaded asset, or the placeholder for T while loading and if the load failed
+		Ref<T> GetOrPlaceholder() const
+		{
+			if (IsReady())
+				return Get();
+
+			return AssetManager::GetPlaceholderAsset(T::GetStaticType()).As<T>();
+		}
+
+		// The load is dropped once every requester has cancelled it
+		void Cancel()
+		{
+			if (m_Request)
+				AssetManager::CancelAssetLoad(m_Request);
+			m_Request = nullptr;
+		}
+
+	private:
+		Ref<AssetLoadRequest> m_Request;
+	};
+
 }
@@ -0,0 +1,377 @@
+#include "pch.h"
+#include "AssetLoader.h"
+
+#include "AssetManagerBase.h"
+
+#include "Beyond/Core/Timer.h"
+#include "Beyond/Debug/Profiler.h"
+#include "Beyond/Renderer/Renderer.h"
+
+// Lock order: AssetLoader::m_Mutex, then AssetManagerBase::m_AssetMutex. The asset manager never calls
+// into the loader while holding its own mutex.
+
+namespace Beyond {
+
+	AssetLoader::AssetLoader(AssetManagerBase* assetManager, uint32_t threadCount)
+		: m_AssetManager(assetManager)
+	{
+		m_Threads.reserve(threadCount);
+		for (uint32_t i = 0; i < threadCount; i++)
+			m_Threads.emplace_back([this](std::stop_token stopToken) { WorkerMain(stopToken); });
+	}
+
+	AssetLoader::~AssetLoader()
+	{
+		// Threads finish the load they are working on, queued requests are dropped
+		for (std::jthread& thread : m_Threads)
+			thread.request_stop();
+		m_Threads.clear();
+	}
+
+	bool AssetLoader::HasLowerPriority(const Ref<AssetLoadRequest>& a, const Ref<AssetLoadRequest>& b)
+	{
+		if (a->m_Priority != b->m_Priority)
+			return a->m_Priority < b->m_Priority;
+
+		return a->m_Sequence > b->m_Sequence;
+	}
+
+	Ref<AssetLoadRequest> AssetLoader::Request(AssetHandle handle, AssetType type, AssetLoadPriority priority)
+	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+		return RequestLocked(handle, type, priority);
+	}
+
+	Ref<AssetLoadRequest> AssetLoader::RequestLocked(AssetHandle handle, AssetType type, AssetLoadPriority priority)
+	{
+		auto it = m_Requests.find(handle);
+		if (it != m_Requests.end())
+		{
+			Ref<AssetLoadRequest> request = it->second;
+			request->m_RequesterCount++;
+			request->m_CancelRequested = false;
+
+			if (priority > request->m_Priority)
+			{
+				request->m_Priority = priority;
+				if (request->GetState() == AssetLoadState::Queued && !RequiresMainThread(request->m_Type))
+					std::make_heap(m_Queue.begin(), m_Queue.end(), HasLowerPriority);
+			}
+
+			return request;
+		}
+
+		Ref<AssetLoadRequest> request = Ref<AssetLoadRequest>::Create();
+		request->m_Handle = handle;
+		request->m_Type = type;
+		request->m_Priority = priority;
+		request->m_Sequence = m_NextSequence++;
+		request->m_RequesterCount = 1;
+
+		m_Requests[handle] = request;
+		m_Statistics.Queued++;
+		EnqueueLocked(request);
+		return request;
+	}
+
+	void AssetLoader::EnqueueLocked(const Ref<AssetLoadRequest>& request)
+	{
+		if (RequiresMainThread(request->m_Type))
+		{
+			m_MainThreadQueue.push_back(request);
+			return;
+		}
+
+		m_Queue.push_back(request);
+		std::push_heap(m_Queue.begin(), m_Queue.end(), HasLowerPriority);
+		m_WorkAvailable.notify_one();
+	}
+
+	void AssetLoader::RemoveFromQueueLocked(const Ref<AssetLoadRequest>& request)
+	{
+		auto it = std::find(m_Queue.begin(), m_Queue.end(), request);
+		if (it != m_Queue.end())
+		{
+			m_Queue.erase(it);
+			std::make_heap(m_Queue.begin(), m_Queue.end(), HasLowerPriority);
+			return;
+		}
+
+		std::erase(m_MainThreadQueue, request);
+	}
+
+	void AssetLoader::Cancel(Ref<AssetLoadRequest> request)
+	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		if (request->IsDone() || request->m_RequesterCount == 0)
+			return;
+
+		// Still wanted by another caller or by a request that depends on it
+		if (--request->m_RequesterCount > 0)
+			return;
+
+		switch (request->GetState())
+		{
+			case AssetLoadState::Queued:
+			case AssetLoadState::WaitingForDependencies:
+			{
+				// Dependencies keep loading, they are shared and usually wanted again soon
+				RemoveFromQueueLocked(request);
+				request->m_State = AssetLoadState::Cancelled;
+				m_Requests.erase(request->m_Handle);
+				m_Statistics.Queued--;
+				m_Statistics.Cancelled++;
+				break;
+			}
+			case AssetLoadState::Loading:
+			{
+				// Can't interrupt a load, the result is dropped in Finish
+				request->m_CancelRequested = true;
+				break;
+			}
+		}
+	}
+
+	Ref<AssetLoadRequest> AssetLoader::CreateFinished(AssetHandle handle, Ref<Asset> asset)
+	{
+		Ref<AssetLoadRequest> request = Ref<AssetLoadRequest>::Create();
+		request->m_Handle = handle;
+		request->m_Type = asset ? asset->GetAssetType() : AssetType::None;
+		request->m_Asset = asset;
+		request->m_State = asset ? AssetLoadState::Loaded : AssetLoadState::Failed;
+		return request;
+	}
+
+	void AssetLoader::WorkerMain(std::stop_token stopToken)
+	{
+		while (true)
+		{
+			Ref<AssetLoadRequest> request;
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				if (!m_WorkAvailable.wait(lock, stopToken, [this]() { return !m_Queue.empty(); }))
+					return;
+
+				std::pop_heap(m_Queue.begin(), m_Queue.end(), HasLowerPriority);
+				request = m_Queue.back();
+				m_Queue.pop_back();
+
+				request->m_State = AssetLoadState::Loading;
+				m_Statistics.Queued--;
+				m_Statistics.InFlight++;
+			}
+
+			// Queued again once its dependencies have been published
+			if (!ResolveDependencies(request))
+				continue;
+
+			Load(*request, true);
+
+			std::scoped_lock<std::mutex> lock(m_Mutex);
+			m_FinishedLoads.push_back(request);
+		}
+	}
+
+	bool AssetLoader::ResolveDependencies(Ref<AssetLoadRequest> request)
+	{
+		// Only the thread that dequeued the request touches it until it's queued again
+		if (request->m_DependenciesResolved)
+			return true;
+
+		std::vector<AssetHandle> dependencies;
+		m_AssetManager->GetAssetDependencies(request->m_Handle, dependencies);
+
+		std::vector<std::pair<AssetHandle, AssetType>> missingDependencies;
+		{
+			std::scoped_lock<std::recursive_mutex> lock(m_AssetManager->m_AssetMutex);
+			for (AssetHandle dependency : dependencies)
+			{
+				if (dependency == 0 || dependency == request->m_Handle || !m_AssetManager->IsAssetHandleValid(dependency))
+					continue;
+
+				if (m_AssetManager->IsMemoryAsset(dependency) || m_AssetManager->IsAssetLoaded(dependency))
+					continue;
+
+				missingDependencies.emplace_back(dependency, m_AssetManager->GetAssetType(dependency));
+			}
+		}
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+		request->m_DependenciesResolved = true;
+
+		if (request->m_CancelRequested)
+		{
+			request->m_State = AssetLoadState::Cancelled;
+			m_Requests.erase(request->m_Handle);
+			m_Statistics.InFlight--;
+			m_Statistics.Cancelled++;
+			return false;
+		}
+
+		for (const auto& [handle, type] : missingDependencies)
+		{
+			Ref<AssetLoadRequest> dependency = RequestLocked(handle, type, request->m_Priority);
+			dependency->m_Dependents.push_back(request);
+			request->m_PendingDependencies++;
+		}
+
+		if (request->m_PendingDependencies == 0)
+			return true;
+
+		request->m_State = AssetLoadState::WaitingForDependencies;
+		m_Statistics.InFlight--;
+		m_Statistics.Queued++;
+		return false;
+	}
+
+	void AssetLoader::Load(AssetLoadRequest& request, bool recordRenderCommands)
+	{
+		BEY_PROFILE_FUNC();
+
+		{
+			std::scoped_lock<std::mutex> lock(m_Mutex);
+			if (request.m_CancelRequested)
+				return;
+		}
+
+		{
+			// Loaded synchronously in the meantime, Finish picks up the loaded asset
+			std::scoped_lock<std::recursive_mutex> lock(m_AssetManager->m_AssetMutex);
+			if (m_AssetManager->IsAssetLoaded(request.m_Handle))
+				return;
+		}
+
+		if (recordRenderCommands)
+		{
+			RenderCommandRecordingScope recordingScope(&request.m_RenderCommands);
+			request.m_Asset = m_AssetManager->LoadAssetData(request.m_Handle);
+		}
+		else
+		{
+			request.m_Asset = m_AssetManager->LoadAssetData(request.m_Handle);
+		}
+	}
+
+	void AssetLoader::Finish(Ref<AssetLoadRequest> request)
+	{
+		// Recorded commands have to run even when the asset is dropped, they own whatever they captured
+		Renderer::SubmitRecordedCommands(request->m_RenderCommands);
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		if (request->m_CancelRequested)
+		{
+			request->m_Asset = nullptr;
+			request->m_State = AssetLoadState::Cancelled;
+			m_Statistics.Cancelled++;
+		}
+		else
+		{
+			request->m_Asset = m_AssetManager->PublishLoadedAsset(request->m_Handle, request->m_Asset);
+			if (request->m_Asset)
+			{
+				request->m_State = AssetLoadState::Loaded;
+				m_Statistics.Completed++;
+			}
+			else
+			{
+				BEY_CORE_WARN_TAG("AssetManager", "Failed to load asset {} asynchronously", request->m_Handle);
+				request->m_State = AssetLoadState::Failed;
+				m_Statistics.Failed++;
+			}
+		}
+
+		m_Statistics.InFlight--;
+
+		auto it = m_Requests.find(request->m_Handle);
+		if (it != m_Requests.end() && it->second == request)
+			m_Requests.erase(it);
+
+		// A failed dependency doesn't fail its dependents, they handle the missing asset like a synchronous load would
+		for (Ref<AssetLoadRequest>& dependent : request->m_Dependents)
+		{
+			if (dependent->GetState() == AssetLoadState::Cancelled)
+				continue;
+
+			if (--dependent->m_PendingDependencies == 0)
+			{
+				dependent->m_State = AssetLoadState::Queued;
+				EnqueueLocked(dependent);
+			}
+		}
+		request->m_Dependents.clear();
+	}
+
+	void AssetLoader::Update()
+	{
+		BEY_PROFILE_FUNC();
+
+		std::vector<Ref<AssetLoadRequest>> finishedLoads;
+		std::vector<Ref<AssetLoadRequest>> mainThreadLoads;
+		{
+			std::scoped_lock<std::mutex> lock(m_Mutex);
+			finishedLoads.swap(m_FinishedLoads);
+			mainThreadLoads.swap(m_MainThreadQueue);
+			std::stable_sort(mainThreadLoads.begin(), mainThreadLoads.end(), [](const auto& a, const auto& b) { return a->m_Priority > b->m_Priority; });
+		}
+
+		for (const Ref<AssetLoadRequest>& request : finishedLoads)
+			Finish(request);
+
+		Timer timer;
+		size_t loadCount = 0;
+		for (; loadCount < mainThreadLoads.size(); loadCount++)
+		{
+			if (loadCount > 0 && timer.ElapsedMillis() > MainThreadBudgetMs)
+				break;
+
+			Ref<AssetLoadRequest>& request = mainThreadLoads[loadCount];
+			{
+				std::scoped_lock<std::mutex> lock(m_Mutex);
+				if (request->GetState() == AssetLoadState::Cancelled)
+					continue;
+
+				request->m_State = AssetLoadState::Loading;
+				m_Statistics.Queued--;
+				m_Statistics.InFlight++;
+			}
+
+			// Render commands go straight into the render command queue on the main thread
+			Load(*request, false);
+			Finish(request);
+		}
+
+		// What didn't fit into this frame goes first next frame
+		if (loadCount < mainThreadLoads.size())
+		{
+			std::scoped_lock<std::mutex> lock(m_Mutex);
+			std::erase_if(mainThreadLoads, [](const auto& request) { return request->GetState() != AssetLoadState::Queued; });
+			m_MainThreadQueue.insert(m_MainThreadQueue.begin(), mainThreadLoads.begin(), mainThreadLoads.end());
+		}
+	}
+
+	AssetLoaderStatistics AssetLoader::GetStatistics() const
+	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+		return m_Statistics;
+	}
+
+	bool AssetLoader::RequiresMainThread(AssetType type)
+	{
+		switch (type)
+		{
+			case AssetType::Scene:
+			case AssetType::Prefab:
+			case AssetType::EnvMap:
+			case AssetType::Font:
+			case AssetType::ScriptFile:
+			case AssetType::SoundGraphSound:
+			case AssetType::AnimationGraph:
+				return true;
+			default:
+				return false;
+		}
+	}
+
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "Beyond/Asset/Asset.h"
+#include "Beyond/Renderer/RenderCommandQueue.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace Beyond {
+
+	class AssetManagerBase;
+
+	enum class AssetLoadPriority : uint8_t
+	{
+		Low = 0,
+		Normal,
+		High
+	};
+
+	enum class AssetLoadState : uint8_t
+	{
+		Queued = 0,
+		WaitingForDependencies,
+		Loading,
+		Loaded,
+		Failed,
+		Cancelled
+	};
+
+	/// State of one asynchronous load, shared by everyone that requested the same asset
+	class AssetLoadRequest : public RefCounted
+	{
+	public:
+		AssetHandle GetHandle() const { return m_Handle; }
+		AssetType GetAssetType() const { return m_Type; }
+		AssetLoadState GetState() const { return m_State.load(std::memory_order_acquire); }
+
+		bool IsLoaded() const { return GetState() == AssetLoadState::Loaded; }
+		bool IsDone() const
+		{
+			const AssetLoadState state = GetState();
+			return state == AssetLoadState::Loaded || state == AssetLoadState::Failed || state == AssetLoadState::Cancelled;
+		}
+
+		// Only set once the request is Loaded, which happens on the main thread when the asset is published to the asset manager
+		Ref<Asset> GetAsset() const { return IsLoaded() ? m_Asset : nullptr; }
+
+	private:
+		AssetHandle m_Handle = 0;
+		AssetType m_Type = AssetType::None;
+		std::atomic<AssetLoadState> m_State = AssetLoadState::Queued;
+		Ref<Asset> m_Asset;
+
+		// Guarded by the loader mutex
+		AssetLoadPriority m_Priority = AssetLoadPriority::Normal;
+		uint64_t m_Sequence = 0;
+		uint32_t m_RequesterCount = 0; // Callers plus dependent requests, a cancel only takes effect once it reaches zero
+		uint32_t m_PendingDependencies = 0;
+		bool m_DependenciesResolved = false;
+		bool m_CancelRequested = false;
+		std::vector<Ref<AssetLoadRequest>> m_Dependents;
+
+		// Render commands submitted while loading on a loader thread, submitted on the main thread when the request finishes
+		RenderCommandQueue m_RenderCommands;
+
+		friend class AssetLoader;
+	};
+
+	struct AssetLoaderStatistics
+	{
+		uint32_t Queued = 0;   // Waiting for a loader thread or for dependencies
+		uint32_t InFlight = 0; // Being loaded or waiting to be published
+		uint64_t Completed = 0;
+		uint64_t Failed = 0;
+		uint64_t Cancelled = 0;
+	};
+
+	/// Background loading for AssetManagerBase::GetAssetAsync. Loads run on dedicated threads rather than the job system
+	/// since they block on I/O, and finished loads are published to the asset manager on the main thread in Update.
+	/// Dependencies reported by the asset serializer are loaded first, so the GetAsset calls a serializer makes
+	/// for them while loading find them already loaded.
+	class AssetLoader
+	{
+	public:
+		static constexpr uint32_t DefaultThreadCount = 2;
+
+		// Main thread loads started per Update stop once this much time has been spent
+		static constexpr float MainThreadBudgetMs = 4.0f;
+
+	public:
+		AssetLoader(AssetManagerBase* assetManager, uint32_t threadCount = DefaultThreadCount);
+		~AssetLoader();
+
+		AssetLoader(const AssetLoader&) = delete;
+		AssetLoader& operator=(const AssetLoader&) = delete;
+
+		// Returns the pending request for the asset if there is one, requesting it again can raise its priority
+		Ref<AssetLoadRequest> Request(AssetHandle handle, AssetType type, AssetLoadPriority priority);
+		void Cancel(Ref<AssetLoadRequest> request);
+
+		// Request that is already Loaded with asset, or Failed if asset is null
+		static Ref<AssetLoadRequest> CreateFinished(AssetHandle handle, Ref<Asset> asset);
+
+		// Main thread. Publishes finished loads and runs the loads that have to happen on the main thread.
+		void Update();
+
+		AssetLoaderStatistics GetStatistics() const;
+
+		// Assets whose loading needs the main thread (scenes, prefabs, environment maps, ...)
+		static bool RequiresMainThread(AssetType type);
+
+	private:
+		static bool HasLowerPriority(const Ref<AssetLoadRequest>& a, const Ref<AssetLoadRequest>& b);
+
+		Ref<AssetLoadRequest> RequestLocked(AssetHandle handle, AssetType type, AssetLoadPriority priority);
+		void EnqueueLocked(const Ref<AssetLoadRequest>& request);
+		void RemoveFromQueueLocked(const Ref<AssetLoadRequest>& request);
+
+		void WorkerMain(std::stop_token stopToken);
+		bool ResolveDependencies(Ref<AssetLoadRequest> request);
+		void Load(AssetLoadRequest& request, bool recordRenderCommands);
+		void Finish(Ref<AssetLoadRequest> request);
+
+	private:
+		AssetManagerBase* m_AssetManager = nullptr;
+
+		mutable std::mutex m_Mutex;
+		std::condition_variable_any m_WorkAvailable;
+		std::unordered_map<AssetHandle, Ref<AssetLoadRequest>> m_Requests; // Every unfinished request
+		std::vector<Ref<AssetLoadRequest>> m_Queue; // Heap, highest priority then oldest first
+		std::vector<Ref<AssetLoadRequest>> m_MainThreadQueue;
+		std::vector<Ref<AssetLoadRequest>> m_FinishedLoads; // Loaded on a loader thread, published in Update
+		uint64_t m_NextSequence = 0;
+		AssetLoaderStatistics m_Statistics;
+
+		// Last so the threads are stopped before anything they use is destroyed
+		std::vector<std::jthread> m_Threads;
+	};
+
+}
@@ -0,0 +1,92 @@
+#include "pch.h"
+#include "AssetManagerBase.h"
+
+namespace Beyond {
+
+	AssetManagerBase::AssetManagerBase()
+	{
+		m_AssetLoader = CreateScope<AssetLoader>(this);
+	}
+
+	AssetManagerBase::~AssetManagerBase()
+	{
+		ShutdownAsyncLoads();
+	}
+
+	Ref<AssetLoadRequest> AssetManagerBase::GetAssetAsync(AssetHandle assetHandle, AssetLoadPriority priority)
+	{
+		BEY_CORE_ASSERT(m_AssetLoader, "Asset loader has been shut down");
+
+		// Note: the asset mutex must not be held while calling into the loader
+		{
+			std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+			if (!IsAssetHandleValid(assetHandle))
+				return AssetLoader::CreateFinished(assetHandle, nullptr);
+
+			if (IsMemoryAsset(assetHandle) || IsAssetLoaded(assetHandle))
+				return AssetLoader::CreateFinished(assetHandle, GetAsset(assetHandle));
+		}
+
+		return m_AssetLoader->Request(assetHandle, GetAssetType(assetHandle), priority);
+	}
+
+	void AssetManagerBase::CancelAssetLoad(const Ref<AssetLoadRequest>& request)
+	{
+		if (request && m_AssetLoader)
+			m_AssetLoader->Cancel(request);
+	}
+
+	void AssetManagerBase::UpdateAsyncLoads()
+	{
+		if (m_AssetLoader)
+			m_AssetLoader->Update();
+	}
+
+	AssetLoaderStatistics AssetManagerBase::GetAsyncLoadStatistics() const
+	{
+		return m_AssetLoader ? m_AssetLoader->GetStatistics() : AssetLoaderStatistics();
+	}
+
+	Ref<Asset> AssetManagerBase::LoadAssetSynchronous(AssetHandle assetHandle)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_SynchronousLoadsMutex);
+			auto it = m_SynchronousLoads.find(assetHandle);
+			if (it != m_SynchronousLoads.end())
+			{
+				if (it->second == std::this_thread::get_id())
+				{
+					BEY_CORE_ERROR_TAG("AssetManager", "Asset {} depends on itself", assetHandle);
+					return nullptr;
+				}
+
+				m_SynchronousLoadsCondition.wait(lock, [&]() { return !m_SynchronousLoads.contains(assetHandle); });
+				lock.unlock();
+
+				// Whatever the other load ended up with, nullptr if it failed
+				return PublishLoadedAsset(assetHandle, nullptr);
+			}
+
+			m_SynchronousLoads[assetHandle] = std::this_thread::get_id();
+		}
+
+		// Loaded by another thread between the caller's lookup and registering the load
+		Ref<Asset> asset = PublishLoadedAsset(assetHandle, nullptr);
+		if (!asset)
+			asset = PublishLoadedAsset(assetHandle, LoadAssetData(assetHandle));
+
+		{
+			std::scoped_lock<std::mutex> lock(m_SynchronousLoadsMutex);
+			m_SynchronousLoads.erase(assetHandle);
+		}
+		m_SynchronousLoadsCondition.notify_all();
+
+		return asset;
+	}
+
+	void AssetManagerBase::ShutdownAsyncLoads()
+	{
+		m_AssetLoader.reset();
+	}
+
+}
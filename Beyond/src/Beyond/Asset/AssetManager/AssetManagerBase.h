@@ -2,7 +2,11 @@
 
 #include "Beyond/Asset/Asset.h"
 #include "Beyond/Asset/AssetTypes.h"
+#include "AssetLoader.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <unordered_set>
 
 #include "EASTL/fixed_hash_map.h"
@@ -18,8 +22,8 @@ namespace Beyond {
 	class AssetManagerBase : public RefCounted
 	{
 	public:
-		AssetManagerBase() = default;
-		virtual ~AssetManagerBase() = default;
+		AssetManagerBase();
+		virtual ~AssetManagerBase();
 
 		virtual AssetType GetAssetType(AssetHandle assetHandle) = 0;
 		virtual Ref<Asset> GetAsset(AssetHandle assetHandle) = 0;
@@ -31,8 +35,50 @@ namespace Beyond {
 		virtual void RemoveAsset(AssetHandle handle) = 0;
 
 		virtual std::unordered_set<AssetHandle> GetAllAssetsWithType(AssetType type) = 0;
-		virtual const std::unordered_map<AssetHandle, Ref<Asset>>& GetLoadedAssets() = 0;
-		virtual const std::unordered_map<AssetHandle, Ref<Asset>>& GetMemoryOnlyAssets() = 0;
+		// Copies, the maps can change on loader threads while they're iterated
+		virtual std::unordered_map<AssetHandle, Ref<Asset>> GetLoadedAssets() = 0;
+		virtual std::unordered_map<AssetHandle, Ref<Asset>> GetMemoryOnlyAssets() = 0;
+
+		// Loads the asset (and its dependencies) in the background. Assets that are already loaded
+		// complete immediately, requests for an asset that is being loaded share the same request.
+		Ref<AssetLoadRequest> GetAssetAsync(AssetHandle assetHandle, AssetLoadPriority priority = AssetLoadPriority::Normal);
+		void CancelAssetLoad(const Ref<AssetLoadRequest>& request);
+
+		// Main thread, once per frame
+		void UpdateAsyncLoads();
+		// Main thread, once per frame. Writes out changes made since the last call (the editor's asset registry)
+		virtual void FlushChanges() {}
+		AssetLoaderStatistics GetAsyncLoadStatistics() const;
+
+	protected:
+		// Loads the asset without adding it to the manager, called on loader threads
+		virtual Ref<Asset> LoadAssetData(AssetHandle assetHandle) = 0;
+		// Assets that have to be loaded before this one, called on loader threads
+		virtual void GetAssetDependencies(AssetHandle assetHandle, std::vector<AssetHandle>& outDependencies) {}
+		// Adds an asset loaded with LoadAssetData unless it has been loaded in the meantime, returns the asset the manager ends up with
+		virtual Ref<Asset> PublishLoadedAsset(AssetHandle assetHandle, Ref<Asset> asset) = 0;
+
+		// Loads and publishes an asset on the calling thread, for GetAsset after a lookup miss. Must be called without m_AssetMutex held.
+		// Synchronous loads of the same handle from other threads wait for the first one instead of loading it again.
+		Ref<Asset> LoadAssetSynchronous(AssetHandle assetHandle);
+
+		// Stops the loader threads, derived destructors call this before anything a load uses is destroyed
+		void ShutdownAsyncLoads();
+
+	protected:
+		// Guards the loaded / memory asset maps, GetAsset can be called from job system workers and loader threads.
+		// Only held for lookups and inserts, never across a load. Recursive because the lookups call each other.
+		std::recursive_mutex m_AssetMutex;
+
+	private:
+		Scope<AssetLoader> m_AssetLoader;
+
+		// Handles being loaded by LoadAssetSynchronous and the thread loading them
+		std::mutex m_SynchronousLoadsMutex;
+		std::condition_variable m_SynchronousLoadsCondition;
+		std::unordered_map<AssetHandle, std::thread::id> m_SynchronousLoads;
+
+		friend class AssetLoader;
 	};
 
 }
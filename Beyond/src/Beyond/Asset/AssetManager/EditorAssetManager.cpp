@@ -14,23 +14,32 @@
 
 namespace Beyond {
 
-	static AssetMetadata s_NullMetadata;
+	static const AssetMetadata s_NullMetadata;
 
 	EditorAssetManager::EditorAssetManager()
+		: m_RegistryJournal(Project::GetCacheDirectory() / "AssetRegistry.hzrs", Project::GetCacheDirectory() / "AssetRegistry.hzrj")
 	{
 		AssetImporter::Init();
 
-		LoadAssetRegistry();
+		// Registries read from YAML or recovered from the journal are written out once, otherwise the
+		// snapshot is up to date and only the assets found by the scan are journaled
+		const bool registryChanged = LoadAssetRegistry();
 		ReloadAssets();
+		if (registryChanged)
+			WriteRegistryToFile();
 	}
 
 	EditorAssetManager::~EditorAssetManager()
 	{
-		WriteRegistryToFile();
+		ShutdownAsyncLoads();
+		if (m_RegistryJournal.GetRecordCount() > 0)
+			WriteRegistryToFile();
 	}
 
 	AssetType EditorAssetManager::GetAssetType(AssetHandle assetHandle)
 	{
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+
 		if (!IsAssetHandleValid(assetHandle))
 			return AssetType::None;
 
@@ -43,70 +52,124 @@ namespace Beyond {
 		BEY_PROFILE_FUNC();
 		BEY_SCOPE_PERF("AssetManager::GetAsset");
 
-		if (IsMemoryAsset(assetHandle))
-			return m_MemoryAssets.at(assetHandle);
+		{
+			std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
 
-		auto& metadata = GetMetadataInternal(assetHandle);
-		if (!metadata.IsValid())
-			return nullptr;
+			if (IsMemoryAsset(assetHandle))
+				return m_MemoryAssets.at(assetHandle);
 
-		Ref<Asset> asset = nullptr;
-		if (!metadata.IsDataLoaded)
-		{
-			metadata.IsDataLoaded = AssetImporter::TryLoadData(metadata, asset);
-			if (!metadata.IsDataLoaded)
+			const auto& metadata = GetMetadataInternal(assetHandle);
+			if (!metadata.IsValid())
 				return nullptr;
 
-			m_LoadedAssets[assetHandle] = asset;
+			if (metadata.IsDataLoaded)
+				return m_LoadedAssets[assetHandle];
+		}
+
+		// Needs load, the asset mutex is released so lookups of loaded assets don't wait for it
+		return LoadAssetSynchronous(assetHandle);
+	}
+
+	Ref<Asset> EditorAssetManager::LoadAssetData(AssetHandle assetHandle)
+	{
+		BEY_PROFILE_FUNC();
+
+		// Copied so the importer doesn't hold on to registry memory while the lock is released
+		AssetMetadata metadata;
+		{
+			std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+			metadata = GetMetadataInternal(assetHandle);
 		}
-		else
+
+		if (!metadata.IsValid())
+			return nullptr;
+
+		Ref<Asset> asset;
+		if (!AssetImporter::TryLoadData(metadata, asset))
+			return nullptr;
+
+		return asset;
+	}
+
+	void EditorAssetManager::GetAssetDependencies(AssetHandle assetHandle, std::vector<AssetHandle>& outDependencies)
+	{
+		AssetMetadata metadata;
 		{
-			asset = m_LoadedAssets[assetHandle];
+			std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+			metadata = GetMetadataInternal(assetHandle);
 		}
 
+		if (metadata.IsValid())
+			AssetImporter::GetDependencies(metadata, outDependencies);
+	}
+
+	Ref<Asset> EditorAssetManager::PublishLoadedAsset(AssetHandle assetHandle, Ref<Asset> asset)
+	{
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+
+		if (IsMemoryAsset(assetHandle))
+			return m_MemoryAssets.at(assetHandle);
+
+		const auto& metadata = GetMetadataInternal(assetHandle);
+		if (!metadata.IsValid())
+			return nullptr;
+
+		if (metadata.IsDataLoaded)
+			return m_LoadedAssets[assetHandle];
+
+		if (!asset)
+			return nullptr;
+
+		m_AssetRegistry.SetDataLoaded(assetHandle, true);
+		m_LoadedAssets[assetHandle] = asset;
 		return asset;
 	}
 
 	void EditorAssetManager::AddMemoryOnlyAsset(Ref<Asset> asset)
 	{
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+
 		AssetMetadata metadata;
 		metadata.Handle = asset->Handle;
 		metadata.IsDataLoaded = true;
 		metadata.Type = asset->GetAssetType();
 		metadata.IsMemoryAsset = true;
-		m_AssetRegistry[metadata.Handle] = metadata;
+		m_AssetRegistry.Set(metadata);
 
 		m_MemoryAssets[asset->Handle] = asset;
 	}
 
 	std::unordered_set<AssetHandle> EditorAssetManager::GetAllAssetsWithType(AssetType type)
 	{
-		std::unordered_set<AssetHandle> result;
-		for (const auto& [handle, metadata] : m_AssetRegistry)
-		{
-			if (metadata.Type == type)
-				result.insert(handle);
-		}
-		return result;
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+		return m_AssetRegistry.GetHandles(type);
 	}
 
-	const AssetMetadata& EditorAssetManager::GetMetadata(AssetHandle handle)
+	std::unordered_map<AssetHandle, Ref<Asset>> EditorAssetManager::GetLoadedAssets()
 	{
-		if (m_AssetRegistry.Contains(handle))
-			return m_AssetRegistry[handle];
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+		return m_LoadedAssets;
+	}
 
-		return s_NullMetadata;
+	std::unordered_map<AssetHandle, Ref<Asset>> EditorAssetManager::GetMemoryOnlyAssets()
+	{
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+		return m_MemoryAssets;
+	}
+
+	const AssetMetadata& EditorAssetManager::GetMetadata(AssetHandle handle)
+	{
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+		return GetMetadataInternal(handle);
 	}
 
 	const AssetMetadata& EditorAssetManager::GetMetadata(const std::filesystem::path& filepath)
 	{
-		const auto relativePath = GetRelativePath(filepath);
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
 
-		for (auto& [handle, metadata] : m_AssetRegistry)
-		{
-			if (metadata.FilePath == relativePath)
-				return metadata;
-		}
+		AssetHandle handle = m_AssetRegistry.GetHandle(GetRelativePath(filepath));
+		if (handle != 0)
+			return m_AssetRegistry.Get(handle);
 
 		return s_NullMetadata;
 	}
@@ -116,14 +179,6 @@ namespace Beyond {
 		return GetMetadata(asset->Handle);
 	}
 
-	AssetMetadata& EditorAssetManager::GetMutableMetadata(AssetHandle handle)
-	{
-		if (m_AssetRegistry.Contains(handle))
-			return m_AssetRegistry[handle];
-
-		return s_NullMetadata;
-	}
-
 	AssetHandle EditorAssetManager::GetAssetHandleFromFilePath(const std::filesystem::path& filepath)
 	{
 		return GetMetadata(filepath).Handle;
@@ -180,29 +235,54 @@ namespace Beyond {
 
 	bool EditorAssetManager::ReloadData(AssetHandle assetHandle)
 	{
-		auto& metadata = GetMetadataInternal(assetHandle);
-		if (!metadata.IsValid())
+		// Loaded outside the lock so lookups of other assets don't wait for it
+		Ref<Asset> asset = LoadAssetData(assetHandle);
+
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+
+		if (!GetMetadataInternal(assetHandle).IsValid())
 		{
 			BEY_CORE_ERROR("Trying to reload invalid asset");
 			return false;
 		}
 
-		Ref<Asset> asset;
-		metadata.IsDataLoaded = AssetImporter::TryLoadData(metadata, asset);
-		if (metadata.IsDataLoaded)
+		m_AssetRegistry.SetDataLoaded(assetHandle, asset != nullptr);
+		if (asset)
 		{
 			m_LoadedAssets[assetHandle] = asset;
 		}
-		return metadata.IsDataLoaded;
+		return asset != nullptr;
+	}
+
+	void EditorAssetManager::FlushChanges()
+	{
+		m_RegistryJournal.Flush();
+		if (m_RegistryJournal.NeedsCompaction())
+			WriteRegistryToFile();
+	}
+
+	bool EditorAssetManager::IsAssetHandleValid(AssetHandle assetHandle)
+	{
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+		return IsMemoryAsset(assetHandle) || GetMetadataInternal(assetHandle).IsValid();
+	}
+
+	bool EditorAssetManager::IsMemoryAsset(AssetHandle handle)
+	{
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+		return m_MemoryAssets.find(handle) != m_MemoryAssets.end();
 	}
 
 	bool EditorAssetManager::IsAssetLoaded(AssetHandle handle)
 	{
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
 		return m_LoadedAssets.find(handle) != m_LoadedAssets.end();
 	}
 
 	void EditorAssetManager::RemoveAsset(AssetHandle handle)
 	{
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+
 		if (m_LoadedAssets.find(handle) != m_LoadedAssets.end())
 			m_LoadedAssets.erase(handle);
 
@@ -210,13 +290,19 @@ namespace Beyond {
 			m_MemoryAssets.erase(handle);
 
 		if (m_AssetRegistry.Contains(handle))
+		{
+			if (!m_AssetRegistry.Get(handle).IsMemoryAsset)
+				m_RegistryJournal.RecordRemove(handle);
 			m_AssetRegistry.Remove(handle);
+		}
 	}
 
 	AssetHandle EditorAssetManager::ImportAsset(const std::filesystem::path& filepath)
 	{
 		std::filesystem::path path = GetRelativePath(filepath);
 
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+
 		if (auto& metadata = GetMetadata(path); metadata.IsValid())
 			return metadata.Handle;
 
@@ -228,18 +314,25 @@ namespace Beyond {
 		metadata.Handle = AssetHandle();
 		metadata.FilePath = path;
 		metadata.Type = type;
-		m_AssetRegistry[metadata.Handle] = metadata;
+		m_AssetRegistry.Set(metadata);
+		m_RegistryJournal.RecordSet(metadata);
 
 		return metadata.Handle;
 	}
 
-	void EditorAssetManager::LoadAssetRegistry()
+	bool EditorAssetManager::LoadAssetRegistry()
 	{
 		BEY_CORE_INFO("[AssetManager] Loading Asset Registry");
 
 		const auto& assetRegistryPath = Project::GetAssetRegistryPath();
+		if (m_RegistryJournal.LoadSnapshot(m_AssetRegistry, assetRegistryPath))
+			return m_RegistryJournal.Replay(m_AssetRegistry) > 0;
+
 		if (!FileSystem::Exists(assetRegistryPath))
-			return;
+		{
+			m_RegistryJournal.Replay(m_AssetRegistry);
+			return true;
+		}
 
 		std::ifstream stream(assetRegistryPath);
 		BEY_CORE_ASSERT(stream);
@@ -252,7 +345,7 @@ namespace Beyond {
 		{
 			BEY_CORE_ERROR("[AssetManager] Asset Registry appears to be corrupted!");
 			BEY_CORE_VERIFY(false);
-			return;
+			return false;
 		}
 
 		for (auto entry : handles)
@@ -331,101 +424,174 @@ namespace Beyond {
 				continue;
 			}
 
-			m_AssetRegistry[metadata.Handle] = metadata;
+			m_AssetRegistry.Set(metadata);
 		}
 
 		BEY_CORE_INFO("[AssetManager] Loaded {0} asset entries", m_AssetRegistry.Count());
+
+		// Changes that didn't make it into the registry file before the editor closed
+		m_RegistryJournal.Replay(m_AssetRegistry);
+		return true;
 	}
 
 	void EditorAssetManager::ProcessDirectory(const std::filesystem::path& directoryPath)
 	{
-		for (auto entry : std::filesystem::directory_iterator(directoryPath))
+		BEY_PROFILE_FUNC();
+
+		Timer timer;
+		JobSystem& jobSystem = Application::Get().GetJobSystem();
+
+		// Breadth first, all directories of one level are listed in parallel
+		struct DirectoryContents
+		{
+			std::vector<std::filesystem::path> Directories;
+			std::vector<std::filesystem::path> Files;
+		};
+
+		std::vector<std::filesystem::path> files;
+		std::vector<std::filesystem::path> directories = { directoryPath };
+		while (!directories.empty())
+		{
+			std::vector<DirectoryContents> contents(directories.size());
+			jobSystem.ParallelFor((uint32_t)directories.size(), 1, [&](uint32_t index)
+			{
+				std::error_code error;
+				std::filesystem::directory_iterator it(directories[index], error);
+				for (; !error && it != std::filesystem::directory_iterator(); it.increment(error))
+				{
+					if (it->is_directory(error))
+						contents[index].Directories.push_back(it->path());
+					else
+						contents[index].Files.push_back(it->path());
+				}
+
+				if (error)
+					BEY_CORE_WARN_TAG("AssetManager", "Failed to scan '{}': {}", directories[index].string(), error.message());
+			});
+
+			directories.clear();
+			for (DirectoryContents& directoryContents : contents)
+			{
+				directories.insert(directories.end(), std::make_move_iterator(directoryContents.Directories.begin()), std::make_move_iterator(directoryContents.Directories.end()));
+				files.insert(files.end(), std::make_move_iterator(directoryContents.Files.begin()), std::make_move_iterator(directoryContents.Files.end()));
+			}
+		}
+
+		// Resolving paths and types doesn't touch the registry, only registering the new assets is serial
+		std::vector<std::filesystem::path> relativePaths(files.size());
+		std::vector<AssetType> types(files.size());
+		jobSystem.ParallelFor((uint32_t)files.size(), 64, [&](uint32_t index)
 		{
-			if (entry.is_directory())
-				ProcessDirectory(entry.path());
-			else
-				ImportAsset(entry.path());
+			relativePaths[index] = GetRelativePath(files[index]);
+			types[index] = GetAssetTypeFromPath(relativePaths[index]);
+		});
+
+		uint32_t importedCount = 0;
+		for (size_t i = 0; i < files.size(); i++)
+		{
+			if (types[i] == AssetType::None || m_AssetRegistry.GetHandle(relativePaths[i]) != 0)
+				continue;
+
+			AssetMetadata metadata;
+			metadata.Handle = AssetHandle();
+			metadata.FilePath = relativePaths[i];
+			metadata.Type = types[i];
+			m_AssetRegistry.Set(metadata);
+			m_RegistryJournal.RecordSet(metadata);
+			importedCount++;
 		}
+
+		BEY_CORE_INFO("[AssetManager] Scanned {0} files in {1:.2f} ms, imported {2} new assets", files.size(), timer.ElapsedMillis(), importedCount);
 	}
 
 	void EditorAssetManager::ReloadAssets()
 	{
 		ProcessDirectory(Project::GetAssetDirectory().string());
-		WriteRegistryToFile();
+		m_RegistryJournal.Flush();
 	}
 
 	void EditorAssetManager::WriteRegistryToFile()
 	{
+		m_RegistryJournal.BeginCompaction();
+
 		// Sort assets by UUID to make project managment easier
-		struct AssetRegistryEntry
-		{
-			std::string FilePath;
-			AssetType Type;
-		};
-		std::map<UUID, AssetRegistryEntry> sortedMap;
-		for (auto& [filepath, metadata] : m_AssetRegistry)
+		std::vector<AssetMetadata> entries;
 		{
-			if (!FileSystem::Exists(GetFileSystemPath(metadata)))
-				continue;
-
-			if (metadata.IsMemoryAsset)
-				continue;
+			// Loader threads add memory assets to the registry
+			std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+			entries.reserve(m_AssetRegistry.Count());
+			for (const auto& [filepath, metadata] : m_AssetRegistry)
+			{
+				if (metadata.IsMemoryAsset)
+					continue;
 
-			std::string pathToSerialize = metadata.FilePath.string();
-			// NOTE: if Windows
-			std::replace(pathToSerialize.begin(), pathToSerialize.end(), '\\', '/');
-			sortedMap[metadata.Handle] = { pathToSerialize, metadata.Type };
+				entries.push_back(metadata);
+			}
 		}
+		std::erase_if(entries, [this](const AssetMetadata& metadata) { return !FileSystem::Exists(GetFileSystemPath(metadata)); });
+		std::sort(entries.begin(), entries.end(), [](const AssetMetadata& a, const AssetMetadata& b) { return (uint64_t)a.Handle < (uint64_t)b.Handle; });
 
-		BEY_CORE_INFO("[AssetManager] serializing asset registry with {0} entries", sortedMap.size());
+		BEY_CORE_INFO("[AssetManager] serializing asset registry with {0} entries", entries.size());
 
 		YAML::Emitter out;
 		out << YAML::BeginMap;
 
 		out << YAML::Key << "Assets" << YAML::BeginSeq;
-		for (auto& [handle, entry] : sortedMap)
+		for (const AssetMetadata& metadata : entries)
 		{
+			// NOTE: if Windows
+			std::string pathToSerialize = metadata.FilePath.string();
+			std::replace(pathToSerialize.begin(), pathToSerialize.end(), '\\', '/');
+
 			out << YAML::BeginMap;
-			out << YAML::Key << "Handle" << YAML::Value << handle;
-			out << YAML::Key << "FilePath" << YAML::Value << entry.FilePath;
-			out << YAML::Key << "Type" << YAML::Value << Utils::AssetTypeToString(entry.Type);
+			out << YAML::Key << "Handle" << YAML::Value << metadata.Handle;
+			out << YAML::Key << "FilePath" << YAML::Value << pathToSerialize;
+			out << YAML::Key << "Type" << YAML::Value << Utils::AssetTypeToString(metadata.Type);
 			out << YAML::EndMap;
 		}
 		out << YAML::EndSeq;
 		out << YAML::EndMap;
 
-		const std::string& assetRegistryPath = Project::GetAssetRegistryPath().string();
-		std::ofstream fout(assetRegistryPath);
-		fout << out.c_str();
+		const std::filesystem::path assetRegistryPath = Project::GetAssetRegistryPath();
+		{
+			std::ofstream fout(assetRegistryPath);
+			fout << out.c_str();
+		}
+
+		// The snapshot records the registry file's timestamp, so it's written once the file is closed
+		m_RegistryJournal.Compact(entries, assetRegistryPath);
 	}
 
-	AssetMetadata& EditorAssetManager::GetMetadataInternal(AssetHandle handle)
+	const AssetMetadata& EditorAssetManager::GetMetadataInternal(AssetHandle handle)
 	{
 		if (m_AssetRegistry.Contains(handle))
 			return m_AssetRegistry[handle];
 
-		return s_NullMetadata; // make sure to check return value before you go changing it!
+		return s_NullMetadata;
 	}
 
 	void EditorAssetManager::OnAssetRenamed(AssetHandle assetHandle, const std::filesystem::path& newFilePath)
 	{
-		AssetMetadata& metadata = m_AssetRegistry[assetHandle];
-		if (!metadata.IsValid())
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+
+		if (!GetMetadata(assetHandle).IsValid())
 			return;
 
-		metadata.FilePath = GetRelativePath(newFilePath);
-		WriteRegistryToFile();
+		m_AssetRegistry.SetFilePath(assetHandle, GetRelativePath(newFilePath));
+		m_RegistryJournal.RecordSet(m_AssetRegistry.Get(assetHandle));
 	}
 
 	void EditorAssetManager::OnAssetDeleted(AssetHandle assetHandle)
 	{
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+
 		AssetMetadata metadata = GetMetadata(assetHandle);
 		if (!metadata.IsValid())
 			return;
 
 		m_AssetRegistry.Remove(assetHandle);
+		m_RegistryJournal.RecordRemove(assetHandle);
 		m_LoadedAssets.erase(assetHandle);
-		WriteRegistryToFile();
 	}
 
 }
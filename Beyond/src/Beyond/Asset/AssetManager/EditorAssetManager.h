@@ -6,6 +6,7 @@
 
 #include "Beyond/Asset/AssetImporter.h"
 #include "Beyond/Asset/AssetRegistry.h"
+#include "Beyond/Asset/AssetRegistryJournal.h"
 
 #include "Beyond/Utilities/FileSystem.h"
 
@@ -22,12 +23,16 @@ namespace Beyond {
 		virtual void AddMemoryOnlyAsset(Ref<Asset> asset) override;
 
 		virtual std::unordered_set<AssetHandle> GetAllAssetsWithType(AssetType type) override;
-		virtual const std::unordered_map<AssetHandle, Ref<Asset>>& GetLoadedAssets() override { return m_LoadedAssets; }
-		virtual const std::unordered_map<AssetHandle, Ref<Asset>>& GetMemoryOnlyAssets() override { return m_MemoryAssets; }
+		virtual std::unordered_map<AssetHandle, Ref<Asset>> GetLoadedAssets() override;
+		virtual std::unordered_map<AssetHandle, Ref<Asset>> GetMemoryOnlyAssets() override;
 
 		// Editor-only
 		const AssetMetadata& GetMetadata(AssetHandle handle);
-		AssetMetadata& GetMutableMetadata(AssetHandle handle);
+		void SetMetadataFilePath(AssetHandle handle, const std::filesystem::path& filepath)
+		{
+			std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+			m_AssetRegistry.SetFilePath(handle, filepath);
+		}
 		const AssetMetadata& GetMetadata(const std::filesystem::path& filepath);
 		const AssetMetadata& GetMetadata(const Ref<Asset>& asset);
 
@@ -46,11 +51,13 @@ namespace Beyond {
 		bool FileExists(AssetMetadata& metadata) const;
 
 		virtual bool ReloadData(AssetHandle assetHandle) override;
-		virtual bool IsAssetHandleValid(AssetHandle assetHandle) override { return IsMemoryAsset(assetHandle) || GetMetadata(assetHandle).IsValid(); }
-		virtual bool IsMemoryAsset(AssetHandle handle) override { return m_MemoryAssets.find(handle) != m_MemoryAssets.end(); }
+		virtual void FlushChanges() override;
+		virtual bool IsAssetHandleValid(AssetHandle assetHandle) override;
+		virtual bool IsMemoryAsset(AssetHandle handle) override;
 		virtual bool IsAssetLoaded(AssetHandle handle) override;
 		virtual void RemoveAsset(AssetHandle handle) override;
 
+		// Not guarded by the asset mutex, only iterate it on the main thread while no loads are running
 		const AssetRegistry& GetAssetRegistry() const { return m_AssetRegistry; }
 
 		template<typename T, typename... Args>
@@ -67,6 +74,8 @@ namespace Beyond {
 			metadata.IsDataLoaded = true;
 			metadata.Type = T::GetStaticType();
 
+			std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+
 			/*if (FileExists(metadata))
 			{
 				bool foundAvailableFileName = false;
@@ -93,9 +102,8 @@ namespace Beyond {
 				}
 			}*/
 
-			m_AssetRegistry[metadata.Handle] = metadata;
-
-			WriteRegistryToFile();
+			m_AssetRegistry.Set(metadata);
+			m_RegistryJournal.RecordSet(metadata);
 
 			Ref<T> asset = Ref<T>::Create(std::forward<Args>(args)...);
 			asset->Handle = metadata.Handle;
@@ -120,7 +128,8 @@ namespace Beyond {
 			metadata.Type = TAsset::GetStaticType();
 			metadata.IsMemoryAsset = true;
 
-			m_AssetRegistry[metadata.Handle] = metadata;
+			std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+			m_AssetRegistry.Set(metadata);
 
 			m_MemoryAssets[asset->Handle] = asset;
 			return asset->Handle;
@@ -132,20 +141,26 @@ namespace Beyond {
 			Ref<Asset> asset = GetAsset(GetAssetHandleFromFilePath(filepath));
 			return asset.As<T>();
 		}
+	protected:
+		virtual Ref<Asset> LoadAssetData(AssetHandle assetHandle) override;
+		virtual void GetAssetDependencies(AssetHandle assetHandle, std::vector<AssetHandle>& outDependencies) override;
+		virtual Ref<Asset> PublishLoadedAsset(AssetHandle assetHandle, Ref<Asset> asset) override;
 	private:
-		void LoadAssetRegistry();
+		bool LoadAssetRegistry();
 		void ProcessDirectory(const std::filesystem::path& directoryPath);
 		void ReloadAssets();
-		void WriteRegistryToFile();
+		void WriteRegistryToFile(); // Compacts the registry journal as well
 
-		AssetMetadata& GetMetadataInternal(AssetHandle handle);
+		const AssetMetadata& GetMetadataInternal(AssetHandle handle);
 
 		void OnAssetRenamed(AssetHandle assetHandle, const std::filesystem::path& newFilePath);
 		void OnAssetDeleted(AssetHandle assetHandle);
 	private:
+		// Guarded by m_AssetMutex, loader threads read them and add memory assets (e.g. the materials of a mesh)
 		std::unordered_map<AssetHandle, Ref<Asset>> m_LoadedAssets;
 		std::unordered_map<AssetHandle, Ref<Asset>> m_MemoryAssets;
 		AssetRegistry m_AssetRegistry;
+		AssetRegistryJournal m_RegistryJournal;
 
 		friend class ContentBrowserPanel;
 		friend class ContentBrowserAsset;
@@ -17,15 +17,24 @@ namespace Beyond {
 
 	RuntimeAssetManager::~RuntimeAssetManager()
 	{
+		ShutdownAsyncLoads();
 	}
 
 	AssetType RuntimeAssetManager::GetAssetType(AssetHandle assetHandle)
 	{
-		Ref<Asset> asset = GetAsset(assetHandle);
-		if (!asset)
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+
+		if (IsMemoryAsset(assetHandle))
+			return m_MemoryAssets[assetHandle]->GetAssetType();
+
+		if (IsAssetLoaded(assetHandle))
+			return m_LoadedAssets[assetHandle]->GetAssetType();
+
+		// The pack index knows the type, no need to load the asset
+		if (!m_AssetPack)
 			return AssetType::None;
 
-		return asset->GetAssetType();
+		return m_AssetPack->GetAssetType(m_ActiveScene, assetHandle);
 	}
 
 	Ref<Asset> RuntimeAssetManager::GetAsset(AssetHandle assetHandle)
@@ -33,39 +42,74 @@ namespace Beyond {
 		BEY_PROFILE_FUNC();
 		BEY_SCOPE_PERF("AssetManager::GetAsset");
 
-		if (IsMemoryAsset(assetHandle))
-			return m_MemoryAssets[assetHandle];
-
-		Ref<Asset> asset = nullptr;
-		bool isLoaded = IsAssetLoaded(assetHandle);
-		if (isLoaded)
 		{
-			asset = m_LoadedAssets[assetHandle];
+			std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+
+			if (IsMemoryAsset(assetHandle))
+				return m_MemoryAssets[assetHandle];
+
+			if (IsAssetLoaded(assetHandle))
+				return m_LoadedAssets[assetHandle];
 		}
-		else
-		{
-			// Needs load
-			asset = m_AssetPack->LoadAsset(m_ActiveScene, assetHandle);
-			if (!asset)
-				return nullptr;
 
-			m_LoadedAssets[assetHandle] = asset;
+		// Needs load, the asset mutex is released so lookups of loaded assets don't wait for it
+		return LoadAssetSynchronous(assetHandle);
+	}
+
+	Ref<Asset> RuntimeAssetManager::LoadAssetData(AssetHandle assetHandle)
+	{
+		BEY_PROFILE_FUNC();
+
+		// The pack is taken under the lock so it stays alive if it's replaced during the load. The pack itself is safe to
+		// load from concurrently: its index and mapping are read-only, and every load reads through its own stream reader.
+		Ref<AssetPack> assetPack;
+		AssetHandle activeScene;
+		{
+			std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+			assetPack = m_AssetPack;
+			activeScene = m_ActiveScene;
 		}
+
+		if (!assetPack)
+			return nullptr;
+
+		return assetPack->LoadAsset(activeScene, assetHandle);
+	}
+
+	Ref<Asset> RuntimeAssetManager::PublishLoadedAsset(AssetHandle assetHandle, Ref<Asset> asset)
+	{
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+
+		if (IsMemoryAsset(assetHandle))
+			return m_MemoryAssets[assetHandle];
+
+		if (IsAssetLoaded(assetHandle))
+			return m_LoadedAssets[assetHandle];
+
+		if (!asset)
+			return nullptr;
+
+		m_LoadedAssets[assetHandle] = asset;
 		return asset;
 	}
 
 	void RuntimeAssetManager::AddMemoryOnlyAsset(Ref<Asset> asset)
 	{
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+
 		m_MemoryAssets[asset->Handle] = asset;
 	}
 
 	bool RuntimeAssetManager::ReloadData(AssetHandle assetHandle)
 	{
-		Ref<Asset> asset = m_AssetPack->LoadAsset(m_ActiveScene, assetHandle);
-		if (asset)
-			m_LoadedAssets[assetHandle] = asset;
-		
-		return asset;
+		// Loaded outside the lock so lookups of other assets don't wait for it
+		Ref<Asset> asset = LoadAssetData(assetHandle);
+		if (!asset)
+			return false;
+
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+		m_LoadedAssets[assetHandle] = asset;
+		return true;
 	}
 
 	bool RuntimeAssetManager::IsAssetHandleValid(AssetHandle assetHandle)
@@ -73,21 +117,26 @@ namespace Beyond {
 		if (assetHandle == 0)
 			return false;
 
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
 		return IsMemoryAsset(assetHandle) || (m_AssetPack && m_AssetPack->IsAssetHandleValid(assetHandle));
 	}
 
 	bool RuntimeAssetManager::IsMemoryAsset(AssetHandle handle)
 	{
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
 		return m_MemoryAssets.find(handle) != m_MemoryAssets.end();
 	}
 
 	bool RuntimeAssetManager::IsAssetLoaded(AssetHandle handle)
 	{
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
 		return m_LoadedAssets.find(handle) != m_LoadedAssets.end();
 	}
 
 	void RuntimeAssetManager::RemoveAsset(AssetHandle handle)
 	{
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+
 		if (m_LoadedAssets.find(handle) != m_LoadedAssets.end())
 			m_LoadedAssets.erase(handle);
 
@@ -95,6 +144,18 @@ namespace Beyond {
 			m_MemoryAssets.erase(handle);
 	}
 
+	std::unordered_map<AssetHandle, Ref<Asset>> RuntimeAssetManager::GetLoadedAssets()
+	{
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+		return m_LoadedAssets;
+	}
+
+	std::unordered_map<AssetHandle, Ref<Asset>> RuntimeAssetManager::GetMemoryOnlyAssets()
+	{
+		std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
+		return m_MemoryAssets;
+	}
+
 	std::unordered_set<Beyond::AssetHandle> RuntimeAssetManager::GetAllAssetsWithType(AssetType type)
 	{
 		std::unordered_set<AssetHandle> result;
@@ -106,7 +167,10 @@ namespace Beyond {
 	{
 		Ref<Scene> scene = m_AssetPack->LoadScene(handle);
 		if (scene)
+		{
+			std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex);
 			m_ActiveScene = handle;
+		}
 
 		return scene;
 	}
@@ -23,13 +23,16 @@ namespace Beyond {
 		virtual void RemoveAsset(AssetHandle handle) override;
 
 		virtual std::unordered_set<AssetHandle> GetAllAssetsWithType(AssetType type) override;
-		virtual std::unordered_map<AssetHandle, Ref<Asset>>& GetLoadedAssets() override { return m_LoadedAssets; }
-		virtual std::unordered_map<AssetHandle, Ref<Asset>>& GetMemoryOnlyAssets() override { return m_MemoryAssets; }
+		virtual std::unordered_map<AssetHandle, Ref<Asset>> GetLoadedAssets() override;
+		virtual std::unordered_map<AssetHandle, Ref<Asset>> GetMemoryOnlyAssets() override;
 		
 		// Loads Scene and makes active
 		Ref<Scene> LoadScene(AssetHandle handle);
 
-		void SetAssetPack(Ref<AssetPack> assetPack) { m_AssetPack = assetPack; }
+		void SetAssetPack(Ref<AssetPack> assetPack) { std::scoped_lock<std::recursive_mutex> lock(m_AssetMutex); m_AssetPack = assetPack; }
+	protected:
+		virtual Ref<Asset> LoadAssetData(AssetHandle assetHandle) override;
+		virtual Ref<Asset> PublishLoadedAsset(AssetHandle assetHandle, Ref<Asset> asset) override;
 	private:
 		std::unordered_map<AssetHandle, Ref<Asset>> m_LoadedAssets;
 		std::unordered_map<AssetHandle, Ref<Asset>> m_MemoryAssets;
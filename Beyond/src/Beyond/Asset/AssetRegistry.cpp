@@ -12,12 +12,9 @@ namespace Beyond {
 
 	static std::mutex s_AssetRegistryMutex;
 
-	AssetMetadata& AssetRegistry::operator[](const AssetHandle handle)
+	const AssetMetadata& AssetRegistry::operator[](const AssetHandle handle) const
 	{
-		std::scoped_lock<std::mutex> lock(s_AssetRegistryMutex);
-
-		ASSET_LOG("Retrieving handle {}", handle);
-		return m_AssetRegistry[handle];
+		return Get(handle);
 	}
 
 	const AssetMetadata& AssetRegistry::Get(const AssetHandle handle) const
@@ -29,12 +26,64 @@ namespace Beyond {
 		return m_AssetRegistry.at(handle);
 	}
 
-	AssetMetadata& AssetRegistry::Get(const AssetHandle handle)
+	void AssetRegistry::Set(const AssetMetadata& metadata)
+	{
+		std::scoped_lock<std::mutex> lock(s_AssetRegistryMutex);
+
+		ASSET_LOG("Setting handle {}", metadata.Handle);
+		auto it = m_AssetRegistry.find(metadata.Handle);
+		if (it != m_AssetRegistry.end())
+		{
+			RemoveFromIndices(it->second);
+			it->second = metadata;
+		}
+		else
+		{
+			m_AssetRegistry.emplace(metadata.Handle, metadata);
+		}
+		AddToIndices(metadata);
+	}
+
+	void AssetRegistry::SetFilePath(const AssetHandle handle, const std::filesystem::path& filepath)
+	{
+		std::scoped_lock<std::mutex> lock(s_AssetRegistryMutex);
+
+		auto it = m_AssetRegistry.find(handle);
+		if (it == m_AssetRegistry.end())
+			return;
+
+		ASSET_LOG("Moving handle {} to {}", handle, filepath.string());
+		RemoveFromIndices(it->second);
+		it->second.FilePath = filepath;
+		AddToIndices(it->second);
+	}
+
+	void AssetRegistry::SetDataLoaded(const AssetHandle handle, bool loaded)
 	{
 		std::scoped_lock<std::mutex> lock(s_AssetRegistryMutex);
 
-		ASSET_LOG("Retrieving handle {}", handle);
-		return m_AssetRegistry[handle];
+		// Not part of any index
+		auto it = m_AssetRegistry.find(handle);
+		if (it != m_AssetRegistry.end())
+			it->second.IsDataLoaded = loaded;
+	}
+
+	AssetHandle AssetRegistry::GetHandle(const std::filesystem::path& filepath) const
+	{
+		const std::string key = GetPathKey(filepath);
+
+		std::scoped_lock<std::mutex> lock(s_AssetRegistryMutex);
+
+		auto it = m_PathIndex.find(key);
+		return it != m_PathIndex.end() ? it->second : AssetHandle(0);
+	}
+
+	std::unordered_set<AssetHandle> AssetRegistry::GetHandles(AssetType type) const
+	{
+		std::scoped_lock<std::mutex> lock(s_AssetRegistryMutex);
+
+		auto it = m_TypeIndex.find(type);
+		return it != m_TypeIndex.end() ? it->second : std::unordered_set<AssetHandle>();
 	}
 
 	bool AssetRegistry::Contains(const AssetHandle handle) const
@@ -50,7 +99,13 @@ namespace Beyond {
 		std::scoped_lock<std::mutex> lock(s_AssetRegistryMutex);
 
 		ASSET_LOG("Removing handle", handle);
-		return m_AssetRegistry.erase(handle);
+		auto it = m_AssetRegistry.find(handle);
+		if (it == m_AssetRegistry.end())
+			return 0;
+
+		RemoveFromIndices(it->second);
+		m_AssetRegistry.erase(it);
+		return 1;
 	}
 
 	void AssetRegistry::Clear()
@@ -59,6 +114,36 @@ namespace Beyond {
 
 		ASSET_LOG("Clearing registry");
 		m_AssetRegistry.clear();
+		m_PathIndex.clear();
+		m_TypeIndex.clear();
+	}
+
+	std::string AssetRegistry::GetPathKey(const std::filesystem::path& filepath)
+	{
+		return filepath.lexically_normal().generic_string();
+	}
+
+	void AssetRegistry::AddToIndices(const AssetMetadata& metadata)
+	{
+		// If two entries share a path the first one registered keeps it
+		if (!metadata.FilePath.empty())
+			m_PathIndex.emplace(GetPathKey(metadata.FilePath), metadata.Handle);
+
+		m_TypeIndex[metadata.Type].insert(metadata.Handle);
+	}
+
+	void AssetRegistry::RemoveFromIndices(const AssetMetadata& metadata)
+	{
+		if (!metadata.FilePath.empty())
+		{
+			auto it = m_PathIndex.find(GetPathKey(metadata.FilePath));
+			if (it != m_PathIndex.end() && it->second == metadata.Handle)
+				m_PathIndex.erase(it);
+		}
+
+		auto typeIt = m_TypeIndex.find(metadata.Type);
+		if (typeIt != m_TypeIndex.end())
+			typeIt->second.erase(metadata.Handle);
 	}
 
 }
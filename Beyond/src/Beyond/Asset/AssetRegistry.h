@@ -3,27 +3,44 @@
 #include "AssetMetadata.h"
 
 #include <unordered_map>
+#include <unordered_set>
 
 namespace Beyond {
 
+	// Besides handle -> metadata, the registry keeps a path -> handle and a type -> handles index.
+	// Metadata is read-only from outside, all changes go through the setters so the indices stay in sync.
 	class AssetRegistry
 	{
 	public:
-		AssetMetadata& operator[](const AssetHandle handle);
-		AssetMetadata& Get(const AssetHandle handle);
+		// The handle has to be in the registry
+		const AssetMetadata& operator[](const AssetHandle handle) const;
 		const AssetMetadata& Get(const AssetHandle handle) const;
 
+		void Set(const AssetMetadata& metadata);
+		void SetFilePath(const AssetHandle handle, const std::filesystem::path& filepath);
+		void SetDataLoaded(const AssetHandle handle, bool loaded);
+
+		// Returns 0 if no asset has this path, filepath is expected to be relative to the asset directory
+		AssetHandle GetHandle(const std::filesystem::path& filepath) const;
+		std::unordered_set<AssetHandle> GetHandles(AssetType type) const;
+
 		size_t Count() const { return m_AssetRegistry.size(); }
 		bool Contains(const AssetHandle handle) const;
 		size_t Remove(const AssetHandle handle);
 		void Clear();
 
-		auto begin() { return m_AssetRegistry.begin(); }
-		auto end() { return m_AssetRegistry.end(); }
 		auto begin() const { return m_AssetRegistry.cbegin(); }
 		auto end() const { return m_AssetRegistry.cend(); }
+
+		// Key used by the path index, lexically normal with '/' separators
+		static std::string GetPathKey(const std::filesystem::path& filepath);
+	private:
+		void AddToIndices(const AssetMetadata& metadata);
+		void RemoveFromIndices(const AssetMetadata& metadata);
 	private:
 		std::unordered_map<AssetHandle, AssetMetadata> m_AssetRegistry;
+		std::unordered_map<std::string, AssetHandle> m_PathIndex;
+		std::unordered_map<AssetType, std::unordered_set<AssetHandle>> m_TypeIndex;
 	};
 
 }
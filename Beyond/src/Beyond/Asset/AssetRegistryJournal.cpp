@@ -0,0 +1,318 @@
+#include "pch.h"
+#include "AssetRegistryJournal.h"
+
+#include "Beyond/Core/Timer.h"
+#include "Beyond/Debug/Profiler.h"
+#include "Beyond/Serialization/MemoryStream.h"
+#include "Beyond/Utilities/FileSystem.h"
+
+namespace Beyond {
+
+	namespace Utils {
+
+		static void GetRegistryFileStamp(const std::filesystem::path& filepath, int64_t& outTime, uint64_t& outSize)
+		{
+			std::error_code error;
+			outTime = (int64_t)std::filesystem::last_write_time(filepath, error).time_since_epoch().count();
+			outSize = std::filesystem::file_size(filepath, error);
+			if (error)
+			{
+				outTime = 0;
+				outSize = 0;
+			}
+		}
+
+		static Buffer ReadFileIfExists(const std::filesystem::path& filepath)
+		{
+			std::error_code error;
+			if (!std::filesystem::exists(filepath, error) || std::filesystem::file_size(filepath, error) == 0 || error)
+				return {};
+
+			return FileSystem::ReadBytes(filepath);
+		}
+
+		static void WritePath(StreamWriter& stream, const std::filesystem::path& filepath)
+		{
+			stream.WriteString(filepath.generic_string());
+		}
+
+		// Unlike StreamReader::ReadString the size is validated, the files can be cut short by a crash
+		static bool ReadPath(StreamReader& stream, uint64_t end, std::filesystem::path& outPath)
+		{
+			size_t size = 0;
+			if (!stream.ReadData((char*)&size, sizeof(size)) || size > end - stream.GetStreamPosition())
+				return false;
+
+			std::string string(size, '\0');
+			if (!stream.ReadData(string.data(), size))
+				return false;
+
+			outPath = string;
+			return true;
+		}
+
+	}
+
+	AssetRegistryJournal::AssetRegistryJournal(const std::filesystem::path& snapshotPath, const std::filesystem::path& journalPath)
+		: m_SnapshotPath(snapshotPath), m_JournalPath(journalPath)
+	{
+	}
+
+	AssetRegistryJournal::~AssetRegistryJournal()
+	{
+		m_PendingRecords.Release();
+	}
+
+	bool AssetRegistryJournal::LoadSnapshot(AssetRegistry& registry, const std::filesystem::path& registryFilePath)
+	{
+		BEY_PROFILE_FUNC();
+
+		Timer timer;
+		Buffer data = Utils::ReadFileIfExists(m_SnapshotPath);
+		if (!data)
+			return false;
+
+		MemoryStreamReader stream(data);
+		SnapshotHeader header;
+		bool valid = stream.ReadData((char*)&header, sizeof(header));
+
+		int64_t registryFileTime;
+		uint64_t registryFileSize;
+		Utils::GetRegistryFileStamp(registryFilePath, registryFileTime, registryFileSize);
+
+		valid = valid && memcmp(header.HEADER, SnapshotHeader().HEADER, sizeof(header.HEADER)) == 0 && header.Version == CurrentVersion;
+
+		// The YAML registry changed outside of the editor (version control, ...), it wins over the snapshot
+		if (!valid || header.RegistryFileTime != registryFileTime || header.RegistryFileSize != registryFileSize)
+		{
+			data.Release();
+			return false;
+		}
+
+		m_Generation = header.Generation;
+
+		std::vector<AssetMetadata> entries(header.EntryCount);
+		for (AssetMetadata& metadata : entries)
+		{
+			uint16_t type = 0;
+			valid = stream.ReadData((char*)&metadata.Handle, sizeof(uint64_t)) && stream.ReadData((char*)&type, sizeof(type))
+				&& Utils::ReadPath(stream, data.Size, metadata.FilePath);
+			if (!valid)
+				break;
+
+			metadata.Type = (AssetType)type;
+		}
+		data.Release();
+
+		if (!valid)
+		{
+			BEY_CORE_WARN_TAG("AssetManager", "Asset registry snapshot '{}' is corrupted, reading the registry file instead", m_SnapshotPath.string());
+			return false;
+		}
+
+		for (const AssetMetadata& metadata : entries)
+			registry.Set(metadata);
+
+		BEY_CORE_INFO_TAG("AssetManager", "Loaded {} asset entries from the registry snapshot in {:.2f} ms", entries.size(), timer.ElapsedMillis());
+		return true;
+	}
+
+	uint32_t AssetRegistryJournal::Replay(AssetRegistry& registry)
+	{
+		BEY_PROFILE_FUNC();
+
+		uint32_t recordCount = 0;
+		bool valid = false;
+		Buffer data = Utils::ReadFileIfExists(m_JournalPath);
+		if (data)
+		{
+			MemoryStreamReader stream(data);
+			// A journal of another generation has been compacted into the snapshot already (or belongs to a snapshot that's gone)
+			JournalHeader header;
+			valid = stream.ReadData((char*)&header, sizeof(header)) && memcmp(header.HEADER, JournalHeader().HEADER, sizeof(header.HEADER)) == 0 && header.Version == CurrentVersion && header.Generation == m_Generation;
+			while (valid && stream.GetStreamPosition() < data.Size)
+			{
+				BatchHeader batch;
+				valid = stream.ReadData((char*)&batch, sizeof(batch)) && stream.GetStreamPosition() + batch.Size <= data.Size;
+				if (!valid)
+					break; // Cut short by a crash
+
+				const uint64_t batchEnd = stream.GetStreamPosition() + batch.Size;
+				for (uint32_t i = 0; valid && i < batch.RecordCount; i++)
+				{
+					Operation operation;
+					uint64_t handle = 0;
+					uint16_t type = 0;
+					std::filesystem::path filepath;
+					valid = stream.ReadData((char*)&operation, sizeof(operation)) && stream.ReadData((char*)&handle, sizeof(handle))
+						&& stream.ReadData((char*)&type, sizeof(type)) && Utils::ReadPath(stream, batchEnd, filepath);
+					if (!valid)
+						break;
+
+					if (operation == Operation::Set)
+					{
+						AssetMetadata metadata;
+						metadata.Handle = handle;
+						metadata.Type = (AssetType)type;
+						metadata.FilePath = filepath;
+						registry.Set(metadata);
+					}
+					else if (operation == Operation::Remove)
+					{
+						registry.Remove(handle);
+					}
+					recordCount++;
+				}
+
+				stream.SetStreamPosition(batchEnd);
+			}
+		}
+		data.Release();
+
+		if (recordCount > 0)
+			BEY_CORE_INFO_TAG("AssetManager", "Replayed {} asset registry changes", recordCount);
+
+		// Appending behind a damaged tail would make later batches unreadable, start over. Callers compact
+		// after replaying anything so the records dropped here are in the snapshot.
+		if (!valid)
+			ResetJournal();
+
+		m_RecordCount = recordCount;
+		return recordCount;
+	}
+
+	void AssetRegistryJournal::RecordSet(const AssetMetadata& metadata)
+	{
+		if (metadata.IsMemoryAsset)
+			return;
+
+		WriteRecord(Operation::Set, metadata.Handle, metadata.Type, metadata.FilePath);
+	}
+
+	void AssetRegistryJournal::RecordRemove(AssetHandle handle)
+	{
+		WriteRecord(Operation::Remove, handle, AssetType::None, {});
+	}
+
+	void AssetRegistryJournal::WriteRecord(Operation operation, AssetHandle handle, AssetType type, const std::filesystem::path& filepath)
+	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		MemoryStreamWriter stream(m_PendingRecords, 4096);
+		stream.SetStreamPosition(m_PendingSize);
+		stream.WriteRaw(operation);
+		stream.WriteRaw((uint64_t)handle);
+		stream.WriteRaw((uint16_t)type);
+		Utils::WritePath(stream, filepath);
+		m_PendingSize = stream.GetStreamPosition();
+
+		m_PendingRecordCount++;
+		m_RecordCount++;
+		if (m_PendingRecordCount >= FlushRecordCount && !m_Compacting)
+			FlushPendingRecords();
+	}
+
+	void AssetRegistryJournal::Flush()
+	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+		if (!m_Compacting)
+			FlushPendingRecords();
+	}
+
+	void AssetRegistryJournal::FlushPendingRecords()
+	{
+		if (m_PendingRecordCount == 0)
+			return;
+
+		BEY_PROFILE_FUNC();
+
+		BatchHeader batch;
+		batch.RecordCount = m_PendingRecordCount;
+		batch.Size = (uint32_t)m_PendingSize;
+
+		std::ofstream stream(m_JournalPath, std::ios::binary | std::ios::app);
+		stream.write((const char*)&batch, sizeof(batch));
+		stream.write((const char*)m_PendingRecords.Data, m_PendingSize);
+		if (!stream)
+			BEY_CORE_ERROR_TAG("AssetManager", "Failed to write asset registry journal '{}'", m_JournalPath.string());
+
+		m_PendingSize = 0;
+		m_PendingRecordCount = 0;
+	}
+
+	void AssetRegistryJournal::BeginCompaction()
+	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		// Everything journaled so far is in the registry the entries are read from
+		FlushPendingRecords();
+		m_Compacting = true;
+	}
+
+	void AssetRegistryJournal::Compact(const std::vector<AssetMetadata>& entries, const std::filesystem::path& registryFilePath)
+	{
+		BEY_CORE_ASSERT(m_Compacting, "BeginCompaction has to be called before reading the registry");
+
+		BEY_PROFILE_FUNC();
+
+		Timer timer;
+
+		SnapshotHeader header;
+		header.Generation = m_Generation + 1;
+		header.EntryCount = (uint32_t)entries.size();
+		Utils::GetRegistryFileStamp(registryFilePath, header.RegistryFileTime, header.RegistryFileSize);
+
+		Buffer data;
+		MemoryStreamWriter stream(data, sizeof(SnapshotHeader) + entries.size() * 64);
+		stream.WriteRaw(header);
+		for (const AssetMetadata& metadata : entries)
+		{
+			stream.WriteRaw((uint64_t)metadata.Handle);
+			stream.WriteRaw((uint16_t)metadata.Type);
+			Utils::WritePath(stream, metadata.FilePath);
+		}
+
+		// Written next to the old snapshot and swapped in, a crash leaves either the old or the new one
+		std::filesystem::create_directories(m_SnapshotPath.parent_path());
+		std::filesystem::path temporaryPath = m_SnapshotPath;
+		temporaryPath += ".tmp";
+
+		std::error_code error;
+		bool written = FileSystem::WriteBytes(temporaryPath, Buffer(data.Data, stream.GetWrittenSize()));
+		data.Release();
+		if (written)
+			std::filesystem::rename(temporaryPath, m_SnapshotPath, error);
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+		m_Compacting = false;
+
+		if (!written || error)
+		{
+			// The held back records go to the old journal, which still belongs to the old snapshot
+			BEY_CORE_ERROR_TAG("AssetManager", "Failed to write asset registry snapshot '{}'", m_SnapshotPath.string());
+			return;
+		}
+
+		// The journal starts over with the records made while the entries were read, replaying
+		// the ones that made it into the snapshot anyway is harmless
+		m_Generation = header.Generation;
+		ResetJournal();
+		FlushPendingRecords();
+
+		BEY_CORE_INFO_TAG("AssetManager", "Compacted asset registry ({} entries) in {:.2f} ms", entries.size(), timer.ElapsedMillis());
+	}
+
+	void AssetRegistryJournal::ResetJournal()
+	{
+		std::filesystem::create_directories(m_JournalPath.parent_path());
+
+		JournalHeader header;
+		header.Generation = m_Generation;
+
+		std::ofstream stream(m_JournalPath, std::ios::binary | std::ios::trunc);
+		stream.write((const char*)&header, sizeof(header));
+
+		m_RecordCount = m_PendingRecordCount;
+	}
+
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "AssetRegistry.h"
+
+#include "Beyond/Core/Buffer.h"
+
+#include <filesystem>
+#include <mutex>
+
+namespace Beyond {
+
+	// Persists the editor's asset registry without rewriting all of it on every change.
+	//
+	// Changes are appended to a journal as they happen and written out in batches. Once enough records
+	// piled up the registry is compacted: the YAML registry file (the one that goes into version control)
+	// and a binary snapshot of it are rewritten and the journal starts over. Startup reads the snapshot
+	// and replays the journal, the YAML is only parsed when it changed outside of the editor.
+	//
+	//   Snapshot: SnapshotHeader, then per entry uint64_t Handle, uint16_t Type, string FilePath
+	//   Journal:  JournalHeader, then batches of BatchHeader + records (uint8_t Op, uint64_t Handle, uint16_t Type, string FilePath)
+	//
+	// A journal belongs to the snapshot with the same Generation, batches cut short by a crash are ignored.
+	class AssetRegistryJournal
+	{
+	public:
+		static constexpr uint32_t CurrentVersion = 1;
+
+		static constexpr uint32_t FlushRecordCount = 64; // Flush() writes smaller batches too, once per frame
+		static constexpr uint32_t CompactionRecordCount = 4096;
+
+		struct SnapshotHeader
+		{
+			char HEADER[4] = { 'H','Z','R','S' };
+			uint32_t Version = CurrentVersion;
+			uint64_t Generation = 0;
+			int64_t RegistryFileTime = 0; // Last write time and size of the YAML registry the snapshot matches
+			uint64_t RegistryFileSize = 0;
+			uint32_t EntryCount = 0;
+			uint32_t Reserved = 0;
+		};
+
+		struct JournalHeader
+		{
+			char HEADER[4] = { 'H','Z','R','J' };
+			uint32_t Version = CurrentVersion;
+			uint64_t Generation = 0;
+		};
+
+		struct BatchHeader
+		{
+			uint32_t RecordCount = 0;
+			uint32_t Size = 0; // Bytes following the batch header
+		};
+
+		enum class Operation : uint8_t
+		{
+			Set = 1,
+			Remove = 2
+		};
+
+	public:
+		AssetRegistryJournal(const std::filesystem::path& snapshotPath, const std::filesystem::path& journalPath);
+		AssetRegistryJournal(const AssetRegistryJournal&) = delete;
+		~AssetRegistryJournal();
+
+		// Fills the registry from the snapshot if it matches the YAML registry file, returns false otherwise
+		bool LoadSnapshot(AssetRegistry& registry, const std::filesystem::path& registryFilePath);
+
+		// Applies the changes journaled since the last compaction, returns the number of records applied
+		uint32_t Replay(AssetRegistry& registry);
+
+		void RecordSet(const AssetMetadata& metadata);
+		void RecordRemove(AssetHandle handle);
+
+		void Flush();
+
+		uint32_t GetRecordCount() const { return m_RecordCount; }
+		bool NeedsCompaction() const { return m_RecordCount >= CompactionRecordCount; }
+
+		// Call before reading the registry for Compact. Records made from then on may be missing from the
+		// entries, so they're held back and carried over into the new journal.
+		void BeginCompaction();
+		// entries is the registry as written to the YAML registry file, which has to be written already
+		void Compact(const std::vector<AssetMetadata>& entries, const std::filesystem::path& registryFilePath);
+
+	private:
+		void WriteRecord(Operation operation, AssetHandle handle, AssetType type, const std::filesystem::path& filepath);
+		void FlushPendingRecords();
+		void ResetJournal();
+
+	private:
+		std::filesystem::path m_SnapshotPath;
+		std::filesystem::path m_JournalPath;
+		uint64_t m_Generation = 0;
+
+		// Assets can be imported from loader threads
+		std::mutex m_Mutex;
+		Buffer m_PendingRecords;
+		uint64_t m_PendingSize = 0;
+		uint32_t m_PendingRecordCount = 0;
+		bool m_Compacting = false; // Pending records are held back until Compact starts the new journal
+
+		uint32_t m_RecordCount = 0; // In the journal file and pending
+	};
+
+}
@@ -46,7 +46,7 @@ namespace Beyond {
 		return result;
 	}
 
-	bool TextureSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const
+	bool TextureSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const
 	{
 		outInfo.Offset = stream.GetStreamPosition();
 
@@ -56,7 +56,7 @@ namespace Beyond {
 		return true;
 	}
 
-	Ref<Asset> TextureSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
+	Ref<Asset> TextureSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
 	{
 		BEY_CORE_WARN("TextureSerializer::DeserializeFromAssetPack");
 
@@ -83,7 +83,7 @@ namespace Beyond {
 		return true;
 	}
 
-	bool FontSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const
+	bool FontSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const
 	{
 		outInfo.Offset = stream.GetStreamPosition();
 
@@ -97,7 +97,7 @@ namespace Beyond {
 		return true;
 	}
 
-	Ref<Asset> FontSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
+	Ref<Asset> FontSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
 	{
 		stream.SetStreamPosition(assetInfo.PackedOffset);
 
@@ -142,7 +142,28 @@ namespace Beyond {
 		return true;
 	}
 
-	bool MaterialAssetSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const
+	void MaterialAssetSerializer::GetDependencies(const AssetMetadata& metadata, std::vector<AssetHandle>& outDependencies) const
+	{
+		std::ifstream stream(Project::GetEditorAssetManager()->GetFileSystemPath(metadata));
+		if (!stream.is_open())
+			return;
+
+		std::stringstream strStream;
+		strStream << stream.rdbuf();
+
+		YAML::Node root = YAML::Load(strStream.str());
+		YAML::Node materialNode = root["Material"];
+		if (!materialNode)
+			return;
+
+		for (const char* map : { "AlbedoMap", "NormalMap", "MetalnessMap", "RoughnessMap" })
+		{
+			if (materialNode[map])
+				outDependencies.push_back(materialNode[map].as<uint64_t>());
+		}
+	}
+
+	bool MaterialAssetSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const
 	{
 		Ref<MaterialAsset> materialAsset = AssetManager::GetAsset<MaterialAsset>(handle);
 
@@ -153,7 +174,7 @@ namespace Beyond {
 		return true;
 	}
 
-	Ref<Asset> MaterialAssetSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
+	Ref<Asset> MaterialAssetSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
 	{
 		stream.SetStreamPosition(assetInfo.PackedOffset);
 		std::string yamlString;
@@ -328,7 +349,7 @@ namespace Beyond {
 		return true;
 	}
 
-	bool EnvironmentSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const
+	bool EnvironmentSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const
 	{
 		outInfo.Offset = stream.GetStreamPosition();
 
@@ -347,7 +368,7 @@ namespace Beyond {
 		return true;
 	}
 
-	Ref<Asset> EnvironmentSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
+	Ref<Asset> EnvironmentSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
 	{
 		stream.SetStreamPosition(assetInfo.PackedOffset);
 		Ref<TextureCube> radianceMap = TextureRuntimeSerializer::DeserializeTextureCube(stream);
@@ -378,7 +399,7 @@ namespace Beyond {
 		return true;
 	}
 
-	bool AudioFileSourceSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const
+	bool AudioFileSourceSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const
 	{
 		//? JP. Disabled as we don't use filepaths for lookup anymore. No idea if this serialization is till needed for the runtime, maybe in the future.
 #if 0 
@@ -399,7 +420,7 @@ namespace Beyond {
 		return true;
 	}
 
-	Ref<Asset> AudioFileSourceSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
+	Ref<Asset> AudioFileSourceSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
 	{
 		//? JP. Disabled as we don't use filepaths for lookup anymore. No idea if this serialization is till needed for the runtime, maybe in the future.
 #if 0
@@ -459,7 +480,7 @@ namespace Beyond {
 		return true;
 	}
 
-	bool SoundConfigSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const
+	bool SoundConfigSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const
 	{
 		Ref<SoundConfig> soundConfig = AssetManager::GetAsset<SoundConfig>(handle);
 
@@ -470,7 +491,7 @@ namespace Beyond {
 		return true;
 	}
 
-	Ref<Asset> SoundConfigSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
+	Ref<Asset> SoundConfigSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
 	{
 		stream.SetStreamPosition(assetInfo.PackedOffset);
 		std::string yamlString;
@@ -500,6 +521,7 @@ namespace Beyond {
 		BEY_SERIALIZE_PROPERTY(MasterReverbSend, soundConfig->MasterReverbSend, out);
 		BEY_SERIALIZE_PROPERTY(LPFilterValue, soundConfig->LPFilterValue, out);
 		BEY_SERIALIZE_PROPERTY(HPFilterValue, soundConfig->HPFilterValue, out);
+		BEY_SERIALIZE_PROPERTY(Priority, (int)soundConfig->Priority, out);
 
 		// TODO: move Spatialization to its own asset type
 		out << YAML::Key << "Spatialization";
@@ -579,6 +601,10 @@ namespace Beyond {
 		BEY_DESERIALIZE_PROPERTY(LPFilterValue, targetSoundConfig->LPFilterValue, data, 20000.0f);
 		BEY_DESERIALIZE_PROPERTY(HPFilterValue, targetSoundConfig->HPFilterValue, data, 0.0f);
 
+		int priority = 64;
+		BEY_DESERIALIZE_PROPERTY(Priority, priority, data, 64);
+		targetSoundConfig->Priority = (uint8_t)std::clamp(priority, 0, 255);
+
 		auto spConfigData = data["Spatialization"];
 		if (spConfigData)
 		{
@@ -642,7 +668,7 @@ namespace Beyond {
 		return true;
 	}
 
-	bool PrefabSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const
+	bool PrefabSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const
 	{
 		Ref<Prefab> prefab = AssetManager::GetAsset<Prefab>(handle);
 
@@ -653,7 +679,7 @@ namespace Beyond {
 		return true;
 	}
 
-	Ref<Asset> PrefabSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
+	Ref<Asset> PrefabSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
 	{
 		stream.SetStreamPosition(assetInfo.PackedOffset);
 		std::string yamlString;
@@ -718,7 +744,7 @@ namespace Beyond {
 		return true;
 	}
 
-	bool SceneAssetSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const
+	bool SceneAssetSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const
 	{
 		Ref<Scene> scene = Ref<Scene>::Create("AssetPackTemp", true, false);
 		const auto& metadata = Project::GetEditorAssetManager()->GetMetadata(handle);
@@ -730,13 +756,13 @@ namespace Beyond {
 		return false;
 	}
 
-	Ref<Asset> SceneAssetSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
+	Ref<Asset> SceneAssetSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
 	{
 		BEY_CORE_VERIFY(false); // Not implemented
 		return nullptr;
 	}
 
-	Ref<Scene> SceneAssetSerializer::DeserializeSceneFromAssetPack(FileStreamReader& stream, const AssetPackFile::SceneInfo& sceneInfo) const
+	Ref<Scene> SceneAssetSerializer::DeserializeSceneFromAssetPack(StreamReader& stream, const AssetPackFile::SceneInfo& sceneInfo) const
 	{
 		Ref<Scene> scene = Ref<Scene>::Create();
 		SceneSerializer serializer(scene);
@@ -782,7 +808,7 @@ namespace Beyond {
 		return true;
 	}
 
-	bool MeshColliderSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const
+	bool MeshColliderSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const
 	{
 		Ref<MeshColliderAsset> meshCollider = AssetManager::GetAsset<MeshColliderAsset>(handle);
 
@@ -793,7 +819,7 @@ namespace Beyond {
 		return true;
 	}
 
-	Ref<Asset> MeshColliderSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
+	Ref<Asset> MeshColliderSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
 	{
 		stream.SetStreamPosition(assetInfo.PackedOffset);
 		std::string yamlString;
@@ -898,7 +924,7 @@ namespace Beyond {
 		return true;
 	}
 
-	bool ScriptFileSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const
+	bool ScriptFileSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const
 	{
 		BEY_CORE_VERIFY(false); // Not implemented
 
@@ -912,7 +938,7 @@ namespace Beyond {
 		return true;
 	}
 
-	Ref<Asset> ScriptFileSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
+	Ref<Asset> ScriptFileSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
 	{
 		BEY_CORE_VERIFY(false); // Not implemented
 		return nullptr;
@@ -27,8 +27,11 @@ namespace Beyond {
 		virtual void Serialize(const AssetMetadata& metadata, const Ref<Asset>& asset) const = 0;
 		virtual bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset) const = 0;
 		
-		virtual bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const = 0;
-		virtual Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const = 0;
+		virtual bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const = 0;
+		virtual Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const = 0;
+
+		// Assets TryLoadData requests through the AssetManager, used to load them up front for asynchronous loads
+		virtual void GetDependencies(const AssetMetadata& metadata, std::vector<AssetHandle>& outDependencies) const {}
 	};
 
 	class TextureSerializer : public AssetSerializer
@@ -37,8 +40,8 @@ namespace Beyond {
 		virtual void Serialize(const AssetMetadata& metadata, const Ref<Asset>& asset) const override{}
 		virtual bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset) const override;
 
-		virtual bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const;
-		virtual Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
+		virtual bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const;
+		virtual Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
 	};
 
 	class FontSerializer : public AssetSerializer
@@ -47,8 +50,8 @@ namespace Beyond {
 		virtual void Serialize(const AssetMetadata& metadata, const Ref<Asset>& asset) const override {}
 		virtual bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset) const override;
 
-		virtual bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const;
-		virtual Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
+		virtual bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const;
+		virtual Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
 	};
 
 	class MaterialAssetSerializer : public AssetSerializer
@@ -57,8 +60,10 @@ namespace Beyond {
 		virtual void Serialize(const AssetMetadata& metadata, const Ref<Asset>& asset) const override;
 		virtual bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset) const override;
 
-		virtual bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const;
-		virtual Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
+		virtual bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const;
+		virtual Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
+
+		virtual void GetDependencies(const AssetMetadata& metadata, std::vector<AssetHandle>& outDependencies) const override;
 	private:
 		std::string SerializeToYAML(Ref<MaterialAsset> materialAsset) const;
 		bool DeserializeFromYAML(const std::string& yamlString, Ref<MaterialAsset>& targetMaterialAsset) const;
@@ -70,8 +75,8 @@ namespace Beyond {
 		virtual void Serialize(const AssetMetadata& metadata, const Ref<Asset>& asset) const override{}
 		virtual bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset) const override;
 
-		virtual bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const;
-		virtual Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
+		virtual bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const;
+		virtual Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
 	};
 
 	class AudioFileSourceSerializer : public AssetSerializer
@@ -80,8 +85,8 @@ namespace Beyond {
 		virtual void Serialize(const AssetMetadata& metadata, const Ref<Asset>& asset) const override;
 		virtual bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset) const override;
 
-		virtual bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const;
-		virtual Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
+		virtual bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const;
+		virtual Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
 	};
 
 	class SoundConfigSerializer : public AssetSerializer
@@ -90,8 +95,8 @@ namespace Beyond {
 		virtual void Serialize(const AssetMetadata& metadata, const Ref<Asset>& asset) const override;
 		virtual bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset) const override;
 
-		virtual bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const;
-		virtual Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
+		virtual bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const;
+		virtual Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
 	private:
 		std::string SerializeToYAML(Ref<SoundConfig> soundConfig) const;
 		bool DeserializeFromYAML(const std::string& yamlString, Ref<SoundConfig> targetSoundConfig) const;
@@ -103,8 +108,8 @@ namespace Beyond {
 		virtual void Serialize(const AssetMetadata& metadata, const Ref<Asset>& asset) const override;
 		virtual bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset) const override;
 
-		virtual bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const;
-		virtual Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
+		virtual bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const;
+		virtual Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
 	private:
 		std::string SerializeToYAML(Ref<Prefab> prefab) const;
 		bool DeserializeFromYAML(const std::string& yamlString, Ref<Prefab> prefab) const;
@@ -116,9 +121,9 @@ namespace Beyond {
 		virtual void Serialize(const AssetMetadata& metadata, const Ref<Asset>& asset) const override;
 		virtual bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset) const override;
 
-		virtual bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const;
-		virtual Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
-		Ref<Scene> DeserializeSceneFromAssetPack(FileStreamReader& stream, const AssetPackFile::SceneInfo& sceneInfo) const;
+		virtual bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const;
+		virtual Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
+		Ref<Scene> DeserializeSceneFromAssetPack(StreamReader& stream, const AssetPackFile::SceneInfo& sceneInfo) const;
 	};
 		
 	class MeshColliderSerializer : public AssetSerializer
@@ -127,8 +132,8 @@ namespace Beyond {
 		virtual void Serialize(const AssetMetadata& metadata, const Ref<Asset>& asset) const override;
 		virtual bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset) const override;
 
-		virtual bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const;
-		virtual Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
+		virtual bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const;
+		virtual Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
 	private:
 		std::string SerializeToYAML(Ref<MeshColliderAsset> meshCollider) const;
 		bool DeserializeFromYAML(const std::string& yamlString, Ref<MeshColliderAsset> targetMeshCollider) const;
@@ -140,8 +145,8 @@ namespace Beyond {
 		virtual void Serialize(const AssetMetadata& metadata, const Ref<Asset>& asset) const override;
 		virtual bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset) const override;
 
-		virtual bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const;
-		virtual Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
+		virtual bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const;
+		virtual Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const;
 	};
 
 }
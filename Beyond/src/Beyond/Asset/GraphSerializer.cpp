@@ -77,7 +77,7 @@ namespace Beyond {
 		return true;
 	}
 
-	bool DefaultGraphSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const
+	bool DefaultGraphSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const
 	{
 		Ref<SoundGraphAsset> soundGraph = AssetManager::GetAsset<SoundGraphAsset>(handle);
 
@@ -88,7 +88,7 @@ namespace Beyond {
 		return true;
 	}
 
-	Ref<Asset> DefaultGraphSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
+	Ref<Asset> DefaultGraphSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
 	{
 		BEY_CORE_VERIFY(false, "DefaultGraphSerialized should not be used.");
 
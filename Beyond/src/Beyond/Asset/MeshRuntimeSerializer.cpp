@@ -130,7 +130,7 @@ namespace Beyond {
 		animation = std::move(Animation(duration, numTracks, compressedTracks));
 	}
 
-	bool MeshRuntimeSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo)
+	bool MeshRuntimeSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo)
 	{
 		outInfo.Offset = stream.GetStreamPosition();
 
@@ -261,7 +261,7 @@ namespace Beyond {
 		return true;
 	}
 
-	Ref<Asset> MeshRuntimeSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo)
+	Ref<Asset> MeshRuntimeSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo)
 	{
 		stream.SetStreamPosition(assetInfo.PackedOffset);
 		uint64_t streamOffset = stream.GetStreamPosition();
@@ -12,8 +12,8 @@ namespace Beyond {
 	class MeshRuntimeSerializer
 	{
 	public:
-		bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo);
-		Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo);
+		bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo);
+		Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo);
 	};
 
 }
@@ -51,6 +51,27 @@ namespace Beyond {
 		return out;
 	}
 
+	// Mesh and static mesh files share the layout, the mesh source is their only dependency
+	static void GetMeshSourceDependency(const AssetMetadata& metadata, std::vector<AssetHandle>& outDependencies)
+	{
+		std::ifstream stream(Project::GetAssetDirectory() / metadata.FilePath);
+		if (!stream)
+			return;
+
+		std::stringstream strStream;
+		strStream << stream.rdbuf();
+
+		YAML::Node data = YAML::Load(strStream.str());
+		YAML::Node rootNode = data["Mesh"];
+		if (!rootNode)
+			return;
+
+		if (rootNode["MeshSource"])
+			outDependencies.push_back(rootNode["MeshSource"].as<uint64_t>());
+		else if (rootNode["MeshAsset"]) // DEPRECATED
+			outDependencies.push_back(rootNode["MeshAsset"].as<uint64_t>());
+	}
+
 	//////////////////////////////////////////////////////////////////////////////////
 	// MeshSourceSerializer
 	//////////////////////////////////////////////////////////////////////////////////
@@ -77,14 +98,14 @@ namespace Beyond {
 		return true;
 	}
 
-	bool MeshSourceSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const
+	bool MeshSourceSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const
 	{
 		MeshRuntimeSerializer serializer;
 		serializer.SerializeToAssetPack(handle, stream, outInfo);
 		return true;
 	}
 
-	Ref<Asset> MeshSourceSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
+	Ref<Asset> MeshSourceSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
 	{
 		MeshRuntimeSerializer serializer;
 		return serializer.DeserializeFromAssetPack(stream, assetInfo);
@@ -134,7 +155,7 @@ namespace Beyond {
 		return true;
 	}
 
-	bool MeshSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const
+	bool MeshSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const
 	{
 		Ref<Mesh> mesh = AssetManager::GetAsset<Mesh>(handle);
 
@@ -145,7 +166,7 @@ namespace Beyond {
 		return true;
 	}
 
-	Ref<Asset> MeshSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
+	Ref<Asset> MeshSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
 	{
 		stream.SetStreamPosition(assetInfo.PackedOffset);
 		std::string yamlString;
@@ -183,6 +204,11 @@ namespace Beyond {
 		return std::string(out.c_str());
 	}
 
+	void MeshSerializer::GetDependencies(const AssetMetadata& metadata, std::vector<AssetHandle>& outDependencies) const
+	{
+		GetMeshSourceDependency(metadata, outDependencies);
+	}
+
 	bool MeshSerializer::DeserializeFromYAML(const std::string& yamlString, Ref<Mesh>& targetMesh) const
 	{
 		YAML::Node data = YAML::Load(yamlString);
@@ -247,7 +273,7 @@ namespace Beyond {
 		return true;
 	}
 
-	bool StaticMeshSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const
+	bool StaticMeshSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const
 	{
 		Ref<StaticMesh> staticMesh = AssetManager::GetAsset<StaticMesh>(handle);
 
@@ -258,7 +284,7 @@ namespace Beyond {
 		return true;
 	}
 
-	Ref<Asset> StaticMeshSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
+	Ref<Asset> StaticMeshSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
 	{
 		stream.SetStreamPosition(assetInfo.PackedOffset);
 		std::string yamlString;
@@ -296,6 +322,11 @@ namespace Beyond {
 		return std::string(out.c_str());
 	}
 
+	void StaticMeshSerializer::GetDependencies(const AssetMetadata& metadata, std::vector<AssetHandle>& outDependencies) const
+	{
+		GetMeshSourceDependency(metadata, outDependencies);
+	}
+
 	bool StaticMeshSerializer::DeserializeFromYAML(const std::string& yamlString, Ref<StaticMesh>& targetStaticMesh) const
 	{
 		YAML::Node data = YAML::Load(yamlString);
@@ -13,8 +13,8 @@ namespace Beyond {
 		virtual void Serialize(const AssetMetadata& metadata, const Ref<Asset>& asset) const override {}
 		virtual bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset) const override;
 
-		virtual bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const override;
-		virtual Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const override;
+		virtual bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const override;
+		virtual Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const override;
 	};
 
 	class MeshSerializer : public AssetSerializer
@@ -23,8 +23,10 @@ namespace Beyond {
 		virtual void Serialize(const AssetMetadata& metadata, const Ref<Asset>& asset) const override;
 		virtual bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset) const override;
 
-		virtual bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const override;
-		virtual Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const override;
+		virtual bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const override;
+		virtual Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const override;
+
+		virtual void GetDependencies(const AssetMetadata& metadata, std::vector<AssetHandle>& outDependencies) const override;
 	private:
 		std::string SerializeToYAML(Ref<Mesh> mesh, const std::string& name) const;
 		bool DeserializeFromYAML(const std::string& yamlString, Ref<Mesh>& targetMesh) const;
@@ -36,8 +38,10 @@ namespace Beyond {
 		virtual void Serialize(const AssetMetadata& metadata, const Ref<Asset>& asset) const override;
 		virtual bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset) const override;
 
-		virtual bool SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const override;
-		virtual Ref<Asset> DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const override;
+		virtual bool SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const override;
+		virtual Ref<Asset> DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const override;
+
+		virtual void GetDependencies(const AssetMetadata& metadata, std::vector<AssetHandle>& outDependencies) const override;
 	private:
 		std::string SerializeToYAML(Ref<StaticMesh> staticMesh, const std::string& name) const;
 		bool DeserializeFromYAML(const std::string& yamlString, Ref<StaticMesh>& targetStaticMesh) const;
@@ -94,7 +94,7 @@ namespace Beyond {
 	}
 
 
-	bool SoundGraphGraphSerializer::SerializeToAssetPack(AssetHandle handle, FileStreamWriter& stream, AssetSerializationInfo& outInfo) const
+	bool SoundGraphGraphSerializer::SerializeToAssetPack(AssetHandle handle, StreamWriter& stream, AssetSerializationInfo& outInfo) const
 	{
 		Ref<SoundGraphAsset> soundGraph = AssetManager::GetAsset<SoundGraphAsset>(handle);
 
@@ -106,7 +106,7 @@ namespace Beyond {
 	}
 
 
-	Ref<Asset> SoundGraphGraphSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
+	Ref<Asset> SoundGraphGraphSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::AssetInfo& assetInfo) const
 	{
 		stream.SetStreamPosition(assetInfo.PackedOffset);
 		std::string yamlString;
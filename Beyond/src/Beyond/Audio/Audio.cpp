@@ -8,14 +8,15 @@ using namespace std::chrono_literals;
 
 namespace Beyond::Audio
 {
-    static std::queue<AudioFunctionCallback*> s_AudioThreadJobsLocal;
-
 	//==============================================================================
     bool AudioThread::Start()
     {
         if (s_ThreadActive)
             return false;
 
+        if (!s_Commands.GetCapacity())
+            s_Commands.Allocate(s_CommandQueueCapacity);
+
         s_ThreadActive = true;
         s_AudioThread = hnew std::thread([]
             {
@@ -74,6 +75,38 @@ namespace Beyond::Audio
 
         std::scoped_lock lock(s_AudioThreadJobsLock);
         s_AudioThreadJobs.emplace(std::move(funcCb));
+
+        // Marker is pushed under the same lock, so that markers are in the same order as the tasks
+        if (!s_Commands.TryPush(AudioThreadCommand{}))
+            ++s_UnmarkedTasks;
+    }
+
+    bool AudioThread::SubmitCommand(const AudioThreadCommand& command)
+    {
+        if (s_Commands.TryPush(command))
+            return true;
+
+        ++s_DroppedCommands;
+        return false;
+    }
+
+    static void ExecuteNextTask(std::queue<AudioFunctionCallback*>& jobs, std::mutex& jobsLock)
+    {
+        AudioFunctionCallback* job = nullptr;
+        {
+            std::scoped_lock lock(jobsLock);
+            if (jobs.empty())
+                return;
+
+            job = jobs.front();
+            jobs.pop();
+        }
+
+        //BEY_CONSOLE_LOG_INFO("AudioThread. Executing: {}", job->GetID());
+        job->Execute();
+
+        // TODO: check if job ran successfully, if not, notify and/or add back to the queue
+        delete job; // TODO: better allocation strategy
     }
 
     void AudioThread::OnUpdate()
@@ -83,41 +116,51 @@ namespace Beyond::Audio
         s_Timer.Reset();
 
         //---------------------------
-        //--- Handle AudioThread Jobs
+        //--- Handle AudioThread Commands and Jobs
 
         {
             BEY_PROFILE_SCOPE_DYNAMIC("AudioThread::OnUpdate - Execution");
 
-            auto& jobs = s_AudioThreadJobsLocal;
+            const uint32_t queueDepth = (uint32_t)s_Commands.GetSize();
+            uint32_t maxDepth = s_MaxCommandQueueDepth.load(std::memory_order_relaxed);
+            while (queueDepth > maxDepth && !s_MaxCommandQueueDepth.compare_exchange_weak(maxDepth, queueDepth))
             {
-                std::scoped_lock lock(s_AudioThreadJobsLock);
-                s_AudioThreadJobsLocal = s_AudioThreadJobs;
-                s_AudioThreadJobs = std::queue<AudioFunctionCallback*>();
             }
-            if (!jobs.empty())
+
+            // Only handle commands that have been submitted before this update,
+            // commands submitted by the commands and tasks themselves are handled on the next update.
+            AudioThreadCommand command;
+            for (uint32_t i = 0; i < queueDepth && s_Commands.TryPop(command); ++i)
             {
-                // Should not run while jobs are not complete, instead re-add them to run on the next update loop
-                for (int i = (int)jobs.size() - 1; i >= 0; i--)
+                if (command.Type == AudioThreadCommand::EType::ExecuteTask)
                 {
-                    auto job = jobs.front();
-                    //BEY_CONSOLE_LOG_INFO("AudioThread. Executing: {}", job->GetID());
-                    job->Execute();
-
-                    // TODO: check if job ran successfully, if not, notify and/or add back to the queue
-                    jobs.pop();
-                    delete job; // TODO: better allocation strategy
+                    ExecuteNextTask(s_AudioThreadJobs, s_AudioThreadJobsLock);
+                }
+                else
+                {
+                    BEY_CORE_ASSERT(onCommandCallback.IsBound(), "Command Function is not bound!");
+                    onCommandCallback.Invoke(command);
                 }
             }
+
+            for (uint32_t i = s_UnmarkedTasks.exchange(0); i > 0; --i)
+                ExecuteNextTask(s_AudioThreadJobs, s_AudioThreadJobsLock);
         }
 
         BEY_CORE_ASSERT(onUpdateCallback.IsBound(), "Update Function is not bound!");
         onUpdateCallback.Invoke(s_TimeStep);
 
-        // Sleeping to let at least a single audio block to render before next OnUpdate
-        // This should ensure that we don't pass too many updates to render thread
-        // before it can handle previous ones.
-        const uint32_t sleepDurationMS = glm::min((uint32_t)s_Timer.ElapsedMillis() - PCM_FRAME_CHUNK_MS, PCM_FRAME_CHUNK_MS);
-        std::this_thread::sleep_for(std::chrono::milliseconds(sleepDurationMS));
+        // Updating at a fixed rate of one audio block, this should ensure that we don't pass
+        // too many updates to render thread before it can handle previous ones.
+        // If an update took longer than that, the schedule is reset instead of trying to catch up.
+        static auto s_NextUpdate = std::chrono::steady_clock::now();
+        const auto now = std::chrono::steady_clock::now();
+
+        s_NextUpdate += std::chrono::milliseconds(PCM_FRAME_CHUNK_MS);
+        if (s_NextUpdate < now)
+            s_NextUpdate = now + std::chrono::milliseconds(PCM_FRAME_CHUNK_MS);
+
+        std::this_thread::sleep_until(s_NextUpdate);
 
         s_TimeStep = s_Timer.Elapsed();
         s_LastFrameTime = s_TimeStep.GetMilliseconds();
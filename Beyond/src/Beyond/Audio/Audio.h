@@ -7,6 +7,8 @@
 #include "choc/audio/choc_SampleBuffers.h"
 #include "choc/audio/choc_SampleBufferUtilities.h"
 
+#include "Beyond/Audio/Buffer/MPSCQueue.h"
+
 #include <thread>
 #include <atomic>
 #include <queue>
@@ -59,6 +61,50 @@ namespace Beyond::Audio
         const char* m_JobID;
     };
 
+    //==============================================================================
+    /*  Plain data command submitted to the Audio Thread without allocation.
+        Interpreted by the function bound with AudioThread::BindCommandFunction().
+    */
+    struct AudioThreadCommand
+    {
+        enum class EType : uint8_t
+        {
+            ExecuteTask,            // Marker of a queued AudioFunctionCallback, keeps tasks ordered with the commands
+            PostTrigger,
+            StopObject,
+            PauseObject,
+            ResumeObject,
+            ActionOnEvent,
+            SetParameterOnObject,
+            SetParameterOnEvent,
+            SetLowPassOnObject,
+            SetLowPassOnEvent,
+            SetHighPassOnObject,
+            SetHighPassOnEvent
+        };
+
+        enum class EValueType : uint8_t
+        {
+            Float,
+            Int,
+            Bool
+        };
+
+        EType Type = EType::ExecuteTask;
+        EValueType ValueType = EValueType::Float;
+        int32_t Action = 0;
+        uint32_t EventID = 0;
+        uint32_t ParameterID = 0;
+        uint64_t ObjectID = 0;
+
+        union
+        {
+            float Float;
+            int Int;
+            bool Bool;
+        } Value{ 0.0f };
+    };
+
     //==============================================================================
 	///	Audio Update Thread
     class AudioThread // TODO: inherit from Beyond::Thread
@@ -75,9 +121,19 @@ namespace Beyond::Audio
         friend class AudioThreadFence;
 
         static void AddTask(AudioFunctionCallback*&& funcCb);
+
+        /* Push command to the preallocated command queue, safe to call from any thread.
+           @returns false - if the queue is full, the command is dropped
+        */
+        static bool SubmitCommand(const AudioThreadCommand& command);
+
         static void OnUpdate();
         static float GetFrameTime() { return s_LastFrameTime.load(); }
 
+        /* @returns maximum number of commands waiting in the queue since the last call */
+        static uint32_t GetCommandQueueDepth() { return s_MaxCommandQueueDepth.exchange(0); }
+        static uint64_t GetDroppedCommands() { return s_DroppedCommands.load(); }
+
         template<auto TFunction, class TClass>
         static void BindUpdateFunction(TClass* object)
         {
@@ -87,6 +143,15 @@ namespace Beyond::Audio
 			onUpdateCallback.Bind<TFunction>(object);
         }
 
+        template<auto TFunction, class TClass>
+        static void BindCommandFunction(TClass* object)
+        {
+			using TCommandFunc = void(TClass::*)(const AudioThreadCommand&);
+			static_assert(std::is_same_v<decltype(TFunction), TCommandFunc>, "Invalid Command function signature.");
+
+			onCommandCallback.Bind<TFunction>(object);
+        }
+
     private:
         static inline std::thread* s_AudioThread{ nullptr };
         static inline std::atomic<bool > s_ThreadActive{ false };
@@ -96,7 +161,14 @@ namespace Beyond::Audio
         static inline std::queue<AudioFunctionCallback*> s_AudioThreadJobs;
         static inline std::mutex s_AudioThreadJobsLock;
 
+        static constexpr size_t s_CommandQueueCapacity = 4096;
+        static inline MPSCQueue<AudioThreadCommand> s_Commands;
+        static inline std::atomic<uint32_t> s_UnmarkedTasks{ 0 };        // Tasks that didn't fit their marker into the command queue
+        static inline std::atomic<uint32_t> s_MaxCommandQueueDepth{ 0 };
+        static inline std::atomic<uint64_t> s_DroppedCommands{ 0 };
+
 		static inline Delegate<void(Timestep)> onUpdateCallback;
+		static inline Delegate<void(const AudioThreadCommand&)> onCommandCallback;
         static inline Timer s_Timer;
 		static inline Timestep s_TimeStep{ 0.0f };
 		static inline std::atomic<float> s_LastFrameTime{ 0.0f };
@@ -21,7 +21,6 @@
 #include "yaml-cpp/yaml.h"
 
 #include <algorithm>
-#include <execution>
 
 #include "Beyond/Scene/Scene.h"
 
@@ -72,6 +71,113 @@ namespace Beyond {
 			AudioThread::AddTask(hnew AudioFunctionCallback(std::move(func), jobID));
 		}
 	}
+
+	bool MiniAudioEngine::SubmitCommand(const Audio::AudioThreadCommand& command)
+	{
+		if (IsAudioThread())
+		{
+			s_Instance->ExecuteCommand(command);
+		}
+		else if (!AudioThread::SubmitCommand(command))
+		{
+			BEY_CORE_WARN_TAG("Audio", "Audio Thread command queue is full, dropped command {}.", magic_enum::enum_name(command.Type));
+			return false;
+		}
+
+		return true;
+	}
+
+	void MiniAudioEngine::ExecuteCommand(const Audio::AudioThreadCommand& command)
+	{
+		BEY_PROFILE_FUNC();
+
+		using EType = AudioThreadCommand::EType;
+		using EValueType = AudioThreadCommand::EValueType;
+
+		const auto setParameter = [&command](SoundObject* sound)
+		{
+			switch (command.ValueType)
+			{
+				case EValueType::Float: sound->SetParameter(command.ParameterID, command.Value.Float); break;
+				case EValueType::Int:	sound->SetParameter(command.ParameterID, command.Value.Int); break;
+				case EValueType::Bool:	sound->SetParameter(command.ParameterID, command.Value.Bool); break;
+			}
+		};
+
+		switch (command.Type)
+		{
+			case EType::PostTrigger:
+			{
+				const EventID eventID(command.EventID);
+				m_EventsManager->PostTrigger(eventID);
+				m_EventHandles[command.ObjectID].push_back({ eventID });
+
+				m_UpdateState.Set(UpdateState::Stats_ActiveEvents);
+				break;
+			}
+			case EType::StopObject:
+			{
+				// Stop Active Sound Sources associated to the Entity
+				for (const auto& voice : m_VoiceHandles)
+				{
+					if (voice.OwningEntity == command.ObjectID)
+						m_SoundSources[voice.ID]->Stop();
+				}
+				break;
+			}
+			case EType::PauseObject:
+			{
+				// Pause Active Sound Sources associated to the Entity
+				for (const auto& voice : m_VoiceHandles)
+				{
+					if (voice.OwningEntity == command.ObjectID)
+						m_SoundSources[voice.ID]->Pause();
+				}
+				break;
+			}
+			case EType::ResumeObject:
+			{
+				// Resume Active Sound Sources associated to the Entity
+				for (const auto& voice : m_VoiceHandles)
+				{
+					if (voice.OwningEntity == command.ObjectID)
+					{
+						SoundObject* sound = m_SoundSources[voice.ID];
+
+						// Only re-start sound if it wasn explicitly paused
+						if (sound->GetPlayState() == ESoundPlayState::Paused)
+							sound->Play();
+					}
+				}
+				break;
+			}
+			case EType::ActionOnEvent:
+				m_EventsManager->ProcessActionOnPlayingEvent(EventID(command.EventID), (EActionTypeOnPlayingEvent)command.Action);
+				break;
+			case EType::SetParameterOnObject:
+				InvokeOnActiveSounds(command.ObjectID, setParameter);
+				break;
+			case EType::SetParameterOnEvent:
+				InvokeOnActiveSources(EventID(command.EventID), setParameter);
+				break;
+			case EType::SetLowPassOnObject:
+				InvokeOnActiveSounds(command.ObjectID, [&command](SoundObject* sound) { sound->SetLowPassFilter(command.Value.Float); });
+				break;
+			case EType::SetLowPassOnEvent:
+				InvokeOnActiveSources(EventID(command.EventID), [&command](SoundObject* source) { source->SetLowPassFilter(command.Value.Float); });
+				break;
+			case EType::SetHighPassOnObject:
+				InvokeOnActiveSounds(command.ObjectID, [&command](SoundObject* sound) { sound->SetHighPassFilter(command.Value.Float); });
+				break;
+			case EType::SetHighPassOnEvent:
+				InvokeOnActiveSources(EventID(command.EventID), [&command](SoundObject* source) { source->SetHighPassFilter(command.Value.Float); });
+				break;
+			case EType::ExecuteTask:
+			default:
+				BEY_CORE_ASSERT(false, "Invalid Audio Thread command.");
+				break;
+		}
+	}
 	
 	//==========================================================================
 	// TODO: JP. wrap this into a proper sufix allocator
@@ -172,7 +278,8 @@ namespace Beyond {
 	}
 
 	//==========================================================================
-	MiniAudioEngine::MiniAudioEngine()
+	MiniAudioEngine::MiniAudioEngine(bool offlineRendering)
+		: m_OfflineRendering(offlineRendering)
 	{
 		m_ResourceManager = CreateScope<Audio::ResourceManager>(*this);
 
@@ -230,6 +337,7 @@ namespace Beyond {
 
 
 		AudioThread::BindUpdateFunction<&MiniAudioEngine::Update>(this);
+		AudioThread::BindCommandFunction<&MiniAudioEngine::ExecuteCommand>(this);
 		AudioThread::Start();
 
 		MiniAudioEngine::ExecuteOnAudioThread([this] { Initialize(); }, "InitializeAudioEngine");
@@ -241,10 +349,10 @@ namespace Beyond {
 			Uninitialize();
 	}
 
-	void MiniAudioEngine::Init()
+	void MiniAudioEngine::Init(bool offlineRendering)
 	{
 		BEY_CORE_ASSERT(s_Instance == nullptr, "Audio Engine already initialized.");
-		MiniAudioEngine::s_Instance = hnew MiniAudioEngine();
+		MiniAudioEngine::s_Instance = hnew MiniAudioEngine(offlineRendering);
 	}
 
 	void MiniAudioEngine::Shutdown()
@@ -302,6 +410,25 @@ namespace Beyond {
 
 		engineConfig.pResourceManagerVFS = m_ResourceManagerVFS.get();
 
+		if (m_OfflineRendering)
+		{
+			// The device of the null backend is never started, RenderOffline() reads the node graph
+			const ma_backend nullBackend = ma_backend_null;
+			ma_context_config contextConfig = ma_context_config_init();
+			contextConfig.pLog = &m_maLog;
+			contextConfig.allocationCallbacks = allocationCallbacks;
+			result = ma_context_init(&nullBackend, 1, &contextConfig, &m_OfflineContext);
+			if (result != MA_SUCCESS)
+			{
+				BEY_CORE_ASSERT(false, "Failed to initialize offline audio context.");
+				return false;
+			}
+
+			engineConfig.pContext = &m_OfflineContext;
+			engineConfig.sampleRate = 48000;
+			engineConfig.noAutoStart = MA_TRUE;
+		}
+
 		result = ma_engine_init(&engineConfig, &m_Engine);
 		if (result != MA_SUCCESS)
 		{
@@ -313,6 +440,11 @@ namespace Beyond {
 		allocationCallbacks.pUserData = &m_RMCallbackData;
 		m_Engine.pResourceManager->config.allocationCallbacks = allocationCallbacks;
 
+		// TODO: get max number of sources from platform interface, or user settings
+		// Only up to MaxRealVoices of these are processed, the rest is virtual
+		m_NumSources = 128;
+
+		m_ResourceManager->GetStreamingManager().Initialize();
 		m_SourceManager->Initialize();
 		m_MasterReverb = CreateScope<DSP::Reverb>();
 		m_MasterReverb->Initialize(&m_Engine, &m_Engine.nodeGraph.endpoint);
@@ -321,8 +453,6 @@ namespace Beyond {
 		// if the sound needs to be uninitialized before reusing it
 		m_PreviewSound.pDataSource = nullptr;
 
-		// TODO: get max number of sources from platform interface, or user settings
-		m_NumSources = 32;
 		CreateSources();
 
 		BEY_CORE_INFO_TAG("Audio", R"(Audio Engine: engine initialized.
@@ -366,12 +496,16 @@ namespace Beyond {
 		m_MasterReverb.reset();
 
 		ma_engine_uninit(&m_Engine);
+		if (m_OfflineRendering)
+			ma_context_uninit(&m_OfflineContext);
 
 		for (auto& s : m_SoundSources)
 			delete s;
 
 		m_SoundSources.clear();
 
+		m_ResourceManager->GetStreamingManager().Shutdown();
+
 		m_VoiceData.clear();
 		m_VoiceHandles.clear();
 		m_EventHandles.clear();
@@ -422,8 +556,7 @@ namespace Beyond {
 			return;
 		}
 
-		for (SourceID sourceID : m_EventsManager->GetActiveSources(playingEvent))
-			functionToInvoke(m_SoundSources.at(sourceID));
+		m_EventsManager->InvokeOnActiveSources(playingEvent, [&](SourceID sourceID) { functionToInvoke(m_SoundSources.at(sourceID)); });
 	}
 
 	//==============================================================================
@@ -450,6 +583,7 @@ namespace Beyond {
 
 		BEY_CORE_ASSERT(m_SourceManager->m_FreeSourcIDs.empty());
 
+		SoundObject* lowestPriVirtualSource = nullptr;
 		SoundObject* lowestPriStoppingSource = nullptr;
 		SoundObject* lowestPriNonLoopingSource = nullptr;
 		SoundObject* lowestPriSource = nullptr;
@@ -481,7 +615,12 @@ namespace Beyond {
 				and handle, in some way, complex SoundObject graphs that may contain multiple Waves.
 				Should probably keep track of Active Sources and Active Sounds separatelly (e.i. implement ActiveSound abstraction)
 			*/
-			if (source->IsStopping())
+			if (source->IsVirtual())
+			{
+				// Virtual sources are not heard, they are the first to go
+				lowestPriVirtualSource = getLowerPriority(source, lowestPriVirtualSource);
+			}
+			else if (source->IsStopping())
 			{
 				lowestPriStoppingSource = getLowerPriority(source, lowestPriStoppingSource);
 			}
@@ -501,7 +640,8 @@ namespace Beyond {
 
 		SoundObject* releasedSoundSource = nullptr;
 
-		if (lowestPriStoppingSource)   releasedSoundSource = lowestPriNonLoopingSource;
+		if (lowestPriVirtualSource)			releasedSoundSource = lowestPriVirtualSource;
+		else if (lowestPriStoppingSource)   releasedSoundSource = lowestPriNonLoopingSource;
 		else if (lowestPriNonLoopingSource) releasedSoundSource = lowestPriNonLoopingSource;
 		else                                releasedSoundSource = lowestPriSource;
 
@@ -539,6 +679,77 @@ namespace Beyond {
 		return releasedSoundSource;
 	}
 
+	void MiniAudioEngine::UpdateVirtualVoices()
+	{
+		BEY_PROFILE_FUNC();
+
+		struct Candidate
+		{
+			SoundObject* Voice;
+			uint8_t Priority;
+			float Audibility;
+		};
+
+		choc::SmallVector<Candidate, 64> candidates;
+		candidates.reserve(m_ActiveSounds.size());
+
+		const UserConfig config = GetUserConfiguration();
+		int64_t realVoicesLeft = config.MaxRealVoices;
+
+		for (SoundObject* voice : m_ActiveSounds)
+		{
+			// Voices fading out, or paused, are left as they are
+			const ESoundPlayState state = voice->GetPlayState();
+			if (state != ESoundPlayState::Playing && state != ESoundPlayState::Starting)
+			{
+				if (!voice->IsVirtual())
+					realVoicesLeft--;
+				continue;
+			}
+
+			candidates.push_back({ voice, voice->m_SoundConfig->Priority, GetVoiceAudibility(voice) });
+		}
+
+		std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b)
+		{
+			return a.Priority != b.Priority ? a.Priority > b.Priority : a.Audibility > b.Audibility;
+		});
+
+		// Virtual voices must get 6 dB louder than the threshold to become real again, to not flip back and forth
+		const float threshold = std::pow(10.0f, config.VirtualizationThresholdDB / 20.0f);
+		const float devirtualizeThreshold = threshold * 2.0f;
+
+		for (const Candidate& candidate : candidates)
+		{
+			const bool audible = candidate.Audibility >= (candidate.Voice->IsVirtual() ? devirtualizeThreshold : threshold);
+			const bool real = audible && realVoicesLeft > 0;
+			if (real)
+				realVoicesLeft--;
+
+			candidate.Voice->SetVirtual(!real);
+		}
+
+		const auto numVirtualVoices = (uint32_t)std::count_if(m_ActiveSounds.begin(), m_ActiveSounds.end(), [](const SoundObject* voice) { return voice->IsVirtual(); });
+		if (numVirtualVoices != m_NumVirtualVoices)
+		{
+			m_NumVirtualVoices = numVirtualVoices;
+			m_UpdateState.Set(UpdateState::Stats_Voices);
+		}
+	}
+
+	float MiniAudioEngine::GetVoiceAudibility(const SoundObject* voice) const
+	{
+		const int sourceID = voice->m_SoundSourceID;
+		float audibility = voice->m_SoundConfig->VolumeMultiplier * m_VoiceData[sourceID].Volume;
+
+		// Before the first position update attenuation is 1, new voices start real
+		const auto& spatializer = m_SourceManager->m_Spatializer;
+		if (spatializer->IsInitialized(sourceID))
+			audibility *= spatializer->GetCurrentDistanceAttenuation(sourceID) * spatializer->GetCurrentConeAngleAttenuation(sourceID);
+
+		return audibility;
+	}
+
 	bool MiniAudioEngine::SubmitStartPlayback(uint64_t audioEntityID)
 	{
 		BEY_PROFILE_FUNC();
@@ -560,60 +771,26 @@ namespace Beyond {
 
 	bool MiniAudioEngine::StopActiveSoundSource(uint64_t entityID)
 	{
-		auto stopSound = [this, entityID]
-		{
-			// Stop Active Sound Sources associated to the Entity
-
-			for (const auto& voice : m_VoiceHandles)
-			{
-				if (voice.OwningEntity == entityID)
-					m_SoundSources[voice.ID]->Stop();
-			}
-		};
-
-		ExecuteOnAudioThread(EIfThisIsAudioThread::ExecuteNow, stopSound, "StopSound");
-
-		return true;
+		AudioThreadCommand command;
+		command.Type = AudioThreadCommand::EType::StopObject;
+		command.ObjectID = entityID;
+		return SubmitCommand(command);
 	}
 
 	bool MiniAudioEngine::PauseActiveSoundSource(uint64_t entityID)
 	{
-		auto pauseSound = [this, entityID]
-		{
-			// Pause Active Sound Sources associated to the Entity
-			for (const auto& voice : m_VoiceHandles)
-			{
-				if (voice.OwningEntity == entityID)
-					m_SoundSources[voice.ID]->Pause();
-			}
-		};
-
-		ExecuteOnAudioThread(EIfThisIsAudioThread::ExecuteNow, pauseSound, "PauseSound");
-
-		return true;
+		AudioThreadCommand command;
+		command.Type = AudioThreadCommand::EType::PauseObject;
+		command.ObjectID = entityID;
+		return SubmitCommand(command);
 	}
 
 	bool MiniAudioEngine::ResumeActiveSoundSource(uint64_t entityID)
 	{
-		auto resumeSound = [this, entityID]
-		{
-			// Resume Active Sound Sources associated to the Entity
-			for (const auto& voice : m_VoiceHandles)
-			{
-				if (voice.OwningEntity == entityID)
-				{
-					SoundObject* sound = m_SoundSources[voice.ID];
-
-					// Only re-start sound if it wasn explicitly paused
-					if (sound->GetPlayState() == ESoundPlayState::Paused)
-						sound->Play();
-				}
-			}
-		};
-
-		ExecuteOnAudioThread(EIfThisIsAudioThread::ExecuteNow, resumeSound, "PauseSound");
-
-		return true;
+		AudioThreadCommand command;
+		command.Type = AudioThreadCommand::EType::ResumeObject;
+		command.ObjectID = entityID;
+		return SubmitCommand(command);
 	}
 
 	bool MiniAudioEngine::StopEventID(EventID playingEvent)
@@ -1013,24 +1190,21 @@ namespace Beyond {
 
 		// 3. Update position of the sound sources from associated AudioObjects, which can originate from AudioComponent or not.
 
+		// Spatializer processes all of the new positions in one batch on the next Spatializer::Update()
+		for (const auto& voice : m_VoiceHandles)
 		{
-			BEY_PROFILE_SCOPE_DYNAMIC("MiniAudioEngine::UpdateSources - USP Loop");
+			// It is valid to not yet have any data from Game Thread when the voice is already initialized
+			const auto dIt = m_ObjectData.find(voice.OwningEntity);
+			if (dIt == m_ObjectData.end())
+				continue;
 
-			std::for_each(std::execution::par, m_VoiceHandles.begin(), m_VoiceHandles.end(), [&](const VoiceHandle& voice)
-			{
-				// It is valid to not yet have any data from Game Thread when the voice is already initialized
-				const auto dIt = m_ObjectData.find(voice.OwningEntity);
-				if (dIt == m_ObjectData.end())
-					return;
+			const AudioObjectData& data = dIt->second;
 
-				const AudioObjectData& data = dIt->second;
-
-				m_SourceManager->m_Spatializer->UpdateSourcePosition(voice.ID, data.Transform, data.Velocity);
-			});
+			m_SourceManager->m_Spatializer->SetSourcePosition(voice.ID, data.Transform, data.Velocity);
 		}
 	}
 
-	void MiniAudioEngine::SubmitSourceUpdateData(std::vector<SoundSourceUpdateData> updateData)
+	void MiniAudioEngine::SubmitSourceUpdateData(std::vector<SoundSourceUpdateData>& updateData)
 	{
 		{
 			std::scoped_lock lock{ m_UpdateSourcesLock };
@@ -1177,6 +1351,10 @@ namespace Beyond {
 		if (!bInitialized)
 			return;
 
+		// Offline, the time only moves while rendering
+		if (m_OfflineRendering && !m_RenderingOffline)
+			return;
+
 		// AudioThread tasks handled before this Update function
 
 		if (m_PlaybackState == EPlaybackState::Playing)
@@ -1190,6 +1368,9 @@ namespace Beyond {
 			// Update Emitter data from Game Thread
 			UpdateSources();
 
+			// Recalculate spatialization of the sources moved, or with the listener moved
+			m_SourceManager->m_Spatializer->Update();
+
 			if (!m_SoundsToStart.empty())
 				m_UpdateState.Set(UpdateState::Stats_ActiveSounds);
 
@@ -1201,6 +1382,8 @@ namespace Beyond {
 			}
 			m_SoundsToStart.clear();
 
+			UpdateVirtualVoices();
+
 			// At this stage we should have UpdatedSources for SoundsToStart as well,
 			// even if they weren't in ActiveSounds pool yet, because we update VoiceData
 			// for initialized Voices, not ActiveSounds.
@@ -1233,6 +1416,10 @@ namespace Beyond {
 
 	void MiniAudioEngine::ProcessUpdateState()
 	{
+		// Released voices might have been virtual
+		if (m_UpdateState.Has(UpdateState::Stats_ActiveSounds))
+			m_NumVirtualVoices = (uint32_t)std::count_if(m_ActiveSounds.begin(), m_ActiveSounds.end(), [](const SoundObject* voice) { return voice->IsVirtual(); });
+
 		std::optional<uint32_t> updatedObjectCount;
 
 		if (m_UpdateState.Has(UpdateState::Stats_AudioObjects))
@@ -1245,6 +1432,8 @@ namespace Beyond {
 			std::scoped_lock lock{ s_Stats.mutex };
 			s_Stats.NumActiveSounds = (uint32_t)m_ActiveSounds.size();
 			s_Stats.ActiveEvents = m_EventsManager->GetNumberOfActiveEvents(); //? this may not be correct, this only returns number of 'registered" events
+			s_Stats.VirtualVoices = m_NumVirtualVoices;
+			s_Stats.RealVoices = (uint32_t)m_ActiveSounds.size() - m_NumVirtualVoices;
 			
 			if (updatedObjectCount)
 				s_Stats.AudioObjects = *updatedObjectCount;
@@ -1339,138 +1528,249 @@ namespace Beyond {
 		EventID eventID = m_EventsManager->RegisterEvent(eventInfo);
 		if (eventID)
 		{
-			auto postTrigger = [this, entityID, eventInfo]() mutable
+			// EventInfo stays in the registry, Audio Thread retrieves it by the EventID
+			AudioThreadCommand postTrigger;
+			postTrigger.Type = AudioThreadCommand::EType::PostTrigger;
+			postTrigger.EventID = eventID;
+			postTrigger.ObjectID = entityID;
+			if (!SubmitCommand(postTrigger))
 			{
-				m_EventsManager->PostTrigger(eventInfo);
-				m_EventHandles[entityID].push_back({ eventInfo.EventID });
-
-				m_UpdateState.Set(UpdateState::Stats_ActiveEvents);
-			};
-
-			ExecuteOnAudioThread(EIfThisIsAudioThread::ExecuteNow, postTrigger, "Post Trigger");
+				// The command was dropped, Audio Thread will never post or finish this event
+				m_EventsManager->UnregisterEvent(eventID);
+				return EventID::INVALID;
+			}
 		}
 
 		return eventID;
 	}
 
+	static AudioThreadCommand MakeParameterCommand(Audio::CommandID parameterID, uint64_t objectID)
+	{
+		AudioThreadCommand command;
+		command.Type = AudioThreadCommand::EType::SetParameterOnObject;
+		command.ParameterID = parameterID;
+		command.ObjectID = objectID;
+		return command;
+	}
+
+	static AudioThreadCommand MakeParameterCommand(Audio::CommandID parameterID, Audio::EventID playingEvent)
+	{
+		AudioThreadCommand command;
+		command.Type = AudioThreadCommand::EType::SetParameterOnEvent;
+		command.ParameterID = parameterID;
+		command.EventID = playingEvent;
+		return command;
+	}
+
+	static AudioThreadCommand MakeFilterCommand(AudioThreadCommand::EType type, uint64_t objectID, uint32_t playingEvent, float value)
+	{
+		AudioThreadCommand command;
+		command.Type = type;
+		command.ObjectID = objectID;
+		command.EventID = playingEvent;
+		command.Value.Float = value;
+		return command;
+	}
+
 	void MiniAudioEngine::SetParameterFloat(Audio::CommandID parameterID, uint64_t objectID, float value)
 	{
-		const auto setParameter = [=]
-		{
-			InvokeOnActiveSounds(objectID, [=](SoundObject* sound) { sound->SetParameter(parameterID, value); });
-		};
-		ExecuteOnAudioThread(EIfThisIsAudioThread::ExecuteNow, setParameter, "Set Sound Parameter"); //? might overflow the queue
+		AudioThreadCommand command = MakeParameterCommand(parameterID, objectID);
+		command.ValueType = AudioThreadCommand::EValueType::Float;
+		command.Value.Float = value;
+		SubmitCommand(command);
 	}
 
 	void MiniAudioEngine::SetParameterInt(Audio::CommandID parameterID, uint64_t objectID, int value)
 	{
-		const auto setParameter = [=]
-		{
-			InvokeOnActiveSounds(objectID, [=](SoundObject* sound) { sound->SetParameter(parameterID, value); });
-		};
-		ExecuteOnAudioThread(EIfThisIsAudioThread::ExecuteNow, setParameter, "Set Sound Parameter"); //? might overflow the queue
+		AudioThreadCommand command = MakeParameterCommand(parameterID, objectID);
+		command.ValueType = AudioThreadCommand::EValueType::Int;
+		command.Value.Int = value;
+		SubmitCommand(command);
 	}
 
 	void MiniAudioEngine::SetParameterBool(Audio::CommandID parameterID, uint64_t objectID, bool value)
 	{
-		const auto setParameter = [=]
-		{
-			InvokeOnActiveSounds(objectID, [=](SoundObject* sound) { sound->SetParameter(parameterID, value); });
-		};
-		ExecuteOnAudioThread(EIfThisIsAudioThread::ExecuteNow, setParameter, "Set Sound Parameter"); //? might overflow the queue
+		AudioThreadCommand command = MakeParameterCommand(parameterID, objectID);
+		command.ValueType = AudioThreadCommand::EValueType::Bool;
+		command.Value.Bool = value;
+		SubmitCommand(command);
 	}
 
 	void MiniAudioEngine::SetParameterFloat(Audio::CommandID parameterID, Audio::EventID playingEvent, float value)
 	{
-		auto setParameter = [=]
-		{
-			InvokeOnActiveSources(playingEvent, [=] (SoundObject* source)
-			{
-				source->SetParameter(parameterID, value);
-			});
-		};
-
-		ExecuteOnAudioThread(EIfThisIsAudioThread::ExecuteNow, setParameter, "Set Sound Parameter");  //? might overflow the queue
+		AudioThreadCommand command = MakeParameterCommand(parameterID, playingEvent);
+		command.ValueType = AudioThreadCommand::EValueType::Float;
+		command.Value.Float = value;
+		SubmitCommand(command);
 	}
 
 	void MiniAudioEngine::SetParameterInt(Audio::CommandID parameterID, Audio::EventID playingEvent, int value)
 	{
-		auto setParameter = [=]
-		{
-			InvokeOnActiveSources(playingEvent, [=](SoundObject* source)
-			{
-				source->SetParameter(parameterID, value);
-			});
-		};
-
-		ExecuteOnAudioThread(EIfThisIsAudioThread::ExecuteNow, setParameter, "Set Sound Parameter");  //? might overflow the queue
+		AudioThreadCommand command = MakeParameterCommand(parameterID, playingEvent);
+		command.ValueType = AudioThreadCommand::EValueType::Int;
+		command.Value.Int = value;
+		SubmitCommand(command);
 	}
 
 	void MiniAudioEngine::SetParameterBool(Audio::CommandID parameterID, Audio::EventID playingEvent, bool value)
 	{
-		auto setParameter = [=]
-		{
-			InvokeOnActiveSources(playingEvent, [=](SoundObject* source)
-			{
-				source->SetParameter(parameterID, value);
-			});
-		};
-
-		ExecuteOnAudioThread(EIfThisIsAudioThread::ExecuteNow, setParameter, "Set Sound Parameter");  //? might overflow the queue
+		AudioThreadCommand command = MakeParameterCommand(parameterID, playingEvent);
+		command.ValueType = AudioThreadCommand::EValueType::Bool;
+		command.Value.Bool = value;
+		SubmitCommand(command);
 	}
 
 	void MiniAudioEngine::SetLowPassFilterValueObj(uint64_t objectID, float value)
 	{
-		auto setLowPassFilter = [=]
-		{
-			InvokeOnActiveSounds(objectID, [=](SoundObject* sound) { sound->SetLowPassFilter(value); });
-		};
-
-		ExecuteOnAudioThread(EIfThisIsAudioThread::ExecuteNow, setLowPassFilter, "Set Low Pass Filter");  //? might overflow the queue
+		SubmitCommand(MakeFilterCommand(AudioThreadCommand::EType::SetLowPassOnObject, objectID, EventID::INVALID, value));
 	}
 
 	void MiniAudioEngine::SetHighPassFilterValueObj(uint64_t objectID, float value)
 	{
-		auto setHighPassFilter = [=]
-		{
-			InvokeOnActiveSounds(objectID, [=](SoundObject* sound) { sound->SetHighPassFilter(value); });
-		};
-
-		ExecuteOnAudioThread(EIfThisIsAudioThread::ExecuteNow, setHighPassFilter, "Set High Pass Filter");  //? might overflow the queue
+		SubmitCommand(MakeFilterCommand(AudioThreadCommand::EType::SetHighPassOnObject, objectID, EventID::INVALID, value));
 	}
 
 	void MiniAudioEngine::SetLowPassFilterValue(Audio::EventID playingEvent, float value)
 	{
-		auto setLowPassFilter = [=]
-		{
-			InvokeOnActiveSources(playingEvent, [=](SoundObject* source)
-			{
-				source->SetLowPassFilter(value);
-			});
-		};
-
-		ExecuteOnAudioThread(EIfThisIsAudioThread::ExecuteNow, setLowPassFilter, "Set Low Pass Filter");  //? might overflow the queue
+		SubmitCommand(MakeFilterCommand(AudioThreadCommand::EType::SetLowPassOnEvent, 0, playingEvent, value));
 	}
 
 	void MiniAudioEngine::SetHighPassFilterValue(Audio::EventID playingEvent, float value)
 	{
-		auto setHighPassFilter = [=]
+		SubmitCommand(MakeFilterCommand(AudioThreadCommand::EType::SetHighPassOnEvent, 0, playingEvent, value));
+	}
+
+	//==================================================================================
+
+	Audio::OfflineRenderResult MiniAudioEngine::RenderOffline(const Audio::OfflineRenderSettings& settings)
+	{
+		BEY_CORE_ASSERT(s_Instance, "Audio Engine was not initialized.");
+
+		Audio::OfflineRenderResult result;
+
+		auto render = [&settings, &result]
 		{
-			InvokeOnActiveSources(playingEvent, [=](SoundObject* source)
+			BEY_PROFILE_FUNC("MiniAudioEngine::RenderOffline");
+
+			MiniAudioEngine& engine = *s_Instance;
+			if (!engine.bInitialized)
+				return;
+
+			ma_engine* maEngine = &engine.m_Engine;
+			result.SampleRate = ma_engine_get_sample_rate(maEngine);
+			result.Channels = ma_engine_get_channels(maEngine);
+
+			const uint32_t blockSize = settings.BlockSize ? settings.BlockSize : maEngine->pDevice->playback.internalPeriodSizeInFrames;
+			const uint64_t totalFrames = (uint64_t)(settings.Duration * result.SampleRate);
+			const Timestep timeStep((float)blockSize / (float)result.SampleRate);
+
+			ma_encoder encoder;
+			const bool writeFile = !settings.OutputFile.empty();
+			if (writeFile)
 			{
-				source->SetHighPassFilter(value);
-			});
+				ma_encoder_config encoderConfig = ma_encoder_config_init(ma_encoding_format_wav, ma_format_f32, result.Channels, result.SampleRate);
+				if (ma_encoder_init_file(settings.OutputFile.string().c_str(), &encoderConfig, &encoder) != MA_SUCCESS)
+				{
+					BEY_CORE_ERROR_TAG("Audio", "Offline render: failed to open output file '{}'", settings.OutputFile.string());
+					return;
+				}
+			}
+
+			// Playback device must not pull the graph at the same time
+			const bool deviceStarted = ma_device_is_started(maEngine->pDevice);
+			if (deviceStarted)
+				ma_engine_stop(maEngine);
+
+			std::vector<float> block((size_t)blockSize * result.Channels);
+			if (settings.KeepFrames)
+				result.Frames.reserve((size_t)totalFrames * result.Channels);
+
+			Audio::NodeProfiler profiler;
+			profiler.Begin(&maEngine->nodeGraph);
+
+			engine.m_RenderingOffline = true;
+
+			Timer timer;
+			while (result.FrameCount < totalFrames)
+			{
+				const uint32_t numFrames = (uint32_t)std::min<uint64_t>(blockSize, totalFrames - result.FrameCount);
+
+				timer.Reset();
+				engine.Update(timeStep);
+				result.UpdateMilliseconds += timer.ElapsedMillis();
+
+				// Sounds started by the update have been attached to the graph
+				profiler.Sample();
+
+				ma_uint32 framesRead = 0;
+				timer.Reset();
+				ma_node_graph_read_pcm_frames(&maEngine->nodeGraph, block.data(), numFrames, &framesRead);
+				result.RenderMilliseconds += timer.ElapsedMillis();
+
+				if (framesRead < numFrames)
+					ma_silence_pcm_frames(block.data() + (size_t)framesRead * result.Channels, numFrames - framesRead, ma_format_f32, result.Channels);
+
+				if (writeFile)
+					ma_encoder_write_pcm_frames(&encoder, block.data(), numFrames);
+
+				if (settings.KeepFrames)
+					result.Frames.insert(result.Frames.end(), block.begin(), block.begin() + (size_t)numFrames * result.Channels);
+
+				result.FrameCount += numFrames;
+			}
+
+			engine.m_RenderingOffline = false;
+			result.NodeTimings = profiler.End();
+
+			if (writeFile)
+				ma_encoder_uninit(&encoder);
+
+			if (deviceStarted)
+				ma_engine_start(maEngine);
+
+			result.Success = true;
 		};
 
-		ExecuteOnAudioThread(EIfThisIsAudioThread::ExecuteNow, setHighPassFilter, "Set High Pass Filter");  //? might overflow the queue
-	}
+		ExecuteOnAudioThread(render, "RenderOffline");
 
-	//==================================================================================
+		AudioThreadFence fence;
+		fence.BeginAndWait();
+
+		if (!result.Success)
+			return result;
+
+		std::string report;
+		for (const auto& timing : result.NodeTimings)
+		{
+			report += fmt::format("\n                    {:<16} {:>4} nodes {:>9} calls {:>10.2f} ms ({:.1f}%)",
+				timing.Name, timing.NodeCount, timing.ProcessCount, timing.Milliseconds,
+				result.RenderMilliseconds > 0.0 ? timing.Milliseconds / result.RenderMilliseconds * 100.0 : 0.0);
+		}
+
+		BEY_CORE_INFO_TAG("Audio", R"(Audio Engine: offline render finished.
+                    -----------------------------
+                    Frames:                 {0} ({1:.2f} s at {2} Hz, {3} channels)
+                    Render:                 {4:.2f} ms
+                    Update:                 {5:.2f} ms
+                    Realtime Factor:        {6:.1f}x
+                    -----------------------------{7})",
+					result.FrameCount, (double)result.FrameCount / result.SampleRate, result.SampleRate, result.Channels,
+					result.RenderMilliseconds, result.UpdateMilliseconds, result.GetRealtimeFactor(), report);
+
+		return result;
+	}
 
 	Stats MiniAudioEngine::GetStats()
 	{
+		const auto streamingStats = s_Instance->m_ResourceManager->GetStreamingManager().GetStats();
+
 		std::scoped_lock lock{ s_Stats.mutex };
 		s_Stats.FrameTime = AudioThread::GetFrameTime();
+		s_Stats.ActiveStreams = streamingStats.ActiveStreams;
+		s_Stats.MemStreaming = streamingStats.MemoryUsed;
+		s_Stats.StreamingStarvedFrames = streamingStats.StarvedFrames;
+		s_Stats.CommandQueueDepth = AudioThread::GetCommandQueueDepth();
+		s_Stats.DroppedCommands = AudioThread::GetDroppedCommands();
 		return MiniAudioEngine::s_Stats;
 	}
 
@@ -1614,6 +1914,25 @@ namespace Beyond {
 		//BEY_CORE_INFO_TAG("Audio", "ON RUNTIME PLAYING");
 	}
 
+	void MiniAudioEngine::StartSceneAudio(const Ref<Scene>& scene)
+	{
+		//! Game Thread
+
+		SetSceneContext(scene);
+		if (!scene)
+			return;
+
+		auto& audioEngine = Get();
+		auto* sceneContext = audioEngine.m_SceneContext.Raw();
+		auto view = sceneContext->GetAllEntitiesWith<AudioComponent>();
+		for (auto entity : view)
+		{
+			Entity audioEntity = { entity, sceneContext };
+			if (audioEntity.GetComponent<AudioComponent>().bPlayOnAwake)
+				audioEngine.SubmitStartPlayback(audioEntity.GetUUID());
+		}
+	}
+
 	void MiniAudioEngine::OnSceneDestruct(UUID sceneID)
 	{
 		ExecuteOnAudioThread([] {
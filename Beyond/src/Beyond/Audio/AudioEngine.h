@@ -17,6 +17,7 @@
 #include "Beyond/Utilities/ContainerUtils.h"
 
 #include "AudioPlayback.h"
+#include "OfflineRender.h"
 
 #include <optional>
 #include <queue>
@@ -67,6 +68,13 @@ namespace Beyond
                 MemEngine = other.MemEngine;
                 MemResManager = other.MemResManager;
                 FrameTime = other.FrameTime;
+                ActiveStreams = other.ActiveStreams;
+                MemStreaming = other.MemStreaming;
+                StreamingStarvedFrames = other.StreamingStarvedFrames;
+                RealVoices = other.RealVoices;
+                VirtualVoices = other.VirtualVoices;
+                CommandQueueDepth = other.CommandQueueDepth;
+                DroppedCommands = other.DroppedCommands;
             }
 
             uint32_t AudioObjects = 0;
@@ -76,6 +84,13 @@ namespace Beyond
             uint64_t MemEngine = 0;
             uint64_t MemResManager = 0;
             float FrameTime = 0.0f;
+            uint32_t ActiveStreams = 0;
+            uint64_t MemStreaming = 0;
+            uint64_t StreamingStarvedFrames = 0; // Frames the streams couldn't decode in time, played as silence
+            uint32_t RealVoices = 0;
+            uint32_t VirtualVoices = 0;         // Active voices that are not processed, too quiet or over the real voice limit
+            uint32_t CommandQueueDepth = 0;     // Maximum number of commands waiting for Audio Thread since the last read
+            uint64_t DroppedCommands = 0;       // Commands that didn't fit into the Audio Thread command queue
 
             mutable std::shared_mutex mutex;
         };
@@ -183,11 +198,13 @@ namespace Beyond
     class MiniAudioEngine
     {
     public:
-        MiniAudioEngine();
+        MiniAudioEngine(bool offlineRendering = false);
         ~MiniAudioEngine();
 
-        /* Initialize Instance */
-        static void Init();
+        /* Initialize Instance
+		   @param offlineRendering - initialize without a playback device, audio is only rendered by RenderOffline()
+		*/
+        static void Init(bool offlineRendering = false);
 
         /* Shutdown AudioEngine and tear down hardware initialization */
         static void Shutdown();
@@ -217,6 +234,21 @@ namespace Beyond
 		static bool BuildSoundBank();
 		static bool UnloadCurrentSoundBank();
 
+		//==================================================================================
+		/** Render the audio of the current scene without a playback device, as fast as possible.
+			Engine is updated in between the blocks with a fixed time step, the scene itself is not.
+			The playback device is stopped while rendering. Called from Game Thread, blocks until finished.
+
+			@param settings - duration, block size and where the frames should go
+			@returns rendered frames info and the time spent in each type of node
+		*/
+		static Audio::OfflineRenderResult RenderOffline(const Audio::OfflineRenderSettings& settings);
+
+		/** Make scene the audio context and start its "play on awake" sources without running the scene
+			(no scripts or physics), for rendering its audio offline in a headless application.
+		*/
+		static void StartSceneAudio(const Ref<Scene>& scene);
+
 		//==================================================================================
         static Audio::Stats GetStats();
 
@@ -270,6 +302,10 @@ namespace Beyond
 		struct UserConfig
 		{
 			double FileStreamingDurationThreshold = 30.0;
+			uint32_t StreamingMemoryBudgetMB = 32;		// Decoded-ahead audio of all of the streams
+			double StreamingBufferDuration = 0.5;		// Seconds decoded ahead per stream
+			uint32_t MaxRealVoices = 32;				// Voices processed at the same time, the rest is virtual
+			float VirtualizationThresholdDB = -60.0f;	// Voices quieter than this are virtual
 		};
 		UserConfig GetUserConfiguration() const { std::scoped_lock sl(m_UserConfigLock); return m_UserConfig; }
 		void SetUserConfiguration(const UserConfig& newConfig) { std::scoped_lock sl(m_UserConfigLock); m_UserConfig = newConfig; }
@@ -280,9 +316,9 @@ namespace Beyond
         void Update(Timestep ts);
 
         /* Submit data to update Sound Sources from Game Thread.
-		   @param updateData - updated data submitted on scene update
+		   @param updateData - updated data submitted on scene update, swapped with the previous buffer to reuse its memory
 		*/
-        void SubmitSourceUpdateData(std::vector<SoundSourceUpdateData> updateData);
+        void SubmitSourceUpdateData(std::vector<SoundSourceUpdateData>& updateData);
 		
 		/**	Must be called by Game Thread to delete any Entities that were created
 			for one-shot Audio Events.
@@ -329,6 +365,9 @@ namespace Beyond
 		template<typename Function>
 		void InvokeOnActiveSources(Audio::EventID playingEvent, Function functionToInvoke);
 
+		/* Called from Audio Thread to execute commands submitted with SubmitCommand() */
+		void ExecuteCommand(const Audio::AudioThreadCommand& command);
+
     public:
         //==================================================================================
         /// Sound Object Parameter Interface
@@ -360,6 +399,13 @@ namespace Beyond
 		};
         static void ExecuteOnAudioThread(EIfThisIsAudioThread policy, Audio::AudioThreadCallbackFunction func, const char* jobID = "NONE");
 
+		/* Submit plain data command to Audio Thread without allocating, or execute it now if this is Audio Thread.
+		   Commands are executed in order with the functions passed to ExecuteOnAudioThread().
+		   If the command queue is full, the command is dropped and counted in Stats::DroppedCommands.
+		   @returns false - if the command was dropped
+		*/
+		static bool SubmitCommand(const Audio::AudioThreadCommand& command);
+
 		//==================================================================================
         /** 	Callback from Game Thread when an AudioComponent has been created
 			(marking Entity as "audible" for our semantics)
@@ -386,6 +432,7 @@ namespace Beyond
 				Stats_AudioObjects = BIT(1),
 				Stats_AudioComponents = BIT(2),
 				Stats_ActiveEvents = BIT(3),
+				Stats_Voices = BIT(4),
 			};
 
 			void Set(int flag) { m_Flags |= flag; }
@@ -413,6 +460,14 @@ namespace Beyond
         /* This is called when there is no free source available in pool for new playback start request. */
         SoundObject* FreeLowestPrioritySource();
 
+        /* Virtualize voices that are too quiet to be heard, or over the real voice limit.
+           Voices with higher SoundConfig priority, then louder voices, are kept real.
+        */
+        void UpdateVirtualVoices();
+
+        /* @returns volume of the voice, attenuated by distance and cone angle if spatialized */
+        float GetVoiceAudibility(const SoundObject* voice) const;
+
 
         //==================================================================================
         /// Playback interface. In most cases these functions are called from Game Thread.
@@ -489,6 +544,12 @@ namespace Beyond
         ma_engine m_Engine;
         ma_log m_maLog;
         bool bInitialized = false;
+
+        // Offline rendering uses a context with the null backend only,
+        // the engine is only updated while rendering.
+        bool m_OfflineRendering = false;
+        bool m_RenderingOffline = false;
+        ma_context m_OfflineContext;
         ma_sound m_PreviewSound;
 
 		mutable std::mutex m_UserConfigLock;
@@ -511,6 +572,7 @@ namespace Beyond
         std::vector<SoundObject*> m_SoundSources;
         std::vector<SoundObject*> m_ActiveSounds;
         std::vector<SoundObject*> m_SoundsToStart;
+        uint32_t m_NumVirtualVoices = 0;
 
 		//==============================================
         std::mutex m_UpdateSourcesLock;
@@ -338,6 +338,11 @@ namespace Beyond::Audio {
 		return m_EventRegistry.Add(info);
 	}
 
+	void AudioEventsManager::UnregisterEvent(EventID playingEvent)
+	{
+		m_EventRegistry.Remove(playingEvent);
+	}
+
 	void AudioEventsManager::OnSourceFinished(EventID playingEvent, SourceID source)
 	{
 		if (m_EventRegistry.RemoveSource(playingEvent, source))
@@ -345,16 +350,21 @@ namespace Beyond::Audio {
 			// If all Actions of the Event were handled (e.g. this Play Action was the last one),
 			// remove Event from the object registry.
 
-			auto info = m_EventRegistry.Get(playingEvent);
-			TriggerCommand& trigger = std::get<TriggerCommand>(*info.CommandState);
-			auto& actions = trigger.Actions.GetVector();
-			const bool allActionsHandled = std::all_of(actions.begin(), actions.end(),
-										[](const TriggerAction& action) {return action.Handled; });
+			bool allActionsHandled = false;
+			UUID objectID = 0;
+			m_EventRegistry.Invoke(playingEvent, [&](const EventInfo& info)
+			{
+				const TriggerCommand& trigger = std::get<TriggerCommand>(*info.CommandState);
+				const auto& actions = trigger.Actions.GetVector();
+				allActionsHandled = std::all_of(actions.begin(), actions.end(),
+											[](const TriggerAction& action) {return action.Handled; });
+				objectID = info.ObjectID;
+			});
 
 			if (allActionsHandled)
 			{
 				m_EventRegistry.Remove(playingEvent);
-				m_OnEventFinished.Invoke(playingEvent, info.ObjectID);
+				m_OnEventFinished.Invoke(playingEvent, objectID);
 			}
 		}
 	}
@@ -368,6 +378,12 @@ namespace Beyond::Audio {
 		m_CommandQueue.push({ ECommandType::Trigger, eventInfo }); // TODO: alternative option is to push playbackID and retrieve EventInfo in the Update()
 	}
 
+	void AudioEventsManager::PostTrigger(EventID playingEvent)
+	{
+		// Copy the EventInfo straight into the command queue, the registry lookup itself doesn't copy
+		m_EventRegistry.Invoke(playingEvent, [this](const EventInfo& info) { PostTrigger(info); });
+	}
+
 	bool AudioEventsManager::ExecuteActionOnPlayingEvent(EventID playingEvent, EActionTypeOnPlayingEvent action)
 	{
 		if (m_EventRegistry.GetNumberOfSources(playingEvent) <= 0)
@@ -376,15 +392,19 @@ namespace Beyond::Audio {
 			return false;
 		}
 
-		auto executeAction = [=]
-		{
-			const EventInfo eventInfo = m_EventRegistry.Get(playingEvent);
-			m_ActionHandler.ExecuteOnSources.Invoke(action, eventInfo.ActiveSources);
-		};
-
-		MiniAudioEngine::ExecuteOnAudioThread(MiniAudioEngine::EIfThisIsAudioThread::ExecuteNow, executeAction, "ExecuteActionOnPlayingEvent");
+		AudioThreadCommand command;
+		command.Type = AudioThreadCommand::EType::ActionOnEvent;
+		command.EventID = playingEvent;
+		command.Action = (int32_t)action;
+		return MiniAudioEngine::SubmitCommand(command);
+	}
 
-		return true;
+	void AudioEventsManager::ProcessActionOnPlayingEvent(EventID playingEvent, EActionTypeOnPlayingEvent action)
+	{
+		m_EventRegistry.Invoke(playingEvent, [&](const EventInfo& info)
+		{
+			m_ActionHandler.ExecuteOnSources.Invoke(action, info.ActiveSources);
+		});
 	}
 
 } // namespace Beyond::Audio
@@ -14,19 +14,33 @@ namespace Beyond::Audio {
 
 		/** Returnsand assigns the same EventID to the supplied EventInfo */
 		EventID RegisterEvent(EventInfo& info);
+
+		/** Remove event registered with RegisterEvent() that could not be posted to Audio Thread. */
+		void UnregisterEvent(EventID playingEvent);
 		
 		/** Unregister source with the playing event. Called by AudioEngine. */
 		void OnSourceFinished(EventID playingEvent, SourceID source);
 		
 		void PostTrigger(const EventInfo& eventInfo);
 
+		/** Post trigger of an event that's been registered with RegisterEvent(). Called on Audio Thread. */
+		void PostTrigger(EventID playingEvent);
+
 		uint32_t GetNumberOfActiveEvents() const { return m_EventRegistry.Count(); }
 		uint32_t GetNumberOfActiveSources(EventID playingEvent) const { return m_EventRegistry.GetNumberOfSources(playingEvent); }
-		std::vector<SourceID> GetActiveSources(EventID playingEvent) const { return m_EventRegistry.Get(playingEvent).ActiveSources; }
+
+		/** Invoke function on each active source of a playing event without copying the source list.
+			The registry is locked for the duration of the call, function must not post or finish events.
+		*/
+		template<typename Function>
+		void InvokeOnActiveSources(EventID playingEvent, Function&& function) const;
 
 		/** Execute Action on all active sources of a playing event. */
 		bool ExecuteActionOnPlayingEvent(EventID playingEvent, EActionTypeOnPlayingEvent action);
 
+		/** Execute Action submitted by ExecuteActionOnPlayingEvent(). Called on Audio Thread. */
+		void ProcessActionOnPlayingEvent(EventID playingEvent, EActionTypeOnPlayingEvent action);
+
 	private:
 		friend MiniAudioEngine::MiniAudioEngine();
 		explicit AudioEventsManager(MiniAudioEngine& audioEngine);
@@ -78,4 +92,14 @@ namespace Beyond::Audio {
 		} m_ActionHandler;
 	};
 
+	template<typename Function>
+	void AudioEventsManager::InvokeOnActiveSources(EventID playingEvent, Function&& function) const
+	{
+		m_EventRegistry.Invoke(playingEvent, [&function](const EventInfo& info)
+		{
+			for (SourceID sourceID : info.ActiveSources)
+				function(sourceID);
+		});
+	}
+
 } // namespace Beyond::Audio
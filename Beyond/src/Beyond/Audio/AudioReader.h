@@ -24,12 +24,16 @@ namespace Beyond::Audio
 			uint32_t NumChannels;
 			ma_channel_converter Converter;
 			BufferSafe Buffer;
+			AudioStream* Stream = nullptr; // Set for streamed files, the data source is not used then
 
 			// Returns number of frames read
 			uint64_t Read(float* destination, uint64_t numFramesToRead, uint64_t readPositionInSource, uint64_t startFrameInSource)
 			{
 				BEY_CORE_ASSERT(destination != nullptr);
 
+				if (Stream)
+					return Stream->Read(destination, numFramesToRead, readPositionInSource, startFrameInSource);
+
 				if (numFramesToRead == 0) return 0;
 
 				ma_result result;
@@ -73,6 +77,10 @@ namespace Beyond::Audio
 
 			bool IsAtEnd()
 			{
+				// Streams always loop
+				if (Stream)
+					return false;
+
 				ma_uint64 cursor, length;
 				ma_result r = ma_resource_manager_data_source_get_cursor_in_pcm_frames(&Source, &cursor);
 				BEY_CORE_ASSERT(r == MA_SUCCESS);
@@ -137,6 +145,21 @@ namespace Beyond::Audio
 					filepath = path.string();
 			}
 #endif
+			// Long files are streamed instead of being decoded fully
+			ResourceManager* resources = MiniAudioEngine::Get().GetResourceManager();
+			if (resources->IsStreaming(waveAssetHandle))
+			{
+				reader.Stream = resources->GetStreamingManager().OpenStream(resourceManager, waveAssetHandle, resources->GetStreamingConfig());
+				if (reader.Stream)
+				{
+					reader.TotalFrames = reader.Stream->GetTotalFrames();
+					reader.NumChannels = AudioStream::NumChannels;
+					return true;
+				}
+
+				// Out of the streaming memory budget, decoding the whole file instead
+			}
+
 			const std::string sourceFile = std::to_string(waveAssetHandle);
 
 			// TODO: flags (streaming, decoding, etc.)
@@ -190,7 +213,12 @@ namespace Beyond::Audio
 				return;
 
 			for (std::pair<const AssetHandle, Reader>& reader : Readers)
-				ma_resource_manager_data_source_uninit(&reader.second.Source);
+			{
+				if (reader.second.Stream)
+					MiniAudioEngine::Get().GetResourceManager()->GetStreamingManager().CloseStream(reader.second.Stream);
+				else
+					ma_resource_manager_data_source_uninit(&reader.second.Source);
+			}
 
 			Readers.clear();
 		}
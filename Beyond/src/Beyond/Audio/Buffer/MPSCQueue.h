@@ -0,0 +1,125 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <type_traits>
+
+namespace Beyond::Audio
+{
+	/** Bounded lock-free queue with any number of producer threads and a single consumer thread.
+		Each cell carries a sequence number telling whether it's free to write, or holds an element to read,
+		so producers only contend on reserving the write position. Capacity is rounded up to a power of two.
+	*/
+	template<typename T>
+	class MPSCQueue final
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "MPSCQueue elements are copied in and out of preallocated cells.");
+
+	public:
+		MPSCQueue() = default;
+		MPSCQueue(const MPSCQueue&) = delete;
+
+		/** Not thread safe, must be called while none of the threads uses the queue. */
+		void Allocate(size_t capacity)
+		{
+			size_t size = 2;
+			while (size < capacity)
+				size <<= 1;
+
+			m_Cells = std::make_unique<Cell[]>(size);
+			m_Mask = size - 1;
+
+			for (size_t i = 0; i < size; ++i)
+				m_Cells[i].Sequence.store(i, std::memory_order_relaxed);
+
+			m_WritePosition.store(0);
+			m_ReadPosition.store(0);
+		}
+
+		size_t GetCapacity() const noexcept { return m_Cells ? m_Mask + 1 : 0; }
+
+		/** Approximate number of elements in the queue, exact only on the consumer thread while no producers push. */
+		size_t GetSize() const noexcept
+		{
+			const size_t write = m_WritePosition.load(std::memory_order_relaxed);
+			const size_t read = m_ReadPosition.load(std::memory_order_relaxed);
+			return write > read ? write - read : 0;
+		}
+
+		//==============================================================================
+		/// Producers
+
+		/** @returns false - if the queue is full, the element is not pushed */
+		bool TryPush(const T& element) noexcept
+		{
+			if (!m_Cells)
+				return false;
+
+			size_t position = m_WritePosition.load(std::memory_order_relaxed);
+			while (true)
+			{
+				Cell& cell = m_Cells[position & m_Mask];
+				const size_t sequence = cell.Sequence.load(std::memory_order_acquire);
+				const intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+
+				if (difference == 0)
+				{
+					// Cell is free, try to reserve it
+					if (m_WritePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						cell.Data = element;
+						cell.Sequence.store(position + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (difference < 0)
+				{
+					// Cell still holds an element from the previous lap
+					return false;
+				}
+				else
+				{
+					// Another producer reserved this position
+					position = m_WritePosition.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		//==============================================================================
+		/// Consumer
+
+		/** @returns false - if there is nothing to read, or the next element is still being written */
+		bool TryPop(T& element) noexcept
+		{
+			if (!m_Cells)
+				return false;
+
+			const size_t position = m_ReadPosition.load(std::memory_order_relaxed);
+			Cell& cell = m_Cells[position & m_Mask];
+
+			if (cell.Sequence.load(std::memory_order_acquire) != position + 1)
+				return false;
+
+			element = cell.Data;
+
+			// Free the cell for the producers of the next lap
+			cell.Sequence.store(position + m_Mask + 1, std::memory_order_release);
+			m_ReadPosition.store(position + 1, std::memory_order_relaxed);
+			return true;
+		}
+
+	private:
+		struct Cell
+		{
+			std::atomic<size_t> Sequence;
+			T Data;
+		};
+
+		std::unique_ptr<Cell[]> m_Cells;
+		size_t m_Mask = 0;
+
+		alignas(64) std::atomic<size_t> m_WritePosition{ 0 };
+		alignas(64) std::atomic<size_t> m_ReadPosition{ 0 };
+	};
+
+} // namespace Beyond::Audio
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+
+namespace Beyond::Audio
+{
+	/** Lock-free ring buffer with a single producer and a single consumer thread.
+		Read and write counters only ever increase, each of them is written by one thread only.
+	*/
+	template<typename T>
+	class SPSCRingBuffer final
+	{
+	public:
+		SPSCRingBuffer() = default;
+		SPSCRingBuffer(const SPSCRingBuffer&) = delete;
+
+		/** Not thread safe, must be called while neither of the threads uses the buffer. */
+		void Allocate(size_t capacity)
+		{
+			m_Data = std::make_unique<T[]>(capacity);
+			m_Capacity = capacity;
+			m_ReadCount.store(0);
+			m_WriteCount.store(0);
+		}
+
+		void Release()
+		{
+			m_Data.reset();
+			m_Capacity = 0;
+			m_ReadCount.store(0);
+			m_WriteCount.store(0);
+		}
+
+		size_t GetCapacity() const noexcept { return m_Capacity; }
+		size_t GetSizeInBytes() const noexcept { return m_Capacity * sizeof(T); }
+
+		//==============================================================================
+		/// Producer
+
+		inline size_t AvailableToWrite() const noexcept { return m_Capacity - (size_t)(m_WriteCount.load(std::memory_order_relaxed) - m_ReadCount.load()); }
+
+		/** Contiguous region that can be written to, count is how many elements fit into it. */
+		inline T* PrepareWrite(size_t& count) noexcept
+		{
+			const uint64_t writeCount = m_WriteCount.load(std::memory_order_relaxed);
+			const size_t position = (size_t)(writeCount % m_Capacity);
+			count = std::min(AvailableToWrite(), m_Capacity - position);
+			return m_Data.get() + position;
+		}
+
+		/** Makes count elements written to the region returned by PrepareWrite() available to the consumer. */
+		inline void CommitWrite(size_t count) noexcept
+		{
+			m_WriteCount.store(m_WriteCount.load(std::memory_order_relaxed) + count);
+		}
+
+		//==============================================================================
+		/// Consumer
+
+		inline size_t AvailableToRead() const noexcept { return (size_t)(m_WriteCount.load() - m_ReadCount.load(std::memory_order_relaxed)); }
+
+		/** Returns number of elements read, which might be less than count. */
+		size_t Read(T* destination, size_t count) noexcept
+		{
+			count = std::min(count, AvailableToRead());
+
+			const uint64_t readCount = m_ReadCount.load(std::memory_order_relaxed);
+			const size_t position = (size_t)(readCount % m_Capacity);
+			const size_t first = std::min(count, m_Capacity - position);
+
+			std::memcpy(destination, m_Data.get() + position, first * sizeof(T));
+			std::memcpy(destination + first, m_Data.get(), (count - first) * sizeof(T));
+
+			m_ReadCount.store(readCount + count);
+			return count;
+		}
+
+		/** Drops up to count elements, returns number of elements dropped. */
+		size_t Skip(size_t count) noexcept
+		{
+			count = std::min(count, AvailableToRead());
+			m_ReadCount.store(m_ReadCount.load(std::memory_order_relaxed) + count);
+			return count;
+		}
+
+	private:
+		std::unique_ptr<T[]> m_Data;
+		size_t m_Capacity = 0;
+
+		// Sequentially consistent, the streams order other flags against them
+		alignas(64) std::atomic<uint64_t> m_WriteCount{ 0 };
+		alignas(64) std::atomic<uint64_t> m_ReadCount{ 0 };
+	};
+
+} // namespace Beyond::Audio
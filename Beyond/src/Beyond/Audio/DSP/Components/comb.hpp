@@ -21,6 +21,7 @@ public:
 			void	setfeedback(float val);
 			float	getfeedback();
 private:
+	friend class revmodel; // processblock() runs all combs together
 	float	feedback;
 	float	filterstore;
 	float	damp1;
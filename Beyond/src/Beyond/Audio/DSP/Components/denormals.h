@@ -10,6 +10,35 @@
 
 #define undenormalise(sample) if(((*(unsigned int*)&sample)&0x7f800000)==0) sample=0.0f
 
+#if defined(_M_X64) || defined(__SSE2__)
+#include <xmmintrin.h>
+#endif
+
+// Has the FPU flush denormals to zero (FTZ/DAZ) while in scope, block processing
+// relies on this instead of undenormalise in its inner loops
+class denormalguard
+{
+public:
+#if defined(_M_X64) || defined(__SSE2__)
+	denormalguard() : csr(_mm_getcsr()) { _mm_setcsr(csr | 0x8040); }
+	~denormalguard() { _mm_setcsr(csr); }
+private:
+	unsigned int csr;
+#elif defined(__aarch64__) && defined(__GNUC__)
+	denormalguard() { asm volatile("mrs %0, fpcr" : "=r"(fpcr)); setfpcr(fpcr | (1ull << 24)); }
+	~denormalguard() { setfpcr(fpcr); }
+private:
+	static void setfpcr(unsigned long long value) { asm volatile("msr fpcr, %0" : : "r"(value)); }
+private:
+	unsigned long long fpcr;
+#else
+	denormalguard() {}
+#endif
+public:
+	denormalguard(const denormalguard&) = delete;
+	denormalguard& operator=(const denormalguard&) = delete;
+};
+
 #endif//_denormals_
 
 //ends
@@ -8,6 +8,67 @@
 
 #include "revmodel.hpp"
 
+#include <algorithm>
+
+// Four SIMD lanes for processblock(). Build with AVX still uses these, the comb bank
+// maps onto 4x4 transposes and the allpasses are too short for wider lanes to pay off.
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+typedef __m128 lanes;
+static inline lanes lanes_set(float value)				{ return _mm_set1_ps(value); }
+static inline lanes lanes_load(const float *p)			{ return _mm_loadu_ps(p); }
+static inline void	lanes_store(float *p, lanes value)	{ _mm_storeu_ps(p, value); }
+static inline lanes lanes_add(lanes a, lanes b)			{ return _mm_add_ps(a, b); }
+static inline lanes lanes_sub(lanes a, lanes b)			{ return _mm_sub_ps(a, b); }
+static inline lanes lanes_mul(lanes a, lanes b)			{ return _mm_mul_ps(a, b); }
+static inline void	lanes_transpose(lanes &a, lanes &b, lanes &c, lanes &d) { _MM_TRANSPOSE4_PS(a, b, c, d); }
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+typedef float32x4_t lanes;
+static inline lanes lanes_set(float value)				{ return vdupq_n_f32(value); }
+static inline lanes lanes_load(const float *p)			{ return vld1q_f32(p); }
+static inline void	lanes_store(float *p, lanes value)	{ vst1q_f32(p, value); }
+static inline lanes lanes_add(lanes a, lanes b)			{ return vaddq_f32(a, b); }
+static inline lanes lanes_sub(lanes a, lanes b)			{ return vsubq_f32(a, b); }
+static inline lanes lanes_mul(lanes a, lanes b)			{ return vmulq_f32(a, b); }
+static inline void	lanes_transpose(lanes &a, lanes &b, lanes &c, lanes &d)
+{
+	const float32x4x2_t ab = vtrnq_f32(a, b);
+	const float32x4x2_t cd = vtrnq_f32(c, d);
+	a = vcombine_f32(vget_low_f32(ab.val[0]), vget_low_f32(cd.val[0]));
+	b = vcombine_f32(vget_low_f32(ab.val[1]), vget_low_f32(cd.val[1]));
+	c = vcombine_f32(vget_high_f32(ab.val[0]), vget_high_f32(cd.val[0]));
+	d = vcombine_f32(vget_high_f32(ab.val[1]), vget_high_f32(cd.val[1]));
+}
+#else
+struct lanes { float v[4]; };
+static inline lanes lanes_set(float value)				{ return { value, value, value, value }; }
+static inline lanes lanes_load(const float *p)			{ return { p[0], p[1], p[2], p[3] }; }
+static inline void	lanes_store(float *p, lanes value)	{ for (int i=0; i<4; i++) p[i] = value.v[i]; }
+static inline lanes lanes_add(lanes a, lanes b)			{ for (int i=0; i<4; i++) a.v[i] += b.v[i]; return a; }
+static inline lanes lanes_sub(lanes a, lanes b)			{ for (int i=0; i<4; i++) a.v[i] -= b.v[i]; return a; }
+static inline lanes lanes_mul(lanes a, lanes b)			{ for (int i=0; i<4; i++) a.v[i] *= b.v[i]; return a; }
+static inline void	lanes_transpose(lanes &a, lanes &b, lanes &c, lanes &d)
+{
+	lanes *rows[4] = { &a, &b, &c, &d };
+	for (int i=0; i<4; i++)
+		for (int j=i+1; j<4; j++)
+			std::swap(rows[i]->v[j], rows[j]->v[i]);
+}
+#endif
+static const int numlanes = 4;
+
+// Calls process(samples, first, count) for the parts of a circular buffer the next numframes
+// frames go through, samples[i] being the sample of frame first + i
+template<typename Function>
+static inline void forbuffer(float *buffer, int bufsize, int bufidx, int numframes, Function process)
+{
+	const int count = std::min(numframes, bufsize - bufidx);
+	process(buffer + bufidx, 0, count);
+	if (count < numframes)
+		process(buffer, count, numframes - count);
+}
+
 revmodel::revmodel(double sampleRate)
 {
 	// the tuning values are set for 44100Hz sample rate, need to adjust accordingly
@@ -65,6 +126,12 @@ revmodel::revmodel(double sampleRate)
 	allpassL[3].setbuffer(bufallpassL4.data(), (int)bufallpassL4.size());
 	allpassR[3].setbuffer(bufallpassR4.data(), (int)bufallpassR4.size());
 
+	blockframes = maxblockframes;
+	for (int i=0;i<numcombs;i++)
+		blockframes = std::min(blockframes, std::min(combL[i].bufsize, combR[i].bufsize));
+	for (int i=0;i<numallpasses;i++)
+		blockframes = std::min(blockframes, std::min(allpassL[i].bufsize, allpassR[i].bufsize));
+
 	// Set default values
 	allpassL[0].setfeedback(0.5f);
 	allpassR[0].setfeedback(0.5f);
@@ -172,6 +239,191 @@ void revmodel::processmix(const float *inputL, const float *inputR, float *outpu
 	}
 }
 
+void revmodel::processblock(const float *input, float *output, long numframes, int channels)
+{
+	denormalguard denormals;
+
+	while (numframes > 0)
+	{
+		const int count = (int)std::min(numframes, (long)blockframes);
+
+		for (int i=0; i<count; i++)
+		{
+			blockdry[0][i] = input[i*channels];
+			blockdry[1][i] = input[i*channels + 1];
+			blockinput[i] = (blockdry[0][i] + blockdry[1][i]) * gain;
+		}
+
+		processcombs(count);
+		processallpasses(count);
+
+		for (int i=0; i<count; i++)
+		{
+			const float outL = blockout[0][i];
+			const float outR = blockout[1][i];
+			output[i*channels] = outL*wet1 + outR*wet2 + blockdry[0][i]*dry;
+			output[i*channels + 1] = outR*wet1 + outL*wet2 + blockdry[1][i]*dry;
+		}
+
+		input += count*channels;
+		output += count*channels;
+		numframes -= count;
+	}
+}
+
+void revmodel::processcombs(int numframes)
+{
+	// A lane per comb: left 0-3, left 4-7, right 0-3, right 4-7
+	static const int numgroups = numcombs * 2 / numlanes;
+	comb *combs[numcombs * 2];
+	for (int c=0; c<numcombs; c++)
+	{
+		combs[c] = &combL[c];
+		combs[numcombs + c] = &combR[c];
+	}
+
+	alignas(16) float state[4][numcombs * 2];
+	for (int c=0; c<numcombs * 2; c++)
+	{
+		state[0][c] = combs[c]->filterstore;
+		state[1][c] = combs[c]->damp1;
+		state[2][c] = combs[c]->damp2;
+		state[3][c] = combs[c]->feedback;
+	}
+
+	lanes filterstore[numgroups], damp1[numgroups], damp2[numgroups], feedback[numgroups];
+	for (int g=0; g<numgroups; g++)
+	{
+		filterstore[g] = lanes_load(state[0] + g*numlanes);
+		damp1[g] = lanes_load(state[1] + g*numlanes);
+		damp2[g] = lanes_load(state[2] + g*numlanes);
+		feedback[g] = lanes_load(state[3] + g*numlanes);
+	}
+
+	// Damping filters of group g for count frames, samples[i] are the delayed samples of frame i
+	// and are replaced with the samples written back into the delay lines
+	auto damp = [&](int g, lanes *samples, const float *input, int count)
+	{
+		for (int i=0; i<count; i++)
+		{
+			filterstore[g] = lanes_add(lanes_mul(samples[i], damp2[g]), lanes_mul(filterstore[g], damp1[g]));
+			samples[i] = lanes_add(lanes_set(input[i]), lanes_mul(filterstore[g], feedback[g]));
+		}
+	};
+
+	int frame = 0;
+	while (frame < numframes)
+	{
+		// Up to where the first of the delay lines wraps around
+		float *samples[numcombs * 2];
+		int count = numframes - frame;
+		for (int c=0; c<numcombs * 2; c++)
+		{
+			samples[c] = combs[c]->buffer + combs[c]->bufidx;
+			count = std::min(count, combs[c]->bufsize - combs[c]->bufidx);
+		}
+
+		// Four frames at a time, rows of frames of four combs are transposed into the lanes and back
+		int i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			lanes out[2] = { lanes_set(0.0f), lanes_set(0.0f) };
+			for (int g=0; g<numgroups; g++)
+			{
+				float **group = samples + g*numlanes;
+				lanes rows[4] = { lanes_load(group[0] + i), lanes_load(group[1] + i), lanes_load(group[2] + i), lanes_load(group[3] + i) };
+
+				lanes &sum = out[g < numgroups / 2 ? 0 : 1];
+				for (int j=0; j<4; j++)
+					sum = lanes_add(sum, rows[j]);
+
+				lanes_transpose(rows[0], rows[1], rows[2], rows[3]);
+				damp(g, rows, blockinput + frame + i, 4);
+				lanes_transpose(rows[0], rows[1], rows[2], rows[3]);
+
+				for (int j=0; j<4; j++)
+					lanes_store(group[j] + i, rows[j]);
+			}
+			lanes_store(blockout[0] + frame + i, out[0]);
+			lanes_store(blockout[1] + frame + i, out[1]);
+		}
+
+		for (; i < count; i++)
+		{
+			alignas(16) float delayed[numcombs * 2];
+			for (int c=0; c<numcombs * 2; c++)
+				delayed[c] = samples[c][i];
+
+			float out[2] = { 0.0f, 0.0f };
+			for (int c=0; c<numcombs * 2; c++)
+				out[c < numcombs ? 0 : 1] += delayed[c];
+			blockout[0][frame + i] = out[0];
+			blockout[1][frame + i] = out[1];
+
+			for (int g=0; g<numgroups; g++)
+			{
+				lanes lane = lanes_load(delayed + g*numlanes);
+				damp(g, &lane, blockinput + frame + i, 1);
+				lanes_store(delayed + g*numlanes, lane);
+			}
+
+			for (int c=0; c<numcombs * 2; c++)
+				samples[c][i] = delayed[c];
+		}
+
+		for (int c=0; c<numcombs * 2; c++)
+		{
+			combs[c]->bufidx += count;
+			if (combs[c]->bufidx >= combs[c]->bufsize)
+				combs[c]->bufidx = 0;
+		}
+		frame += count;
+	}
+
+	for (int g=0; g<numgroups; g++)
+		lanes_store(state[0] + g*numlanes, filterstore[g]);
+	for (int c=0; c<numcombs * 2; c++)
+		combs[c]->filterstore = state[0][c];
+}
+
+void revmodel::processallpasses(int numframes)
+{
+	// An allpass doesn't depend on its own output within a block, its frames are processed side by side
+	for (int channel=0; channel<2; channel++)
+	{
+		allpass *filters = channel == 0 ? allpassL : allpassR;
+		float *io = blockout[channel];
+
+		for (int a=0; a<numallpasses; a++)
+		{
+			allpass &filter = filters[a];
+			forbuffer(filter.buffer, filter.bufsize, filter.bufidx, numframes, [&](float *samples, int first, int count)
+			{
+				float *frames = io + first;
+				const lanes feedback = lanes_set(filter.feedback);
+
+				int i = 0;
+				for (; i + numlanes <= count; i += numlanes)
+				{
+					const lanes input = lanes_load(frames + i);
+					const lanes bufout = lanes_load(samples + i);
+					lanes_store(frames + i, lanes_sub(bufout, input));
+					lanes_store(samples + i, lanes_add(input, lanes_mul(bufout, feedback)));
+				}
+				for (; i < count; i++)
+				{
+					const float input = frames[i];
+					const float bufout = samples[i];
+					frames[i] = bufout - input;
+					samples[i] = input + bufout*filter.feedback;
+				}
+			});
+
+			filter.bufidx = (filter.bufidx + numframes) % filter.bufsize;
+		}
+	}
+}
+
 void revmodel::update()
 {
 // Recalculate internal values after parameter change
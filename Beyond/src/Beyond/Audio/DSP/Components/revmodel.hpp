@@ -20,6 +20,9 @@ public:
 			void	mute();
 			void	processmix(const float *inputL, const float *inputR, float *outputL, float *outputR, long numsamples, int skip);
 			void	processreplace(const float *inputL, const float *inputR, float *outputL, float *outputR, long numsamples, int skip);
+			// Same as processreplace() on the first two channels of interleaved frames (in place is fine), the combs
+			// run side by side in SIMD lanes. Flushes denormals to zero in hardware while processing.
+			void	processblock(const float *input, float *output, long numframes, int channels);
 			void	setroomsize(float value);
 			float	getroomsize();
 			void	setdamp(float value);
@@ -34,6 +37,8 @@ public:
 			float	getmode();
 private:
 			void	update();
+			void	processcombs(int numframes);
+			void	processallpasses(int numframes);
 private:
 	float	gain;
 	float	roomsize,roomsize1;
@@ -82,6 +87,14 @@ private:
 	std::vector<float, Beyond::SourceManager::Allocator<float>>	bufallpassR3{ 341 + stereospread };
 	std::vector<float, Beyond::SourceManager::Allocator<float>>	bufallpassL4{ 225 };
 	std::vector<float, Beyond::SourceManager::Allocator<float>>	bufallpassR4{ 225 + stereospread };
+
+	// Working memory of processblock(). Blocks are never longer than the shortest delay,
+	// so within a block the filters only read samples written by previous blocks.
+	static const int maxblockframes = 256;
+	int		blockframes;
+	alignas(16) float	blockdry[2][maxblockframes];
+	alignas(16) float	blockinput[maxblockframes];
+	alignas(16) float	blockout[2][maxblockframes];
 };
 
 #endif//_revmodel_
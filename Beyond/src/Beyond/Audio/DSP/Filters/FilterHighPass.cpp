@@ -1,6 +1,8 @@
 #include <pch.h>
 #include "FilterHighPass.h"
 
+#include "Beyond/Audio/OfflineRender.h"
+
 namespace Beyond::Audio::DSP
 {
 
@@ -82,6 +84,8 @@ namespace Beyond::Audio::DSP
         if(abortIfFailed(result,"Node Init failed"))
             return false;
 
+        NodeProfiler::SetNodeName(&m_Node, "High Pass");
+
         ma_hpf2_config config = ma_hpf2_config_init(ma_format_f32, numChannels, (ma_uint32)m_SampleRate, m_CutoffMultiplier.load(), 0.707);
         result = ma_hpf2_init(&config, &m_Node.filter);
         if(abortIfFailed(result,"Filter Init failed"))
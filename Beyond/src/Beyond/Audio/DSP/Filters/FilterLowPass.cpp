@@ -1,6 +1,8 @@
 #include <pch.h>
 #include "FilterLowPass.h"
 
+#include "Beyond/Audio/OfflineRender.h"
+
 namespace Beyond::Audio::DSP
 
 {
@@ -83,6 +85,8 @@ namespace Beyond::Audio::DSP
         if (abortIfFailed(result, "Node Init failed"))
             return false;
 
+        NodeProfiler::SetNodeName(&m_Node, "Low Pass");
+
         ma_lpf1_config config = ma_lpf1_config_init(ma_format_f32, numChannels, (ma_uint32)m_SampleRate, m_CutoffMultiplier.load());
         result = ma_lpf1_init(&config, &m_Node.filter);
         if (abortIfFailed(result, "Filter Init failed"))
@@ -4,6 +4,7 @@
 
 #include "Beyond/Audio/DSP/Components/revmodel.hpp"
 #include "Beyond/Audio/DSP/Components/DelayLine.h"
+#include "Beyond/Audio/OfflineRender.h"
 
 namespace Beyond::Audio::DSP
 {
@@ -67,7 +68,7 @@ void reverb_node_process_pcm_frames(ma_node* pNode, const float** ppFramesIn, ma
     }
 
     // 2. Process delayed signal with reverb
-    node->reverb->processreplace(pFramesOut_0, &pFramesOut_0[1], pFramesOut_0, &pFramesOut_0[1], *pFrameCountIn, channels);
+    node->reverb->processblock(pFramesOut_0, pFramesOut_0, *pFrameCountIn, channels);
 }
 
 static ma_node_vtable reverb_vtable = {
@@ -138,6 +139,8 @@ bool Reverb::Initialize(ma_engine* engine, ma_node_base* nodeToAttachTo)
     if (abortIfFailed(result, "Node Init failed"))
         return false;
 
+    NodeProfiler::SetNodeName(&m_Node, "Reverb");
+
     m_DelayLine->SetConfig(ma_node_get_input_channels(&m_Node, 0), sampleRate);
 
     // Set default pre-delay time to 50ms
@@ -2,6 +2,7 @@
 #include "Spatializer.h"
 
 #include "Beyond/Audio/Sound.h"
+#include "Beyond/Audio/OfflineRender.h"
 
 #include "Beyond/Debug/Profiler.h"
 
@@ -11,6 +12,12 @@
 
 #include <execution>
 
+#if defined(_M_X64) || defined(__SSE2__)
+	#define BEY_SPATIALIZER_SSE 1
+	#include <emmintrin.h>
+#else
+	#define BEY_SPATIALIZER_SSE 0
+#endif
 
 namespace Beyond::Audio::DSP
 {
@@ -54,65 +61,63 @@ namespace Beyond::Audio::DSP
         }
     }
 
-    static float ProcessAngularAttenuation(glm::vec3 dirSourceToListener, glm::vec3 dirSource, float coneInnerAngleInRadians, float coneOuterAngleInRadians, float coneOuterGain)
+    static inline float ProcessAngularAttenuation(float d, float cutoffInner, float cutoffOuter, float coneOuterGain)
     {
-        if (coneInnerAngleInRadians < 6.283185f)
+        if (d > cutoffInner)
         {
-            float angularGain = 1.0f;
-            float cutoffInner = (float)cos(coneInnerAngleInRadians * 0.5f);
-            float cutoffOuter = (float)cos(coneOuterAngleInRadians * 0.5f);
-            float d;
-
-            d = glm::dot(dirSourceToListener, dirSource);
-
-            if (d > cutoffInner)
-            {
-                // It's inside the inner angle.
-                angularGain = 1;
-            }
-            else
-            {
-                // It's outside the inner angle.
-                if (d > cutoffOuter)
-                {
-                    // It's between the inner and outer angle. We need to linearly interpolate between 1 and coneOuterGain.
-                    angularGain = Lerp(coneOuterGain, 1, (d - cutoffOuter) / (cutoffInner - cutoffOuter));
-                }
-                else
-                {
-                    // It's outside the outer angle.
-                    angularGain = coneOuterGain;
-                }
-            }
-
-            return angularGain;
+            // It's inside the inner angle.
+            return 1.0f;
+        }
+        else if (d > cutoffOuter)
+        {
+            // It's between the inner and outer angle. We need to linearly interpolate between 1 and coneOuterGain.
+            return Lerp(coneOuterGain, 1.0f, (d - cutoffOuter) / (cutoffInner - cutoffOuter));
         }
         else
         {
-            // Inner angle is 360 degrees so no need to do any attenuation.
-            return 1.0f;
+            // It's outside the outer angle.
+            return coneOuterGain;
         }
     }
 
-    static float ProcessDopplerPitch(glm::vec3 relativePosition, glm::vec3 sourceVelocity, glm::vec3 listenVelocity, float speedOfSound, float dopplerFactor)
+    // Cone angle cutoffs, inner cutoff below -1 when the inner angle is 360 degrees and no attenuation is needed
+    static inline std::pair<float, float> GetConeCutoffs(float coneInnerAngleInRadians, float coneOuterAngleInRadians)
     {
-        float len;
-        float vls;
-        float vss;
+        if (coneInnerAngleInRadians >= 6.283185f)
+            return { -2.0f, -2.0f };
 
-        len = glm::length(relativePosition);
+        return { (float)cos(coneInnerAngleInRadians * 0.5f), (float)cos(coneOuterAngleInRadians * 0.5f) };
+    }
 
-        if (len == 0)
-            return 1.0;
+    // Listener basis, same as rows of glm::lookAt matrix
+    struct ListenerData
+    {
+        glm::vec3 Position;
+        glm::vec3 Right;
+        glm::vec3 Up;
+        glm::vec3 Forward;
+        glm::vec3 Velocity;
+
+        float ConeCutoffInner;
+        float ConeCutoffOuter;
+        float ConeOuterGain;
+    };
 
-        vls = glm::dot(relativePosition, listenVelocity) / len;
-        vss = glm::dot(relativePosition, sourceVelocity) / len;
+#if BEY_SPATIALIZER_SSE
+    static inline __m128 Select(__m128 mask, __m128 a, __m128 b)
+    {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
 
-        vls = std::min(vls, speedOfSound / dopplerFactor);
-        vss = std::min(vss, speedOfSound / dopplerFactor);
+    static inline __m128 ProcessAngularAttenuation(__m128 d, __m128 cutoffInner, __m128 cutoffOuter, __m128 coneOuterGain)
+    {
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 t = _mm_div_ps(_mm_sub_ps(d, cutoffOuter), _mm_sub_ps(cutoffInner, cutoffOuter));
+        const __m128 between = _mm_add_ps(coneOuterGain, _mm_mul_ps(t, _mm_sub_ps(one, coneOuterGain)));
 
-        return (speedOfSound - dopplerFactor * vls) / (speedOfSound - dopplerFactor * vss);
+        return Select(_mm_cmpgt_ps(d, cutoffInner), one, Select(_mm_cmpgt_ps(d, cutoffOuter), between, coneOuterGain));
     }
+#endif
 
 
     //==============================================================================
@@ -137,21 +142,22 @@ namespace Beyond::Audio::DSP
 
         //===== Retrieve updated panning gain values ======
 
-        if (node->IsDirty())
-        {
+        const Spatializer::GainsFrame& frame = node->owner->AcquireGains();
+        const float* sourceGains = frame.Gains.data() + node->sourceID * Spatializer::s_SourceGainsStride;
 
-            for (auto& chg : vbap.ChannelGroups)
-            {
-                farbot::RealtimeObject<ChannelGains, farbot::RealtimeObjectOptions::nonRealtimeMutatable>::ScopedAccess<farbot::ThreadType::realtime> gains(chg.Gains);
-
-                // Set interpolation target values for the gainer
-                if (!SampleBufferOperations::ContentMatches(chg.Gainer.pNewGains, gains->data(), chg.Gainer.config.channels, 1))
-                    memcpy(chg.Gainer.pNewGains, gains->data(), sizeof(float) * chg.Gainer.config.channels);
-            }
+        for (uint32_t iGroup = 0; iGroup < (uint32_t)vbap.ChannelGroups.size(); ++iGroup)
+        {
+            auto& gainer = vbap.ChannelGroups[iGroup].Gainer;
+            const float* gains = sourceGains + iGroup * Spatializer::s_MaxChannelGroupGains;
 
-            pEngineNode->spatializer.dopplerPitch = node->DopplerPitch;
+            // Set interpolation target values for the gainer
+            if (!SampleBufferOperations::ContentMatches(gainer.pNewGains, gains, gainer.config.channels, 1))
+                memcpy(gainer.pNewGains, gains, sizeof(float) * gainer.config.channels);
         }
 
+        //? A bit of a hack to let Miniaudio know that we need to update pitch and handle all of the resapling boilerplate
+        pEngineNode->spatializer.dopplerPitch = frame.DopplerPitch[node->sourceID];
+
         //===== Apply Panning Effect to the Output ======
 
         ma_silence_pcm_frames(pFramesOut_0, frameCount, ma_format_f32, channelsOut);
@@ -192,8 +198,9 @@ namespace Beyond::Audio::DSP
         : base(other.base)
         , channelsIn(other.channelsIn)
         , channelsOut(other.channelsOut)
-        , DopplerPitch(other.DopplerPitch.load())
         , targetEngineNode(other.targetEngineNode)
+        , owner(other.owner)
+        , sourceID(other.sourceID)
     {
         vbap.reset(other.vbap.get());
     }
@@ -203,10 +210,16 @@ namespace Beyond::Audio::DSP
         Uninitialize();
     }
 
-    bool Spatializer::Initialize(ma_engine* engine_)
+    bool Spatializer::Initialize(ma_engine* engine_, uint32_t maxSources)
     {
         m_Engine = engine_;
 
+        for (GainsFrame& frame : m_GainsFrames)
+        {
+            frame.Gains.assign((size_t)maxSources * s_SourceGainsStride, 0.0f);
+            frame.DopplerPitch.assign(maxSources, 1.0f);
+        }
+
         return true;
     }
 
@@ -233,19 +246,19 @@ namespace Beyond::Audio::DSP
     float Spatializer::GetCurrentDistanceAttenuation(uint32_t sourceID) const
     {
 		BEY_CORE_ASSERT(IsInitialized(sourceID));
-        return m_Sources.at(sourceID).DistanceAttenuationFactor;
+        return m_Batch.DistanceAttenuation[m_Sources.at(sourceID).BatchIndex];
     }
 
     float Spatializer::GetCurrentConeAngleAttenuation(uint32_t sourceID) const
     {
 		BEY_CORE_ASSERT(IsInitialized(sourceID));
-        return m_Sources.at(sourceID).AngleAttenuationFactor;
+        return m_Batch.AngleAttenuation[m_Sources.at(sourceID).BatchIndex];
     }
 
     float Spatializer::GetCurrentDistance(uint32_t sourceID) const
     {
         BEY_CORE_ASSERT(IsInitialized(sourceID));
-        return m_Sources.at(sourceID).Distance;
+        return m_Batch.Distance[m_Sources.at(sourceID).BatchIndex];
     }
 
 
@@ -269,8 +282,7 @@ namespace Beyond::Audio::DSP
         }
 
         source.Spread = std::clamp(newSpread, 0.0f, 1.0f);
-        UpdateVBAP(source);
-        FlagRealtimeForUpdate(source);
+        m_PositionsChanged = true;
     }
 
     void Spatializer::SetFocus(uint32_t sourceID, float newFocus)
@@ -284,8 +296,7 @@ namespace Beyond::Audio::DSP
         Source& source = m_Sources.at(sourceID);
 
         source.Focus = std::clamp(newFocus, 0.0f, 1.0f);
-        UpdateVBAP(source);
-        FlagRealtimeForUpdate(source);
+        m_PositionsChanged = true;
     }
 
 
@@ -301,133 +312,327 @@ namespace Beyond::Audio::DSP
         return degreeSpread / 180.0f;
     }
 
-    void Spatializer::UpdatePositionalData(Source& source, const ma_spatializer_listener* listener)
+    void Spatializer::UpdatePositionalData()
     {
-        auto* pEngineNode = source.SpatializerNode.targetEngineNode;
-        const float distance = source.Distance;
-        const glm::vec3 positionRelative = source.PositionRelative;   // Source to listener position
-        const glm::vec3 position = source.Transform.Position;         // Source absolute position
-        const glm::vec3 relativeDir = source.RelativeDir;             // Source to listener direction
-        const glm::vec3 velocity = source.Velocity;
-
-        // TODO: rewrite this to use my listener, instead of ma_listener
-        
-        //const int channels = node->channels;
+        BEY_PROFILE_FUNC();
 
-        //===== Distance Attenuation ======
+        SourceBatch& batch = m_Batch;
 
-        float gainAttenuation = ProcessDistanceAttenuation(source.SpatializationConfig->AttenuationMod,
-                                                           source.Distance,
-                                                           source.SpatializationConfig->MinDistance,
-                                                           source.SpatializationConfig->MaxDistance,
-                                                           source.SpatializationConfig->Rolloff);
+        // Configurations can be edited while the sources are playing
+        for (uint32_t i = 0; i < batch.Count; ++i)
+            WriteBatchConfig(i, *batch.Sources[i]->SpatializationConfig);
 
-        // Store value to be used elsewehere
-        source.DistanceAttenuationFactor = gainAttenuation;
+        ListenerData listener;
+        listener.Position = m_ListenerTransform.Position;
+        listener.Forward = glm::normalize(m_ListenerTransform.Orientation);
+        listener.Right = glm::normalize(glm::cross(listener.Forward, m_ListenerTransform.Up));
+        listener.Up = glm::cross(listener.Right, listener.Forward);
+        listener.Velocity = m_ListenerVelocity;
 
-        // TODO: expose Cone Angle and Distance based attenuation factors separately to use with filters and user parameters
+        /** Listener angular gain, to reduce the volume of sounds that are position behind the listener.
+              On default settings, this will have no effect.
+          */
+        const ma_spatializer_listener& maListener = m_Engine->listeners[0];
+        std::tie(listener.ConeCutoffInner, listener.ConeCutoffOuter) = GetConeCutoffs(maListener.config.coneInnerAngleInRadians, maListener.config.coneOuterAngleInRadians);
+        listener.ConeOuterGain = maListener.config.coneOuterGain;
 
-        //===== Cone Angle Attenuation ======
+        // Listener is looking down -Z
+        const float listenerDirectionZ = maListener.config.handedness == ma_handedness_right ? -1.0f : 1.0f;
 
-        // TODO: rewrite this to use stored relativeTransform matrix
-        if (distance > 0)
+        uint32_t i = 0;
+
+#if BEY_SPATIALIZER_SSE
         {
-            float angleAttenuation = 1.0f;
-
-            // Source anglular gain.
-            angleAttenuation *= ProcessAngularAttenuation(glm::vec3(0.0f, 0.0f, -1.0f), relativeDir, source.SpatializationConfig->ConeInnerAngleInRadians,
-                                                                                                     source.SpatializationConfig->ConeOuterAngleInRadians,
-                                                                                                     source.SpatializationConfig->ConeOuterGain);
-            
-            /** Listener angular gain, to reduce the volume of sounds that are position behind the listener.
-                  On default settings, this will have no effect.
-              */
-            if (listener != nullptr && listener->config.coneInnerAngleInRadians < 6.283185f)
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 minDistanceToListener = _mm_set1_ps(1e-6f);
+            const __m128 speedOfSound = _mm_set1_ps(SPEED_OF_SOUND);
+
+            const __m128 lpx = _mm_set1_ps(listener.Position.x), lpy = _mm_set1_ps(listener.Position.y), lpz = _mm_set1_ps(listener.Position.z);
+            const __m128 lrx = _mm_set1_ps(listener.Right.x), lry = _mm_set1_ps(listener.Right.y), lrz = _mm_set1_ps(listener.Right.z);
+            const __m128 lux = _mm_set1_ps(listener.Up.x), luy = _mm_set1_ps(listener.Up.y), luz = _mm_set1_ps(listener.Up.z);
+            const __m128 lfx = _mm_set1_ps(listener.Forward.x), lfy = _mm_set1_ps(listener.Forward.y), lfz = _mm_set1_ps(listener.Forward.z);
+            const __m128 lvx = _mm_set1_ps(listener.Velocity.x), lvy = _mm_set1_ps(listener.Velocity.y), lvz = _mm_set1_ps(listener.Velocity.z);
+            const __m128 listenerCutoffInner = _mm_set1_ps(listener.ConeCutoffInner);
+            const __m128 listenerCutoffOuter = _mm_set1_ps(listener.ConeCutoffOuter);
+            const __m128 listenerOuterGain = _mm_set1_ps(listener.ConeOuterGain);
+            const __m128 listenerDirZ = _mm_set1_ps(listenerDirectionZ);
+            const __m128i inverseModel = _mm_set1_epi32((int32_t)AttenuationModel::Inverse);
+            const __m128i linearModel = _mm_set1_epi32((int32_t)AttenuationModel::Linear);
+
+            // Arrays are padded to a multiple of 4
+            const uint32_t paddedCount = (uint32_t)batch.PositionX.size();
+            for (; i < paddedCount; i += 4)
             {
-                glm::vec3 listenerDirection;
-                float listenerInnerAngle;
-                float listenerOuterAngle;
-                float listenerOuterGain;
-
-                if (listener->config.handedness == ma_handedness_right)
-                {
-                    listenerDirection = glm::vec3(0, 0, -1);
-                }
-                else
-                {
-                    listenerDirection = glm::vec3(0, 0, +1);
-                }
-
-                listenerInnerAngle = listener->config.coneInnerAngleInRadians;
-                listenerOuterAngle = listener->config.coneOuterAngleInRadians;
-                listenerOuterGain = listener->config.coneOuterGain;
-
-                angleAttenuation *= ProcessAngularAttenuation(listenerDirection, glm::normalize(positionRelative), listenerInnerAngle, listenerOuterAngle, listenerOuterGain);
-
-                //BEY_CORE_TRACE_TAG("Sound Spatializer", "Angle Attenuation: {}", angleAttenuation);
+                // Listener to source
+                const __m128 dx = _mm_sub_ps(_mm_loadu_ps(&batch.PositionX[i]), lpx);
+                const __m128 dy = _mm_sub_ps(_mm_loadu_ps(&batch.PositionY[i]), lpy);
+                const __m128 dz = _mm_sub_ps(_mm_loadu_ps(&batch.PositionZ[i]), lpz);
+
+                const __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz)));
+
+                // When the sound is on top of us, we can't do vector math properly, keep the previous values
+                const __m128 valid = _mm_cmpge_ps(distance, minDistanceToListener);
+
+                // Position of the source ralative to listener plane
+                const __m128 relX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(lrx, dx), _mm_mul_ps(lry, dy)), _mm_mul_ps(lrz, dz));
+                const __m128 relY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(lux, dx), _mm_mul_ps(luy, dy)), _mm_mul_ps(luz, dz));
+                const __m128 relZ = _mm_sub_ps(zero, _mm_add_ps(_mm_add_ps(_mm_mul_ps(lfx, dx), _mm_mul_ps(lfy, dy)), _mm_mul_ps(lfz, dz)));
+
+                //===== Distance Attenuation ======
+
+                const __m128 minDistance = _mm_loadu_ps(&batch.MinDistance[i]);
+                const __m128 maxDistance = _mm_loadu_ps(&batch.MaxDistance[i]);
+                const __m128 rolloff = _mm_loadu_ps(&batch.Rolloff[i]);
+                const __m128 attenuationDistance = _mm_sub_ps(_mm_min_ps(_mm_max_ps(distance, minDistance), maxDistance), minDistance);
+
+                const __m128 inverse = _mm_div_ps(minDistance, _mm_add_ps(minDistance, _mm_mul_ps(rolloff, attenuationDistance)));
+                const __m128 linear = _mm_sub_ps(one, _mm_div_ps(_mm_mul_ps(rolloff, attenuationDistance), _mm_sub_ps(maxDistance, minDistance)));
+
+                // Exponential model is processed per source, None and invalid ranges do not attenuate
+                const __m128i model = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&batch.AttenuationMod[i]));
+                __m128 distanceAttenuation = Select(_mm_castsi128_ps(_mm_cmpeq_epi32(model, inverseModel)), inverse,
+                                                    Select(_mm_castsi128_ps(_mm_cmpeq_epi32(model, linearModel)), linear, one));
+                distanceAttenuation = Select(_mm_cmplt_ps(minDistance, maxDistance), distanceAttenuation, one);
+
+                //===== Cone Angle Attenuation ======
+
+                const __m128 ox = _mm_loadu_ps(&batch.OrientationX[i]);
+                const __m128 oy = _mm_loadu_ps(&batch.OrientationY[i]);
+                const __m128 oz = _mm_loadu_ps(&batch.OrientationZ[i]);
+                const __m128 orientationLength = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(ox, ox), _mm_mul_ps(oy, oy)), _mm_mul_ps(oz, oz)));
+
+                // Direction of the source towards the listener
+                const __m128 sourceDot = _mm_sub_ps(zero, _mm_add_ps(_mm_add_ps(_mm_mul_ps(ox, dx), _mm_mul_ps(oy, dy)), _mm_mul_ps(oz, dz)));
+                const __m128 sourceD = Select(_mm_cmpgt_ps(orientationLength, zero), _mm_div_ps(sourceDot, _mm_mul_ps(orientationLength, distance)), one);
+
+                __m128 angleAttenuation = ProcessAngularAttenuation(sourceD, _mm_loadu_ps(&batch.ConeCutoffInner[i]), _mm_loadu_ps(&batch.ConeCutoffOuter[i]), _mm_loadu_ps(&batch.ConeOuterGain[i]));
+
+                // Direction of the listener towards the source
+                const __m128 listenerD = _mm_div_ps(_mm_mul_ps(listenerDirZ, relZ), distance);
+                angleAttenuation = _mm_mul_ps(angleAttenuation, ProcessAngularAttenuation(listenerD, listenerCutoffInner, listenerCutoffOuter, listenerOuterGain));
+
+                //===== Doppler Effect ======
+
+                /*
+                    Pitch shifting applied externally by Miniaudio. Projecting velocities onto the source-to-listener direction,
+                    with doppler factor of 0 the pitch always ends up 1.0
+                 */
+                const __m128 dopplerFactor = _mm_loadu_ps(&batch.DopplerFactor[i]);
+                const __m128 maxSpeed = _mm_div_ps(speedOfSound, dopplerFactor);
+                const __m128 invDistance = _mm_div_ps(one, distance);
+
+                __m128 vls = _mm_mul_ps(_mm_sub_ps(zero, _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, lvx), _mm_mul_ps(dy, lvy)), _mm_mul_ps(dz, lvz))), invDistance);
+                __m128 vss = _mm_mul_ps(_mm_sub_ps(zero, _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, _mm_loadu_ps(&batch.VelocityX[i])),
+                                                                              _mm_mul_ps(dy, _mm_loadu_ps(&batch.VelocityY[i]))),
+                                                                   _mm_mul_ps(dz, _mm_loadu_ps(&batch.VelocityZ[i])))), invDistance);
+                vls = _mm_min_ps(vls, maxSpeed);
+                vss = _mm_min_ps(vss, maxSpeed);
+
+                const __m128 dopplerPitch = _mm_div_ps(_mm_sub_ps(speedOfSound, _mm_mul_ps(dopplerFactor, vls)),
+                                                       _mm_sub_ps(speedOfSound, _mm_mul_ps(dopplerFactor, vss)));
+
+                //===== Store ======
+
+                auto store = [valid](float* out, __m128 value) { _mm_storeu_ps(out, Select(valid, value, _mm_loadu_ps(out))); };
+                store(&batch.RelativeX[i], relX);
+                store(&batch.RelativeY[i], relY);
+                store(&batch.RelativeZ[i], relZ);
+                store(&batch.Distance[i], distance);
+                store(&batch.DistanceAttenuation[i], distanceAttenuation);
+                store(&batch.AngleAttenuation[i], angleAttenuation);
+                store(&batch.DopplerPitch[i], dopplerPitch);
             }
-
-            gainAttenuation *= angleAttenuation;
-
-            // Store value to be used elsewehere
-            source.AngleAttenuationFactor = angleAttenuation;
         }
-        else
+#endif
+
+        for (; i < batch.Count; ++i)
         {
-            /* The sound is right on top of the listener. Don't do any angular attenuation. */
-        }
+            const glm::vec3 position(batch.PositionX[i], batch.PositionY[i], batch.PositionZ[i]);
+            const glm::vec3 orientation(batch.OrientationX[i], batch.OrientationY[i], batch.OrientationZ[i]);
+            const glm::vec3 velocity(batch.VelocityX[i], batch.VelocityY[i], batch.VelocityZ[i]);
 
-        // TODO: make this affect where the curve starts and where it hits 0.0f instead of just clamping the multiplier
-        gainAttenuation = std::clamp(gainAttenuation, source.SpatializationConfig->MinGain, source.SpatializationConfig->MaxGain);
+            const glm::vec3 toSource = position - listener.Position;
+            const float distance = glm::length(toSource);
 
-        //BEY_CORE_TRACE_TAG("Sound Spatializer", "Gain attenuation: {}", gainAttenuation);
+            // When the sound is on top of us, we can't do vector math properly
+            if (distance < 1e-6f)
+                continue;
 
-        glm::vec3 listenerVel(0.0f);
-        if (listener)
-        {
-            listenerVel = glm::vec3{ listener->velocity.x, listener->velocity.y, listener->velocity.z };
+            // Position of the source ralative to listener plane
+            const glm::vec3 relativePos(glm::dot(listener.Right, toSource), glm::dot(listener.Up, toSource), -glm::dot(listener.Forward, toSource));
+
+            //===== Distance Attenuation ======
+
+            // Exponential model is processed per source
+            const auto attenuationModel = (AttenuationModel)batch.AttenuationMod[i];
+            const float distanceAttenuation = attenuationModel == AttenuationModel::Exponential ? 1.0f
+                                              : ProcessDistanceAttenuation(attenuationModel, distance, batch.MinDistance[i], batch.MaxDistance[i], batch.Rolloff[i]);
+
+            //===== Cone Angle Attenuation ======
+
+            const float orientationLength = glm::length(orientation);
+            const float sourceD = orientationLength > 0.0f ? -glm::dot(orientation, toSource) / (orientationLength * distance) : 1.0f;
+
+            float angleAttenuation = ProcessAngularAttenuation(sourceD, batch.ConeCutoffInner[i], batch.ConeCutoffOuter[i], batch.ConeOuterGain[i]);
+            angleAttenuation *= ProcessAngularAttenuation(listenerDirectionZ * relativePos.z / distance, listener.ConeCutoffInner, listener.ConeCutoffOuter, listener.ConeOuterGain);
+
+            //===== Doppler Effect ======
+
+            const float dopplerFactor = batch.DopplerFactor[i];
+            float vls = -glm::dot(toSource, listener.Velocity) / distance;
+            float vss = -glm::dot(toSource, velocity) / distance;
+
+            if (dopplerFactor > 0.0f)
+            {
+                vls = std::min(vls, SPEED_OF_SOUND / dopplerFactor);
+                vss = std::min(vss, SPEED_OF_SOUND / dopplerFactor);
+            }
+
+            batch.RelativeX[i] = relativePos.x;
+            batch.RelativeY[i] = relativePos.y;
+            batch.RelativeZ[i] = relativePos.z;
+            batch.Distance[i] = distance;
+            batch.DistanceAttenuation[i] = distanceAttenuation;
+            batch.AngleAttenuation[i] = angleAttenuation;
+            batch.DopplerPitch[i] = (SPEED_OF_SOUND - dopplerFactor * vls) / (SPEED_OF_SOUND - dopplerFactor * vss);
         }
+    }
+
+    void Spatializer::UpdateVBAP(Source& source, GainsFrame& frame, bool isInitialPosition /*= false*/)
+    {
+        SourceBatch& batch = m_Batch;
+        const uint32_t i = source.BatchIndex;
+        const SpatializationConfig& config = *source.SpatializationConfig;
+
+        if (config.AttenuationMod == AttenuationModel::Exponential)
+            batch.DistanceAttenuation[i] = ProcessDistanceAttenuation(config.AttenuationMod, batch.Distance[i], config.MinDistance, config.MaxDistance, config.Rolloff);
+
+        if (config.bSpreadFromSourceSize)
+            source.Spread = GetSpreadFromSourceSize(config.SourceSize, batch.Distance[i]);
+
+        // TODO: elevation and height spread?
+
+        // Angle of source relative to listener in XZ plane
+        const float azimuth = VectorAngle(glm::vec3(batch.RelativeX[i], batch.RelativeY[i], batch.RelativeZ[i]));
+
+        VBAP::PositionUpdateData updateData{ azimuth,
+                                             source.Spread,
+                                             source.Focus,
+                                             batch.DistanceAttenuation[i] * batch.AngleAttenuation[i] };
+
+        float* sourceGains = frame.Gains.data() + source.SourceID * s_SourceGainsStride;
+        VBAP::UpdateVBAP(source.SpatializerNode.vbap.get(), updateData, source.Converter, sourceGains, s_MaxChannelGroupGains, isInitialPosition);
+
+        frame.DopplerPitch[source.SourceID] = batch.DopplerPitch[i];
+    }
+
+    void Spatializer::PublishGains()
+    {
+        m_WriteFrame = m_ReadyFrame.exchange(m_WriteFrame | s_NewFrameBit) & ~s_NewFrameBit;
+    }
+
+    const Spatializer::GainsFrame& Spatializer::AcquireGains()
+    {
+        if (m_ReadyFrame.load() & s_NewFrameBit)
+            m_ReadFrame = m_ReadyFrame.exchange(m_ReadFrame) & ~s_NewFrameBit;
+
+        return m_GainsFrames[m_ReadFrame];
+    }
+
+    void Spatializer::Update()
+    {
+        if (!m_PositionsChanged)
+            return;
 
+        BEY_PROFILE_FUNC();
 
-        //===== Doppler Effect ======
+        m_PositionsChanged = false;
 
-        /*
-            Pitch shifting applied externally by Miniaudio. Note that we need to negate the relative positionRelative here
-            because the doppler calculation needs to be source-to-listener, but ours is listener-to-
-            source.
-         */
+        UpdatePositionalData();
 
-        if (source.SpatializationConfig->DopplerFactor > 0.0f)
+        // All of the sources are written to the frame, it may have been published a couple of updates ago
+        GainsFrame& frame = m_GainsFrames[m_WriteFrame];
+
+        std::for_each(std::execution::par_unseq, m_Batch.Sources.begin(), m_Batch.Sources.begin() + m_Batch.Count, [&](Source* source)
         {
-            if (listener != nullptr)
-            {
-                glm::vec3 lp(listener->position.x, listener->position.y, listener->position.z);
+            // Not updating sources that haven't got their position yet
+            if (source->bPositionSet)
+                UpdateVBAP(*source, frame, !source->bInitialPositionSet);
+        });
 
-                source.SpatializerNode.DopplerPitch = ProcessDopplerPitch(lp - position, velocity, listenerVel, SPEED_OF_SOUND, source.SpatializationConfig->DopplerFactor);
+        PublishGains();
 
-                //? A bit of a hack to let Miniaudio know that we need to update pitch and handle all of the resapling boilerplate
-                pEngineNode->spatializer.dopplerPitch = source.SpatializerNode.DopplerPitch;
+        // Now that the initial gain values have been published, we can start the audio callback
+        for (uint32_t i = 0; i < m_Batch.Count; ++i)
+        {
+            Source& source = *m_Batch.Sources[i];
+            if (source.bPositionSet && !source.bInitialPositionSet)
+            {
+                ma_node_set_state(&source.SpatializerNode, ma_node_state_started);
+                source.bInitialPositionSet = true;
             }
         }
-        else
+    }
+
+
+    //==============================================================================
+    /// SOURCE BATCH
+
+    uint32_t Spatializer::AddToBatch(Source& source)
+    {
+        SourceBatch& batch = m_Batch;
+        const uint32_t i = batch.Count++;
+
+        if (batch.Count > batch.PositionX.size())
         {
-            source.SpatializerNode.DopplerPitch = 1.0f;
+            const size_t paddedCount = (batch.Count + 3) & ~size_t(3);
+            batch.ForEachArray([paddedCount](auto& array) { array.resize(paddedCount); });
         }
+
+        batch.PositionX[i] = batch.PositionY[i] = batch.PositionZ[i] = 0.0f;
+        batch.OrientationX[i] = batch.OrientationY[i] = 0.0f;
+        batch.OrientationZ[i] = -1.0f;
+        batch.VelocityX[i] = batch.VelocityY[i] = batch.VelocityZ[i] = 0.0f;
+
+        WriteBatchConfig(i, *source.SpatializationConfig);
+
+        batch.RelativeX[i] = batch.RelativeY[i] = 0.0f;
+        batch.RelativeZ[i] = -1.0f;
+        batch.Distance[i] = 0.0f;
+        batch.DistanceAttenuation[i] = 1.0f;
+        batch.AngleAttenuation[i] = 1.0f;
+        batch.DopplerPitch[i] = 1.0f;
+
+        batch.Sources[i] = &source;
+
+        return i;
     }
 
-    void Spatializer::UpdateVBAP(Source& source, bool isInitialPosition /*= false*/)
+    void Spatializer::RemoveFromBatch(uint32_t batchIndex)
     {
-        VBAP::PositionUpdateData updateData{ source.vbapAzimuth,
-                                             source.Spread,
-                                             source.Focus,
-                                             source.DistanceAttenuationFactor * source.AngleAttenuationFactor };
+        SourceBatch& batch = m_Batch;
+        BEY_CORE_ASSERT(batchIndex < batch.Count);
 
-        VBAP::UpdateVBAP(source.SpatializerNode.vbap.get(), updateData, source.Converter, isInitialPosition);
+        const uint32_t last = --batch.Count;
+        if (batchIndex != last)
+        {
+            batch.ForEachArray([batchIndex, last](auto& array) { array[batchIndex] = array[last]; });
+            batch.Sources[batchIndex]->BatchIndex = batchIndex;
+        }
     }
 
-    void Spatializer::FlagRealtimeForUpdate(Source& source)
+    void Spatializer::WriteBatchConfig(uint32_t batchIndex, const SpatializationConfig& config)
     {
-        source.SpatializerNode.fGainsUpToDate.clear();
+        SourceBatch& batch = m_Batch;
+
+        batch.AttenuationMod[batchIndex] = (int32_t)config.AttenuationMod;
+        batch.MinDistance[batchIndex] = config.MinDistance;
+        batch.MaxDistance[batchIndex] = config.MaxDistance;
+        batch.Rolloff[batchIndex] = config.Rolloff;
+        std::tie(batch.ConeCutoffInner[batchIndex], batch.ConeCutoffOuter[batchIndex]) = GetConeCutoffs(config.ConeInnerAngleInRadians, config.ConeOuterAngleInRadians);
+        batch.ConeOuterGain[batchIndex] = config.ConeOuterGain;
+        batch.DopplerFactor[batchIndex] = std::max(config.DopplerFactor, 0.0f);
     }
 
 
@@ -437,6 +642,19 @@ namespace Beyond::Audio::DSP
     bool Spatializer::InitSource(uint32_t sourceID, ma_engine_node* nodeToInsertAfter, const Ref<SpatializationConfig>& config)
     {
         BEY_CORE_ASSERT(m_Sources.find(sourceID) == m_Sources.end());
+
+        // Gains frames only have space for limited number of sources and source channels
+        if (sourceID >= m_GainsFrames[0].DopplerPitch.size())
+        {
+            BEY_CORE_ERROR_TAG("Sound Spatializer", "InitSource({0}) - sourceID is out of range of the Spatializer.", sourceID);
+            return false;
+        }
+
+        if (nodeToInsertAfter->resampler.config.channels > s_MaxInputChannels)
+        {
+            BEY_CORE_ERROR_TAG("Sound Spatializer", "InitSource({0}) - can't spatialize a source with {1} channels, maximum is {2}.", sourceID, nodeToInsertAfter->resampler.config.channels, s_MaxInputChannels);
+            return false;
+        }
         
         //Source source;
         //source.sourceID = sourceID;
@@ -481,9 +699,14 @@ namespace Beyond::Audio::DSP
         if (abortIfFailed(result, "Node Init failed"))
             return false;
 
+        NodeProfiler::SetNodeName(&source.SpatializerNode, "Spatializer");
+
         source.SpatializerNode.channelsIn = numInputChannels[0];
         source.SpatializerNode.channelsOut = numOutputChannels[0];
         source.SpatializerNode.targetEngineNode = nodeToInsertAfter;
+        source.SpatializerNode.owner = this;
+        source.SpatializerNode.sourceID = sourceID;
+        source.SourceID = sourceID;
 
 
         //----------------- VBAP -----------------
@@ -538,6 +761,7 @@ namespace Beyond::Audio::DSP
             return false;
 
         source.bInitialized = true;
+        source.BatchIndex = AddToBatch(source);
 
         return true;
     }
@@ -592,6 +816,10 @@ namespace Beyond::Audio::DSP
         // Clear VBAP
         VBAP::ClearVBAP(source.SpatializerNode.vbap.get());
 
+        if (source.bInitialized)
+            RemoveFromBatch(source.BatchIndex);
+
+        source.bPositionSet = false;
         source.bInitialPositionSet = false;
         source.bInitialized = false;
 
@@ -600,14 +828,14 @@ namespace Beyond::Audio::DSP
         return true;
     }
 
-    void Spatializer::UpdateSourcePosition(uint32_t sourceID, const Audio::Transform& transform, glm::vec3 velocity)
+    void Spatializer::SetSourcePosition(uint32_t sourceID, const Audio::Transform& transform, glm::vec3 velocity)
     {
         auto sIt = m_Sources.find(sourceID);
         if (sIt == m_Sources.end())
         {
             //? For now this is going to be firing for all of the entities with disabled spatialization.
             //? Disabled the error massage to prevent the spam. Neen to not update position on audio objects with disabled spatializer.
-            //BEY_CORE_ERROR_TAG("Sound Spatializer", "UpdateSourcePosition() Invalid sourceID {}.", sourceID);
+            //BEY_CORE_ERROR_TAG("Sound Spatializer", "SetSourcePosition() Invalid sourceID {}.", sourceID);
             return;
         }
 
@@ -619,66 +847,21 @@ namespace Beyond::Audio::DSP
             return;
         }
 
-        auto& position = transform.Position;
-        auto& orientation = transform.Orientation;
-        auto& sourceUp = transform.Up;
-
-        const auto& lp = m_ListenerTransform.Position;
-        const auto& lr = m_ListenerTransform.Orientation;
-        const auto& lup = m_ListenerTransform.Up;
-
-        // Position of the source ralative to listener plane
-        const glm::mat4 lookatM = glm::lookAt(lp, lp + lr, lup);
-        glm::vec3 relativePos = lookatM * glm::vec4(position, 1.0f);
-
-        // Direction from the source to listener in source's plane
-        const glm::mat4 lookatMR = glm::lookAt(position, position + orientation, sourceUp);
-        glm::vec3 relativeDir = glm::normalize(lookatMR * glm::vec4(lp, 1.0f));
-
-        // TODO: pass in transform matrix as function argument instead of doing this double conversion
-
-        const float distance = glm::length(relativePos);
-
-        // When the sound is on top of us, we can't do vector math properly
-        if (distance < 1e-6f)   //? this might still backfire when the source is above the listener but the distance is more than 0
-        {
-            //pos.z = -0.001f;
-            relativePos.z = -0.001f;
-            return;
-        }
-
-        // TODO: elevation and height spread?
-
-        // Angle of source relative to listener in XZ plane
-        float azimuth = VectorAngle(glm::normalize(relativePos));
-
-        //BEY_CORE_INFO_TAG("Sound Spatializer", "Relative Pos: X {0} | Y {1} | Z {2}", relativePos.x, relativePos.y, relativePos.z);
-
-        //BEY_CORE_TRACE_TAG("Sound Spatializer", "Angle degrees: {}", glm::degrees(azimuth));
-
-        source.Distance = distance;
-        source.vbapAzimuth = azimuth;
-        source.PositionRelative = relativePos;
-        source.Transform.Position = position;
-        source.Transform.Orientation = orientation;
-        source.Transform.Up = sourceUp;
-        source.RelativeDir = relativeDir;
-        source.Velocity = velocity;
-
-        if (source.SpatializationConfig->bSpreadFromSourceSize)
-            source.Spread = GetSpreadFromSourceSize(source.SpatializationConfig->SourceSize, distance);
-
-        UpdatePositionalData(source, &m_Engine->listeners[0]);
-        UpdateVBAP(source, !source.bInitialPositionSet);
-
-        // Now that the initial gain values have been set, we can start the audio callback
-        if (!source.bInitialPositionSet)
-        {
-            ma_node_set_state(&source.SpatializerNode, ma_node_state_started);
-            source.bInitialPositionSet = true;
-        }
-
-        FlagRealtimeForUpdate(source); // TODO: mark dirty in bulk?
+        SourceBatch& batch = m_Batch;
+        const uint32_t i = source.BatchIndex;
+
+        batch.PositionX[i] = transform.Position.x;
+        batch.PositionY[i] = transform.Position.y;
+        batch.PositionZ[i] = transform.Position.z;
+        batch.OrientationX[i] = transform.Orientation.x;
+        batch.OrientationY[i] = transform.Orientation.y;
+        batch.OrientationZ[i] = transform.Orientation.z;
+        batch.VelocityX[i] = velocity.x;
+        batch.VelocityY[i] = velocity.y;
+        batch.VelocityZ[i] = velocity.z;
+
+        source.bPositionSet = true;
+        m_PositionsChanged = true;
     }
 
     void Spatializer::UpdateListener(const Audio::Transform& transform, glm::vec3 velocity)
@@ -686,50 +869,7 @@ namespace Beyond::Audio::DSP
         m_ListenerTransform = transform;
         m_ListenerVelocity = velocity;
 
-        const auto& lp = m_ListenerTransform.Position;
-        const auto& lr = m_ListenerTransform.Orientation;
-        const auto& lup = m_ListenerTransform.Up;
-
         // Need to update sources when the listener position changed
-
-        for (auto& [sourceID, source] : m_Sources)
-        {
-            const auto& sp = source.Transform.Position;
-            const auto& sr = source.Transform.Orientation;
-            const auto& sup = source.Transform.Up;
-
-            // Position of the source ralative to listener
-            const glm::mat4 lookatM = glm::lookAt(lp, lp + lr, lup);
-            glm::vec3 relativePos = lookatM * glm::vec4(sp, 1.0f);
-
-            // Direction from the source to listener
-            const glm::mat4 lookatMR = glm::lookAt(sp, sp + sr, sup);
-            glm::vec3 relativeDir = glm::normalize(lookatMR * glm::vec4(lp, 1.0f));
-
-            const float distance = glm::length(relativePos);
-
-            // TODO: elevation and height spread?
-
-            // Angle of source relative to listener in XZ plane
-            float azimuth = VectorAngle(glm::normalize(relativePos));
-
-            //BEY_CORE_TRACE_TAG("Sound Spatializer", "Angle degrees: {}", glm::degrees(azimuth));
-
-            source.Distance = distance;
-            source.vbapAzimuth = azimuth;
-            source.PositionRelative = relativePos;
-            source.RelativeDir = relativeDir;
-
-            if (source.SpatializationConfig->bSpreadFromSourceSize)
-                source.Spread = GetSpreadFromSourceSize(source.SpatializationConfig->SourceSize, distance);
-        }
-
-        std::for_each(std::execution::par_unseq, m_Sources.begin(), m_Sources.end(), [&](std::pair<const uint32_t, Source>& IDSourcePair) 
-            {
-                auto& source = IDSourcePair.second;
-                UpdatePositionalData(source, &m_Engine->listeners[0]);
-                UpdateVBAP(source);
-                FlagRealtimeForUpdate(source);
-            });
+        m_PositionsChanged = true;
     }
 }
@@ -25,10 +25,10 @@ namespace Beyond::Audio::DSP
         Spatializer() = default;
         ~Spatializer();
 
-		/*  Audio callback is going to be stopped until initial position is set with the next SetPositionRotation() call.
+		/*  Audio callback is going to be stopped until initial position is set with SetSourcePosition() and processed by the next Update() call.
 			This is done to prevent volume spike at the beginning of playback if it's started before initial panning gains have been calculated.
 		*/
-        bool Initialize(ma_engine* engine);
+        bool Initialize(ma_engine* engine, uint32_t maxSources);
         void Uninitialize();
 
         bool IsInitialized(uint32_t sourceID) const;
@@ -40,25 +40,41 @@ namespace Beyond::Audio::DSP
         //============================================================================
         bool InitSource(uint32_t sourceID, ma_engine_node* nodeToInsertAfter, const Ref<SpatializationConfig>& config);
         bool ReleaseSource(uint32_t sourceID);
-        void UpdateSourcePosition(uint32_t sourceID, const Audio::Transform& position, glm::vec3 velocity = { 0.0f, 0.0f, 0.0f });
+
+        /* Set new position of the source. Attenuation and panning gains are recalculated on the next Update() call. */
+        void SetSourcePosition(uint32_t sourceID, const Audio::Transform& position, glm::vec3 velocity = { 0.0f, 0.0f, 0.0f });
         void SetSpread(uint32_t sourceID, float newSpread);
         void SetFocus(uint32_t sourceID, float newFocus);
 
         void UpdateListener(const Audio::Transform& transform, glm::vec3 velocity = { 0.0f, 0.0f, 0.0f });
 
+        /* Recalculate positional data and panning gains of all of the sources in one batch,
+           if the listener or any of the sources have changed since the last call,
+           and publish new gains to the audio render thread.
+        */
+        void Update();
+
     private:
         struct Source;
+        struct GainsFrame;
 
         static float GetSpreadFromSourceSize(float sourceSize, float distance);
 
-        // Updates attenuation values
-        static void UpdatePositionalData(Source& source, const ma_spatializer_listener* listener);
+        // Updates distance, attenuation and doppler pitch of all of the sources
+        void UpdatePositionalData();
+
+        // Update VBAP channel gains and doppler pitch of the source in the gains frame
+        void UpdateVBAP(Source& source, GainsFrame& frame, bool isInitialPosition = false);
+
+        // Swap in the new gains frame for the realtime thread to grab
+        void PublishGains();
 
-        // Update VBAP channel gains for changed source directions
-        static void UpdateVBAP(Source& source, bool isInitialPosition = false);
+        // Called from the realtime thread to get the latest published gains
+        const GainsFrame& AcquireGains();
 
-        // Flag channel gains dirty so that realtime thread can grab new values
-        static void FlagRealtimeForUpdate(Source& source);
+        uint32_t AddToBatch(Source& source);
+        void RemoveFromBatch(uint32_t batchIndex);
+        void WriteBatchConfig(uint32_t batchIndex, const SpatializationConfig& config);
 
     private:
         friend void spatializer_node_process_pcm_frames(ma_node* pNode, const float** ppFramesIn, ma_uint32* pFrameCountIn,
@@ -66,6 +82,11 @@ namespace Beyond::Audio::DSP
         
         ma_engine* m_Engine = nullptr;
 
+        // Limits of the gains stored per source in the gains frames
+        static constexpr uint32_t s_MaxInputChannels = 8;
+        static constexpr uint32_t s_MaxChannelGroupGains = 8;
+        static constexpr uint32_t s_SourceGainsStride = s_MaxInputChannels * s_MaxChannelGroupGains;
+
         struct spatializer_node
         {
             ma_node_base base;
@@ -75,11 +96,9 @@ namespace Beyond::Audio::DSP
 
             Scope<VBAPData> vbap = nullptr;
 
-            // This accessed from audio callback to set Miniaudio's spatializer doppler pitch
-            std::atomic<float> DopplerPitch;
-
-            std::atomic_flag fGainsUpToDate;
-            bool IsDirty() { return !fGainsUpToDate.test_and_set(); }
+            // Spatializer publishing gains and doppler pitch for this node
+            Spatializer* owner = nullptr;
+            uint32_t sourceID = 0;
 
             spatializer_node() = default;
             spatializer_node(const spatializer_node&);
@@ -90,7 +109,9 @@ namespace Beyond::Audio::DSP
             // Static data
             //------------
             uint32_t SourceID;                  // ID of the sound source this Source is associated to
+            uint32_t BatchIndex = 0;            // Index of the source in the SourceBatch arrays
             bool bInitialized = false;
+            bool bPositionSet = false;
             bool bInitialPositionSet = false;
             uint32_t InternalChannelCount = 4;  // Number of virtual speakers used to calculate VBAP gains
 
@@ -104,23 +125,71 @@ namespace Beyond::Audio::DSP
             //-------------
             float Spread;
             float Focus;
-
-            float vbapAzimuth;                // Direction angle in XZ plane used to calculate VBAP gains
-            float Distance;                   // Distance from the source to Listener
-            float DistanceAttenuationFactor;  // Current distance attenuation factor
-            float AngleAttenuationFactor;     // Current cone angle attenuation factor
-            glm::vec3 PositionRelative;       // Position relative to Listener
-            Audio::Transform Transform;       // Absolute position, orientation and up vector
-            glm::vec3 RelativeDir;            // Direction of Listener relative to the Source
-
-            glm::vec3 Velocity = glm::vec3(0.0f, 0.0f, 0.0f);   // For doppler pitch calculation.
 		};
 
 		std::unordered_map<uint32_t, Source> m_Sources;
 
+        /*  Positional data of the sources stored as structure of arrays, so that it can be processed
+            for 4 sources at a time. Arrays are padded to a multiple of 4, sources are swap-removed.
+        */
+        struct SourceBatch
+        {
+            // Input
+            std::vector<float> PositionX, PositionY, PositionZ;
+            std::vector<float> OrientationX, OrientationY, OrientationZ;
+            std::vector<float> VelocityX, VelocityY, VelocityZ;
+
+            // Configuration
+            std::vector<int32_t> AttenuationMod;
+            std::vector<float> MinDistance, MaxDistance, Rolloff;
+            std::vector<float> ConeCutoffInner, ConeCutoffOuter, ConeOuterGain;
+            std::vector<float> DopplerFactor;
+
+            // Output
+            std::vector<float> RelativeX, RelativeY, RelativeZ;   // Position relative to Listener
+            std::vector<float> Distance;                          // Distance from the source to Listener
+            std::vector<float> DistanceAttenuation;               // Current distance attenuation factor
+            std::vector<float> AngleAttenuation;                  // Current cone angle attenuation factor
+            std::vector<float> DopplerPitch;
+
+            std::vector<Source*> Sources;
+            uint32_t Count = 0;
+
+            template<typename TFunction>
+            void ForEachArray(TFunction&& function)
+            {
+                for (auto* array : { &PositionX, &PositionY, &PositionZ, &OrientationX, &OrientationY, &OrientationZ, &VelocityX, &VelocityY, &VelocityZ,
+                                     &MinDistance, &MaxDistance, &Rolloff, &ConeCutoffInner, &ConeCutoffOuter, &ConeOuterGain, &DopplerFactor,
+                                     &RelativeX, &RelativeY, &RelativeZ, &Distance, &DistanceAttenuation, &AngleAttenuation, &DopplerPitch })
+                    function(*array);
+
+                function(AttenuationMod);
+                function(Sources);
+            }
+        } m_Batch;
+
+        /*  Panning gains and doppler pitch of all of the sources, indexed by source ID.
+            Frames are triple-buffered: the update thread fills one frame and swaps it with the "ready" one,
+            the realtime thread swaps its frame with the "ready" one if it has been published since. Neither side ever waits.
+        */
+        struct GainsFrame
+        {
+            std::vector<float> Gains;           // s_MaxInputChannels channel groups of output channel gains per source
+            std::vector<float> DopplerPitch;
+        };
+
+        static constexpr uint32_t s_NewFrameBit = 4;
+
+        GainsFrame m_GainsFrames[3];
+        uint32_t m_WriteFrame = 0;                  // Update thread
+        uint32_t m_ReadFrame = 1;                   // Realtime thread
+        std::atomic<uint32_t> m_ReadyFrame = 2;     // Latest published frame, with s_NewFrameBit set until the realtime thread takes it
+
+        bool m_PositionsChanged = false;
+
         // Listener
         Audio::Transform m_ListenerTransform;
-        glm::vec3 m_ListenerVelocity;
+        glm::vec3 m_ListenerVelocity{ 0.0f };
 	};
 
 } // namespace Beyond::Audio::DSP
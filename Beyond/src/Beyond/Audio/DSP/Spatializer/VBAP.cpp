@@ -268,9 +268,11 @@ namespace Beyond::Audio::DSP
         //vbap.ChannelGroups.clear();
     }
 
-    void VBAP::UpdateVBAP(VBAPData* vbap, const PositionUpdateData& positionData, const ma_channel_converter& converter, bool isInitialPosition /*= false*/)
+    void VBAP::UpdateVBAP(VBAPData* vbap, const PositionUpdateData& positionData, const ma_channel_converter& converter,
+                           float* channelGroupGains, uint32_t channelGroupStride, bool isInitialPosition /*= false*/)
     {
         BEY_CORE_ASSERT(!vbap->VirtualSources.empty());
+        BEY_CORE_ASSERT(vbap->ChannelGroups.empty() || vbap->ChannelGroups[0].Gainer.config.channels <= channelGroupStride);
 
         const float panAngle = positionData.PanAngle;
         const float spread = positionData.Spread;
@@ -297,8 +299,10 @@ namespace Beyond::Audio::DSP
 
         //===== Normalize and Apply Gains ======
 
-        for (auto& chg : vbap->ChannelGroups)
+        for (uint32_t iGroup = 0; iGroup < (uint32_t)vbap->ChannelGroups.size(); ++iGroup)
         {
+            auto& chg = vbap->ChannelGroups[iGroup];
+
             ChannelGains gainsLocal;//
             ma_silence_pcm_frames(gainsLocal.data(), MA_MAX_CHANNELS, ma_format_f32, 1);
 
@@ -321,8 +325,7 @@ namespace Beyond::Audio::DSP
 
             // Convert intermediate Surround channel gains to Stereo output
             ChannelGains gainsOut = ConvertChannelGains(gainsLocal, converter);
-            farbot::RealtimeObject<ChannelGains, farbot::RealtimeObjectOptions::nonRealtimeMutatable>::ScopedAccess<farbot::ThreadType::nonRealtime> gains(chg.Gains);
-            *gains = gainsOut;
+            memcpy(channelGroupGains + iGroup * channelGroupStride, gainsOut.data(), sizeof(float) * chg.Gainer.config.channels);
 
             // If initial position hasn't been set yet, no need for interpolation, set "old" gains to the current ones
             if (isInitialPosition)
@@ -1,14 +1,10 @@
 #pragma once
 #include "miniaudio/include/miniaudio_incl.h"
-#include "farbot/RealtimeObject.hpp"
 
 namespace Beyond::Audio::DSP
 {
     using ChannelGains = std::array<float, MA_MAX_CHANNELS>;
 
-    // Thread-safe object to update VBAP gains from non-realtime thread and read from realtime thread.
-    using RealtimeGains = farbot::RealtimeObject<ChannelGains, farbot::RealtimeObjectOptions::nonRealtimeMutatable>;
-
     struct VBAPData;
 
     class VBAP
@@ -39,7 +35,6 @@ namespace Beyond::Audio::DSP
             uint32_t Channel;                                           // Index of the channel this group is associated to. Mainly for debugging.
             std::vector<int> VirtualSourceIDs;                          // Virtual sources associated to this channel group
 
-            RealtimeGains Gains;                                        // Accumulated and normalized gains of virtual sources associated to this channel group.
             ma_gainer Gainer;                                           // Interpolating changes in gain for the virtual sources of the group.
 
             ChannelGroup();
@@ -52,8 +47,11 @@ namespace Beyond::Audio::DSP
         static bool InitVBAP(VBAPData* vbap, const uint32_t numOfInputs, const uint32_t numOfOutputs, const ma_channel* sourceChannelMap, const ma_channel* outPutChannelMap);
         static void ClearVBAP(VBAPData* vbap);
 
-        // Update gains each Virtual Source contributing to the output channels based on the new positional data
-        static void UpdateVBAP(VBAPData* vbap, const PositionUpdateData& positionData, const ma_channel_converter& converter, bool isInitialPosition = false);
+        /*  Update gains each Virtual Source contributing to the output channels based on the new positional data
+            @param channelGroupGains - output, accumulated and normalized gains of each channel group, groups are 'channelGroupStride' apart
+         */
+        static void UpdateVBAP(VBAPData* vbap, const PositionUpdateData& positionData, const ma_channel_converter& converter,
+                               float* channelGroupGains, uint32_t channelGroupStride, bool isInitialPosition = false);
 
     private:
         // Sort speaker vectors in ascending order preparing for FindActiveArch()
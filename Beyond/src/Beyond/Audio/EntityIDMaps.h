@@ -271,6 +271,22 @@ namespace Beyond {
 
             EventInfo Get(EventID eventID) const;
 
+            // Invoke function with the EventInfo while holding the registry lock, without copying it.
+            // The function must not call back into the registry.
+            // @returns false - if eventID is not in the registry
+            template<typename Function>
+            bool Invoke(EventID eventID, Function&& function) const
+            {
+                std::shared_lock lock{ m_Mutex };
+
+                auto it = m_PlaybackInstances.find(eventID);
+                if (it == m_PlaybackInstances.end())
+                    return false;
+
+                function(it->second);
+                return true;
+            }
+
         private:
             mutable std::shared_mutex m_Mutex;
             std::unordered_map<EventID, EventInfo> m_PlaybackInstances;
@@ -0,0 +1,143 @@
+#include "pch.h"
+#include "OfflineRender.h"
+
+#include "miniaudio_incl.h"
+
+#include <chrono>
+#include <unordered_set>
+
+namespace Beyond::Audio
+{
+	namespace
+	{
+		// Copy of a node's vtable with the timed process callback, the node's
+		// vtable pointer points to VTable so the original can be found from the node.
+		struct TimedVTable
+		{
+			ma_node_vtable VTable;
+			const ma_node_vtable* Original = nullptr;
+		};
+
+		struct NodeTime
+		{
+			uint64_t ProcessCount = 0;
+			std::chrono::steady_clock::duration Time{ 0 };
+		};
+
+		bool s_Active = false;
+		std::unordered_map<const ma_node_vtable*, std::unique_ptr<TimedVTable>> s_TimedVTables;
+		std::unordered_map<const void*, NodeTime> s_NodeTimes;
+
+		void ProcessTimed(ma_node* pNode, const float** ppFramesIn, ma_uint32* pFrameCountIn, float** ppFramesOut, ma_uint32* pFrameCountOut)
+		{
+			const auto* timed = (const TimedVTable*)((ma_node_base*)pNode)->vtable;
+			if (!s_Active)
+			{
+				timed->Original->onProcess(pNode, ppFramesIn, pFrameCountIn, ppFramesOut, pFrameCountOut);
+				return;
+			}
+
+			// Inputs are read before the callback, the time is exclusive of them
+			const auto start = std::chrono::steady_clock::now();
+			timed->Original->onProcess(pNode, ppFramesIn, pFrameCountIn, ppFramesOut, pFrameCountOut);
+			const auto time = std::chrono::steady_clock::now() - start;
+
+			NodeTime& nodeTime = s_NodeTimes[pNode];
+			nodeTime.ProcessCount++;
+			nodeTime.Time += time;
+		}
+
+		void WrapNode(ma_node_base* node)
+		{
+			const ma_node_vtable* vtable = node->vtable;
+			if (vtable == nullptr || vtable->onProcess == nullptr || vtable->onProcess == &ProcessTimed)
+				return;
+
+			auto& timed = s_TimedVTables[vtable];
+			if (!timed)
+			{
+				timed = std::make_unique<TimedVTable>();
+				timed->Original = vtable;
+			}
+
+			// Some vtables are set up again when their node is (AudioCallback), keep the copy up to date
+			timed->VTable = *vtable;
+			timed->VTable.onProcess = &ProcessTimed;
+			node->vtable = &timed->VTable;
+		}
+
+		void WrapInputs(ma_node_base* node, std::unordered_set<ma_node_base*>& visited)
+		{
+			if (!visited.insert(node).second)
+				return;
+
+			WrapNode(node);
+
+			for (ma_uint32 bus = 0; bus < node->inputBusCount; ++bus)
+			{
+				for (ma_node_output_bus* output = node->pInputBuses[bus].head.pNext; output != nullptr; output = output->pNext)
+				{
+					if (output->pNode)
+						WrapInputs((ma_node_base*)output->pNode, visited);
+				}
+			}
+		}
+	}
+
+	void NodeProfiler::SetNodeName(const void* node, const char* name)
+	{
+		std::scoped_lock lock{ s_NodeNamesLock };
+		s_NodeNames[node] = name;
+	}
+
+	void NodeProfiler::Begin(ma_node_graph* graph)
+	{
+		BEY_CORE_ASSERT(!s_Active, "Only one node graph can be profiled at a time.");
+
+		m_Graph = graph;
+		SetNodeName(&graph->endpoint, "Endpoint");
+
+		s_NodeTimes.clear();
+		s_Active = true;
+		Sample();
+	}
+
+	void NodeProfiler::Sample()
+	{
+		std::unordered_set<ma_node_base*> visited;
+		WrapInputs(&m_Graph->endpoint, visited);
+	}
+
+	std::vector<OfflineRenderResult::NodeTiming> NodeProfiler::End()
+	{
+		s_Active = false;
+
+		std::vector<OfflineRenderResult::NodeTiming> timings;
+		{
+			std::scoped_lock lock{ s_NodeNamesLock };
+			for (const auto& [node, nodeTime] : s_NodeTimes)
+			{
+				auto name = s_NodeNames.find(node);
+				const char* nodeName = name != s_NodeNames.end() ? name->second : "Other";
+
+				auto timing = std::find_if(timings.begin(), timings.end(), [nodeName](const OfflineRenderResult::NodeTiming& t) { return t.Name == nodeName; });
+				if (timing == timings.end())
+				{
+					timings.push_back({ nodeName });
+					timing = timings.end() - 1;
+				}
+
+				timing->NodeCount++;
+				timing->ProcessCount += nodeTime.ProcessCount;
+				timing->Milliseconds += std::chrono::duration<double, std::milli>(nodeTime.Time).count();
+			}
+		}
+
+		std::sort(timings.begin(), timings.end(), [](const auto& a, const auto& b) { return a.Milliseconds > b.Milliseconds; });
+
+		s_NodeTimes.clear();
+		m_Graph = nullptr;
+		return timings;
+	}
+
+} // namespace Beyond::Audio
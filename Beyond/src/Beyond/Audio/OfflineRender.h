@@ -0,0 +1,78 @@
+#pragma once
+
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct ma_node_graph;
+
+namespace Beyond::Audio
+{
+	//==============================================================================
+	/// Offline rendering pulls the engine's node graph directly instead of a playback
+	/// device, as fast as possible and with a fixed block size and time step,
+	/// which makes the output and the cost of the DSP reproducible.
+	struct OfflineRenderSettings
+	{
+		double Duration = 10.0;				// Seconds of audio to render
+		uint32_t BlockSize = 0;				// Frames per block, 0 - period size of the device
+		std::filesystem::path OutputFile;	// 32-bit float WAV file, nothing is written if empty
+		bool KeepFrames = false;			// Return the rendered interleaved frames in the result
+	};
+
+	struct OfflineRenderResult
+	{
+		struct NodeTiming
+		{
+			std::string Name;
+			uint32_t NodeCount = 0;		// Nodes of this type that processed any frames
+			uint64_t ProcessCount = 0;	// Calls to the nodes' process callback
+			double Milliseconds = 0.0;	// Exclusive of the nodes' inputs
+		};
+
+		bool Success = false;
+		uint32_t SampleRate = 0;
+		uint32_t Channels = 0;
+		uint64_t FrameCount = 0;
+
+		double RenderMilliseconds = 0.0;	// Pulling the node graph
+		double UpdateMilliseconds = 0.0;	// Engine updates between the blocks
+
+		std::vector<NodeTiming> NodeTimings; // Sorted by time, most expensive first
+		std::vector<float> Frames;
+
+		double GetRealtimeFactor() const { return RenderMilliseconds > 0.0 ? (FrameCount * 1000.0 / SampleRate) / (RenderMilliseconds + UpdateMilliseconds) : 0.0; }
+	};
+
+	//==============================================================================
+	/** Measures the time spent in the process callbacks of the nodes of a node graph.
+
+		The nodes found in the graph get a copy of their vtable with a timed process callback.
+		Time is measured only between Begin() and End(), the copies stay in place afterwards
+		because the nodes might be uninitialized by then. Must be used on the thread that
+		reads the node graph, while nothing else is reading it.
+	*/
+	class NodeProfiler
+	{
+	public:
+		/** Name the timings of a node are reported under, e.g. "Reverb". Nodes without a name are "Other". */
+		static void SetNodeName(const void* node, const char* name);
+
+		void Begin(ma_node_graph* graph);
+
+		/** Finds nodes attached to the graph since the last call. Call before reading each block. */
+		void Sample();
+
+		/** Stops timing and aggregates the timings per node name. */
+		std::vector<OfflineRenderResult::NodeTiming> End();
+
+	private:
+		ma_node_graph* m_Graph = nullptr;
+
+		inline static std::mutex s_NodeNamesLock;
+		inline static std::unordered_map<const void*, const char*> s_NodeNames;
+	};
+
+} // namespace Beyond::Audio
@@ -337,4 +337,14 @@ namespace Beyond::Audio
 		return false;
 	}
 
+	StreamingManager::Config ResourceManager::GetStreamingConfig() const
+	{
+		const auto userConfig = MiniAudioEngine::Get().GetUserConfiguration();
+
+		StreamingManager::Config config;
+		config.MemoryBudget = (uint64_t)userConfig.StreamingMemoryBudgetMB * 1024 * 1024;
+		config.BufferDuration = userConfig.StreamingBufferDuration;
+		return config;
+	}
+
 } // namespace Beyond::Audio
@@ -2,6 +2,7 @@
 
 #include "AudioEngine.h"
 #include "SoundBank.h"
+#include "StreamingManager.h"
 
 #include "Beyond/Core/Buffer.h"
 
@@ -41,6 +42,10 @@ namespace Beyond::Audio
 
 		bool IsStreaming(AssetHandle sourceFile) const;
 
+		StreamingManager& GetStreamingManager() { return m_StreamingManager; }
+		/** Stream memory budget and buffer duration from the user configuration. */
+		StreamingManager::Config GetStreamingConfig() const;
+
 	private:
 		std::vector<AssetHandle> CollectWaveHandlesForPlayAction(const TriggerAction& playAction) const;
 
@@ -50,5 +55,8 @@ namespace Beyond::Audio
 		// It is important to keep this map alive while we read
 		// any audio data from the SoundBank
 		std::unordered_map<AssetHandle, Buffer> m_LoadedFiles;
+
+		// Long files are decoded ahead on the I/O thread instead of being decoded fully
+		StreamingManager m_StreamingManager;
 	};
 } // namespace Beyond::Audio
@@ -33,6 +33,8 @@ namespace Beyond
         
         // Reset Finished flag so that we don't accidentally release this voice again while it's starting for the new source
         bFinished = false;
+        bVirtual = false;
+        m_VirtualFrames = 0.0;
 
         // TODO: handle passing in different flags for decoding (from data source asset)
         // TODO: and handle decoding somewhere else, in some other way
@@ -40,6 +42,8 @@ namespace Beyond
         if (!config->DataSourceAsset)
             return false;
 
+        m_Priority = config->Priority;
+
 		const std::string sourceFile = std::to_string(config->DataSourceAsset);
 
 		if (Application::IsRuntime())
@@ -78,6 +82,8 @@ namespace Beyond
         if (result != MA_SUCCESS)
             return false;
 
+        NodeProfiler::SetNodeName(&m_Sound, "Sound");
+
         InitializeEffects(config);
 
         // TODO: handle using parent's (parent group) spatialization vs override (config probably would be passed down here from parrent)
@@ -125,6 +131,7 @@ namespace Beyond
                                         &m_MasterSplitter);
 
         BEY_CORE_ASSERT(result == MA_SUCCESS);
+        NodeProfiler::SetNodeName(&m_MasterSplitter, "Reverb Send");
 
         // Store the node the sound was connected to
         auto* oldOutput = currentHeaderNode->pOutputBuses[0].pInputNode;
@@ -175,6 +182,7 @@ namespace Beyond
             m_LowPass.Uninitialize();
             m_HighPass.Uninitialize();
 
+            bVirtual = false;
             bIsReadyToPlay = false;
         }
     }
@@ -429,6 +437,29 @@ namespace Beyond
 
         m_StopFadeTime = std::max(0.0f, m_StopFadeTime - ts.GetSeconds());
 
+        if (bVirtual && m_PlayState == EPlayState::Playing)
+        {
+            ma_uint32 sampleRate = 0;
+            ma_sound_get_data_format(&m_Sound, nullptr, nullptr, &sampleRate, nullptr, 0);
+            m_VirtualFrames += ts.GetSeconds() * sampleRate * GetPitch();
+
+            if (!bLooping)
+            {
+                ma_uint64 currentFrame = 0;
+                ma_uint64 totalFrames = 0;
+                ma_sound_get_cursor_in_pcm_frames(&m_Sound, &currentFrame);
+                ma_sound_get_length_in_pcm_frames(&m_Sound, &totalFrames);
+
+                // Reached the end of the data while virtual
+                if (currentFrame + (ma_uint64)m_VirtualFrames >= totalFrames)
+                {
+                    StopNow(true, true);
+                    LOG_PLAYBACK("Upd: " + StringFromState(m_PlayState));
+                    return;
+                }
+            }
+        }
+
         switch (m_PlayState)
         {
         case EPlayState::Stopped:
@@ -485,6 +516,7 @@ namespace Beyond
         {
             // Reset data source read position to the beginning of the data
             ma_sound_seek_to_pcm_frame(&m_Sound, 0);
+            m_VirtualFrames = 0.0;
 
             // Mark this voice to be released.
             bFinished = true;
@@ -515,6 +547,32 @@ namespace Beyond
         return GetCurrentFadeVolume() * ((float) m_Priority / 255.0f);
     }
 
+    void Sound::SetVirtual(bool isVirtual)
+    {
+        if (isVirtual == bVirtual || !bIsReadyToPlay)
+            return;
+
+        if (!isVirtual && m_VirtualFrames > 0.0)
+        {
+            // Catch up with the time played while virtual
+            ma_uint64 currentFrame = 0;
+            ma_uint64 totalFrames = 0;
+            ma_sound_get_cursor_in_pcm_frames(&m_Sound, &currentFrame);
+            ma_sound_get_length_in_pcm_frames(&m_Sound, &totalFrames);
+
+            ma_uint64 frame = currentFrame + (ma_uint64)m_VirtualFrames;
+            if (totalFrames > 0 && frame >= totalFrames)
+                frame = bLooping ? frame % totalFrames : totalFrames;
+
+            ma_sound_seek_to_pcm_frame(&m_Sound, frame);
+        }
+        m_VirtualFrames = 0.0;
+
+        // Splitter is the last node of the voice, nodes feeding it are not processed while it's stopped
+        ma_node_set_state(&m_MasterSplitter, isVirtual ? ma_node_state_stopped : ma_node_state_started);
+        bVirtual = isVirtual;
+    }
+
     float Sound::GetPlaybackPercentage()
     {
         ma_uint64 currentFrame;
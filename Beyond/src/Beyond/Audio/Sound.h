@@ -92,6 +92,13 @@ namespace Beyond
 
         ESoundPlayState GetPlayState() const override { return m_PlayState; }
 
+        /* Stops processing of the data source and effects of this voice. Playback time
+           still advances while virtual, the data source is moved to where it would have been
+           when the voice becomes real again.
+        */
+        virtual void SetVirtual(bool isVirtual) override;
+        virtual bool IsVirtual() const override { return bVirtual; }
+
     private:
         /* Stop playback with short fade-out to prevent click.
 		   @param numSamples - length of the fade-out in PCM frames
@@ -135,11 +142,15 @@ namespace Beyond
 
         bool bIsReadyToPlay = false;
 
-        // TODO
+        /* Priority of the SoundConfig this voice plays. */
         uint8_t m_Priority = 64;
 
         bool bLooping = false;
         bool bFinished = false;
+        bool bVirtual = false;
+
+        /* Frames of the data source that would have been read while the voice has been virtual. */
+        double m_VirtualFrames = 0.0;
 
         /* Stored Fader "resting" value. Used to restore Fader before restarting playback if a fade has occured. */
         float m_StoredFaderValue = 1.0f;
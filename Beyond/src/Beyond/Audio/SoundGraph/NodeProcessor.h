@@ -88,6 +88,39 @@ namespace Beyond::SoundGraph
 	};
 #endif
 
+	//==============================================================================
+	/// Frames of a float stream while the graph processes a block. Streams that don't
+	/// change within a block (parameters, default values, ...) have no frames, every
+	/// frame of the block is *Value then.
+	struct StreamBlock
+	{
+		float* Value = nullptr;		// Endpoint the stream is read from when processing per sample
+		float* Frames = nullptr;
+
+		inline bool IsConstant() const noexcept { return Frames == nullptr; }
+		inline float operator[](uint32_t frame) const noexcept { return Frames ? Frames[frame] : *Value; }
+	};
+
+	/// Streams of a graph's float endpoints, nodes look theirs up in BindBlockStreams()
+	struct BlockStreams
+	{
+		/** Stream read by an input endpoint. */
+		const StreamBlock* In(float* endpoint)
+		{
+			return &Streams.try_emplace(endpoint, StreamBlock{ endpoint, nullptr }).first->second;
+		}
+
+		/** Frames written to by an output endpoint of a block processed node. */
+		float* Out(float& endpoint)
+		{
+			auto it = Streams.find(&endpoint);
+			BEY_CORE_ASSERT(it != Streams.end() && it->second.Frames);
+			return it->second.Frames;
+		}
+
+		std::unordered_map<const float*, StreamBlock> Streams;
+	};
+
 	//==============================================================================
 	/// NodeProcessor
 	struct NodeProcessor
@@ -197,6 +230,15 @@ namespace Beyond::SoundGraph
 		virtual void Init() {}
 		virtual void Process() {}
 
+		/** Block processing. A node that returns true from CanProcessBlock() must have only float
+			output streams, look up its streams in BindBlockStreams() and write numFrames frames of
+			each of its outputs in ProcessBlock(). Input events are only checked at the start of a block,
+			the graph processes nodes connected to other nodes' events per sample.
+		*/
+		virtual bool CanProcessBlock() const { return false; }
+		virtual void BindBlockStreams(BlockStreams& streams) {}
+		virtual void ProcessBlock(uint32_t numFrames) {}
+
 		std::unordered_map<Identifier, InputEvent> InEvs;
 		std::unordered_map<Identifier, OutputEvent&> OutEvs;
 
@@ -0,0 +1,247 @@
+#pragma once
+
+#include "Beyond/Audio/SoundGraph/NodeProcessor.h"
+
+#include <type_traits>
+#include <utility>
+
+#if defined(_M_X64) || defined(__SSE2__)
+	#define BEY_SOUNDGRAPH_SSE 1
+	#include <emmintrin.h>
+#else
+	#define BEY_SOUNDGRAPH_SSE 0
+#endif
+
+namespace Beyond::SoundGraph::BlockKernels
+{
+	//==============================================================================
+	/// Reads the frames of a stream, constant streams are broadcast so that
+	/// kernels don't have to branch on them per frame.
+	struct StreamCursor
+	{
+		explicit StreamCursor(const StreamBlock& stream) noexcept
+		{
+			if (stream.Frames)
+			{
+				Data = stream.Frames;
+				Step = 1;
+			}
+			else
+			{
+				Constant[0] = Constant[1] = Constant[2] = Constant[3] = *stream.Value;
+				Data = Constant;
+				Step = 0;
+			}
+		}
+
+		// Data might point to Constant
+		StreamCursor(const StreamCursor&) = delete;
+
+		inline float At(uint32_t frame) const noexcept { return Data[frame * Step]; }
+#if BEY_SOUNDGRAPH_SSE
+		inline __m128 At4(uint32_t frame) const noexcept { return _mm_loadu_ps(Data + frame * Step); }
+#endif
+
+		const float* Data;
+		uint32_t Step;
+		float Constant[4];
+	};
+
+	inline void Fill(float* out, uint32_t numFrames, float value) noexcept
+	{
+		uint32_t i = 0;
+#if BEY_SOUNDGRAPH_SSE
+		const __m128 v = _mm_set1_ps(value);
+		for (; i + 4 <= numFrames; i += 4)
+			_mm_storeu_ps(out + i, v);
+#endif
+		for (; i < numFrames; ++i)
+			out[i] = value;
+	}
+
+	namespace Impl {
+
+		template<typename TOp, size_t... Index>
+		inline void Map(float* out, uint32_t numFrames, const TOp& op, const StreamCursor* cursors, std::index_sequence<Index...>) noexcept
+		{
+			uint32_t i = 0;
+#if BEY_SOUNDGRAPH_SSE
+			// Operations without an __m128 overload are evaluated per frame
+			if constexpr (std::is_invocable_v<const TOp&, decltype(cursors[Index].At4(0))...>)
+			{
+				for (; i + 4 <= numFrames; i += 4)
+					_mm_storeu_ps(out + i, op(cursors[Index].At4(i)...));
+			}
+#endif
+			for (; i < numFrames; ++i)
+				out[i] = op(cursors[Index].At(i)...);
+		}
+
+	} // namespace Impl
+
+	/** out[i] = op(streams[i]...). If all of the streams are constant op is evaluated once. */
+	template<typename TOp, typename... TStreams>
+	inline void Map(float* out, uint32_t numFrames, const TOp& op, const TStreams&... streams) noexcept
+	{
+		if ((streams.IsConstant() && ...))
+		{
+			Fill(out, numFrames, op((*streams.Value)...));
+			return;
+		}
+
+		const StreamCursor cursors[] = { StreamCursor(streams)... };
+		Impl::Map(out, numFrames, op, cursors, std::index_sequence_for<TStreams...>{});
+	}
+
+	//==============================================================================
+	/// Operations for Map(), they match the per sample Process() of the nodes.
+	/// Any callable taking floats works too.
+
+	struct AddOp
+	{
+		inline float operator()(float a, float b) const noexcept { return a + b; }
+#if BEY_SOUNDGRAPH_SSE
+		inline __m128 operator()(__m128 a, __m128 b) const noexcept { return _mm_add_ps(a, b); }
+#endif
+	};
+
+	struct SubtractOp
+	{
+		inline float operator()(float a, float b) const noexcept { return a - b; }
+#if BEY_SOUNDGRAPH_SSE
+		inline __m128 operator()(__m128 a, __m128 b) const noexcept { return _mm_sub_ps(a, b); }
+#endif
+	};
+
+	struct MultiplyOp
+	{
+		inline float operator()(float a, float b) const noexcept { return a * b; }
+#if BEY_SOUNDGRAPH_SSE
+		inline __m128 operator()(__m128 a, __m128 b) const noexcept { return _mm_mul_ps(a, b); }
+#endif
+	};
+
+	struct DivideOp
+	{
+		inline float operator()(float value, float denominator) const noexcept { return denominator == 0.0f ? -1.0f : value / denominator; }
+#if BEY_SOUNDGRAPH_SSE
+		inline __m128 operator()(__m128 value, __m128 denominator) const noexcept
+		{
+			const __m128 isZero = _mm_cmpeq_ps(denominator, _mm_setzero_ps());
+			return _mm_or_ps(_mm_and_ps(isZero, _mm_set1_ps(-1.0f)), _mm_andnot_ps(isZero, _mm_div_ps(value, denominator)));
+		}
+#endif
+	};
+
+	struct MinOp
+	{
+		inline float operator()(float a, float b) const noexcept { return glm::min(a, b); }
+#if BEY_SOUNDGRAPH_SSE
+		// glm::min(a, b) is (b < a) ? b : a
+		inline __m128 operator()(__m128 a, __m128 b) const noexcept { return _mm_min_ps(a, b); }
+#endif
+	};
+
+	struct MaxOp
+	{
+		inline float operator()(float a, float b) const noexcept { return glm::max(a, b); }
+#if BEY_SOUNDGRAPH_SSE
+		inline __m128 operator()(__m128 a, __m128 b) const noexcept { return _mm_max_ps(a, b); }
+#endif
+	};
+
+	struct ClampOp
+	{
+		inline float operator()(float in, float min, float max) const noexcept { return glm::clamp(in, min, max); }
+#if BEY_SOUNDGRAPH_SSE
+		inline __m128 operator()(__m128 in, __m128 min, __m128 max) const noexcept { return _mm_min_ps(_mm_max_ps(in, min), max); }
+#endif
+	};
+
+	struct MapRangeOp
+	{
+		bool Clamped;
+
+		inline float operator()(float in, float inA, float inB, float outA, float outB) const noexcept
+		{
+			const float value = Clamped ? glm::clamp(in, inA, inB) : in;
+			const float t = value / (inB - inA);
+			return glm::mix(outA, outB, t);
+		}
+#if BEY_SOUNDGRAPH_SSE
+		inline __m128 operator()(__m128 in, __m128 inA, __m128 inB, __m128 outA, __m128 outB) const noexcept
+		{
+			const __m128 value = Clamped ? _mm_min_ps(_mm_max_ps(in, inA), inB) : in;
+			const __m128 t = _mm_div_ps(value, _mm_sub_ps(inB, inA));
+			return _mm_add_ps(_mm_mul_ps(outA, _mm_sub_ps(_mm_set1_ps(1.0f), t)), _mm_mul_ps(outB, t));
+		}
+#endif
+	};
+
+	//==============================================================================
+	/** frames[i] = pow(frames[i], exponent), curve of the envelopes. */
+	inline void Pow(float* frames, uint32_t numFrames, float exponent) noexcept
+	{
+		if (exponent == 1.0f)
+			return;
+
+		for (uint32_t i = 0; i < numFrames; ++i)
+			frames[i] = glm::pow(frames[i], exponent);
+	}
+
+	/** frames[i] = 1 - frames[i] */
+	inline void OneMinus(float* frames, uint32_t numFrames) noexcept
+	{
+		uint32_t i = 0;
+#if BEY_SOUNDGRAPH_SSE
+		const __m128 one = _mm_set1_ps(1.0f);
+		for (; i + 4 <= numFrames; i += 4)
+			_mm_storeu_ps(frames + i, _mm_sub_ps(one, _mm_loadu_ps(frames + i)));
+#endif
+		for (; i < numFrames; ++i)
+			frames[i] = 1.0f - frames[i];
+	}
+
+#if BEY_SOUNDGRAPH_SSE
+	/** Sine of any phase. The phase is reduced to [-pi/2, pi/2] where the Taylor series up to x^11 is accurate to about 1e-7. */
+	inline __m128 Sin4(__m128 x) noexcept
+	{
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 pi = _mm_set1_ps(glm::pi<float>());
+		const __m128 halfPi = _mm_set1_ps(glm::half_pi<float>());
+
+		// [-pi, pi]
+		const __m128 turns = _mm_cvtepi32_ps(_mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(glm::one_over_two_pi<float>()))));
+		x = _mm_sub_ps(x, _mm_mul_ps(turns, _mm_set1_ps(glm::two_pi<float>())));
+
+		// sin(x) = sin(pi - x), keeping the sign
+		const __m128 sign = _mm_and_ps(x, signMask);
+		__m128 absX = _mm_andnot_ps(signMask, x);
+		const __m128 fold = _mm_cmpgt_ps(absX, halfPi);
+		absX = _mm_or_ps(_mm_and_ps(fold, _mm_sub_ps(pi, absX)), _mm_andnot_ps(fold, absX));
+		x = _mm_or_ps(absX, sign);
+
+		const __m128 x2 = _mm_mul_ps(x, x);
+		__m128 p = _mm_set1_ps(-1.0f / 39916800.0f);
+		p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f / 362880.0f));
+		p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(-1.0f / 5040.0f));
+		p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f / 120.0f));
+		p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(-1.0f / 6.0f));
+		p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f));
+		return _mm_mul_ps(x, p);
+	}
+#endif
+
+	/** frames[i] = sin(frames[i]) */
+	inline void Sin(float* frames, uint32_t numFrames) noexcept
+	{
+		uint32_t i = 0;
+#if BEY_SOUNDGRAPH_SSE
+		for (; i + 4 <= numFrames; i += 4)
+			_mm_storeu_ps(frames + i, Sin4(_mm_loadu_ps(frames + i)));
+#endif
+		for (; i < numFrames; ++i)
+			frames[i] = glm::sin(frames[i]);
+	}
+
+} // namespace Beyond::SoundGraph::BlockKernels
@@ -1,5 +1,6 @@
 #pragma once
 #include "Beyond/Audio/SoundGraph/NodeProcessor.h"
+#include "Beyond/Audio/SoundGraph/Nodes/BlockKernels.h"
 #include "Beyond/Core/UUID.h"
 
 #define DECLARE_ID(name) static constexpr Identifier name{ #name }
@@ -26,18 +27,7 @@ namespace Beyond::SoundGraph {
 		{
 			InitializeInputs();
 
-			attackCurve = glm::max(0.0f, *in_AttackCurve);
-			decayCurve = glm::max(0.0f, *in_DecayCurve);
-
-			if (*in_AttackTime <= 0.0f)
-				attackRate = 1.0f; // clamping rate to 1 sample
-			else
-				attackRate = 1.0f / (*in_AttackTime * 48000.0f); // TODO: get sample rate from the graph
-
-			if (*in_DecayTime <= 0.0f)
-				decayRate = 1.0f;
-			else
-				decayRate = 1.0f / (*in_DecayTime * 48000.0f);
+			UpdateRates(*in_AttackTime, *in_DecayTime, *in_AttackCurve, *in_DecayCurve);
 
 			value = 0.0f;
 			target = 0.0f;
@@ -79,26 +69,34 @@ namespace Beyond::SoundGraph {
 
 		Flag fTrigger;
 
+		const StreamBlock* blk_AttackTime = nullptr;
+		const StreamBlock* blk_DecayTime = nullptr;
+		const StreamBlock* blk_AttackCurve = nullptr;
+		const StreamBlock* blk_DecayCurve = nullptr;
+		float* blk_OutEnvelope = nullptr;
+
 	private:
 		void RegisterEndpoints();
 		void InitializeInputs();
 
-	public:
-		void Trigger(float)
+		void UpdateRates(float attackTime, float decayTime, float attackCurveValue, float decayCurveValue)
 		{
-			attackCurve = glm::max(0.0f, *in_AttackCurve);
-			decayCurve = glm::max(0.0f, *in_DecayCurve);
+			attackCurve = glm::max(0.0f, attackCurveValue);
+			decayCurve = glm::max(0.0f, decayCurveValue);
 
-			if (*in_AttackTime <= 0.0f)
+			if (attackTime <= 0.0f)
 				attackRate = 1.0f; // clamping rate to 1 sample
 			else
-				attackRate = 1.0f / (*in_AttackTime * 48000.0f); // TODO: get sample rate from the graph
-			
-			if (*in_DecayTime <= 0.0f)
+				attackRate = 1.0f / (attackTime * 48000.0f); // TODO: get sample rate from the graph
+
+			if (decayTime <= 0.0f)
 				decayRate = 1.0f;
 			else
-				decayRate = 1.0f / (*in_DecayTime * 48000.0f);
+				decayRate = 1.0f / (decayTime * 48000.0f);
+		}
 
+		void Start()
+		{
 			// we deliberately don't reset current value to 0 to allow to restart attack from the current state
 			// this makes retrigger smooth
 			target = 1.0f;
@@ -108,6 +106,13 @@ namespace Beyond::SoundGraph {
 			out_OnTrigger(1.0f);
 		}
 
+	public:
+		void Trigger(float)
+		{
+			UpdateRates(*in_AttackTime, *in_DecayTime, *in_AttackCurve, *in_DecayCurve);
+			Start();
+		}
+
 		void Process() final
 		{
 			if (fTrigger.CheckAndResetIfDirty())
@@ -145,6 +150,79 @@ namespace Beyond::SoundGraph {
 				break;
 			}
 		}
+
+		bool CanProcessBlock() const final { return true; }
+
+		void BindBlockStreams(BlockStreams& streams) final
+		{
+			blk_AttackTime = streams.In(in_AttackTime);
+			blk_DecayTime = streams.In(in_DecayTime);
+			blk_AttackCurve = streams.In(in_AttackCurve);
+			blk_DecayCurve = streams.In(in_DecayCurve);
+			blk_OutEnvelope = streams.Out(out_OutEnvelope);
+		}
+
+		void ProcessBlock(uint32_t numFrames) final
+		{
+			if (fTrigger.CheckAndResetIfDirty())
+			{
+				UpdateRates((*blk_AttackTime)[0], (*blk_DecayTime)[0], (*blk_AttackCurve)[0], (*blk_DecayCurve)[0]);
+				Start();
+			}
+
+			// The ramps of a state are written first and shaped by the curve afterwards
+			float* out = blk_OutEnvelope;
+			uint32_t i = 0;
+			while (i < numFrames)
+			{
+				const uint32_t segmentStart = i;
+				switch (state)
+				{
+				case Attack:
+					while (i < numFrames && state == Attack)
+					{
+						value += attackRate;
+						if (value >= target)
+						{
+							value = target;
+							target = 0.0f;
+							state = Decay;
+						}
+						out[i++] = value;
+					}
+
+					BlockKernels::Pow(out + segmentStart, i - segmentStart, attackCurve);
+					break;
+
+				case Decay:
+					while (i < numFrames && state == Decay)
+					{
+						value -= decayRate;
+						if (value <= 0.0f)
+						{
+							value = 0.0f;
+							target = 1.0f;
+							state = Idle + (int)(*in_Looping);
+
+							out_OnComplete(1.0f);
+						}
+						out[i++] = 1.0f - value;
+					}
+
+					BlockKernels::Pow(out + segmentStart, i - segmentStart, decayCurve);
+					BlockKernels::OneMinus(out + segmentStart, i - segmentStart);
+					break;
+
+				default:
+					// Holds the last value
+					BlockKernels::Fill(out + i, numFrames - i, out_OutEnvelope);
+					i = numFrames;
+					break;
+				}
+
+				out_OutEnvelope = out[i - 1];
+			}
+		}
 	};
 
 	//==========================================================================
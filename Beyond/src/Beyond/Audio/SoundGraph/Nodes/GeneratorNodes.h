@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Beyond/Audio/SoundGraph/NodeProcessor.h"
+#include "Beyond/Audio/SoundGraph/Nodes/BlockKernels.h"
 
 #include "Beyond/Core/UUID.h"
 #include "Beyond/Core/FastRandom.h"
@@ -41,6 +42,18 @@ namespace Beyond::SoundGraph
 			out_Value = generator.GetNextValue();
 		}
 
+		bool CanProcessBlock() const final { return true; }
+
+		void BindBlockStreams(BlockStreams& streams) final
+		{
+			blk_Value = streams.Out(out_Value);
+		}
+
+		void ProcessBlock(uint32_t numFrames) final
+		{
+			generator.Generate(blk_Value, numFrames);
+		}
+
 		enum ENoiseType : int32_t
 		{
 			WhiteNoise = 0, PinkNoise = 1, BrownianNoise = 2
@@ -84,6 +97,26 @@ namespace Beyond::SoundGraph
 				}
 			}
 
+			/** Same as calling GetNextValue() numFrames times, without branching on the type per frame */
+			inline void Generate(float* out, uint32_t numFrames)
+			{
+				switch (type)
+				{
+					case PinkNoise:
+						for (uint32_t i = 0; i < numFrames; ++i)
+							out[i] = GetNextValuePink();
+						break;
+					case BrownianNoise:
+						for (uint32_t i = 0; i < numFrames; ++i)
+							out[i] = GetNextValueBrownian();
+						break;
+					default:
+						for (uint32_t i = 0; i < numFrames; ++i)
+							out[i] = GetNextValueWhite();
+						break;
+				}
+			}
+
 		private:
 			/** Count the number of trailing zero bits */
 			static inline unsigned int Tzcnt32(unsigned int x) noexcept
@@ -168,6 +201,8 @@ namespace Beyond::SoundGraph
 			} state;
 
 		} generator;
+
+		float* blk_Value = nullptr;
 	};
 
 	//==============================================================================
@@ -291,6 +326,48 @@ namespace Beyond::SoundGraph
 			out_Sine = glm::sin(phase);
 			phase = fmodf(phase + phaseIncrement, glm::two_pi<float>());
 		}
+
+		bool CanProcessBlock() const final { return true; }
+
+		void BindBlockStreams(BlockStreams& streams) final
+		{
+			blk_Frequency = streams.In(in_Frequency);
+			blk_PhaseOffset = streams.In(in_PhaseOffset);
+			blk_Sine = streams.Out(out_Sine);
+		}
+
+		void ProcessBlock(uint32_t numFrames) final
+		{
+			if (fResetPhase.CheckAndResetIfDirty())
+				phase = (*blk_PhaseOffset)[0];
+
+			// The phases are accumulated first and the sine of the whole block is taken at once.
+			// Increments are below 2pi, subtracting 2pi is the same as fmodf once the phase is in range.
+			constexpr float twoPi = glm::two_pi<float>();
+			phase = fmodf(phase, twoPi);
+
+			const StreamBlock& frequency = *blk_Frequency;
+			if (frequency.IsConstant())
+				phaseIncrement = float(glm::clamp(*frequency.Value, minFreqHz, maxFreqHz) * twoPi * processorPeriod);
+
+			for (uint32_t i = 0; i < numFrames; ++i)
+			{
+				if (!frequency.IsConstant())
+					phaseIncrement = float(glm::clamp(frequency.Frames[i], minFreqHz, maxFreqHz) * twoPi * processorPeriod);
+
+				blk_Sine[i] = phase;
+				phase += phaseIncrement;
+				if (phase >= twoPi)
+					phase -= twoPi;
+			}
+
+			BlockKernels::Sin(blk_Sine, numFrames);
+		}
+
+	private:
+		const StreamBlock* blk_Frequency = nullptr;
+		const StreamBlock* blk_PhaseOffset = nullptr;
+		float* blk_Sine = nullptr;
 	};
 
 
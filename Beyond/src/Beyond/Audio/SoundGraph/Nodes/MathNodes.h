@@ -1,5 +1,6 @@
 #pragma once
 #include "Beyond/Audio/SoundGraph/NodeProcessor.h"
+#include "Beyond/Audio/SoundGraph/Nodes/BlockKernels.h"
 #include "Beyond/Core/UUID.h"
 
 #ifndef GLM_ENABLE_EXPERIMENTAL
@@ -28,6 +29,29 @@ namespace Beyond::SoundGraph
 		{
 			out_Out = (*in_Value1) + (*in_Value2);
 		}
+
+		bool CanProcessBlock() const final { return std::is_same_v<T, float>; }
+
+		void BindBlockStreams(BlockStreams& streams) final
+		{
+			if constexpr (std::is_same_v<T, float>)
+			{
+				blk_Value1 = streams.In(in_Value1);
+				blk_Value2 = streams.In(in_Value2);
+				blk_Out = streams.Out(out_Out);
+			}
+		}
+
+		void ProcessBlock(uint32_t numFrames) final
+		{
+			if constexpr (std::is_same_v<T, float>)
+				BlockKernels::Map(blk_Out, numFrames, BlockKernels::AddOp{}, *blk_Value1, *blk_Value2);
+		}
+
+	private:
+		const StreamBlock* blk_Value1 = nullptr;
+		const StreamBlock* blk_Value2 = nullptr;
+		float* blk_Out = nullptr;
 	};
 
 	//==========================================================================
@@ -46,6 +70,29 @@ namespace Beyond::SoundGraph
 		{
 			out_Out = (*in_Value1) - (*in_Value2);
 		}
+
+		bool CanProcessBlock() const final { return std::is_same_v<T, float>; }
+
+		void BindBlockStreams(BlockStreams& streams) final
+		{
+			if constexpr (std::is_same_v<T, float>)
+			{
+				blk_Value1 = streams.In(in_Value1);
+				blk_Value2 = streams.In(in_Value2);
+				blk_Out = streams.Out(out_Out);
+			}
+		}
+
+		void ProcessBlock(uint32_t numFrames) final
+		{
+			if constexpr (std::is_same_v<T, float>)
+				BlockKernels::Map(blk_Out, numFrames, BlockKernels::SubtractOp{}, *blk_Value1, *blk_Value2);
+		}
+
+	private:
+		const StreamBlock* blk_Value1 = nullptr;
+		const StreamBlock* blk_Value2 = nullptr;
+		float* blk_Out = nullptr;
 	};
 
 	//==========================================================================
@@ -64,6 +111,29 @@ namespace Beyond::SoundGraph
 		{
 			out_Out = (*in_Value)* (*in_Multiplier);
 		}
+
+		bool CanProcessBlock() const final { return std::is_same_v<T, float>; }
+
+		void BindBlockStreams(BlockStreams& streams) final
+		{
+			if constexpr (std::is_same_v<T, float>)
+			{
+				blk_Value = streams.In(in_Value);
+				blk_Multiplier = streams.In(in_Multiplier);
+				blk_Out = streams.Out(out_Out);
+			}
+		}
+
+		void ProcessBlock(uint32_t numFrames) final
+		{
+			if constexpr (std::is_same_v<T, float>)
+				BlockKernels::Map(blk_Out, numFrames, BlockKernels::MultiplyOp{}, *blk_Value, *blk_Multiplier);
+		}
+
+	private:
+		const StreamBlock* blk_Value = nullptr;
+		const StreamBlock* blk_Multiplier = nullptr;
+		float* blk_Out = nullptr;
 	};
 
 	//==========================================================================
@@ -85,6 +155,29 @@ namespace Beyond::SoundGraph
 			else
 				out_Out = (*in_Value) / (*in_Denominator);
 		}
+
+		bool CanProcessBlock() const final { return std::is_same_v<T, float>; }
+
+		void BindBlockStreams(BlockStreams& streams) final
+		{
+			if constexpr (std::is_same_v<T, float>)
+			{
+				blk_Value = streams.In(in_Value);
+				blk_Denominator = streams.In(in_Denominator);
+				blk_Out = streams.Out(out_Out);
+			}
+		}
+
+		void ProcessBlock(uint32_t numFrames) final
+		{
+			if constexpr (std::is_same_v<T, float>)
+				BlockKernels::Map(blk_Out, numFrames, BlockKernels::DivideOp{}, *blk_Value, *blk_Denominator);
+		}
+
+	private:
+		const StreamBlock* blk_Value = nullptr;
+		const StreamBlock* blk_Denominator = nullptr;
+		float* blk_Out = nullptr;
 	};
 
 	//==========================================================================
@@ -117,6 +210,25 @@ namespace Beyond::SoundGraph
 		{
 			out_Out = glm::pow((*in_Base), (*in_Exponent));
 		}
+
+		bool CanProcessBlock() const final { return true; }
+
+		void BindBlockStreams(BlockStreams& streams) final
+		{
+			blk_Base = streams.In(in_Base);
+			blk_Exponent = streams.In(in_Exponent);
+			blk_Out = streams.Out(out_Out);
+		}
+
+		void ProcessBlock(uint32_t numFrames) final
+		{
+			BlockKernels::Map(blk_Out, numFrames, [](float base, float exponent) { return glm::pow(base, exponent); }, *blk_Base, *blk_Exponent);
+		}
+
+	private:
+		const StreamBlock* blk_Base = nullptr;
+		const StreamBlock* blk_Exponent = nullptr;
+		float* blk_Out = nullptr;
 	};
 
 	//==========================================================================
@@ -133,6 +245,25 @@ namespace Beyond::SoundGraph
 		{
 			out_Out = glm::log((*in_Value), (*in_Base));
 		}
+
+		bool CanProcessBlock() const final { return true; }
+
+		void BindBlockStreams(BlockStreams& streams) final
+		{
+			blk_Base = streams.In(in_Base);
+			blk_Value = streams.In(in_Value);
+			blk_Out = streams.Out(out_Out);
+		}
+
+		void ProcessBlock(uint32_t numFrames) final
+		{
+			BlockKernels::Map(blk_Out, numFrames, [](float base, float value) { return glm::log(value, base); }, *blk_Base, *blk_Value);
+		}
+
+	private:
+		const StreamBlock* blk_Base = nullptr;
+		const StreamBlock* blk_Value = nullptr;
+		float* blk_Out = nullptr;
 	};
 
 	//==========================================================================
@@ -157,6 +288,36 @@ namespace Beyond::SoundGraph
 			const float octaveRange = glm::log2(*in_MaxFrequency / *in_MinFrequency);
 			out_Frequency = glm::exp2(normalizedValue * octaveRange) * (*in_MinFrequency);
 		}
+
+		bool CanProcessBlock() const final { return true; }
+
+		void BindBlockStreams(BlockStreams& streams) final
+		{
+			blk_Value = streams.In(in_Value);
+			blk_Min = streams.In(in_Min);
+			blk_Max = streams.In(in_Max);
+			blk_MinFrequency = streams.In(in_MinFrequency);
+			blk_MaxFrequency = streams.In(in_MaxFrequency);
+			blk_Frequency = streams.Out(out_Frequency);
+		}
+
+		void ProcessBlock(uint32_t numFrames) final
+		{
+			BlockKernels::Map(blk_Frequency, numFrames, [](float value, float min, float max, float minFrequency, float maxFrequency)
+			{
+				const float normalizedValue = (value - min) / (max - min);
+				const float octaveRange = glm::log2(maxFrequency / minFrequency);
+				return glm::exp2(normalizedValue * octaveRange) * minFrequency;
+			}, *blk_Value, *blk_Min, *blk_Max, *blk_MinFrequency, *blk_MaxFrequency);
+		}
+
+	private:
+		const StreamBlock* blk_Value = nullptr;
+		const StreamBlock* blk_Min = nullptr;
+		const StreamBlock* blk_Max = nullptr;
+		const StreamBlock* blk_MinFrequency = nullptr;
+		const StreamBlock* blk_MaxFrequency = nullptr;
+		float* blk_Frequency = nullptr;
 	};
 	
 	//==========================================================================
@@ -185,6 +346,37 @@ namespace Beyond::SoundGraph
 			//? would use cached inverse octave range if we were able to cache values
 			//out_Value = octavesBetweenMinAndTarget * (1.0f / octaveRange) * valueRange + *in_Min;
 		}
+
+		bool CanProcessBlock() const final { return true; }
+
+		void BindBlockStreams(BlockStreams& streams) final
+		{
+			blk_Frequency = streams.In(in_Frequency);
+			blk_MinFrequency = streams.In(in_MinFrequency);
+			blk_MaxFrequency = streams.In(in_MaxFrequency);
+			blk_Min = streams.In(in_Min);
+			blk_Max = streams.In(in_Max);
+			blk_Value = streams.Out(out_Value);
+		}
+
+		void ProcessBlock(uint32_t numFrames) final
+		{
+			BlockKernels::Map(blk_Value, numFrames, [](float frequency, float minFrequency, float maxFrequency, float min, float max)
+			{
+				const float octavesBetweenMinAndTarget = glm::log2(frequency / minFrequency);
+				const float octaveRange = 1.0f / glm::log2(maxFrequency / minFrequency);
+				const float valueRange = (max - min);
+				return octavesBetweenMinAndTarget / octaveRange * valueRange + min;
+			}, *blk_Frequency, *blk_MinFrequency, *blk_MaxFrequency, *blk_Min, *blk_Max);
+		}
+
+	private:
+		const StreamBlock* blk_Frequency = nullptr;
+		const StreamBlock* blk_MinFrequency = nullptr;
+		const StreamBlock* blk_MaxFrequency = nullptr;
+		const StreamBlock* blk_Min = nullptr;
+		const StreamBlock* blk_Max = nullptr;
+		float* blk_Value = nullptr;
 	};
 
 	//==========================================================================
@@ -203,6 +395,29 @@ namespace Beyond::SoundGraph
 		{
 			out_Value = glm::min((*in_A), (*in_B));
 		}
+
+		bool CanProcessBlock() const final { return std::is_same_v<T, float>; }
+
+		void BindBlockStreams(BlockStreams& streams) final
+		{
+			if constexpr (std::is_same_v<T, float>)
+			{
+				blk_A = streams.In(in_A);
+				blk_B = streams.In(in_B);
+				blk_Value = streams.Out(out_Value);
+			}
+		}
+
+		void ProcessBlock(uint32_t numFrames) final
+		{
+			if constexpr (std::is_same_v<T, float>)
+				BlockKernels::Map(blk_Value, numFrames, BlockKernels::MinOp{}, *blk_A, *blk_B);
+		}
+
+	private:
+		const StreamBlock* blk_A = nullptr;
+		const StreamBlock* blk_B = nullptr;
+		float* blk_Value = nullptr;
 	};
 
 	//==========================================================================
@@ -221,6 +436,29 @@ namespace Beyond::SoundGraph
 		{
 			out_Value = glm::max((*in_A), (*in_B));
 		}
+
+		bool CanProcessBlock() const final { return std::is_same_v<T, float>; }
+
+		void BindBlockStreams(BlockStreams& streams) final
+		{
+			if constexpr (std::is_same_v<T, float>)
+			{
+				blk_A = streams.In(in_A);
+				blk_B = streams.In(in_B);
+				blk_Value = streams.Out(out_Value);
+			}
+		}
+
+		void ProcessBlock(uint32_t numFrames) final
+		{
+			if constexpr (std::is_same_v<T, float>)
+				BlockKernels::Map(blk_Value, numFrames, BlockKernels::MaxOp{}, *blk_A, *blk_B);
+		}
+
+	private:
+		const StreamBlock* blk_A = nullptr;
+		const StreamBlock* blk_B = nullptr;
+		float* blk_Value = nullptr;
 	};
 
 	//==========================================================================
@@ -240,6 +478,31 @@ namespace Beyond::SoundGraph
 		{
 			out_Value = glm::clamp((*in_In), (*in_Min), (*in_Max));
 		}
+
+		bool CanProcessBlock() const final { return std::is_same_v<T, float>; }
+
+		void BindBlockStreams(BlockStreams& streams) final
+		{
+			if constexpr (std::is_same_v<T, float>)
+			{
+				blk_In = streams.In(in_In);
+				blk_Min = streams.In(in_Min);
+				blk_Max = streams.In(in_Max);
+				blk_Value = streams.Out(out_Value);
+			}
+		}
+
+		void ProcessBlock(uint32_t numFrames) final
+		{
+			if constexpr (std::is_same_v<T, float>)
+				BlockKernels::Map(blk_Value, numFrames, BlockKernels::ClampOp{}, *blk_In, *blk_Min, *blk_Max);
+		}
+
+	private:
+		const StreamBlock* blk_In = nullptr;
+		const StreamBlock* blk_Min = nullptr;
+		const StreamBlock* blk_Max = nullptr;
+		float* blk_Value = nullptr;
 	};
 
 	//==========================================================================
@@ -267,6 +530,35 @@ namespace Beyond::SoundGraph
 
 			out_Value = glm::mix((*in_OutRangeA), (*in_OutRangeB), t);
 		}
+
+		bool CanProcessBlock() const final { return std::is_same_v<T, float>; }
+
+		void BindBlockStreams(BlockStreams& streams) final
+		{
+			if constexpr (std::is_same_v<T, float>)
+			{
+				blk_In = streams.In(in_In);
+				blk_InRangeA = streams.In(in_InRangeA);
+				blk_InRangeB = streams.In(in_InRangeB);
+				blk_OutRangeA = streams.In(in_OutRangeA);
+				blk_OutRangeB = streams.In(in_OutRangeB);
+				blk_Value = streams.Out(out_Value);
+			}
+		}
+
+		void ProcessBlock(uint32_t numFrames) final
+		{
+			if constexpr (std::is_same_v<T, float>)
+				BlockKernels::Map(blk_Value, numFrames, BlockKernels::MapRangeOp{ *in_Clamped }, *blk_In, *blk_InRangeA, *blk_InRangeB, *blk_OutRangeA, *blk_OutRangeB);
+		}
+
+	private:
+		const StreamBlock* blk_In = nullptr;
+		const StreamBlock* blk_InRangeA = nullptr;
+		const StreamBlock* blk_InRangeB = nullptr;
+		const StreamBlock* blk_OutRangeA = nullptr;
+		const StreamBlock* blk_OutRangeB = nullptr;
+		float* blk_Value = nullptr;
 	};
 
 } //Beyond::SoundGraph
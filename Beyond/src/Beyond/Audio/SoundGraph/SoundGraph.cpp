@@ -1,8 +1,360 @@
 #include <pch.h>
 #include "SoundGraph.h"
+#include "SoundGraphFactory.h"
+#include "Nodes/NodeDescriptors.h"
+
+#include "Beyond/Debug/Profiler.h"
+
+#include <queue>
+#include <unordered_set>
 
 namespace Beyond::SoundGraph
 {
+	void SoundGraph::SortNodes()
+	{
+		const uint32_t nodeCount = (uint32_t)Nodes.size();
+
+		std::unordered_map<const void*, uint32_t> outputOwners;
+		for (uint32_t i = 0; i < nodeCount; ++i)
+		{
+			for (auto& [id, out] : Nodes[i]->Outs)
+				outputOwners.try_emplace(out.getRawData(), i);
+		}
+
+		std::vector<std::vector<uint32_t>> dependents(nodeCount);
+		std::vector<uint32_t> dependencyCount(nodeCount, 0);
+		for (uint32_t i = 0; i < nodeCount; ++i)
+		{
+			for (auto& [id, in] : Nodes[i]->Ins)
+			{
+				auto owner = outputOwners.find(in.getRawData());
+				if (owner != outputOwners.end() && owner->second != i)
+				{
+					dependents[owner->second].push_back(i);
+					++dependencyCount[i];
+				}
+			}
+		}
+
+		// Always taking the earliest added node that's ready keeps the order of adding if it's topological already
+		std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> ready;
+		for (uint32_t i = 0; i < nodeCount; ++i)
+		{
+			if (dependencyCount[i] == 0)
+				ready.push(i);
+		}
+
+		ProcessingOrder.clear();
+		ProcessingOrder.reserve(nodeCount);
+		std::vector<bool> ordered(nodeCount, false);
+		while (!ready.empty())
+		{
+			const uint32_t i = ready.top();
+			ready.pop();
+
+			ProcessingOrder.push_back(Nodes[i].get());
+			ordered[i] = true;
+
+			for (uint32_t dependent : dependents[i])
+			{
+				if (--dependencyCount[dependent] == 0)
+					ready.push(dependent);
+			}
+		}
+
+		if (ProcessingOrder.size() != nodeCount)
+		{
+			BEY_CORE_WARN_TAG("SoundGraph", "Graph '{}' has cyclic value connections, processing the rest of the nodes in the order they were added", dbgName);
+			for (uint32_t i = 0; i < nodeCount; ++i)
+			{
+				if (!ordered[i])
+					ProcessingOrder.push_back(Nodes[i].get());
+			}
+		}
+	}
+
+	void SoundGraph::InitBlockProcessing(uint32_t maxBlockSize)
+	{
+		BEY_PROFILE_FUNC();
+		BEY_CORE_ASSERT(bIsInitialized && maxBlockSize > 0);
+
+		MaxBlockSize = maxBlockSize;
+		Streams.Streams.clear();
+		BlockFrames.clear();
+		BlockStages.clear();
+		BlockInterpolatedInputs.clear();
+		BlockOutputChannels.clear();
+
+		const uint32_t nodeCount = (uint32_t)ProcessingOrder.size();
+
+		std::unordered_map<const void*, uint32_t> outputOwners;
+		for (uint32_t i = 0; i < nodeCount; ++i)
+		{
+			for (auto& [id, out] : ProcessingOrder[i]->Outs)
+				outputOwners.try_emplace(out.getRawData(), i);
+		}
+		auto getOwner = [&outputOwners](const void* endpoint) -> int32_t
+		{
+			auto owner = outputOwners.find(endpoint);
+			return owner != outputOwners.end() ? (int32_t)owner->second : -1;
+		};
+
+		std::unordered_map<const NodeProcessor*, uint32_t> nodeIndices;
+		for (uint32_t i = 0; i < nodeCount; ++i)
+			nodeIndices[ProcessingOrder[i]] = i;
+
+		// Events sent between nodes must arrive on the frame they're sent on,
+		// so both ends are processed per sample and in the same stage
+		std::vector<std::vector<uint32_t>> sameStageLinks(nodeCount);
+		std::vector<bool> perSample(nodeCount, false);
+		for (uint32_t i = 0; i < nodeCount; ++i)
+		{
+			for (auto& [id, out] : ProcessingOrder[i]->OutEvs)
+			{
+				for (auto& destination : out.DestinationEvs)
+				{
+					// Routes to the graph's own output events are fine
+					auto target = nodeIndices.find(destination->node);
+					if (target == nodeIndices.end())
+						continue;
+
+					sameStageLinks[i].push_back(target->second);
+					sameStageLinks[target->second].push_back(i);
+					perSample[i] = true;
+					perSample[target->second] = true;
+				}
+			}
+		}
+
+		std::vector<std::vector<uint32_t>> valueSources(nodeCount);
+		for (uint32_t i = 0; i < nodeCount; ++i)
+		{
+			NodeProcessor* node = ProcessingOrder[i];
+
+			bool canProcessBlock = node->CanProcessBlock();
+			for (auto& [id, out] : node->OutEvs)
+				canProcessBlock = canProcessBlock && out.DestinationEvs.empty(); // Would be sent on the wrong frame
+
+			for (auto& [id, in] : node->Ins)
+			{
+				const int32_t owner = getOwner(in.getRawData());
+				if (owner == -1 || owner == (int32_t)i)
+					continue;
+
+				valueSources[i].push_back((uint32_t)owner);
+
+				// Only float streams have frames, others are read by per sample nodes of the same stage
+				if (!in.isFloat32())
+				{
+					canProcessBlock = false;
+					sameStageLinks[i].push_back((uint32_t)owner);
+					sameStageLinks[owner].push_back(i);
+				}
+			}
+
+			perSample[i] = perSample[i] || !canProcessBlock;
+		}
+
+		// Stages alternate between per sample (even) and block processed (odd) nodes. A node goes into
+		// the first stage of its kind after all of its sources, linked nodes into the same stage.
+		std::vector<uint32_t> stages(nodeCount, 0);
+		bool converged = false;
+		for (uint32_t iteration = 0; !converged && iteration <= 2 * nodeCount + 1; ++iteration)
+		{
+			converged = true;
+			for (uint32_t i = 0; i < nodeCount; ++i)
+			{
+				uint32_t stage = stages[i];
+				for (uint32_t source : valueSources[i])
+					stage = glm::max(stage, stages[source]);
+				for (uint32_t linked : sameStageLinks[i])
+					stage = glm::max(stage, stages[linked]);
+
+				if ((stage % 2 == 0) != perSample[i])
+					++stage;
+
+				if (stage != stages[i])
+				{
+					stages[i] = stage;
+					converged = false;
+				}
+			}
+		}
+
+		if (!converged)
+		{
+			// Linked nodes with block processed nodes in between, can't split this graph
+			BEY_CORE_WARN_TAG("SoundGraph", "Graph '{}' is processed per sample, its event and non-float connections can't be separated from its block processed nodes", dbgName);
+			std::fill(perSample.begin(), perSample.end(), true);
+			std::fill(stages.begin(), stages.end(), 0);
+		}
+
+		const uint32_t stageCount = nodeCount > 0 ? *std::max_element(stages.begin(), stages.end()) + 1 : 0;
+		std::vector<int32_t> stageIndices(stageCount, -1);
+		for (uint32_t stage = 0; stage < stageCount; ++stage)
+		{
+			for (uint32_t i = 0; i < nodeCount; ++i)
+			{
+				if (stages[i] != stage)
+					continue;
+
+				if (stageIndices[stage] == -1)
+				{
+					stageIndices[stage] = (int32_t)BlockStages.size();
+					BlockStages.emplace_back().PerSample = stage % 2 == 0;
+				}
+				BlockStages[stageIndices[stage]].Nodes.push_back(ProcessingOrder[i]);
+			}
+		}
+
+		// Streams with frames: outputs of block processed nodes, per sample outputs read
+		// outside of their stage or by the graph outputs and the interpolated graph inputs
+		struct FramesOwner
+		{
+			float* Endpoint;
+			int32_t GatherStage; // -1 unless written by a per sample stage
+		};
+		std::vector<FramesOwner> framesOwners;
+		std::unordered_set<const void*> hasFrames;
+
+		auto addPerSampleOutput = [&](void* endpoint, int32_t readingStage)
+		{
+			const int32_t owner = getOwner(endpoint);
+			if (owner == -1 || !perSample[owner] || (int32_t)stages[owner] == readingStage || !hasFrames.insert(endpoint).second)
+				return;
+
+			framesOwners.push_back({ (float*)endpoint, stageIndices[stages[owner]] });
+		};
+
+		for (uint32_t i = 0; i < nodeCount; ++i)
+		{
+			if (!perSample[i])
+			{
+				for (auto& [id, out] : ProcessingOrder[i]->Outs)
+				{
+					BEY_CORE_ASSERT(out.isFloat32(), "Block processed nodes must only have float outputs");
+					if (hasFrames.insert(out.getRawData()).second)
+						framesOwners.push_back({ (float*)out.getRawData(), -1 });
+				}
+			}
+
+			for (auto& [id, in] : ProcessingOrder[i]->Ins)
+			{
+				if (in.isFloat32())
+					addPerSampleOutput(in.getRawData(), (int32_t)stages[i]);
+			}
+		}
+
+		for (const Identifier& channel : OutputChannelIDs)
+			addPerSampleOutput(EndpointOutputStreams.InValue(channel).getRawData(), -1);
+
+		const size_t framesStride = (maxBlockSize + 3) & ~3u;
+		BlockFrames.resize((framesOwners.size() + InterpInputs.size()) * framesStride, 0.0f);
+
+		float* frames = BlockFrames.data();
+		for (const FramesOwner& owner : framesOwners)
+		{
+			StreamBlock& stream = Streams.Streams[owner.Endpoint];
+			stream = { owner.Endpoint, frames };
+			frames += framesStride;
+
+			if (owner.GatherStage != -1)
+				BlockStages[owner.GatherStage].Gather.push_back(&stream);
+		}
+
+		for (auto& [id, interpolatedValue] : InterpInputs)
+		{
+			float* endpoint = (float*)interpolatedValue.endpoint->outV.getRawData();
+			StreamBlock& stream = Streams.Streams[endpoint];
+			stream = { endpoint, nullptr };
+
+			BlockInterpolatedInputs.push_back({ &interpolatedValue, &stream, frames });
+			frames += framesStride;
+		}
+
+		for (BlockStage& stage : BlockStages)
+		{
+			if (!stage.PerSample)
+				continue;
+
+			// Everything in the stream table by now has frames, at least in some blocks
+			std::unordered_set<StreamBlock*> scatter;
+			for (NodeProcessor* node : stage.Nodes)
+			{
+				for (auto& [id, in] : node->Ins)
+				{
+					auto stream = Streams.Streams.find((const float*)in.getRawData());
+					if (stream != Streams.Streams.end() && std::find(stage.Gather.begin(), stage.Gather.end(), &stream->second) == stage.Gather.end())
+						scatter.insert(&stream->second);
+				}
+			}
+			stage.Scatter.assign(scatter.begin(), scatter.end());
+		}
+
+		for (BlockStage& stage : BlockStages)
+		{
+			if (!stage.PerSample)
+			{
+				for (NodeProcessor* node : stage.Nodes)
+					node->BindBlockStreams(Streams);
+			}
+		}
+
+		for (const Identifier& channel : OutputChannelIDs)
+			BlockOutputChannels.push_back(Streams.In((float*)EndpointOutputStreams.InValue(channel).getRawData()));
+	}
+
+	void SoundGraph::ProcessBlock(uint32_t numFrames)
+	{
+		BEY_CORE_ASSERT(numFrames <= MaxBlockSize);
+
+		for (BlockInterpolatedInput& input : BlockInterpolatedInputs)
+		{
+			if (input.Value->steps > 0)
+			{
+				for (uint32_t i = 0; i < numFrames; ++i)
+				{
+					input.Value->Process();
+					input.Frames[i] = input.Value->current;
+				}
+				input.Stream->Frames = input.Frames;
+			}
+			else
+			{
+				input.Stream->Frames = nullptr;
+			}
+		}
+
+		const uint64_t blockStartFrame = CurrentFrame;
+		for (BlockStage& stage : BlockStages)
+		{
+			if (!stage.PerSample)
+			{
+				for (NodeProcessor* node : stage.Nodes)
+					node->ProcessBlock(numFrames);
+				continue;
+			}
+
+			for (uint32_t i = 0; i < numFrames; ++i)
+			{
+				// Outgoing events are stamped with the frame they're sent on
+				CurrentFrame = blockStartFrame + i;
+
+				for (StreamBlock* stream : stage.Scatter)
+				{
+					if (stream->Frames)
+						*stream->Value = stream->Frames[i];
+				}
+
+				for (NodeProcessor* node : stage.Nodes)
+					node->Process();
+
+				for (StreamBlock* stream : stage.Gather)
+					stream->Frames[i] = *stream->Value;
+			}
+		}
 
+		CurrentFrame = blockStartFrame + numFrames;
+	}
 
 } // namespace Beyond::SoundGraph
@@ -342,6 +342,8 @@ namespace Beyond::SoundGraph
 			for (auto& node : Nodes)
 				node->Init();
 
+			SortNodes();
+
 			bIsInitialized = true;
 		}
 
@@ -356,12 +358,29 @@ namespace Beyond::SoundGraph
 			for (std::pair<const Identifier, InterpolatedValue>& interpValue : InterpInputs)
 				interpValue.second.Process();
 
-			for (auto& node : Nodes)
-				node->Process(); //? This unique_ptr-> access is very heavy to do every frame
+			for (NodeProcessor* node : ProcessingOrder)
+				node->Process();
 
 			++CurrentFrame;
 		}
 
+		//==============================================================================
+		/// Block processing
+
+		/** Prepares processing blocks of up to maxBlockSize frames with ProcessBlock(),
+			must be called after Init(). Nodes that can process whole blocks do so, nodes
+			connected to other nodes' events are still processed per sample.
+		*/
+		void InitBlockProcessing(uint32_t maxBlockSize);
+
+		/** Same as calling Process() numFrames times, numFrames must not exceed the max block size.
+			The frames of the output channels are in GetOutputChannelBlock() afterwards.
+		*/
+		void ProcessBlock(uint32_t numFrames) final;
+
+		uint32_t GetMaxBlockSize() const { return MaxBlockSize; }
+		const StreamBlock& GetOutputChannelBlock(uint32_t channel) const { return *BlockOutputChannels[channel]; }
+
 		// This should reset nodes to their initial state
 		void Reinit()
 		{
@@ -476,10 +495,41 @@ namespace Beyond::SoundGraph
 			}
 		}
 
+	private:
+		/** Orders nodes so that every node comes after the nodes it reads values from. */
+		void SortNodes();
+
 	private:
 		bool bIsInitialized = false;
 		uint64_t CurrentFrame = 0;
 
+		// Nodes in topological order, ties keep the order of adding to the graph
+		std::vector<NodeProcessor*> ProcessingOrder;
+
+		// Consecutive nodes of the processing order that are either all processed in blocks or all per sample
+		struct BlockStage
+		{
+			std::vector<NodeProcessor*> Nodes;
+			bool PerSample = false;
+
+			std::vector<StreamBlock*> Scatter; // Streams with frames read by the nodes of a per sample stage
+			std::vector<StreamBlock*> Gather; // Outputs of a per sample stage read by block processed nodes or the graph outputs
+		};
+
+		struct BlockInterpolatedInput
+		{
+			InterpolatedValue* Value;
+			StreamBlock* Stream;
+			float* Frames;
+		};
+
+		uint32_t MaxBlockSize = 0;
+		BlockStreams Streams;
+		std::vector<float> BlockFrames;
+		std::vector<BlockStage> BlockStages;
+		std::vector<BlockInterpolatedInput> BlockInterpolatedInputs;
+		std::vector<const StreamBlock*> BlockOutputChannels;
+
 		// TODO: provide access to outgoing messages and events queues thoughout the graph
 		struct OutgoingEvent
 		{
@@ -60,6 +60,7 @@ namespace Beyond
 
         // Reset Finished flag so that we don't accidentally release this voice again while it's starting for the new source
         bFinished = false;
+        bVirtual = false;
 
         // TODO: handle passing in different flags for decoding (from data source asset)
         // TODO: and handle decoding somewhere else, in some other way
@@ -67,7 +68,8 @@ namespace Beyond
         if (!config->DataSourceAsset)
             return false;
 
-		
+        m_Priority = config->Priority;
+
         AssetType type = AssetManager::GetAssetType(config->DataSourceAsset);
         if (type != AssetType::SoundGraphSound)
         {
@@ -173,6 +175,7 @@ namespace Beyond
                                        &m_MasterSplitter);
 
         BEY_CORE_ASSERT(result == MA_SUCCESS);
+        NodeProfiler::SetNodeName(&m_MasterSplitter, "Reverb Send");
 
         // Store the node the sound was connected to
         auto* oldOutput = currentHeaderNode->pOutputBuses[0].pInputNode;
@@ -225,6 +228,7 @@ namespace Beyond
             m_LowPass.Uninitialize();
             m_HighPass.Uninitialize();
 
+            bVirtual = false;
             bIsReadyToPlay = false;
         }
     }
@@ -672,6 +676,16 @@ namespace Beyond
         return GetCurrentFadeVolume() * ((float)m_Priority / 255.0f);
     }
 
+    void SoundGraphSound::SetVirtual(bool isVirtual)
+    {
+        if (isVirtual == bVirtual || !bIsReadyToPlay)
+            return;
+
+        // Splitter is the last node of the voice, nodes feeding it are not processed while it's stopped
+        ma_node_set_state(&m_MasterSplitter, isVirtual ? ma_node_state_stopped : ma_node_state_started);
+        bVirtual = isVirtual;
+    }
+
     float SoundGraphSound::GetPlaybackPercentage()
     {
         //! SoundGraph doesn't have a notion of playback progress.
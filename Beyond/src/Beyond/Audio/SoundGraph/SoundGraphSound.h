@@ -107,6 +107,12 @@ namespace Beyond
 
         ESoundPlayState GetPlayState() const override { return m_PlayState; }
 
+        /* Stops processing of the graph and effects of this voice. SoundGraph has no notion
+           of playback position, virtual voice continues from where it was virtualized.
+        */
+        virtual void SetVirtual(bool isVirtual) override;
+        virtual bool IsVirtual() const override { return bVirtual; }
+
     private:
         /* Stop playback with short fade-out to prevent click.
 		   @param numSamples - length of the fade-out in PCM frames
@@ -163,11 +169,12 @@ namespace Beyond
 
         bool bIsReadyToPlay = false;
 
-        // TODO
+        /* Priority of the SoundConfig this voice plays. */
         uint8_t m_Priority = 64;
 
         bool bLooping = false;
         bool bFinished = false;
+        bool bVirtual = false;
 
         /* Stored Fader "resting" value. Used to restore Fader before restarting playback if a fade has occured. */
         float m_StoredFaderValue = 1.0f;
@@ -2,6 +2,7 @@
 #include "SoundGraphSource.h"
 #include "WaveSource.h"
 
+#include "Beyond/Audio/OfflineRender.h"
 #include "Beyond/Core/Hash.h"
 #include "Beyond/Debug/Profiler.h"
 
@@ -120,6 +121,9 @@ namespace Beyond
         result = ma_engine_node_init(&nodeConfig, nullptr, &m_EngineNode);
         BEY_CORE_ASSERT(result == MA_SUCCESS);
 
+        Audio::NodeProfiler::SetNodeName(GetNode(), "SoundGraph");
+        Audio::NodeProfiler::SetNodeName(&m_EngineNode, "SoundGraph Voice");
+
         result = ma_node_attach_output_bus(GetNode(), 0u, &m_EngineNode, 0u);
         BEY_CORE_ASSERT(result == MA_SUCCESS);
 
@@ -181,17 +185,21 @@ namespace Beyond
                 // Refill buffers of WavePlayers
                 m_Graph->BeginProcessBlock();
                 
-                for (uint32_t i = 0; i < numFrames; ++i)
+                for (uint32_t offset = 0; offset < numFrames;)
                 {
-                    m_Graph->Process();
+                    const uint32_t blockFrames = glm::min(numFrames - offset, m_Graph->GetMaxBlockSize());
+                    m_Graph->ProcessBlock(blockFrames);
 
                     for (uint32_t ch = 0; ch < numOutChannels; ++ch)
                     {
                         // read data from the graph's endpoint to the output of this audio callback
-                        const Identifier& id = m_Graph->OutputChannelIDs[ch];
-                        const float sample = *(float*)(m_Graph->EndpointOutputStreams.InValue(id).getRawData());
-                        mainOutputBus[i * numOutChannels + ch] = sample;
+                        const SoundGraph::StreamBlock& channel = m_Graph->GetOutputChannelBlock(ch);
+                        float* out = mainOutputBus + offset * numOutChannels + ch;
+                        for (uint32_t i = 0; i < blockFrames; ++i)
+                            out[i * numOutChannels] = channel[i];
                     }
+
+                    offset += blockFrames;
                 }
 
                 m_Graph->HandleOutgoingEvents(this, HandleEvent, HandleConsole);
@@ -279,6 +287,7 @@ namespace Beyond
         m_Graph->SetRefillWavePlayerBufferCallback(&RefillWavePlayerBuffer, &m_DataSourceMap, m_BlockSize);
 
         m_Graph->Init();
+        m_Graph->InitBlockProcessing(m_BlockSize);
 
         UpdateParameterSet();
     }
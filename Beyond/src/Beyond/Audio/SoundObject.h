@@ -66,6 +66,8 @@ namespace Beyond
         float LPFilterValue = 1.0f;
         float HPFilterValue = 0.0f;
 
+        uint8_t Priority = 64;                  // Voices with higher priority are kept real when the voice limit is reached
+
         static AssetType GetStaticType() { return AssetType::SoundConfig; }
         virtual AssetType GetAssetType() const override { return GetStaticType(); }
     };
@@ -122,6 +124,10 @@ namespace Beyond
         virtual float GetPriority() = 0;
         virtual float GetPlaybackPercentage() = 0;
 
+        /* Virtual voices keep their play state, but are not processed by the audio render thread. */
+        virtual void SetVirtual(bool isVirtual) = 0;
+        virtual bool IsVirtual() const = 0;
+
         virtual void ReleaseResources() = 0;
     };
 
@@ -173,6 +179,9 @@ namespace Beyond
         float GetPriority()             { return m_Sound->GetPriority(); }
         float GetPlaybackPercentage()   { return m_Sound->GetPlaybackPercentage(); }
 
+        void SetVirtual(bool isVirtual) { m_Sound->SetVirtual(isVirtual); }
+        bool IsVirtual() const          { return m_Sound->IsVirtual(); }
+
         // Parameter Interface
         void SetParameter(uint32_t parameterID, float value){ m_Sound->SetParameter(parameterID, value); }
         void SetParameter(uint32_t parameterID, int value)  { m_Sound->SetParameter(parameterID, value); }
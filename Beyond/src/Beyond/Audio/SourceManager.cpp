@@ -47,7 +47,7 @@ namespace Beyond
 
     void SourceManager::Initialize()
     {
-        m_Spatializer->Initialize(&m_AudioEngine.m_Engine);
+        m_Spatializer->Initialize(&m_AudioEngine.m_Engine, (uint32_t)m_AudioEngine.m_NumSources);
 	}
 
     void SourceManager::UninitializeEffects()
@@ -0,0 +1,286 @@
+#include "pch.h"
+#include "StreamingManager.h"
+
+#include "Beyond/Debug/Profiler.h"
+#include "Beyond/Utilities/StringUtils.h"
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+namespace Beyond::Audio
+{
+	static constexpr uint64_t s_MinStreamBufferFrames = 2048;
+
+	//==============================================================================
+	/// AudioStream
+
+	uint64_t AudioStream::Read(float* destination, uint64_t numFrames, uint64_t readPosition, uint64_t loopStart)
+	{
+		BEY_CORE_ASSERT(destination != nullptr);
+
+		if (numFrames == 0)
+			return 0;
+
+		const uint64_t totalFrames = (uint64_t)m_TotalFrames;
+		if (loopStart >= totalFrames)
+			loopStart = 0;
+
+		// Positions past the end continue from the loop start, the same way the stream is decoded
+		auto wrap = [totalFrames, loopStart](uint64_t frame) { return frame < totalFrames ? frame : loopStart + (frame - totalFrames) % (totalFrames - loopStart); };
+		readPosition = wrap(readPosition);
+
+		if (readPosition != m_NextFrame || loopStart != m_LoopStart)
+		{
+			m_NextFrame = readPosition;
+			m_LoopStart = loopStart;
+			m_SkipFrames = 0;
+
+			m_SeekFrame.store(readPosition, std::memory_order_relaxed);
+			m_SeekLoopStart.store(loopStart, std::memory_order_relaxed);
+			m_SeekRequest.fetch_add(1);
+		}
+
+		// Available frames must be loaded before the acknowledgement, the I/O thread
+		// only writes frames of the new position after acknowledging the seek.
+		uint64_t available = m_Ring.AvailableToRead() / NumChannels;
+		if (m_SeekAcknowledged.load() != m_SeekRequest.load(std::memory_order_relaxed))
+		{
+			// Frames of the old position, the I/O thread waits for them to be gone
+			m_Ring.Skip(available * NumChannels);
+			available = 0;
+		}
+		else if (m_SkipFrames > 0)
+		{
+			const uint64_t skipped = m_Ring.Skip(std::min(m_SkipFrames, available) * NumChannels) / NumChannels;
+			m_SkipFrames -= skipped;
+			available -= skipped;
+		}
+
+		const uint64_t framesRead = m_Ring.Read(destination, std::min(numFrames, available) * NumChannels) / NumChannels;
+		if (framesRead < numFrames)
+		{
+			const uint64_t missing = numFrames - framesRead;
+			std::memset(destination + framesRead * NumChannels, 0, missing * NumChannels * sizeof(float));
+
+			// Keep the position in the file, the missing frames are dropped when they arrive
+			m_SkipFrames += missing;
+			m_StarvedFrames.fetch_add(missing, std::memory_order_relaxed);
+			m_StarvedReads.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		m_NextFrame = wrap(m_NextFrame + numFrames);
+		return numFrames;
+	}
+
+	AudioStream::~AudioStream()
+	{
+		if (m_DecoderInitialized)
+			ma_decoder_uninit(&m_Decoder);
+	}
+
+	void AudioStream::Decode()
+	{
+		const uint32_t request = m_SeekRequest.load();
+		if (request != m_SeekServed)
+		{
+			// Wait for the audio render thread to drain the frames decoded for the old position
+			if (m_Ring.AvailableToRead() > 0)
+				return;
+
+			m_DecoderLoopStart = m_SeekLoopStart.load(std::memory_order_relaxed);
+			ma_decoder_seek_to_pcm_frame(&m_Decoder, m_SeekFrame.load(std::memory_order_relaxed));
+
+			m_SeekServed = request;
+			m_SeekAcknowledged.store(request);
+		}
+
+		bool readAnything = true;
+		while (true)
+		{
+			size_t count = 0;
+			float* region = m_Ring.PrepareWrite(count);
+			const uint64_t numFrames = count / NumChannels;
+			if (numFrames == 0)
+				break;
+
+			ma_uint64 framesRead = 0;
+			ma_decoder_read_pcm_frames(&m_Decoder, region, numFrames, &framesRead);
+			m_Ring.CommitWrite(framesRead * NumChannels);
+
+			if (framesRead < numFrames)
+			{
+				// Reached the end of the file, a file that reads nothing after looping is broken
+				if (framesRead == 0 && !readAnything)
+					break;
+
+				ma_decoder_seek_to_pcm_frame(&m_Decoder, m_DecoderLoopStart);
+			}
+			readAnything = framesRead > 0;
+		}
+	}
+
+	//==============================================================================
+	/// StreamingManager
+
+	StreamingManager::~StreamingManager()
+	{
+		Shutdown();
+	}
+
+	void StreamingManager::Initialize()
+	{
+		if (m_Running)
+			return;
+
+		m_Running = true;
+		m_IOThread = std::thread([this]
+		{
+			BEY_PROFILE_THREAD("AudioIOThread");
+#if defined(BEY_PLATFORM_WINDOWS)
+			SetThreadDescription(GetCurrentThread(), L"Beyond Audio I/O Thread");
+#endif
+			IOThreadLoop();
+		});
+	}
+
+	void StreamingManager::Shutdown()
+	{
+		if (!m_Running)
+			return;
+
+		m_Running = false;
+		m_Wake.notify_all();
+		m_IOThread.join();
+
+		std::scoped_lock lock{ m_StreamsLock };
+		for (auto& stream : m_Streams)
+			RemoveStream(*stream);
+
+		m_Streams.clear();
+	}
+
+	void StreamingManager::IOThreadLoop()
+	{
+		// Opening and closing streams doesn't wait for the streams to be decoded
+		std::vector<std::shared_ptr<AudioStream>> streams;
+		while (m_Running)
+		{
+			{
+				std::scoped_lock lock{ m_StreamsLock };
+				streams = m_Streams;
+			}
+
+			{
+				BEY_PROFILE_SCOPE("StreamingManager::Decode");
+				for (auto& stream : streams)
+					stream->Decode();
+			}
+
+			// Streams closed in the meantime are destroyed here
+			streams.clear();
+
+			// Streams hold much more than this, no need to wake up for every block
+			std::unique_lock lock{ m_StreamsLock };
+			m_Wake.wait_for(lock, 5ms, [this] { return !m_Running; });
+		}
+	}
+
+	AudioStream* StreamingManager::OpenStream(ma_resource_manager* resourceManager, AssetHandle waveAsset, const Config& config)
+	{
+		BEY_PROFILE_FUNC();
+
+		if (!m_Running)
+			return nullptr;
+
+		auto stream = std::make_shared<AudioStream>();
+		stream->m_Handle = waveAsset;
+
+		// We access audio files only by AssetHandle, stringified for miniaudio
+		const std::string sourceFile = std::to_string(waveAsset);
+		const uint32_t sampleRate = resourceManager->config.decodedSampleRate;
+
+		ma_decoder_config decoderConfig = ma_decoder_config_init(ma_format_f32, AudioStream::NumChannels, sampleRate);
+		ma_result result = ma_decoder_init_vfs(resourceManager->config.pVFS, sourceFile.c_str(), &decoderConfig, &stream->m_Decoder);
+		if (result != MA_SUCCESS)
+		{
+			BEY_CORE_ERROR_TAG("Audio", "StreamingManager: failed to open stream for audio file {0}", sourceFile);
+			return nullptr;
+		}
+		stream->m_DecoderInitialized = true;
+
+		ma_uint64 length = 0;
+		ma_decoder_get_length_in_pcm_frames(&stream->m_Decoder, &length);
+		if (length == 0)
+		{
+			BEY_CORE_ERROR_TAG("Audio", "StreamingManager: unknown length of audio file {0}, can't stream it", sourceFile);
+			return nullptr;
+		}
+		stream->m_TotalFrames = (int64_t)length;
+
+		const uint64_t bufferFrames = std::max(uint64_t(config.BufferDuration * sampleRate), s_MinStreamBufferFrames);
+		{
+			std::scoped_lock lock{ m_StreamsLock };
+			m_MemoryBudget = config.MemoryBudget;
+
+			const uint64_t size = bufferFrames * AudioStream::NumChannels * sizeof(float);
+			if (m_MemoryUsed + size > m_MemoryBudget)
+			{
+				BEY_CORE_WARN_TAG("Audio", "StreamingManager: memory budget of {0} exhausted, can't stream audio file {1}", Utils::BytesToString(m_MemoryBudget), sourceFile);
+				return nullptr;
+			}
+
+			m_MemoryUsed += size;
+		}
+
+		// Decoded ahead before the audio render thread reads from it
+		stream->m_Ring.Allocate(bufferFrames * AudioStream::NumChannels);
+		stream->Decode();
+
+		std::scoped_lock lock{ m_StreamsLock };
+		return m_Streams.emplace_back(std::move(stream)).get();
+	}
+
+	void StreamingManager::CloseStream(AudioStream* stream)
+	{
+		std::scoped_lock lock{ m_StreamsLock };
+
+		// Streams still open on shutdown have been closed already
+		auto it = std::find_if(m_Streams.begin(), m_Streams.end(), [stream](const auto& s) { return s.get() == stream; });
+		if (it == m_Streams.end())
+			return;
+
+		// The I/O thread may still be decoding it, the decoder and ring go with the last reference
+		RemoveStream(**it);
+		m_Streams.erase(it);
+	}
+
+	void StreamingManager::RemoveStream(AudioStream& stream)
+	{
+		m_ClosedStarvedReads += stream.m_StarvedReads.load(std::memory_order_relaxed);
+		m_ClosedStarvedFrames += stream.m_StarvedFrames.load(std::memory_order_relaxed);
+
+		m_MemoryUsed -= stream.m_Ring.GetSizeInBytes();
+	}
+
+	StreamingManager::Stats StreamingManager::GetStats() const
+	{
+		std::scoped_lock lock{ m_StreamsLock };
+
+		Stats stats;
+		stats.ActiveStreams = (uint32_t)m_Streams.size();
+		stats.MemoryUsed = m_MemoryUsed;
+		stats.MemoryBudget = m_MemoryBudget;
+		stats.StarvedReads = m_ClosedStarvedReads;
+		stats.StarvedFrames = m_ClosedStarvedFrames;
+
+		for (const auto& stream : m_Streams)
+		{
+			stats.StarvedReads += stream->m_StarvedReads.load(std::memory_order_relaxed);
+			stats.StarvedFrames += stream->m_StarvedFrames.load(std::memory_order_relaxed);
+		}
+
+		return stats;
+	}
+
+} // namespace Beyond::Audio
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "Beyond/Asset/Asset.h"
+#include "Beyond/Audio/Buffer/SPSCRingBuffer.h"
+
+#include "miniaudio_incl.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Beyond::Audio
+{
+	class StreamingManager;
+
+	//==============================================================================
+	/** Decoded audio file streamed from the I/O thread.
+
+		The I/O thread decodes ahead into a ring buffer, the audio render thread reads from it.
+		The stream loops from the loop start frame when it reaches the end of the file.
+		If the audio render thread reads faster than the stream is decoded the missing frames
+		are silent and counted as starved, the stream keeps its position in the file.
+	*/
+	class AudioStream
+	{
+	public:
+		static constexpr uint32_t NumChannels = 2; // Streams are decoded to interleaved stereo
+
+		AudioStream() = default;
+		AudioStream(const AudioStream&) = delete;
+		~AudioStream();
+
+		/** Called from audio render thread. Reads numFrames frames starting at readPosition in the file,
+			reading from a position other than where the last read ended seeks the stream.
+
+			@returns numFrames, missing frames are filled with silence
+		*/
+		uint64_t Read(float* destination, uint64_t numFrames, uint64_t readPosition, uint64_t loopStart);
+
+		int64_t GetTotalFrames() const noexcept { return m_TotalFrames; }
+		AssetHandle GetHandle() const noexcept { return m_Handle; }
+		uint64_t GetStarvedFrames() const noexcept { return m_StarvedFrames.load(std::memory_order_relaxed); }
+
+	private:
+		friend class StreamingManager;
+
+		/** Called from I/O thread, decodes into the free space of the ring buffer. */
+		void Decode();
+
+	private:
+		AssetHandle m_Handle = 0;
+		ma_decoder m_Decoder;
+		bool m_DecoderInitialized = false;
+		int64_t m_TotalFrames = 0;
+		SPSCRingBuffer<float> m_Ring;
+
+		// Seeking. Audio render thread requests a seek, the I/O thread acknowledges it
+		// once the old frames have been drained from the ring and the decoder has been moved.
+		std::atomic<uint32_t> m_SeekRequest{ 0 };
+		std::atomic<uint32_t> m_SeekAcknowledged{ 0 };
+		std::atomic<uint64_t> m_SeekFrame{ 0 };
+		std::atomic<uint64_t> m_SeekLoopStart{ 0 };
+
+		// Audio render thread
+		uint64_t m_NextFrame = 0;		// Frame in file the next frame in the ring belongs to
+		uint64_t m_LoopStart = 0;
+		uint64_t m_SkipFrames = 0;		// Frames played as silence while starving, dropped when they arrive
+
+		// I/O thread
+		uint32_t m_SeekServed = 0;
+		uint64_t m_DecoderLoopStart = 0;
+
+		std::atomic<uint64_t> m_StarvedFrames{ 0 };
+		std::atomic<uint32_t> m_StarvedReads{ 0 };
+	};
+
+	//==============================================================================
+	/** Owns the streams of long audio files and the I/O thread that keeps them decoded ahead.
+
+		Memory used by the streams is limited to a budget, opening a stream fails
+		when it would exceed it. Decoded memory no longer depends on file durations,
+		only on the number of streams and their buffer duration.
+	*/
+	class StreamingManager
+	{
+	public:
+		struct Config
+		{
+			uint64_t MemoryBudget = 32 * 1024 * 1024;	// Bytes of all of the ring buffers
+			double BufferDuration = 0.5;				// Seconds decoded ahead, per stream
+		};
+
+		struct Stats
+		{
+			uint32_t ActiveStreams = 0;
+			uint64_t MemoryUsed = 0;
+			uint64_t MemoryBudget = 0;
+			uint64_t StarvedReads = 0;	// Reads that didn't get all of their frames
+			uint64_t StarvedFrames = 0;
+		};
+
+	public:
+		StreamingManager() = default;
+		StreamingManager(const StreamingManager&) = delete;
+		~StreamingManager();
+
+		void Initialize();
+		/** Stops the I/O thread and closes remaining streams. */
+		void Shutdown();
+
+		/** Opens a stream, already decoded ahead. Returns nullptr if the file can't be decoded or the budget is exhausted. */
+		AudioStream* OpenStream(ma_resource_manager* resourceManager, AssetHandle waveAsset, const Config& config);
+
+		/** The audio render thread must not read from the stream anymore. */
+		void CloseStream(AudioStream* stream);
+
+		Stats GetStats() const;
+
+	private:
+		void IOThreadLoop();
+		void RemoveStream(AudioStream& stream);
+
+	private:
+		std::thread m_IOThread;
+		std::atomic<bool> m_Running{ false };
+
+		// Guards the list of streams. The I/O thread decodes a copy of the list without holding it,
+		// a stream closed in the meantime is destroyed once the I/O thread lets go of it.
+		mutable std::mutex m_StreamsLock;
+		std::condition_variable m_Wake;
+		std::vector<std::shared_ptr<AudioStream>> m_Streams;
+		uint64_t m_MemoryUsed = 0;
+		uint64_t m_MemoryBudget = 0;
+
+		// Of the streams that have been closed
+		uint64_t m_ClosedStarvedReads = 0;
+		uint64_t m_ClosedStarvedFrames = 0;
+	};
+
+} // namespace Beyond::Audio
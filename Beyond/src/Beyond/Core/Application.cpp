@@ -46,7 +46,10 @@ namespace Beyond {
 		s_MainThreadID = std::this_thread::get_id();
 		m_AppSettings.Deserialize();
 
-		m_RenderThread.Run();
+		m_JobSystem = std::make_unique<JobSystem>(specification.WorkerThreadCount);
+
+		if (!specification.Headless)
+			m_RenderThread.Run();
 
 		if (!specification.WorkingDirectory.empty())
 			std::filesystem::current_path(specification.WorkingDirectory);
@@ -55,53 +58,60 @@ namespace Beyond {
 
 		Renderer::SetConfig(specification.RenderConfig);
 
-		WindowSpecification windowSpec;
-		windowSpec.Title = specification.Name;
-		windowSpec.Width = specification.WindowWidth;
-		windowSpec.Height = specification.WindowHeight;
-		windowSpec.Decorated = specification.WindowDecorated;
-		windowSpec.Fullscreen = specification.Fullscreen;
-		windowSpec.VSync = specification.VSync;
-		windowSpec.IconPath = specification.IconPath;
-		m_Window = std::unique_ptr<Window>(Window::Create(windowSpec));
-		m_Window->Init();
-		m_Window->SetEventCallback([this](Event& e) { OnEvent(e); });
-
-		// Load editor settings (will generate default settings if the file doesn't exist yet)
-		EditorApplicationSettingsSerializer::Init();
-
-		BEY_CORE_VERIFY(NFD::Init() == NFD_OKAY);
-
-		// Init renderer and execute command queue to compile all shaders
-		Renderer::Init();
-		// Render one frame (TODO: maybe make a func called Pump or something)
-		m_RenderThread.Pump();
-
-		if (specification.StartMaximized)
-			m_Window->Maximize();
-		else
-			m_Window->CenterWindow();
-		m_Window->SetResizable(specification.Resizable);
-		
-		if (m_Specification.EnableImGui)
+		if (!specification.Headless)
 		{
-			m_ImGuiLayer = ImGuiLayer::Create();
-			PushOverlay(m_ImGuiLayer);
+			WindowSpecification windowSpec;
+			windowSpec.Title = specification.Name;
+			windowSpec.Width = specification.WindowWidth;
+			windowSpec.Height = specification.WindowHeight;
+			windowSpec.Decorated = specification.WindowDecorated;
+			windowSpec.Fullscreen = specification.Fullscreen;
+			windowSpec.VSync = specification.VSync;
+			windowSpec.IconPath = specification.IconPath;
+			m_Window = std::unique_ptr<Window>(Window::Create(windowSpec));
+			m_Window->Init();
+			m_Window->SetEventCallback([this](Event& e) { OnEvent(e); });
+
+			// Load editor settings (will generate default settings if the file doesn't exist yet)
+			EditorApplicationSettingsSerializer::Init();
+
+			BEY_CORE_VERIFY(NFD::Init() == NFD_OKAY);
+
+			// Init renderer and execute command queue to compile all shaders
+			Renderer::Init();
+			// Render one frame (TODO: maybe make a func called Pump or something)
+			m_RenderThread.Pump();
+
+			if (specification.StartMaximized)
+				m_Window->Maximize();
+			else
+				m_Window->CenterWindow();
+			m_Window->SetResizable(specification.Resizable);
+		
+			if (m_Specification.EnableImGui)
+			{
+				m_ImGuiLayer = ImGuiLayer::Create();
+				PushOverlay(m_ImGuiLayer);
+			}
 		}
 
 		//PhysicsSystem::Init();
 		ScriptEngine::Init(specification.ScriptConfig);
-		MiniAudioEngine::Init();
-		Font::Init();
+		MiniAudioEngine::Init(specification.OfflineAudio);
+		if (!specification.Headless)
+			Font::Init();
 	}
 
 	Application::~Application()
 	{
-		NFD::Quit();
+		if (!m_Specification.Headless)
+		{
+			NFD::Quit();
 
-		EditorApplicationSettingsSerializer::SaveSettings();
+			EditorApplicationSettingsSerializer::SaveSettings();
 
-		m_Window->SetEventCallback([](Event& e) {});
+			m_Window->SetEventCallback([](Event& e) {});
+		}
 
 		m_RenderThread.Terminate();
 
@@ -113,10 +123,15 @@ namespace Beyond {
 
 		ScriptEngine::Shutdown();
 		Project::SetActive(nullptr);
-		Font::Shutdown();
 		MiniAudioEngine::Shutdown();
 
-		Renderer::Shutdown();
+		if (!m_Specification.Headless)
+		{
+			Font::Shutdown();
+			Renderer::Shutdown();
+		}
+
+		m_JobSystem.reset();
 
 		delete m_Profiler;
 		m_Profiler = nullptr;
@@ -163,6 +178,13 @@ namespace Beyond {
 	void Application::Run()
 	{
 		OnInit();
+
+		if (m_Specification.Headless)
+		{
+			RunHeadless();
+			return;
+		}
+
 		while (m_Running)
 		{
 			// Wait for render thread to finish frame
@@ -200,6 +222,15 @@ namespace Beyond {
 				});
 
 				Renderer::BeginFrame();
+
+				// Assets finished loading in the background are published before the layers look them up
+				if (Ref<AssetManagerBase> assetManager = Project::GetAssetManager())
+				{
+					BEY_SCOPE_PERF("AssetManager::UpdateAsyncLoads");
+					assetManager->UpdateAsyncLoads();
+					assetManager->FlushChanges();
+				}
+
 				{
 					BEY_SCOPE_PERF("Application Layer::OnUpdate");
 					for (Layer* layer : m_LayerStack)
@@ -260,6 +291,28 @@ namespace Beyond {
 		OnShutdown();
 	}
 
+	void Application::RunHeadless()
+	{
+		// Nothing is presented, so there's no frame rate to follow. Background asset loads aren't
+		// published either, they record render commands.
+		m_TimeStep = 1.0f / 60.0f;
+		while (m_Running)
+		{
+			{
+				std::scoped_lock<std::mutex> lock(m_EventQueueMutex);
+				while (!m_EventQueue.empty())
+				{
+					m_EventQueue.front()();
+					m_EventQueue.pop();
+				}
+			}
+
+			for (Layer* layer : m_LayerStack)
+				layer->OnUpdate(m_TimeStep);
+		}
+		OnShutdown();
+	}
+
 	void Application::Close()
 	{
 		m_Running = false;
@@ -2,6 +2,7 @@
 #include <queue>
 
 #include "ApplicationSettings.h"
+#include "JobSystem.h"
 #include "LayerStack.h"
 #include "RenderThread.h"
 #include "Timer.h"
@@ -35,7 +36,12 @@ namespace Beyond {
 		ScriptEngineConfig ScriptConfig;
 		RendererConfig RenderConfig;
 		ThreadingPolicy CoreThreadingPolicy = ThreadingPolicy::MultiThreaded;
+		int32_t WorkerThreadCount = -1; // -1 = hardware concurrency minus the main and render threads
 		std::filesystem::path IconPath;
+		bool OfflineAudio = false; // No playback device, audio is only rendered by MiniAudioEngine::RenderOffline()
+		// No window, renderer, ImGui or fonts, layers are updated with a fixed time step until Close().
+		// Only for tools that don't create GPU resources (offline audio rendering), runs without a display or GPU.
+		bool Headless = false;
 	};
 
 	class Application
@@ -103,7 +109,8 @@ namespace Beyond {
 			}
 		}
 
-		inline Window& GetWindow() { return *m_Window; }
+		inline Window& GetWindow() { BEY_CORE_ASSERT(m_Window, "Headless applications have no window"); return *m_Window; }
+		bool IsHeadless() const { return m_Specification.Headless; }
 
 		static inline Application& Get() { return *s_Instance; }
 
@@ -129,6 +136,7 @@ namespace Beyond {
 		ImGuiLayer* GetImGuiLayer() { return m_ImGuiLayer; }
 
 		RenderThread& GetRenderThread() { return m_RenderThread; }
+		JobSystem& GetJobSystem() { return *m_JobSystem; }
 		uint32_t GetCurrentFrameIndex() const { return m_CurrentFrameIndex; }
 		const PerformanceTimers& GetPerformanceTimers() const { return m_PerformanceTimers; }
 		PerformanceTimers& GetPerformanceTimers() { return m_PerformanceTimers; }
@@ -140,6 +148,7 @@ namespace Beyond {
 		static bool IsRuntime() { return s_IsRuntime; }
 	private:
 		void ProcessEvents();
+		void RunHeadless();
 
 		bool OnWindowResize(WindowResizeEvent& e);
 		bool OnWindowMinimize(WindowMinimizeEvent& e);
@@ -159,6 +168,7 @@ namespace Beyond {
 		bool m_ShowStats = true;
 
 		RenderThread m_RenderThread;
+		std::unique_ptr<JobSystem> m_JobSystem;
 
 		std::mutex m_EventQueueMutex;
 		std::queue<std::function<void()>> m_EventQueue;
@@ -0,0 +1,429 @@
+#include "pch.h"
+#include "JobSystem.h"
+
+#include "Beyond/Debug/Profiler.h"
+
+namespace Beyond {
+
+	using Internal::Job;
+
+	static constexpr uint32_t s_InvalidJobIndex = ~0u;
+
+	static thread_local uint32_t s_ThreadIndex = JobSystem::InvalidThreadIndex;
+
+	// Running out of pooled jobs is handled (the caller helps out until one is freed), but worth knowing about once
+	static std::atomic<bool> s_WarnedPoolExhausted = false;
+
+	//////////////////////////////////////////////////////////////////////////////////
+	// WorkStealingQueue
+	//////////////////////////////////////////////////////////////////////////////////
+
+	namespace Internal {
+
+		bool WorkStealingQueue::Push(Job* job)
+		{
+			const int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+			const int64_t top = m_Top.load(std::memory_order_acquire);
+			if (bottom - top >= Capacity)
+				return false;
+
+			m_Jobs[bottom & (Capacity - 1)].store(job, std::memory_order_relaxed);
+			m_Bottom.store(bottom + 1, std::memory_order_release);
+			return true;
+		}
+
+		Job* WorkStealingQueue::Pop()
+		{
+			const int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+			m_Bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t top = m_Top.load(std::memory_order_relaxed);
+
+			if (top > bottom)
+			{
+				// Queue was already empty
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			Job* job = m_Jobs[bottom & (Capacity - 1)].load(std::memory_order_relaxed);
+			if (top == bottom)
+			{
+				// Last item, race against thieves
+				if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					job = nullptr;
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+
+			return job;
+		}
+
+		Job* WorkStealingQueue::Steal()
+		{
+			int64_t top = m_Top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
+			if (top >= bottom)
+				return nullptr;
+
+			Job* job = m_Jobs[top & (Capacity - 1)].load(std::memory_order_relaxed);
+			if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return nullptr;
+
+			return job;
+		}
+
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////
+	// JobHandle
+	//////////////////////////////////////////////////////////////////////////////////
+
+	JobHandle::JobHandle(JobSystem* jobSystem, Job* job)
+		: m_JobSystem(jobSystem), m_Job(job)
+	{
+		if (m_Job)
+			m_Job->RefCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	JobHandle::JobHandle(const JobHandle& other)
+		: JobHandle(other.m_JobSystem, other.m_Job)
+	{
+	}
+
+	JobHandle::JobHandle(JobHandle&& other) noexcept
+		: m_JobSystem(std::exchange(other.m_JobSystem, nullptr)), m_Job(std::exchange(other.m_Job, nullptr))
+	{
+	}
+
+	JobHandle::~JobHandle()
+	{
+		if (m_Job)
+			m_JobSystem->ReleaseJob(m_Job);
+	}
+
+	JobHandle& JobHandle::operator=(const JobHandle& other)
+	{
+		if (this != &other)
+			*this = JobHandle(other);
+		return *this;
+	}
+
+	JobHandle& JobHandle::operator=(JobHandle&& other) noexcept
+	{
+		if (this != &other)
+		{
+			if (m_Job)
+				m_JobSystem->ReleaseJob(m_Job);
+
+			m_JobSystem = std::exchange(other.m_JobSystem, nullptr);
+			m_Job = std::exchange(other.m_Job, nullptr);
+		}
+		return *this;
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////
+	// JobSystem
+	//////////////////////////////////////////////////////////////////////////////////
+
+	static uint64_t PackFreeListHead(uint32_t index, uint32_t tag) { return (uint64_t(tag) << 32) | index; }
+	static uint32_t GetFreeListIndex(uint64_t head) { return uint32_t(head & 0xFFFFFFFF); }
+	static uint32_t GetFreeListTag(uint64_t head) { return uint32_t(head >> 32); }
+
+	JobSystem::JobSystem(int32_t workerCount)
+	{
+		if (workerCount < 0)
+		{
+			// Leave room for the main thread and the render thread
+			const int32_t hardwareThreads = (int32_t)std::thread::hardware_concurrency();
+			workerCount = std::max(hardwareThreads - 2, 1);
+		}
+
+		m_JobPool = std::make_unique<Job[]>(MaxJobs);
+		m_NextFree = std::make_unique<std::atomic<uint32_t>[]>(MaxJobs);
+		for (uint32_t i = 0; i < MaxJobs; i++)
+		{
+			m_JobPool[i].PoolIndex = i;
+			m_NextFree[i].store(i + 1 < MaxJobs ? i + 1 : s_InvalidJobIndex, std::memory_order_relaxed);
+		}
+		m_FreeListHead.store(PackFreeListHead(0, 0));
+
+		m_QueueCount = (uint32_t)workerCount + 1;
+		m_Queues = std::make_unique<Internal::WorkStealingQueue[]>(m_QueueCount);
+
+		// The thread constructing the job system owns queue 0
+		s_ThreadIndex = 0;
+
+		m_Workers.reserve(workerCount);
+		for (uint32_t i = 1; i <= (uint32_t)workerCount; i++)
+			m_Workers.emplace_back([this, i]() { WorkerMain(i); });
+
+		BEY_CORE_INFO_TAG("Core", "JobSystem started with {} worker threads", workerCount);
+	}
+
+	JobSystem::~JobSystem()
+	{
+		// Drain whatever is left so nothing waits on a job that will never run
+		while (TryExecuteOne())
+			;
+
+		m_Running = false;
+		{
+			std::scoped_lock<std::mutex> lock(m_SleepMutex);
+		}
+		m_WakeCondition.notify_all();
+
+		m_Workers.clear();
+	}
+
+	uint32_t JobSystem::GetCurrentThreadIndex()
+	{
+		return s_ThreadIndex;
+	}
+
+	Job* JobSystem::AllocateJob(JobFunction&& function, JobCounter* counter)
+	{
+		uint32_t index = s_InvalidJobIndex;
+		for (;;)
+		{
+			uint64_t head = m_FreeListHead.load(std::memory_order_acquire);
+			index = GetFreeListIndex(head);
+			if (index == s_InvalidJobIndex)
+			{
+				// Pool exhausted, help out until a job is freed
+				if (!s_WarnedPoolExhausted.exchange(true, std::memory_order_relaxed))
+					BEY_CORE_WARN_TAG("Core", "JobSystem: no jobs available, waiting for one to be freed. Consider increasing MaxJobs");
+				if (!TryExecuteOne())
+					std::this_thread::yield();
+				continue;
+			}
+
+			const uint64_t next = PackFreeListHead(m_NextFree[index].load(std::memory_order_relaxed), GetFreeListTag(head) + 1);
+			if (m_FreeListHead.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_relaxed))
+				break;
+		}
+
+		Job* job = &m_JobPool[index];
+		job->Function = std::move(function);
+		job->Counter = counter;
+		job->PendingDependencies.store(1, std::memory_order_relaxed);
+		job->Finished.store(false, std::memory_order_relaxed);
+		job->ContinuationCount = 0;
+
+		// One reference for the scheduler, released once the job has executed
+		job->RefCount.store(1, std::memory_order_relaxed);
+
+		if (counter)
+			counter->m_Value.fetch_add(1, std::memory_order_relaxed);
+
+		return job;
+	}
+
+	void JobSystem::ReleaseJob(Job* job)
+	{
+		if (job->RefCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+			return;
+
+		job->Function = nullptr;
+
+		const uint32_t index = job->PoolIndex;
+		uint64_t head = m_FreeListHead.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			m_NextFree[index].store(GetFreeListIndex(head), std::memory_order_relaxed);
+			const uint64_t newHead = PackFreeListHead(index, GetFreeListTag(head) + 1);
+			if (m_FreeListHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed))
+				break;
+		}
+	}
+
+	JobHandle JobSystem::Schedule(JobFunction function, JobCounter* counter)
+	{
+		Job* job = AllocateJob(std::move(function), counter);
+		JobHandle handle(this, job);
+		job->PendingDependencies.store(0, std::memory_order_relaxed);
+		Enqueue(job);
+		return handle;
+	}
+
+	JobHandle JobSystem::CreateJob(JobFunction function, JobCounter* counter)
+	{
+		return JobHandle(this, AllocateJob(std::move(function), counter));
+	}
+
+	void JobSystem::AddDependency(const JobHandle& job, const JobHandle& dependency)
+	{
+		BEY_CORE_ASSERT(job.IsValid() && dependency.IsValid());
+		BEY_CORE_ASSERT(job.m_Job->PendingDependencies.load() > 0, "Can't add a dependency to a job that was already submitted");
+
+		Job* dependencyJob = dependency.m_Job;
+		job.m_Job->PendingDependencies.fetch_add(1, std::memory_order_relaxed);
+
+		while (dependencyJob->ContinuationLock.test_and_set(std::memory_order_acquire))
+			;
+
+		const bool alreadyFinished = dependencyJob->Finished.load(std::memory_order_relaxed);
+		if (!alreadyFinished)
+		{
+			BEY_CORE_VERIFY(dependencyJob->ContinuationCount < Job::MaxContinuations, "JobSystem: too many jobs depend on a single job");
+			dependencyJob->Continuations[dependencyJob->ContinuationCount++] = job.m_Job;
+		}
+
+		dependencyJob->ContinuationLock.clear(std::memory_order_release);
+
+		if (alreadyFinished)
+			job.m_Job->PendingDependencies.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	void JobSystem::Submit(const JobHandle& job)
+	{
+		BEY_CORE_ASSERT(job.IsValid());
+		if (job.m_Job->PendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			Enqueue(job.m_Job);
+	}
+
+	void JobSystem::Enqueue(Job* job)
+	{
+		const uint32_t threadIndex = s_ThreadIndex;
+		if (threadIndex == InvalidThreadIndex || !m_Queues[threadIndex].Push(job))
+		{
+			std::scoped_lock<std::mutex> lock(m_SharedQueueMutex);
+			m_SharedQueue.push_back(job);
+		}
+
+		m_QueuedJobCount.fetch_add(1);
+		WakeWorkers(1);
+	}
+
+	void JobSystem::WakeWorkers(uint32_t count)
+	{
+		// NOTE: seq_cst on both sides, the queued count and sleeping count form a store-load pair
+		if (m_SleepingWorkers.load() == 0)
+			return;
+
+		// Taking the lock makes sure a worker can't miss the notification between checking for work and going to sleep
+		{
+			std::scoped_lock<std::mutex> lock(m_SleepMutex);
+		}
+
+		if (count == 1)
+			m_WakeCondition.notify_one();
+		else
+			m_WakeCondition.notify_all();
+	}
+
+	Job* JobSystem::FindJob(uint32_t threadIndex)
+	{
+		Job* job = nullptr;
+
+		if (threadIndex != InvalidThreadIndex)
+			job = m_Queues[threadIndex].Pop();
+
+		if (!job)
+		{
+			std::scoped_lock<std::mutex> lock(m_SharedQueueMutex);
+			if (!m_SharedQueue.empty())
+			{
+				job = m_SharedQueue.front();
+				m_SharedQueue.pop_front();
+			}
+		}
+
+		if (!job)
+		{
+			// Steal, starting at our neighbour so the workers don't all hammer the same queue
+			const uint32_t start = threadIndex == InvalidThreadIndex ? 0 : threadIndex + 1;
+			for (uint32_t i = 0; i < m_QueueCount && !job; i++)
+			{
+				const uint32_t victim = (start + i) % m_QueueCount;
+				if (victim != threadIndex)
+					job = m_Queues[victim].Steal();
+			}
+		}
+
+		if (job)
+			m_QueuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+
+		return job;
+	}
+
+	void JobSystem::Execute(Job* job)
+	{
+		job->Function();
+
+		// Close the continuation list, anything added from now on sees the job as finished
+		while (job->ContinuationLock.test_and_set(std::memory_order_acquire))
+			;
+		job->Finished.store(true, std::memory_order_release);
+		const uint32_t continuationCount = job->ContinuationCount;
+		job->ContinuationLock.clear(std::memory_order_release);
+
+		for (uint32_t i = 0; i < continuationCount; i++)
+		{
+			Job* continuation = job->Continuations[i];
+			if (continuation->PendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				Enqueue(continuation);
+		}
+
+		if (job->Counter)
+			job->Counter->m_Value.fetch_sub(1, std::memory_order_release);
+
+		ReleaseJob(job);
+	}
+
+	bool JobSystem::TryExecuteOne()
+	{
+		Job* job = FindJob(s_ThreadIndex);
+		if (!job)
+			return false;
+
+		Execute(job);
+		return true;
+	}
+
+	void JobSystem::Wait(const JobCounter& counter)
+	{
+		BEY_PROFILE_FUNC();
+
+		while (!counter.IsDone())
+		{
+			if (!TryExecuteOne())
+				std::this_thread::yield();
+		}
+	}
+
+	void JobSystem::Wait(const JobHandle& job)
+	{
+		BEY_PROFILE_FUNC();
+
+		while (!job.IsDone())
+		{
+			if (!TryExecuteOne())
+				std::this_thread::yield();
+		}
+	}
+
+	void JobSystem::WorkerMain(uint32_t threadIndex)
+	{
+		s_ThreadIndex = threadIndex;
+
+		const std::string threadName = fmt::format("Job Worker {}", threadIndex);
+		BEY_PROFILE_THREAD(threadName.c_str());
+
+		while (m_Running.load(std::memory_order_acquire))
+		{
+			if (TryExecuteOne())
+				continue;
+
+			std::unique_lock<std::mutex> lock(m_SleepMutex);
+			m_SleepingWorkers.fetch_add(1);
+			m_WakeCondition.wait(lock, [this]()
+			{
+				return m_QueuedJobCount.load() > 0 || !m_Running.load(std::memory_order_acquire);
+			});
+			m_SleepingWorkers.fetch_sub(1);
+		}
+	}
+
+}
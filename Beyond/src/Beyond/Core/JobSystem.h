@@ -0,0 +1,225 @@
+#pragma once
+
+#include <EASTL/fixed_function.h>
+#include <EASTL/deque.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Beyond {
+
+	// NOTE: Job functions are stored inline in the job, capture pointers/references rather than containers
+	using JobFunction = eastl::fixed_function<64, void()>;
+
+	class JobSystem;
+
+	/// Counts the number of unfinished jobs that were scheduled with it, waiting on a counter
+	/// makes the calling thread help out executing jobs until the counter reaches zero.
+	class JobCounter
+	{
+	public:
+		JobCounter() = default;
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+		uint32_t GetValue() const { return m_Value.load(std::memory_order_acquire); }
+		bool IsDone() const { return GetValue() == 0; }
+
+	private:
+		std::atomic<uint32_t> m_Value = 0;
+
+		friend class JobSystem;
+	};
+
+	namespace Internal {
+
+		struct Job
+		{
+			static constexpr uint32_t MaxContinuations = 15;
+
+			JobFunction Function;
+			JobCounter* Counter = nullptr;
+
+			// Starts at 1 so that a job can't run before it has been submitted
+			std::atomic<int32_t> PendingDependencies = 1;
+			std::atomic<uint32_t> RefCount = 0;
+			std::atomic<bool> Finished = false;
+
+			// Protects Continuations / ContinuationCount against a concurrently finishing job
+			std::atomic_flag ContinuationLock;
+			uint32_t ContinuationCount = 0;
+			Job* Continuations[MaxContinuations];
+
+			uint32_t PoolIndex = 0;
+		};
+
+		// Chase-Lev work stealing deque, only the owning thread may Push/Pop, any thread may Steal
+		class WorkStealingQueue
+		{
+		public:
+			static constexpr int64_t Capacity = 4096;
+			static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+
+			bool Push(Job* job);
+			Job* Pop();
+			Job* Steal();
+
+			bool IsEmpty() const { return m_Bottom.load(std::memory_order_relaxed) <= m_Top.load(std::memory_order_relaxed); }
+
+		private:
+			alignas(64) std::atomic<int64_t> m_Top = 0;
+			alignas(64) std::atomic<int64_t> m_Bottom = 0;
+			std::atomic<Job*> m_Jobs[Capacity];
+		};
+
+	}
+
+	/// Reference to a scheduled (or created but not yet submitted) job, keeps the job alive so it can be queried / waited on
+	class JobHandle
+	{
+	public:
+		JobHandle() = default;
+		JobHandle(const JobHandle& other);
+		JobHandle(JobHandle&& other) noexcept;
+		~JobHandle();
+
+		JobHandle& operator=(const JobHandle& other);
+		JobHandle& operator=(JobHandle&& other) noexcept;
+
+		bool IsValid() const { return m_Job != nullptr; }
+		bool IsDone() const { return m_Job == nullptr || m_Job->Finished.load(std::memory_order_acquire); }
+
+	private:
+		JobHandle(JobSystem* jobSystem, Internal::Job* job);
+
+		JobSystem* m_JobSystem = nullptr;
+		Internal::Job* m_Job = nullptr;
+
+		friend class JobSystem;
+	};
+
+	/// Engine wide task scheduler. Every worker owns a lock-free deque it pushes to and pops from,
+	/// idle workers steal from the other deques. The main thread owns a deque as well and executes
+	/// jobs whenever it waits. Other threads (render thread, asset threads, etc.) submit through a shared queue.
+	class JobSystem
+	{
+	public:
+		static constexpr uint32_t MaxJobs = 8192;
+		static constexpr uint32_t InvalidThreadIndex = ~0u;
+
+	public:
+		/// workerCount < 0 picks hardware concurrency minus the main and render threads
+		explicit JobSystem(int32_t workerCount = -1);
+		~JobSystem();
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		/// Creates a job and queues it immediately
+		JobHandle Schedule(JobFunction function, JobCounter* counter = nullptr);
+
+		/// Creates a job without queueing it, use AddDependency to build a graph and Submit to release it
+		JobHandle CreateJob(JobFunction function, JobCounter* counter = nullptr);
+
+		/// Makes job wait for dependency to finish, job must not have been submitted yet
+		void AddDependency(const JobHandle& job, const JobHandle& dependency);
+
+		/// Releases a job created with CreateJob, it runs as soon as all of its dependencies are done
+		void Submit(const JobHandle& job);
+
+		/// Executes pending jobs on the calling thread until the counter / job is done
+		void Wait(const JobCounter& counter);
+		void Wait(const JobHandle& job);
+
+		/// Calls func(index) for every index in [0, count), split into batches of at least minBatchSize.
+		/// Blocks until all iterations have finished, the calling thread participates.
+		template<typename TFunc>
+		void ParallelFor(uint32_t count, uint32_t minBatchSize, TFunc&& func);
+
+		uint32_t GetWorkerCount() const { return (uint32_t)m_Workers.size(); }
+
+		/// Number of threads that can execute jobs at the same time (workers + the waiting thread)
+		uint32_t GetMaxConcurrency() const { return GetWorkerCount() + 1; }
+
+		/// 0 for the main thread, 1..N for workers, InvalidThreadIndex for any other thread
+		static uint32_t GetCurrentThreadIndex();
+
+	private:
+		Internal::Job* AllocateJob(JobFunction&& function, JobCounter* counter);
+		void ReleaseJob(Internal::Job* job);
+
+		void Enqueue(Internal::Job* job);
+		Internal::Job* FindJob(uint32_t threadIndex);
+		void Execute(Internal::Job* job);
+		bool TryExecuteOne();
+
+		void WorkerMain(uint32_t threadIndex);
+		void WakeWorkers(uint32_t count);
+
+	private:
+		std::vector<std::jthread> m_Workers;
+
+		// Index 0 is owned by the main thread, the rest by the workers
+		std::unique_ptr<Internal::WorkStealingQueue[]> m_Queues;
+		uint32_t m_QueueCount = 0;
+
+		// Jobs from threads that don't own a queue, or overflow from a full queue
+		std::mutex m_SharedQueueMutex;
+		eastl::deque<Internal::Job*> m_SharedQueue;
+
+		// Fixed job pool with a lock-free free list (index + ABA tag packed in 64 bits)
+		std::unique_ptr<Internal::Job[]> m_JobPool;
+		std::unique_ptr<std::atomic<uint32_t>[]> m_NextFree;
+		std::atomic<uint64_t> m_FreeListHead = 0;
+
+		std::atomic<int32_t> m_QueuedJobCount = 0;
+		std::atomic<uint32_t> m_SleepingWorkers = 0;
+		std::mutex m_SleepMutex;
+		std::condition_variable m_WakeCondition;
+		std::atomic<bool> m_Running = true;
+
+		friend class JobHandle;
+	};
+
+	template<typename TFunc>
+	void JobSystem::ParallelFor(uint32_t count, uint32_t minBatchSize, TFunc&& func)
+	{
+		if (count == 0)
+			return;
+
+		minBatchSize = std::max(minBatchSize, 1u);
+
+		// Aim for a few batches per thread so stealing can even out uneven work
+		const uint32_t targetBatches = GetMaxConcurrency() * 4;
+		const uint32_t batchSize = std::max(minBatchSize, (count + targetBatches - 1) / targetBatches);
+		const uint32_t batchCount = (count + batchSize - 1) / batchSize;
+
+		if (batchCount == 1 || GetWorkerCount() == 0)
+		{
+			for (uint32_t i = 0; i < count; i++)
+				func(i);
+			return;
+		}
+
+		JobCounter counter;
+		for (uint32_t batch = 1; batch < batchCount; batch++)
+		{
+			const uint32_t begin = batch * batchSize;
+			const uint32_t end = std::min(begin + batchSize, count);
+			Schedule([&func, begin, end]()
+			{
+				for (uint32_t i = begin; i < end; i++)
+					func(i);
+			}, &counter);
+		}
+
+		// Run the first batch on this thread
+		for (uint32_t i = 0; i < batchSize; i++)
+			func(i);
+
+		Wait(counter);
+	}
+
+}
@@ -0,0 +1,577 @@
+#include "pch.h"
+#include "Benchmarks.h"
+
+#ifndef BEY_DIST
+
+#include "Beyond/Animation/AnimationGraph.h"
+#include "Beyond/Animation/AnimationSampler.h"
+#include "Beyond/Animation/PoseBlending.h"
+#include "Beyond/Animation/PoseTrackWriter.h"
+#include "Beyond/Audio/DSP/Components/revmodel.hpp"
+#include "Beyond/Audio/SoundGraph/SoundGraph.h"
+#include "Beyond/Audio/SoundGraph/SoundGraphFactory.h"
+#include "Beyond/Audio/SoundGraph/Nodes/NodeDescriptors.h"
+#include "Beyond/Core/Application.h"
+#include "Beyond/Core/FastRandom.h"
+#include "Beyond/Core/Timer.h"
+#include "Beyond/Scene/Components.h"
+#include "Beyond/Scene/Scene.h"
+#include "Beyond/Scene/SceneSerializer.h"
+#include "Beyond/Script/GCManager.h"
+#include "Beyond/Script/ScriptCache.h"
+#include "Beyond/Script/ScriptEngine.h"
+#include "Beyond/Script/ScriptUtils.h"
+#include "Beyond/Serialization/MemoryStream.h"
+
+#include <acl/compression/compress.h>
+#include <acl/compression/track_array.h>
+#include <acl/decompression/decompress.h>
+
+namespace Beyond {
+
+	namespace Utils {
+		acl::iallocator& GetAnimationAllocator();
+	};
+
+}
+
+namespace Beyond::Benchmarks {
+
+	namespace {
+
+		// Detuned oscillator with a bit of noise, tremolo and a looping envelope
+		Ref<SoundGraph::SoundGraph> CreateSynthVoice(uint32_t voiceIndex)
+		{
+			Ref<SoundGraph::SoundGraph> graph = Ref<SoundGraph::SoundGraph>::Create("Benchmark Voice", UUID());
+			graph->AddGraphInputStream(Identifier("Frequency"), choc::value::Value(110.0f + 3.0f * (float)voiceIndex));
+			graph->AddGraphOutputStream(SoundGraph::SoundGraph::IDs::OutLeft);
+			graph->AddGraphOutputStream(SoundGraph::SoundGraph::IDs::OutRight);
+			graph->OutputChannelIDs = { SoundGraph::SoundGraph::IDs::OutLeft, SoundGraph::SoundGraph::IDs::OutRight };
+
+			auto addNode = [&graph](Identifier nodeType, std::initializer_list<std::pair<Identifier, choc::value::Value>> defaultValues) -> UUID
+			{
+				const UUID id;
+				graph->AddNode(SoundGraph::Factory::Create(nodeType, id));
+
+				SoundGraph::NodeProcessor* node = graph->Nodes.back().get();
+				for (const auto& [endpoint, value] : defaultValues)
+					node->DefaultValuePlugs.emplace_back(new SoundGraph::StreamWriter(node->InValue(endpoint), choc::value::Value(value), endpoint));
+				return id;
+			};
+
+			const UUID oscillator = addNode(Identifier("Sine"), { { Identifier("PhaseOffset"), choc::value::Value(0.0f) } });
+			const UUID lfo = addNode(Identifier("Sine"), { { Identifier("Frequency"), choc::value::Value(5.0f) }, { Identifier("PhaseOffset"), choc::value::Value(0.0f) } });
+			const UUID tremolo = addNode(Identifier(SoundGraph::NameAliases::MultAudioFloat), { { Identifier("Multiplier"), choc::value::Value(0.25f) } });
+			const UUID noise = addNode(Identifier("Noise"), { { Identifier("Seed"), choc::value::Value((int32_t)voiceIndex) }, { Identifier("Type"), choc::value::Value((int32_t)SoundGraph::Noise::WhiteNoise) } });
+			const UUID noiseGain = addNode(Identifier(SoundGraph::NameAliases::MultAudioFloat), { { Identifier("Multiplier"), choc::value::Value(0.05f) } });
+			const UUID mix = addNode(Identifier(SoundGraph::NameAliases::AddAudio), {});
+			const UUID envelope = addNode(Identifier(SoundGraph::NameAliases::ADEnvelope), {
+				{ Identifier("AttackTime"), choc::value::Value(0.01f) }, { Identifier("DecayTime"), choc::value::Value(0.4f) },
+				{ Identifier("AttackCurve"), choc::value::Value(1.0f) }, { Identifier("DecayCurve"), choc::value::Value(2.0f) },
+				{ Identifier("Looping"), choc::value::Value(true) } });
+			const UUID amplifier = addNode(Identifier(SoundGraph::NameAliases::MultAudio), {});
+			const UUID output = addNode(Identifier(SoundGraph::NameAliases::MultAudio), {});
+
+			graph->AddInputValueRoute(Identifier("Frequency"), oscillator, Identifier("Frequency"));
+			graph->AddValueConnection(lfo, Identifier("Sine"), tremolo, Identifier("Value"));
+			graph->AddValueConnection(noise, Identifier("Value"), noiseGain, Identifier("Value"));
+			graph->AddValueConnection(oscillator, Identifier("Sine"), mix, Identifier("Value1"));
+			graph->AddValueConnection(noiseGain, Identifier("Out"), mix, Identifier("Value2"));
+			graph->AddValueConnection(mix, Identifier("Out"), amplifier, Identifier("Value"));
+			graph->AddValueConnection(envelope, Identifier("OutEnvelope"), amplifier, Identifier("Multiplier"));
+			graph->AddValueConnection(amplifier, Identifier("Out"), output, Identifier("Value"));
+			graph->AddValueConnection(tremolo, Identifier("Out"), output, Identifier("Multiplier"));
+			graph->AddInputEventsRoute(SoundGraph::SoundGraph::IDs::Play, envelope, Identifier("Trigger"));
+			graph->AddToGraphOutputConnection(output, Identifier("Out"), SoundGraph::SoundGraph::IDs::OutLeft);
+			graph->AddToGraphOutputConnection(output, Identifier("Out"), SoundGraph::SoundGraph::IDs::OutRight);
+
+			graph->Init();
+			graph->SendInputEvent(SoundGraph::SoundGraph::IDs::Play, choc::value::Value(1.0f));
+			return graph;
+		}
+
+	}
+
+
+	void RunSceneLoad(uint32_t entityCount)
+	{
+		// Roughly shaped like a level: small hierarchies of meshes with colliders, some physics and lights
+		Ref<Scene> scene = Ref<Scene>::Create("LoadBenchmark", true);
+		FastRandom random;
+		Entity parent;
+		for (uint32_t i = 0; i < entityCount; i++)
+		{
+			Entity entity = scene->CreateEntityWithID(UUID(), fmt::format("Entity {}", i), false);
+			if (i % 10 == 0)
+				parent = entity;
+			else
+				entity.SetParent(parent);
+
+			auto& transform = entity.Transform();
+			transform.Translation = { random.GetFloat32InRange(-500.0f, 500.0f), random.GetFloat32InRange(0.0f, 50.0f), random.GetFloat32InRange(-500.0f, 500.0f) };
+			transform.SetRotationEuler({ 0.0f, random.GetFloat32InRange(-glm::pi<float>(), glm::pi<float>()), 0.0f });
+
+			auto& staticMesh = entity.AddComponent<StaticMeshComponent>(AssetHandle(0));
+			staticMesh.MaterialTable->SetMaterial(0, AssetHandle(0));
+			entity.AddComponent<BoxColliderComponent>();
+
+			if (i % 4 == 0)
+				entity.AddComponent<RigidBodyComponent>().Mass = random.GetFloat32InRange(1.0f, 100.0f);
+			if (i % 50 == 0)
+				entity.AddComponent<PointLightComponent>().Radiance = glm::vec3(random.GetVec4InRange(0.0f, 1.0f));
+		}
+		scene->SortEntities();
+
+		YAML::Emitter out;
+		SceneSerializer(scene).SerializeToYAML(out);
+		const std::string yamlString = out.c_str();
+
+		Buffer binaryData;
+		MemoryStreamWriter binaryStream(binaryData, 1024 * 1024);
+		SceneSerializer(scene).SerializeToBinary(binaryStream);
+		Buffer binary(binaryData.Data, binaryStream.GetWrittenSize());
+
+		Ref<Scene> yamlScene = Ref<Scene>::Create("LoadBenchmarkYAML", true);
+		Timer timer;
+		SceneSerializer(yamlScene).DeserializeFromYAML(yamlString);
+		const float yamlMs = timer.ElapsedMillis();
+
+		Ref<Scene> binaryScene = Ref<Scene>::Create("LoadBenchmarkBinary", true);
+		MemoryStreamReader binaryReader(binary);
+		timer.Reset();
+		bool success = SceneSerializer(binaryScene).DeserializeFromBinary(binaryReader);
+		const float binaryMs = timer.ElapsedMillis();
+
+		success = success && binaryScene->GetEntityMap().size() == yamlScene->GetEntityMap().size();
+		BEY_CONSOLE_LOG_INFO("Scene load benchmark, {} entities{}", entityCount, success ? "" : " (binary load FAILED)");
+		BEY_CONSOLE_LOG_INFO("  YAML:   {:.2f} ms, {:.2f} MB", yamlMs, (float)yamlString.size() / (1024.0f * 1024.0f));
+		BEY_CONSOLE_LOG_INFO("  Binary: {:.2f} ms, {:.2f} MB ({:.1f}x faster)", binaryMs, (float)binary.Size / (1024.0f * 1024.0f), binaryMs > 0.0f ? yamlMs / binaryMs : 0.0f);
+
+		binaryData.Release();
+	}
+
+
+	void RunSoundGraphBlockProcessing(uint32_t voiceCount)
+	{
+		constexpr uint32_t sampleRate = 48000;
+		constexpr uint32_t blockSize = 512;
+		constexpr uint32_t blockCount = 2 * sampleRate / blockSize;
+		constexpr uint32_t numChannels = 2;
+
+		std::vector<Ref<SoundGraph::SoundGraph>> perSampleVoices;
+		std::vector<Ref<SoundGraph::SoundGraph>> blockVoices;
+		for (uint32_t i = 0; i < voiceCount; ++i)
+		{
+			perSampleVoices.push_back(CreateSynthVoice(i));
+			blockVoices.push_back(CreateSynthVoice(i));
+			blockVoices.back()->InitBlockProcessing(blockSize);
+		}
+
+		std::vector<float> perSampleOutput(blockSize * numChannels);
+		std::vector<float> blockOutput(blockSize * numChannels);
+		float maxDifference = 0.0f;
+
+		float perSampleMs = 0.0f;
+		float blockMs = 0.0f;
+		Timer timer;
+		for (uint32_t block = 0; block < blockCount; ++block)
+		{
+			for (uint32_t voice = 0; voice < voiceCount; ++voice)
+			{
+				// Same as SoundGraphSource did before block processing
+				SoundGraph::SoundGraph& graph = *perSampleVoices[voice];
+				timer.Reset();
+				for (uint32_t i = 0; i < blockSize; ++i)
+				{
+					graph.Process();
+					for (uint32_t ch = 0; ch < numChannels; ++ch)
+						perSampleOutput[i * numChannels + ch] = *(float*)(graph.EndpointOutputStreams.InValue(graph.OutputChannelIDs[ch]).getRawData());
+				}
+				perSampleMs += timer.ElapsedMillis();
+
+				SoundGraph::SoundGraph& blockGraph = *blockVoices[voice];
+				timer.Reset();
+				blockGraph.ProcessBlock(blockSize);
+				for (uint32_t ch = 0; ch < numChannels; ++ch)
+				{
+					const SoundGraph::StreamBlock& channel = blockGraph.GetOutputChannelBlock(ch);
+					for (uint32_t i = 0; i < blockSize; ++i)
+						blockOutput[i * numChannels + ch] = channel[i];
+				}
+				blockMs += timer.ElapsedMillis();
+
+				for (uint32_t i = 0; i < blockSize * numChannels; ++i)
+					maxDifference = glm::max(maxDifference, glm::abs(perSampleOutput[i] - blockOutput[i]));
+			}
+		}
+
+		// Voices one core renders in real time
+		const float renderedMs = 1000.0f * (float)(blockCount * blockSize) / (float)sampleRate * (float)voiceCount;
+		BEY_CONSOLE_LOG_INFO("SoundGraph block processing benchmark, {} voices, {} frames per block", voiceCount, blockSize);
+		BEY_CONSOLE_LOG_INFO("  Per sample: {:.2f} ms, {:.0f} voices per core", perSampleMs, perSampleMs > 0.0f ? renderedMs / perSampleMs : 0.0f);
+		BEY_CONSOLE_LOG_INFO("  Block:      {:.2f} ms, {:.0f} voices per core ({:.1f}x faster)", blockMs, blockMs > 0.0f ? renderedMs / blockMs : 0.0f, blockMs > 0.0f ? perSampleMs / blockMs : 0.0f);
+		BEY_CONSOLE_LOG_INFO("  Max difference between the two: {}", maxDifference);
+	}
+
+
+	void RunReverbBlockProcessing()
+	{
+		constexpr double sampleRate = 48000.0;
+		constexpr int numChannels = 2;
+		constexpr int blockSize = 512;
+		constexpr int blockCount = 20 * 48000 / blockSize;
+		constexpr int numFrames = blockSize * blockCount;
+
+		// Noise bursts for the first couple of seconds, then the tail rings out into denormals
+		std::vector<float> input(numFrames * numChannels, 0.0f);
+		uint32_t seed = 1;
+		for (int i = 0; i < 2 * 48000; ++i)
+		{
+			const float envelope = (i % 24000) < 4800 ? 1.0f - (float)(i % 24000) / 4800.0f : 0.0f;
+			for (int channel = 0; channel < numChannels; ++channel)
+			{
+				seed = seed * 1664525u + 1013904223u;
+				input[i * numChannels + channel] = envelope * ((float)(seed >> 8) / 8388608.0f - 1.0f);
+			}
+		}
+
+		auto perSample = std::make_unique<revmodel>(sampleRate);
+		auto block = std::make_unique<revmodel>(sampleRate);
+		for (revmodel* model : { perSample.get(), block.get() })
+		{
+			model->setroomsize(0.9f);
+			model->setdamp(0.3f);
+			model->setwet(0.5f);
+			model->setdry(0.5f);
+			model->setwidth(0.8f);
+		}
+
+		std::vector<float> perSampleOutput(input.size());
+		std::vector<float> blockOutput(input.size());
+
+		Timer timer;
+		for (int b = 0; b < blockCount; ++b)
+		{
+			const int offset = b * blockSize * numChannels;
+			perSample->processreplace(&input[offset], &input[offset + 1], &perSampleOutput[offset], &perSampleOutput[offset + 1], blockSize, numChannels);
+		}
+		const float perSampleMs = timer.ElapsedMillis();
+
+		timer.Reset();
+		for (int b = 0; b < blockCount; ++b)
+		{
+			const int offset = b * blockSize * numChannels;
+			block->processblock(&input[offset], &blockOutput[offset], blockSize, numChannels);
+		}
+		const float blockMs = timer.ElapsedMillis();
+
+		float maxDifference = 0.0f;
+		for (size_t i = 0; i < input.size(); ++i)
+			maxDifference = std::max(maxDifference, std::abs(perSampleOutput[i] - blockOutput[i]));
+
+		BEY_CONSOLE_LOG_INFO("Reverb block processing benchmark, {:.0f} s of audio in blocks of {} frames", (float)numFrames / (float)sampleRate, blockSize);
+		BEY_CONSOLE_LOG_INFO("  Per sample: {:.2f} ms", perSampleMs);
+		BEY_CONSOLE_LOG_INFO("  Block:      {:.2f} ms ({:.1f}x faster)", blockMs, blockMs > 0.0f ? perSampleMs / blockMs : 0.0f);
+		BEY_CONSOLE_LOG_INFO("  Max difference between the two: {}", maxDifference);
+	}
+
+
+	void RunPoseBlending()
+	{
+		constexpr uint32_t numBones = Animation::MAXBONES;
+		constexpr uint32_t numPoses = 64;
+		constexpr uint32_t numIterations = 2000;
+
+		// Random poses, rotations within 90 degrees of identity like most of the local bone rotations are
+		uint32_t seed = 1;
+		const auto random = [&seed]
+		{
+			seed = seed * 1664525u + 1013904223u;
+			return (float)(seed >> 8) / 8388608.0f - 1.0f;
+		};
+
+		std::vector<Pose> poses(numPoses);
+		for (Pose& pose : poses)
+		{
+			pose.NumBones = numBones;
+			for (LocalTransform& bone : pose.BoneTransforms)
+			{
+				bone.Translation = { random(), random(), random() };
+				bone.Rotation = glm::normalize(glm::quat(1.0f, 0.5f * random(), 0.5f * random(), 0.5f * random()));
+				bone.Scale = { 1.0f + 0.1f * random(), 1.0f + 0.1f * random(), 1.0f + 0.1f * random() };
+			}
+		}
+
+		Pose referenceResult;
+		Pose kernelResult;
+
+		// Blending consecutive pairs of poses, one blend is one character's blend node
+		Timer timer;
+		for (uint32_t iteration = 0; iteration < numIterations; ++iteration)
+		{
+			for (uint32_t p = 0; p < numPoses; ++p)
+			{
+				const Pose& pose0 = poses[p];
+				const Pose& pose1 = poses[(p + 1) % numPoses];
+				const float w = (float)((iteration + p) % 17) / 16.0f;
+				for (uint32_t i = 0; i < numBones; ++i)
+				{
+					referenceResult.BoneTransforms[i].Translation = glm::mix(pose0.BoneTransforms[i].Translation, pose1.BoneTransforms[i].Translation, w);
+					referenceResult.BoneTransforms[i].Rotation = glm::slerp(pose0.BoneTransforms[i].Rotation, pose1.BoneTransforms[i].Rotation, w);
+					referenceResult.BoneTransforms[i].Scale = glm::mix(pose0.BoneTransforms[i].Scale, pose1.BoneTransforms[i].Scale, w);
+				}
+			}
+		}
+		const float referenceMs = timer.ElapsedMillis();
+
+		timer.Reset();
+		for (uint32_t iteration = 0; iteration < numIterations; ++iteration)
+		{
+			for (uint32_t p = 0; p < numPoses; ++p)
+			{
+				const float w = (float)((iteration + p) % 17) / 16.0f;
+				PoseBlending::Blend(poses[p].BoneTransforms.data(), poses[(p + 1) % numPoses].BoneTransforms.data(), w, kernelResult.BoneTransforms.data(), numBones);
+			}
+		}
+		const float kernelMs = timer.ElapsedMillis();
+
+		// Both loops end on the same pair of poses and weight
+		float maxTranslationDifference = 0.0f;
+		float maxRotationDifference = 0.0f;
+		for (uint32_t i = 0; i < numBones; ++i)
+		{
+			maxTranslationDifference = glm::max(maxTranslationDifference, glm::length(referenceResult.BoneTransforms[i].Translation - kernelResult.BoneTransforms[i].Translation));
+			maxRotationDifference = glm::max(maxRotationDifference, 1.0f - glm::abs(glm::dot(referenceResult.BoneTransforms[i].Rotation, kernelResult.BoneTransforms[i].Rotation)));
+		}
+
+		const uint64_t numBlendedBones = (uint64_t)numIterations * numPoses * numBones;
+		BEY_CONSOLE_LOG_INFO("Pose blending benchmark, {} blends of {} bones", numIterations * numPoses, numBones);
+		BEY_CONSOLE_LOG_INFO("  glm::mix / glm::slerp per bone: {:.2f} ms ({:.1f} Mbones/s)", referenceMs, referenceMs > 0.0f ? numBlendedBones / (referenceMs * 1000.0f) : 0.0f);
+		BEY_CONSOLE_LOG_INFO("  SIMD lanes:                     {:.2f} ms ({:.1f} Mbones/s, {:.1f}x faster)", kernelMs, kernelMs > 0.0f ? numBlendedBones / (kernelMs * 1000.0f) : 0.0f, kernelMs > 0.0f ? referenceMs / kernelMs : 0.0f);
+		BEY_CONSOLE_LOG_INFO("  Max difference between the two: translation {}, rotation (1 - |dot|) {}", maxTranslationDifference, maxRotationDifference);
+	}
+
+
+	void RunAnimationEvaluation(const Ref<Scene>& scene)
+	{
+		constexpr uint32_t numFrames = 120;
+		constexpr float timestep = 1.0f / 60.0f;
+
+		std::vector<AnimationGraph::AnimationGraph*> graphs;
+		auto view = scene->GetAllEntitiesWith<AnimationComponent>();
+		for (auto e : view)
+		{
+			const auto& anim = view.get<AnimationComponent>(e);
+			if (anim.AnimationGraph && anim.BoneEntityIds.size() > 0)
+				graphs.push_back(anim.AnimationGraph.Raw());
+		}
+
+		if (graphs.empty())
+		{
+			BEY_CONSOLE_LOG_ERROR("Animation evaluation benchmark needs a scene with animated entities");
+			return;
+		}
+
+		JobSystem& jobSystem = Application::Get().GetJobSystem();
+		const uint32_t maxThreads = jobSystem.GetMaxConcurrency();
+		std::vector<uint32_t> threadCounts;
+		for (uint32_t threads = 1; threads < maxThreads; threads *= 2)
+			threadCounts.push_back(threads);
+		threadCounts.push_back(maxThreads);
+
+		BEY_CONSOLE_LOG_INFO("Animation evaluation benchmark, {} graphs, {} frames", graphs.size(), numFrames);
+
+		const uint32_t numGraphs = (uint32_t)graphs.size();
+		float singleThreadMs = 0.0f;
+		for (uint32_t threads : threadCounts)
+		{
+			// One batch per thread, so no more than that many threads process graphs at the same time
+			const uint32_t graphsPerBatch = (numGraphs + threads - 1) / threads;
+
+			Timer timer;
+			for (uint32_t frame = 0; frame < numFrames; ++frame)
+			{
+				AnimationSampler::NewFrame();
+				jobSystem.ParallelFor(threads, 1, [&](uint32_t batch)
+				{
+					const uint32_t end = glm::min((batch + 1) * graphsPerBatch, numGraphs);
+					for (uint32_t i = batch * graphsPerBatch; i < end; ++i)
+						graphs[i]->Process(timestep);
+				});
+			}
+			const float ms = timer.ElapsedMillis();
+			if (threads == 1)
+				singleThreadMs = ms;
+
+			BEY_CONSOLE_LOG_INFO("  {:2} threads: {:.3f} ms per frame ({:.2f}x)", threads, ms / numFrames, ms > 0.0f ? singleThreadMs / ms : 0.0f);
+		}
+	}
+
+
+	void RunAnimationCrowd()
+	{
+		constexpr uint32_t numTracks = 65; // root motion + 64 bones
+		constexpr uint32_t numClipSamples = 61;
+		constexpr float clipSampleRate = 30.0f;
+		constexpr uint32_t numCharacters = 100;
+		constexpr uint32_t numGroups = 4; // Characters in a group play the clip in step
+		constexpr uint32_t numFrames = 600;
+		constexpr float timestep = 1.0f / 60.0f;
+
+		// Synthetic clip, every bone swinging around its own axis
+		acl::iallocator& allocator = Utils::GetAnimationAllocator();
+		acl::track_array_qvvf rawTrackList(allocator, numTracks);
+		for (uint32_t i = 0; i < numTracks; ++i)
+		{
+			acl::track_desc_transformf desc;
+			desc.output_index = i;
+			desc.parent_index = (i == 0) ? acl::k_invalid_track_index : i / 2;
+			desc.precision = 0.01f;
+			desc.shell_distance = 3.0f;
+
+			const rtm::vector4f axis = rtm::vector_normalize3(rtm::vector_set(1.0f, (float)(i % 3), (float)(i % 5)));
+			acl::track_qvvf rawTrack = acl::track_qvvf::make_reserve(desc, allocator, numClipSamples, clipSampleRate);
+			for (uint32_t j = 0; j < numClipSamples; ++j)
+			{
+				const float phase = glm::two_pi<float>() * (float)j / (float)(numClipSamples - 1);
+				rawTrack[j].rotation = rtm::quat_from_axis_angle(axis, 0.5f * glm::sin(phase + (float)i));
+				rawTrack[j].translation = rtm::vector_set(0.0f, 0.1f * (float)i + 0.05f * glm::cos(phase), 0.0f);
+				rawTrack[j].scale = rtm::vector_set(1.0f);
+			}
+			rawTrackList[i] = std::move(rawTrack);
+		}
+
+		acl::qvvf_transform_error_metric errorMetric;
+		acl::compression_settings compressSettings = acl::get_default_compression_settings();
+		compressSettings.error_metric = &errorMetric;
+		acl::output_stats stats{ acl::stat_logging::none };
+		acl::compressed_tracks* compressedTracks = nullptr;
+		if (acl::error_result result = acl::compress_track_list(allocator, rawTrackList, compressSettings, compressedTracks, stats); result.any())
+		{
+			BEY_CONSOLE_LOG_ERROR("Animation crowd benchmark failed to compress its clip with error code {0}", result.c_str());
+			return;
+		}
+
+		const Animation clip((float)(numClipSamples - 1) / clipSampleRate, numTracks, compressedTracks);
+		const auto characterTime = [&clip](uint32_t frame, uint32_t character)
+		{
+			const float offset = clip.GetDuration() * (float)(character % numGroups) / (float)numGroups;
+			return glm::mod((float)frame * timestep + offset, clip.GetDuration());
+		};
+
+		std::vector<Pose> referencePoses(numCharacters);
+		std::vector<Pose> poses(numCharacters);
+
+		// A decompression context per character, the way each graph node used to have its own
+		std::vector<acl::decompression_context<acl::default_transform_decompression_settings>> contexts(numCharacters);
+		Timer timer;
+		for (uint32_t frame = 0; frame < numFrames; ++frame)
+		{
+			for (uint32_t character = 0; character < numCharacters; ++character)
+			{
+				auto& context = contexts[character];
+				if (!context.is_bound_to(*compressedTracks))
+					context.initialize(*compressedTracks);
+
+				PoseTrackWriter writer(&referencePoses[character]);
+				context.seek(characterTime(frame, character), acl::sample_rounding_policy::none);
+				context.decompress_tracks(writer);
+			}
+		}
+		const float contextPerCharacterMs = timer.ElapsedMillis();
+
+		// Through the sample cache
+		AnimationSampler::NewFrame();
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+		timer.Reset();
+		for (uint32_t frame = 0; frame < numFrames; ++frame)
+		{
+			for (uint32_t character = 0; character < numCharacters; ++character)
+				AnimationSampler::Sample(&clip, characterTime(frame, character), &poses[character]);
+
+			AnimationSampler::NewFrame();
+			const AnimationSampler::Statistics statistics = AnimationSampler::GetStatistics();
+			hits += statistics.Hits;
+			misses += statistics.Misses;
+		}
+		const float cachedMs = timer.ElapsedMillis();
+
+		// Both loops end on the same frame, the difference comes from quantizing the sample time
+		float maxTranslationDifference = 0.0f;
+		float maxRotationDifference = 0.0f;
+		for (uint32_t character = 0; character < numCharacters; ++character)
+		{
+			for (uint32_t i = 0; i < numTracks; ++i)
+			{
+				const LocalTransform& reference = referencePoses[character].BoneTransforms[i];
+				const LocalTransform& cached = poses[character].BoneTransforms[i];
+				maxTranslationDifference = glm::max(maxTranslationDifference, glm::length(reference.Translation - cached.Translation));
+				maxRotationDifference = glm::max(maxRotationDifference, 1.0f - glm::abs(glm::dot(reference.Rotation, cached.Rotation)));
+			}
+		}
+
+		const uint64_t numSamples = (uint64_t)numFrames * numCharacters;
+		BEY_CONSOLE_LOG_INFO("Animation crowd benchmark, {} characters in {} groups, {} frames of a {} track clip", numCharacters, numGroups, numFrames, numTracks);
+		BEY_CONSOLE_LOG_INFO("  Decompression context per character: {:.2f} ms ({:.2f} us per character)", contextPerCharacterMs, contextPerCharacterMs * 1000.0f / numSamples);
+		BEY_CONSOLE_LOG_INFO("  Shared sample cache:                 {:.2f} ms ({:.2f} us per character, {:.1f}x faster)", cachedMs, cachedMs * 1000.0f / numSamples, cachedMs > 0.0f ? contextPerCharacterMs / cachedMs : 0.0f);
+		BEY_CONSOLE_LOG_INFO("  Cache hits {}, misses {} ({:.1f}% hit rate)", hits, misses, 100.0f * (float)hits / (float)numSamples);
+		BEY_CONSOLE_LOG_INFO("  Max difference between the two: translation {}, rotation (1 - |dot|) {}", maxTranslationDifference, maxRotationDifference);
+	}
+
+
+	void RunEntityCallbacks()
+	{
+		constexpr uint32_t numEntities = 10000;
+		constexpr uint32_t numFrames = 10;
+		constexpr float ts = 1.0f / 60.0f;
+
+		ManagedClass* entityClass = BEY_CORE_CLASS(Entity);
+		ManagedMethod* onUpdateMethod = BEY_CACHED_METHOD("Beyond.Entity", "OnUpdate", 1);
+		if (!entityClass || !onUpdateMethod)
+		{
+			BEY_CONSOLE_LOG_ERROR("Script callback benchmark needs the C# core assembly to be loaded");
+			return;
+		}
+
+		// Entity's OnUpdate is empty, so this measures the cost of getting to the method.
+		// The instances aren't backed by scene entities, they only receive OnUpdate.
+		std::vector<GCHandle> instances(numEntities);
+		for (uint32_t i = 0; i < numEntities; ++i)
+			instances[i] = GCManager::CreateObjectReference(ScriptEngine::CreateManagedObject("Beyond.Entity", (uint64_t)(i + 1)), false);
+
+		Timer timer;
+		for (uint32_t frame = 0; frame < numFrames; ++frame)
+		{
+			for (GCHandle instance : instances)
+				ScriptEngine::CallMethod(instance, "OnUpdate", ts);
+		}
+		const float byNameMs = timer.ElapsedMillis();
+
+		ManagedMethodThunk<MonoObject*, float> onUpdate(onUpdateMethod);
+		timer.Reset();
+		for (uint32_t frame = 0; frame < numFrames; ++frame)
+		{
+			for (GCHandle instance : instances)
+			{
+				MonoException* exception = nullptr;
+				onUpdate.Invoke(GCManager::GetReferencedObject(instance), ts, &exception);
+				ScriptUtils::HandleException((MonoObject*)exception);
+			}
+		}
+		const float thunkMs = timer.ElapsedMillis();
+
+		for (GCHandle instance : instances)
+			GCManager::ReleaseObjectReference(instance);
+		GCManager::CollectGarbage();
+
+		const float numCalls = (float)(numEntities * numFrames);
+		BEY_CONSOLE_LOG_INFO("Script callback benchmark, OnUpdate on {} entities for {} frames", numEntities, numFrames);
+		BEY_CONSOLE_LOG_INFO("  By method name (mono_runtime_invoke): {:.2f} ms ({:.3f} us per call)", byNameMs, byNameMs * 1000.0f / numCalls);
+		BEY_CONSOLE_LOG_INFO("  Cached unmanaged thunk:               {:.2f} ms ({:.3f} us per call, {:.1f}x faster)", thunkMs, thunkMs * 1000.0f / numCalls, thunkMs > 0.0f ? byNameMs / thunkMs : 0.0f);
+		BEY_CONSOLE_LOG_INFO("  Grouped by class: Beyond.Entity doesn't override OnUpdate, so none of the calls are made");
+	}
+
+}
+
+#endif
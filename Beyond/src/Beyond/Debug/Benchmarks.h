@@ -0,0 +1,40 @@
+#pragma once
+
+#ifndef BEY_DIST
+
+#include "Beyond/Core/Ref.h"
+
+namespace Beyond {
+	class Scene;
+}
+
+// Micro benchmarks of engine subsystems, run from the editor's Tools menu.
+// Each of them runs on the calling thread and logs its timings to the console.
+namespace Beyond::Benchmarks {
+
+	// Loads a generated scene from YAML and from the binary encoding
+	void RunSceneLoad(uint32_t entityCount);
+
+	// Renders the same synth voice graph per sample and in blocks, logs the voices per core
+	void RunSoundGraphBlockProcessing(uint32_t voiceCount);
+
+	// Renders the same fixed input through revmodel's per sample and block processing
+	void RunReverbBlockProcessing();
+
+	// Blends the same poses with the per-bone glm::mix / glm::slerp path and with the PoseBlending kernels
+	void RunPoseBlending();
+
+	// Processes the animation graphs of the scene with 1, 2, 4... threads up to JobSystem::GetMaxConcurrency().
+	// Graphs are advanced by the frames the benchmark runs for.
+	void RunAnimationEvaluation(const Ref<Scene>& scene);
+
+	// Plays a synthetic clip on a crowd of characters, some of which are in step with each other,
+	// decompressing with a context per character and through the AnimationSampler cache
+	void RunAnimationCrowd();
+
+	// Calls OnUpdate on 10k entity instances by method name and through a cached thunk
+	void RunEntityCallbacks();
+
+}
+
+#endif
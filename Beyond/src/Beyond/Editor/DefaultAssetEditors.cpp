@@ -629,6 +629,11 @@ namespace Beyond {
 
 			UI::Property("Master Reverb send", soundConfig.MasterReverbSend, 0.01f, 0.0f, 1.0f);
 
+			propertyGridSpacing();
+			propertyGridSpacing();
+
+			UI::Property("Priority", soundConfig.Priority, (uint8_t)0, (uint8_t)255, "Voices with higher priority stay real when there are more playing voices than the real voice limit.");
+
 			UI::EndPropertyGrid();
 			UI::PopID();
 
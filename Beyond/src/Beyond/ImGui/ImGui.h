@@ -2309,7 +2309,6 @@ namespace Beyond::UI {
 			preview = "Null";
 		}
 
-		auto& assets = AssetManager::GetLoadedAssets();
 		AssetHandle current = *selected;
 
 		ImGui::SetNextWindowSize(size);
@@ -2317,7 +2316,7 @@ namespace Beyond::UI {
 		{
 			ImGui::SetKeyboardFocusHere(0);
 
-			for (auto& [handle, asset] : assets)
+			for (const auto& [handle, asset] : AssetManager::GetLoadedAssets())
 			{
 				if (asset->GetAssetType() != TAssetType::GetStaticType())
 					continue;
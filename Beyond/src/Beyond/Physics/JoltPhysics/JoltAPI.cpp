@@ -4,6 +4,9 @@
 #include "JoltScene.h"
 #include "JoltCookingFactory.h"
 #include "JoltCaptureManager.h"
+#include "JoltJobSystem.h"
+
+#include "Beyond/Core/Application.h"
 
 #include <Jolt/RegisterTypes.h>
 #include <Jolt/Core/Factory.h>
@@ -17,7 +20,7 @@ namespace Beyond {
 	struct JoltData
 	{
 		JPH::TempAllocator* TemporariesAllocator;
-		std::unique_ptr<JPH::JobSystemThreadPool> JobThreadPool;
+		std::unique_ptr<JoltJobSystem> JobSystem;
 
 		eastl::string LastErrorMessage = "";
 
@@ -85,8 +88,8 @@ namespace Beyond {
 		s_JoltData->TemporariesAllocator = new JPH::TempAllocatorImpl(300 * 1024 * 1024); // 10 mb
 #endif
 
-		// NOTE: Just construct the thread pool for now, don't start the threads
-		s_JoltData->JobThreadPool = std::make_unique<JPH::JobSystemThreadPool>(2048, 8, 6);
+		// NOTE: Jolt jobs run on the engine job system so physics doesn't oversubscribe the cores
+		s_JoltData->JobSystem = std::make_unique<JoltJobSystem>(Application::Get().GetJobSystem(), JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers);
 
 		s_JoltData->CookingFactory = Ref<JoltCookingFactory>::Create();
 		s_JoltData->CookingFactory->Init();
@@ -102,6 +105,7 @@ namespace Beyond {
 		s_JoltData->CookingFactory = nullptr;
 
 		delete s_JoltData->TemporariesAllocator;
+		s_JoltData->JobSystem.reset();
 
 		hdelete s_JoltData;
 		s_JoltData = nullptr;
@@ -110,7 +114,7 @@ namespace Beyond {
 	}
 
 	JPH::TempAllocator* JoltAPI::GetTempAllocator() const { return s_JoltData->TemporariesAllocator; }
-	JPH::JobSystemThreadPool* JoltAPI::GetJobThreadPool() const { return s_JoltData->JobThreadPool.get(); }
+	JPH::JobSystem* JoltAPI::GetJobSystem() const { return s_JoltData->JobSystem.get(); }
 
 	const eastl::string& JoltAPI::GetLastErrorMessage() const { return s_JoltData->LastErrorMessage; }
 
@@ -8,7 +8,7 @@
 
 #include <Jolt/Jolt.h>
 #include <Jolt/Core/TempAllocator.h>
-#include <Jolt/Core/JobSystemThreadPool.h>
+#include <Jolt/Core/JobSystem.h>
 #include <Jolt/Core/Profiler.h>
 
 namespace Beyond {
@@ -23,7 +23,7 @@ namespace Beyond {
 		virtual void Shutdown() override;
 
 		JPH::TempAllocator* GetTempAllocator() const;
-		JPH::JobSystemThreadPool* GetJobThreadPool() const;
+		JPH::JobSystem* GetJobSystem() const;
 
 		virtual const eastl::string& GetLastErrorMessage() const override;
 		virtual Ref<PhysicsScene> CreateScene(const Ref<Scene>& scene) const override;
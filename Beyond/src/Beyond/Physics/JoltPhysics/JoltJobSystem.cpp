@@ -0,0 +1,67 @@
+#include "pch.h"
+#include "JoltJobSystem.h"
+
+namespace Beyond {
+
+	static std::atomic<bool> s_WarnedPoolExhausted = false;
+
+	JoltJobSystem::JoltJobSystem(Beyond::JobSystem& jobSystem, uint32_t maxJobs, uint32_t maxBarriers)
+		: JPH::JobSystemWithBarrier(maxBarriers), m_JobSystem(jobSystem)
+	{
+		m_Jobs.Init(maxJobs, maxJobs);
+	}
+
+	int JoltJobSystem::GetMaxConcurrency() const
+	{
+		return (int)m_JobSystem.GetMaxConcurrency();
+	}
+
+	JPH::JobHandle JoltJobSystem::CreateJob(const char* inName, JPH::ColorArg inColor, const JobFunction& inJobFunction, JPH::uint32 inNumDependencies)
+	{
+		uint32_t index;
+		for (;;)
+		{
+			index = m_Jobs.ConstructObject(inName, inColor, this, inJobFunction, inNumDependencies);
+			if (index != JPH::FixedSizeFreeList<Job>::cInvalidObjectIndex)
+				break;
+
+			// Wait for Jolt to free up a job, only warning the first time it happens
+			if (!s_WarnedPoolExhausted.exchange(true, std::memory_order_relaxed))
+				BEY_CORE_WARN_TAG("Physics", "Jolt: no jobs available, waiting for one to be freed. Consider increasing maxJobs");
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+		}
+
+		Job* job = &m_Jobs.Get(index);
+
+		// Construct handle to keep a reference, the job is queued below and may immediately complete
+		JPH::JobHandle handle(job);
+
+		if (inNumDependencies == 0)
+			QueueJob(job);
+
+		return handle;
+	}
+
+	void JoltJobSystem::QueueJob(Job* inJob)
+	{
+		// Keep the job alive while it sits in our queue, a barrier may still execute it first in which case Execute is a no-op
+		inJob->AddRef();
+		m_JobSystem.Schedule([inJob]()
+		{
+			inJob->Execute();
+			inJob->Release();
+		});
+	}
+
+	void JoltJobSystem::QueueJobs(Job** inJobs, JPH::uint inNumJobs)
+	{
+		for (JPH::uint i = 0; i < inNumJobs; i++)
+			QueueJob(inJobs[i]);
+	}
+
+	void JoltJobSystem::FreeJob(Job* inJob)
+	{
+		m_Jobs.DestructObject(inJob);
+	}
+
+}
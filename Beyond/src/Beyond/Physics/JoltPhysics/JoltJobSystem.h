@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Beyond/Core/JobSystem.h"
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/JobSystemWithBarrier.h>
+#include <Jolt/Core/FixedSizeFreeList.h>
+
+namespace Beyond {
+
+	/// Runs Jolt jobs on the engine JobSystem instead of a separate thread pool,
+	/// barrier handling is left to JPH::JobSystemWithBarrier
+	class JoltJobSystem final : public JPH::JobSystemWithBarrier
+	{
+	public:
+		JoltJobSystem(Beyond::JobSystem& jobSystem, uint32_t maxJobs, uint32_t maxBarriers);
+		virtual ~JoltJobSystem() override = default;
+
+		virtual int GetMaxConcurrency() const override;
+		virtual JobHandle CreateJob(const char* inName, JPH::ColorArg inColor, const JobFunction& inJobFunction, JPH::uint32 inNumDependencies = 0) override;
+
+	protected:
+		virtual void QueueJob(Job* inJob) override;
+		virtual void QueueJobs(Job** inJobs, JPH::uint inNumJobs) override;
+		virtual void FreeJob(Job* inJob) override;
+
+	private:
+		Beyond::JobSystem& m_JobSystem; // NOTE: Qualified, JobSystem alone names the Jolt base class in here
+		JPH::FixedSizeFreeList<Job> m_Jobs;
+	};
+
+}
@@ -137,7 +137,7 @@ namespace Beyond {
 		if (m_CollisionSteps > 0)
 		{
 			BEY_PROFILE_SCOPE_DYNAMIC("JoltSystem::Update");
-			m_JoltSystem->Update(m_FixedTimeStep, m_CollisionSteps, 1, api->GetTempAllocator(), api->GetJobThreadPool());
+			m_JoltSystem->Update(m_FixedTimeStep, m_CollisionSteps, 1, api->GetTempAllocator(), api->GetJobSystem());
 		}
 		
 		for (auto& [entityID, characterController] : m_CharacterControllers)
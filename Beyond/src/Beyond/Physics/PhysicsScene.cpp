@@ -134,13 +134,7 @@ namespace Beyond {
 
 		SubStepStrategy(ts);
 
-		auto view = m_EntityScene->GetAllEntitiesWith<RigidBodyComponent, ScriptComponent>();
-
-		for (auto enttID : view)
-		{
-			const auto& scriptComponent = view.get<ScriptComponent>(enttID);
-			ScriptEngine::CallMethod(scriptComponent.ManagedInstance, "OnPhysicsUpdate", 0.0f);
-		}
+		ScriptEngine::OnPhysicsUpdateEntities(0.0f);
 
 		for (auto& [entityID, characterController] : m_CharacterControllers)
 			characterController->PreSimulate(ts);
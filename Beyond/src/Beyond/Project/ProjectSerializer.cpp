@@ -47,6 +47,10 @@ namespace Beyond {
 				out << YAML::BeginMap;
 				auto userConfig = MiniAudioEngine::Get().GetUserConfiguration();
 				BEY_SERIALIZE_PROPERTY(FileStreamingDurationThreshold, userConfig.FileStreamingDurationThreshold, out);
+				BEY_SERIALIZE_PROPERTY(StreamingMemoryBudgetMB, userConfig.StreamingMemoryBudgetMB, out);
+				BEY_SERIALIZE_PROPERTY(StreamingBufferDuration, userConfig.StreamingBufferDuration, out);
+				BEY_SERIALIZE_PROPERTY(MaxRealVoices, userConfig.MaxRealVoices, out);
+				BEY_SERIALIZE_PROPERTY(VirtualizationThresholdDB, userConfig.VirtualizationThresholdDB, out);
 				out << YAML::EndMap;
 			}
 
@@ -179,6 +183,10 @@ namespace Beyond {
 		{
 			auto userConfig = MiniAudioEngine::Get().GetUserConfiguration();
 			BEY_DESERIALIZE_PROPERTY(FileStreamingDurationThreshold, userConfig.FileStreamingDurationThreshold, audioNode, userConfig.FileStreamingDurationThreshold);
+			BEY_DESERIALIZE_PROPERTY(StreamingMemoryBudgetMB, userConfig.StreamingMemoryBudgetMB, audioNode, userConfig.StreamingMemoryBudgetMB);
+			BEY_DESERIALIZE_PROPERTY(StreamingBufferDuration, userConfig.StreamingBufferDuration, audioNode, userConfig.StreamingBufferDuration);
+			BEY_DESERIALIZE_PROPERTY(MaxRealVoices, userConfig.MaxRealVoices, audioNode, userConfig.MaxRealVoices);
+			BEY_DESERIALIZE_PROPERTY(VirtualizationThresholdDB, userConfig.VirtualizationThresholdDB, audioNode, userConfig.VirtualizationThresholdDB);
 			MiniAudioEngine::Get().SetUserConfiguration(userConfig);
 		}
 
@@ -4,49 +4,12 @@
 namespace Beyond {
 
 
-	struct MeshKey
+	// Raster passes a culled instance is drawn in
+	enum class InstanceVisibility : uint8_t
 	{
-		AssetHandle MeshHandle;
-		AssetHandle MaterialHandle;
-		uint32_t SubmeshIndex;
-		bool IsSelected;
-
-		MeshKey(AssetHandle meshHandle, AssetHandle materialHandle, uint32_t submeshIndex, bool isSelected)
-			: MeshHandle(meshHandle), MaterialHandle(materialHandle), SubmeshIndex(submeshIndex), IsSelected(isSelected)
-		{
-		}
-
-		bool operator==(const MeshKey& other) const
-		{
-			return MeshHandle == other.MeshHandle &&
-				MaterialHandle == other.MaterialHandle &&
-				SubmeshIndex == other.SubmeshIndex &&
-				IsSelected == other.IsSelected;
-		}
-
-		bool operator<(const MeshKey& other) const
-		{
-			if (MeshHandle < other.MeshHandle)
-				return true;
-
-			if (MeshHandle > other.MeshHandle)
-				return false;
-
-			if (SubmeshIndex < other.SubmeshIndex)
-				return true;
-
-			if (SubmeshIndex > other.SubmeshIndex)
-				return false;
-
-			if (MaterialHandle < other.MaterialHandle)
-				return true;
-
-			if (MaterialHandle > other.MaterialHandle)
-				return false;
-
-			return IsSelected < other.IsSelected;
-
-		}
+		All = 0,    // Geometry and shadow passes
+		ShadowOnly, // Outside of the view, but might cast a shadow into it
+		Culled      // Not drawn, the transform is only kept around for the raytracer
 	};
 
 	struct DrawCommand
@@ -58,6 +21,8 @@ namespace Beyond {
 
 		uint32_t InstanceCount = 0;
 		uint32_t InstanceOffset = 0;
+		uint32_t TransformIndex = 0;
+		uint32_t BoneTransformsBaseIndex = 0;
 		bool IsRigged = false;
 	};
 
@@ -70,36 +35,6 @@ namespace Beyond {
 
 		uint32_t InstanceCount = 0;
 		uint32_t InstanceOffset = 0;
-	};
-}
-
-namespace eastl {
-	template <>
-	struct hash<Beyond::MeshKey>
-	{
-		size_t operator()(const Beyond::MeshKey& key) const
-		{
-			std::size_t h1 = key.MeshHandle;
-			std::size_t h2 = key.MaterialHandle;
-			std::size_t h3 = std::hash<uint32_t>()(key.SubmeshIndex);
-			std::size_t h4 = std::hash<bool>()(key.IsSelected);
-			return h1 ^ (h2 << 1) ^ (h3 << 2) ^ (h4 << 3); // Combine the hashes
-		}
-	};
-}
-
-
-namespace std {
-	template <>
-	struct hash<Beyond::MeshKey>
-	{
-		size_t operator()(const Beyond::MeshKey& key) const noexcept
-		{
-			std::size_t h1 = key.MeshHandle;
-			std::size_t h2 = key.MaterialHandle;
-			std::size_t h3 = std::hash<uint32_t>()(key.SubmeshIndex);
-			std::size_t h4 = std::hash<bool>()(key.IsSelected);
-			return h1 ^ (h2 << 1) ^ (h3 << 2) ^ (h4 << 3); // Combine the hashes
-		}
+		uint32_t TransformIndex = 0;
 	};
 }
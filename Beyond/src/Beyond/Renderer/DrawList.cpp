@@ -0,0 +1,73 @@
+#include "pch.h"
+#include "DrawList.h"
+
+#include "Beyond/Debug/Profiler.h"
+
+namespace Beyond {
+
+	static uint64_t HashHandle(uint64_t handle, uint32_t bits)
+	{
+		// Fibonacci hashing, the top bits of the product are the well mixed ones
+		return ((handle ^ (handle >> 32)) * 0x9E3779B97F4A7C15ull) >> (64 - bits);
+	}
+
+	uint64_t DrawKeySorter::MakeKey(const DrawSubmission& submission)
+	{
+		const uint64_t category = ((uint64_t)submission.Lists << 1) | (uint64_t)submission.IsStatic;
+		return (category << 56)
+			| (HashHandle(submission.MaterialHandle, 24) << 32)
+			| (HashHandle(submission.MeshHandle, 20) << 12)
+			| ((uint64_t)submission.SubmeshIndex & 0xfff);
+	}
+
+	void DrawKeySorter::Sort(std::vector<DrawSortEntry>& entries, std::vector<DrawSortEntry>& scratch)
+	{
+		BEY_PROFILE_FUNC();
+
+		constexpr uint32_t PassCount = 8;
+		constexpr uint32_t BucketCount = 256;
+
+		const size_t count = entries.size();
+		if (count < 2)
+			return;
+
+		// All histograms are built in a single read of the keys
+		uint32_t histograms[PassCount][BucketCount] = {};
+		for (const DrawSortEntry& entry : entries)
+		{
+			for (uint32_t pass = 0; pass < PassCount; pass++)
+				histograms[pass][(entry.Key >> (pass * 8)) & 0xff]++;
+		}
+
+		scratch.resize(count);
+		DrawSortEntry* source = entries.data();
+		DrawSortEntry* destination = scratch.data();
+
+		for (uint32_t pass = 0; pass < PassCount; pass++)
+		{
+			uint32_t* histogram = histograms[pass];
+			const uint32_t shift = pass * 8;
+
+			// Every key has the same digit, this pass wouldn't change the order
+			if (histogram[(source[0].Key >> shift) & 0xff] == count)
+				continue;
+
+			uint32_t offset = 0;
+			for (uint32_t bucket = 0; bucket < BucketCount; bucket++)
+			{
+				const uint32_t bucketSize = histogram[bucket];
+				histogram[bucket] = offset;
+				offset += bucketSize;
+			}
+
+			for (size_t i = 0; i < count; i++)
+				destination[histogram[(source[i].Key >> shift) & 0xff]++] = source[i];
+
+			std::swap(source, destination);
+		}
+
+		if (source != entries.data())
+			entries.swap(scratch);
+	}
+
+}
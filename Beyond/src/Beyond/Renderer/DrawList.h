@@ -0,0 +1,79 @@
+#pragma once
+
+#include "DrawCommands.h"
+#include "VertexBuffer.h"
+
+namespace Beyond {
+
+	// Draw lists an instance ends up in, instances are only batched with instances that go into the same lists
+	enum class DrawListFlag : uint8_t
+	{
+		None        = 0,
+		Geometry    = BIT(0),
+		Transparent = BIT(1),
+		Selected    = BIT(2),
+		Shadow      = BIT(3),
+		Collider    = BIT(4)
+	};
+
+	/// One submitted instance, appended to a per-frame array and batched into draw commands in SceneRenderer::PreRender
+	struct DrawSubmission
+	{
+		// Identity, instances are batched when all of these match
+		AssetHandle MeshHandle = 0;
+		AssetHandle MaterialHandle = 0;
+		uint32_t SubmeshIndex = 0;
+		uint8_t Lists = 0;
+		bool IsStatic = false;
+		Material* OverrideMaterial = nullptr;
+
+		// Payload
+		Mesh* Mesh = nullptr;
+		StaticMesh* StaticMesh = nullptr;
+		MaterialTable* MaterialTable = nullptr;
+		bool IsRigged = false;
+		uint32_t BoneTransformsIndex = 0;
+		TransformVertexData Transform;
+		uint64_t InstanceID = 0; // UUID of the submitting entity, previous frame transforms are looked up by it. 0 if not tracked.
+
+		void AddToList(DrawListFlag list) { Lists |= (uint8_t)list; }
+		bool IsInList(DrawListFlag list) const { return Lists & (uint8_t)list; }
+
+		void SetTransform(const glm::mat4& transform)
+		{
+			Transform.MRow[0] = { transform[0][0], transform[1][0], transform[2][0], transform[3][0] };
+			Transform.MRow[1] = { transform[0][1], transform[1][1], transform[2][1], transform[3][1] };
+			Transform.MRow[2] = { transform[0][2], transform[1][2], transform[2][2], transform[3][2] };
+		}
+
+		bool IsSameBatch(const DrawSubmission& other) const
+		{
+			return MeshHandle == other.MeshHandle &&
+				MaterialHandle == other.MaterialHandle &&
+				SubmeshIndex == other.SubmeshIndex &&
+				Lists == other.Lists &&
+				IsStatic == other.IsStatic &&
+				OverrideMaterial == other.OverrideMaterial;
+		}
+	};
+
+	struct DrawSortEntry
+	{
+		uint64_t Key;
+		uint32_t Index; // Into the submission array
+	};
+
+	class DrawKeySorter
+	{
+	public:
+		/// Packs lists (8 bits) | material (24 bits) | mesh (20 bits) | submesh (12 bits), so sorted
+		/// instances of a batch are adjacent and batches sharing a material follow each other.
+		/// The handles are hashed, equal keys don't guarantee equal identities.
+		static uint64_t MakeKey(const DrawSubmission& submission);
+
+		/// Stable LSD radix sort on DrawSortEntry::Key, 8 bits per pass. Passes in which every key
+		/// has the same digit are skipped. scratch is resized as needed and can be reused across frames.
+		static void Sort(std::vector<DrawSortEntry>& entries, std::vector<DrawSortEntry>& scratch);
+	};
+
+}
@@ -0,0 +1,183 @@
+#include "pch.h"
+#include "FrustumCulling.h"
+
+#include "Beyond/Debug/Profiler.h"
+
+#if defined(_M_X64) || defined(__SSE2__)
+	#define BEY_CULLING_SSE 1
+	#include <emmintrin.h>
+#else
+	#define BEY_CULLING_SSE 0
+#endif
+
+namespace Beyond {
+
+	Frustum Frustum::FromViewProjection(const glm::mat4& viewProjection, bool includeNearPlane)
+	{
+		// Gribb/Hartmann, glm is column major so row i is (m[0][i], m[1][i], m[2][i], m[3][i])
+		const glm::mat4 m = glm::transpose(viewProjection);
+
+		Frustum frustum;
+		frustum.Planes[frustum.PlaneCount++] = m[3] + m[0]; // Left
+		frustum.Planes[frustum.PlaneCount++] = m[3] - m[0]; // Right
+		frustum.Planes[frustum.PlaneCount++] = m[3] + m[1]; // Bottom
+		frustum.Planes[frustum.PlaneCount++] = m[3] - m[1]; // Top
+		frustum.Planes[frustum.PlaneCount++] = m[3] - m[2]; // Far
+		if (includeNearPlane)
+			frustum.Planes[frustum.PlaneCount++] = m[2]; // Near
+
+		for (uint32_t i = 0; i < frustum.PlaneCount; i++)
+		{
+			const float length = glm::length(glm::vec3(frustum.Planes[i]));
+			if (length > 0.0f)
+				frustum.Planes[i] /= length;
+		}
+
+		return frustum;
+	}
+
+	void CullingBounds::Clear()
+	{
+		m_Count = 0;
+	}
+
+	void CullingBounds::Resize(uint32_t paddedCount)
+	{
+		// Padding entries stay zero-sized at the origin, their results are never read
+		m_CenterX.resize(paddedCount, 0.0f);
+		m_CenterY.resize(paddedCount, 0.0f);
+		m_CenterZ.resize(paddedCount, 0.0f);
+		m_ExtentX.resize(paddedCount, 0.0f);
+		m_ExtentY.resize(paddedCount, 0.0f);
+		m_ExtentZ.resize(paddedCount, 0.0f);
+	}
+
+	uint32_t CullingBounds::Add(const AABB& localBounds, const glm::mat4& transform)
+	{
+		if (m_Count + 1 > (uint32_t)m_CenterX.size())
+			Resize(glm::max(((m_Count + 1) + 3) & ~3u, (uint32_t)m_CenterX.size() * 2));
+
+		// Arvo: the world extents are the local extents projected onto the absolute basis vectors
+		const glm::vec3 localCenter = (localBounds.Min + localBounds.Max) * 0.5f;
+		const glm::vec3 localExtent = (localBounds.Max - localBounds.Min) * 0.5f;
+
+		const glm::vec3 center = glm::vec3(transform * glm::vec4(localCenter, 1.0f));
+		const glm::vec3 extent = glm::abs(glm::vec3(transform[0])) * localExtent.x
+			+ glm::abs(glm::vec3(transform[1])) * localExtent.y
+			+ glm::abs(glm::vec3(transform[2])) * localExtent.z;
+
+		const uint32_t index = m_Count++;
+		m_CenterX[index] = center.x;
+		m_CenterY[index] = center.y;
+		m_CenterZ[index] = center.z;
+		m_ExtentX[index] = extent.x;
+		m_ExtentY[index] = extent.y;
+		m_ExtentZ[index] = extent.z;
+		return index;
+	}
+
+	void FrustumCuller::CullFrustum(const CullingBounds& bounds, const Frustum& frustum, uint8_t flag, uint8_t* results)
+	{
+		BEY_PROFILE_FUNC();
+
+		const uint32_t count = bounds.m_Count;
+
+#if BEY_CULLING_SSE
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+		for (uint32_t i = 0; i < count; i += 4)
+		{
+			const __m128 cx = _mm_loadu_ps(&bounds.m_CenterX[i]);
+			const __m128 cy = _mm_loadu_ps(&bounds.m_CenterY[i]);
+			const __m128 cz = _mm_loadu_ps(&bounds.m_CenterZ[i]);
+			const __m128 ex = _mm_loadu_ps(&bounds.m_ExtentX[i]);
+			const __m128 ey = _mm_loadu_ps(&bounds.m_ExtentY[i]);
+			const __m128 ez = _mm_loadu_ps(&bounds.m_ExtentZ[i]);
+
+			__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+			for (uint32_t p = 0; p < frustum.PlaneCount; p++)
+			{
+				const glm::vec4& plane = frustum.Planes[p];
+				const __m128 nx = _mm_set1_ps(plane.x);
+				const __m128 ny = _mm_set1_ps(plane.y);
+				const __m128 nz = _mm_set1_ps(plane.z);
+
+				// Signed distance of the center + projected radius of the box onto the plane normal
+				__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, cx), _mm_mul_ps(ny, cy)), _mm_add_ps(_mm_mul_ps(nz, cz), _mm_set1_ps(plane.w)));
+				__m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_and_ps(nx, absMask), ex), _mm_mul_ps(_mm_and_ps(ny, absMask), ey)), _mm_mul_ps(_mm_and_ps(nz, absMask), ez));
+
+				inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(distance, radius), zero));
+			}
+
+			const int mask = _mm_movemask_ps(inside);
+			const uint32_t laneCount = glm::min(count - i, 4u);
+			for (uint32_t lane = 0; lane < laneCount; lane++)
+			{
+				if (mask & (1 << lane))
+					results[i + lane] |= flag;
+			}
+		}
+#else
+		for (uint32_t i = 0; i < count; i++)
+		{
+			bool inside = true;
+			for (uint32_t p = 0; p < frustum.PlaneCount && inside; p++)
+			{
+				const glm::vec4& plane = frustum.Planes[p];
+				const float distance = plane.x * bounds.m_CenterX[i] + plane.y * bounds.m_CenterY[i] + plane.z * bounds.m_CenterZ[i] + plane.w;
+				const float radius = glm::abs(plane.x) * bounds.m_ExtentX[i] + glm::abs(plane.y) * bounds.m_ExtentY[i] + glm::abs(plane.z) * bounds.m_ExtentZ[i];
+				inside = distance + radius >= 0.0f;
+			}
+
+			if (inside)
+				results[i] |= flag;
+		}
+#endif
+	}
+
+	void FrustumCuller::CullDistance(const CullingBounds& bounds, const glm::vec3& origin, float maxDistance, uint8_t flag, uint8_t* results)
+	{
+		BEY_PROFILE_FUNC();
+
+		const uint32_t count = bounds.m_Count;
+		const float maxDistanceSq = maxDistance * maxDistance;
+
+#if BEY_CULLING_SSE
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+		const __m128 ox = _mm_set1_ps(origin.x);
+		const __m128 oy = _mm_set1_ps(origin.y);
+		const __m128 oz = _mm_set1_ps(origin.z);
+		const __m128 limit = _mm_set1_ps(maxDistanceSq);
+
+		for (uint32_t i = 0; i < count; i += 4)
+		{
+			// Distance from the origin to the closest point of the box, per axis
+			const __m128 dx = _mm_max_ps(_mm_sub_ps(_mm_and_ps(_mm_sub_ps(_mm_loadu_ps(&bounds.m_CenterX[i]), ox), absMask), _mm_loadu_ps(&bounds.m_ExtentX[i])), zero);
+			const __m128 dy = _mm_max_ps(_mm_sub_ps(_mm_and_ps(_mm_sub_ps(_mm_loadu_ps(&bounds.m_CenterY[i]), oy), absMask), _mm_loadu_ps(&bounds.m_ExtentY[i])), zero);
+			const __m128 dz = _mm_max_ps(_mm_sub_ps(_mm_and_ps(_mm_sub_ps(_mm_loadu_ps(&bounds.m_CenterZ[i]), oz), absMask), _mm_loadu_ps(&bounds.m_ExtentZ[i])), zero);
+
+			const __m128 distanceSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+			const int mask = _mm_movemask_ps(_mm_cmpgt_ps(distanceSq, limit));
+
+			const uint32_t laneCount = glm::min(count - i, 4u);
+			for (uint32_t lane = 0; lane < laneCount; lane++)
+			{
+				if (mask & (1 << lane))
+					results[i + lane] &= ~flag;
+			}
+		}
+#else
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const float dx = glm::max(glm::abs(bounds.m_CenterX[i] - origin.x) - bounds.m_ExtentX[i], 0.0f);
+			const float dy = glm::max(glm::abs(bounds.m_CenterY[i] - origin.y) - bounds.m_ExtentY[i], 0.0f);
+			const float dz = glm::max(glm::abs(bounds.m_CenterZ[i] - origin.z) - bounds.m_ExtentZ[i], 0.0f);
+			if (dx * dx + dy * dy + dz * dz > maxDistanceSq)
+				results[i] &= ~flag;
+		}
+#endif
+	}
+
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Beyond/Core/Math/AABB.h"
+
+#include <glm/glm.hpp>
+
+namespace Beyond {
+
+	struct Frustum
+	{
+		static constexpr uint32_t MaxPlanes = 6;
+
+		// xyz = normal pointing into the frustum, w = distance
+		glm::vec4 Planes[MaxPlanes];
+		uint32_t PlaneCount = 0;
+
+		// Expects a [0, 1] depth range. Shadow casters in front of a cascade's near plane still cast
+		// into it, so the near plane can be left out.
+		static Frustum FromViewProjection(const glm::mat4& viewProjection, bool includeNearPlane = true);
+	};
+
+	/// World space AABBs of culling candidates as flat SoA arrays (center + half extents),
+	/// padded to a multiple of 4 so that every plane test processes four boxes at once.
+	class CullingBounds
+	{
+	public:
+		void Clear();
+
+		// Transforms localBounds by transform and appends the result, returns the index of the new entry
+		uint32_t Add(const AABB& localBounds, const glm::mat4& transform);
+
+		uint32_t GetCount() const { return m_Count; }
+
+	private:
+		void Resize(uint32_t paddedCount);
+
+	private:
+		uint32_t m_Count = 0;
+		std::vector<float> m_CenterX, m_CenterY, m_CenterZ;
+		std::vector<float> m_ExtentX, m_ExtentY, m_ExtentZ;
+
+		friend class FrustumCuller;
+	};
+
+	class FrustumCuller
+	{
+	public:
+		/// Sets flag in results[i] for every box that is at least partially inside the frustum
+		static void CullFrustum(const CullingBounds& bounds, const Frustum& frustum, uint8_t flag, uint8_t* results);
+
+		/// Clears flag in results[i] for every box that is entirely further than maxDistance from origin
+		static void CullDistance(const CullingBounds& bounds, const glm::vec3& origin, float maxDistance, uint8_t flag, uint8_t* results);
+	};
+
+}
@@ -8,16 +8,99 @@
 
 namespace Beyond {
 
-	RenderCommandQueue::RenderCommandQueue()
-	{
-		m_CommandBuffer = hnew uint8_t[10 * 1024 * 1024]; // 10mb buffer
-		m_CommandBufferPtr = m_CommandBuffer;
-		memset(m_CommandBuffer, 0, 10 * 1024 * 1024);
+	namespace Utils {
+
+		static uint8_t* AllocateCommandChunk(uint32_t capacity)
+		{
+			return (uint8_t*)::operator new(capacity, std::align_val_t(RenderCommandQueue::CommandAlignment));
+		}
+
+		static void FreeCommandChunk(uint8_t* memory)
+		{
+			::operator delete(memory, std::align_val_t(RenderCommandQueue::CommandAlignment));
+		}
+
+		// Standard size chunks shared by all queues. Queues free their own chunks on destruction so
+		// the pool never has to outlive a (static) queue.
+		struct CommandChunkPool
+		{
+			std::mutex Mutex;
+			std::vector<uint8_t*> FreeChunks;
+
+			~CommandChunkPool()
+			{
+				for (uint8_t* memory : FreeChunks)
+					FreeCommandChunk(memory);
+			}
+		};
+
+		static CommandChunkPool& GetCommandChunkPool()
+		{
+			static CommandChunkPool pool;
+			return pool;
+		}
+
 	}
 
 	RenderCommandQueue::~RenderCommandQueue()
 	{
-		delete[] m_CommandBuffer;
+		for (Chunk& chunk : m_Chunks)
+			Utils::FreeCommandChunk(chunk.Memory);
+	}
+
+	RenderCommandQueue::Chunk& RenderCommandQueue::AddChunk(uint32_t minCapacity)
+	{
+		Chunk& chunk = m_Chunks.emplace_back();
+		if (minCapacity > ChunkSize)
+		{
+			// Oversized commands get a chunk of their own, it isn't pooled
+			chunk.Memory = Utils::AllocateCommandChunk(minCapacity);
+			chunk.Capacity = minCapacity;
+			return chunk;
+		}
+
+		{
+			auto& pool = Utils::GetCommandChunkPool();
+			std::scoped_lock lock(pool.Mutex);
+			if (!pool.FreeChunks.empty())
+			{
+				chunk.Memory = pool.FreeChunks.back();
+				pool.FreeChunks.pop_back();
+			}
+		}
+
+		if (!chunk.Memory)
+			chunk.Memory = Utils::AllocateCommandChunk(ChunkSize);
+		chunk.Capacity = ChunkSize;
+		return chunk;
+	}
+
+	void RenderCommandQueue::ReleaseChunks(bool keepFirst)
+	{
+		const size_t firstReleased = keepFirst && !m_Chunks.empty() && m_Chunks[0].Capacity == ChunkSize ? 1 : 0;
+
+		{
+			auto& pool = Utils::GetCommandChunkPool();
+			std::scoped_lock lock(pool.Mutex);
+			for (size_t i = firstReleased; i < m_Chunks.size(); i++)
+			{
+				if (m_Chunks[i].Capacity == ChunkSize)
+					pool.FreeChunks.push_back(m_Chunks[i].Memory);
+				else
+					Utils::FreeCommandChunk(m_Chunks[i].Memory);
+			}
+		}
+
+		m_Chunks.resize(firstReleased);
+		if (!m_Chunks.empty())
+			m_Chunks[0].Size = 0;
+	}
+
+	void RenderCommandQueue::UpdatePeaks()
+	{
+		m_Statistics.ChunkCount = (uint32_t)m_Chunks.size();
+		m_Statistics.PeakCommandCount = std::max(m_Statistics.PeakCommandCount, m_Statistics.CommandCount);
+		m_Statistics.PeakUsedBytes = std::max(m_Statistics.PeakUsedBytes, m_Statistics.UsedBytes);
 	}
 
 	void* RenderCommandQueue::Allocate(RenderCommandFn fn, uint32_t size
@@ -26,45 +109,87 @@ namespace Beyond {
 #endif
 	)
 	{
-		// TODO: alignment
-		*(RenderCommandFn*)m_CommandBufferPtr = fn;
-		m_CommandBufferPtr += sizeof(RenderCommandFn);
+		const uint32_t payloadSize = (size + CommandAlignment - 1) & ~(CommandAlignment - 1);
+		const uint32_t commandSize = (uint32_t)sizeof(CommandHeader) + payloadSize;
 
-		*(uint32_t*)m_CommandBufferPtr = size;
-		m_CommandBufferPtr += sizeof(uint32_t);
+		Chunk* chunk = m_Chunks.empty() ? nullptr : &m_Chunks.back();
+		if (!chunk || chunk->Size + commandSize > chunk->Capacity)
+			chunk = &AddChunk(commandSize);
 
-		void* memory = m_CommandBufferPtr;
-		m_CommandBufferPtr += size;
+		CommandHeader* header = (CommandHeader*)(chunk->Memory + chunk->Size);
+		header->Function = fn;
+		header->Size = payloadSize;
+		chunk->Size += commandSize;
 
 #ifdef SUBMIT_STACK_TRACES
 		m_StackTraces.emplace_back(st);
 #endif
 
-		m_CommandCount++;
-		return memory;
+		m_Statistics.CommandCount++;
+		m_Statistics.UsedBytes += commandSize;
+		UpdatePeaks();
+		return header + 1;
+	}
+
+	void RenderCommandQueue::Append(RenderCommandQueue& other)
+	{
+		if (other.m_Statistics.CommandCount == 0)
+			return;
+
+		// The chunk that was being written to stays in front of the appended ones, commands recorded
+		// afterwards go behind them
+		for (Chunk& chunk : other.m_Chunks)
+		{
+			if (chunk.Size > 0)
+			{
+				m_Chunks.push_back(chunk);
+				chunk = {};
+			}
+		}
+		std::erase_if(other.m_Chunks, [](const Chunk& chunk) { return chunk.Memory == nullptr; });
+		other.ReleaseChunks(false);
+
+		m_Statistics.CommandCount += other.m_Statistics.CommandCount;
+		m_Statistics.UsedBytes += other.m_Statistics.UsedBytes;
+		UpdatePeaks();
+
+		other.m_Statistics.CommandCount = 0;
+		other.m_Statistics.UsedBytes = 0;
+		other.m_Statistics.ChunkCount = 0;
+
+#ifdef SUBMIT_STACK_TRACES
+		for (auto& st : other.m_StackTraces)
+			m_StackTraces.emplace_back(std::move(st));
+		other.m_StackTraces.clear();
+#endif
 	}
 
 	void RenderCommandQueue::Execute()
 	{
 		BEY_PROFILE_FUNC();
-		//BEY_RENDER_TRACE("RenderCommandQueue::Execute -- {0} commands, {1} bytes", m_CommandCount, (m_CommandBufferPtr - m_CommandBuffer));
-		byte* buffer = m_CommandBuffer;
+		//BEY_RENDER_TRACE("RenderCommandQueue::Execute -- {0} commands, {1} bytes", m_Statistics.CommandCount, m_Statistics.UsedBytes);
 
-		for (uint32_t i = 0; i < m_CommandCount; i++)
+#ifdef SUBMIT_STACK_TRACES
+		uint32_t commandIndex = 0;
+#endif
+		for (const Chunk& chunk : m_Chunks)
 		{
-			RenderCommandFn function = *(RenderCommandFn*)buffer;
-			buffer += sizeof(RenderCommandFn);
-			uint32_t size = *(uint32_t*)buffer;
-			buffer += sizeof(uint32_t);
+			uint32_t offset = 0;
+			while (offset < chunk.Size)
+			{
+				CommandHeader* header = (CommandHeader*)(chunk.Memory + offset);
 #ifdef SUBMIT_STACK_TRACES
-			[[maybe_unused]] const auto& st = m_StackTraces.at(i);
+				[[maybe_unused]] const auto& st = m_StackTraces.at(commandIndex++);
 #endif
-			function(buffer);
-			buffer += size;
+				header->Function(header + 1);
+				offset += (uint32_t)sizeof(CommandHeader) + header->Size;
+			}
 		}
 
-		m_CommandBufferPtr = m_CommandBuffer;
-		m_CommandCount = 0;
+		ReleaseChunks(true);
+		m_Statistics.CommandCount = 0;
+		m_Statistics.UsedBytes = 0;
+		m_Statistics.ChunkCount = (uint32_t)m_Chunks.size();
 #ifdef SUBMIT_STACK_TRACES
 		m_StackTraces.clear();
 #endif
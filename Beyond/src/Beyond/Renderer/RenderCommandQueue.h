@@ -1,36 +1,85 @@
 #pragma once
-#include <EASTL/fixed_vector.h>
 
 //#define SUBMIT_STACK_TRACES
 
 namespace Beyond {
 
+	/// Linear command storage made of fixed size chunks. Chunks are taken from a shared pool when the
+	/// queue runs out of space and handed back after execution, so a queue only grows when a frame needs it.
+	/// A queue is written by one thread at a time, use Renderer recording contexts to record from other threads.
 	class RenderCommandQueue
 	{
 	public:
 		typedef void(*RenderCommandFn)(void*);
 
-		RenderCommandQueue();
+		// Every command (and its payload) starts on this alignment
+		static constexpr uint32_t CommandAlignment = 16;
+		static constexpr uint32_t ChunkSize = 1024 * 1024;
+
+		struct Statistics
+		{
+			// Commands currently recorded
+			uint32_t CommandCount = 0;
+			uint64_t UsedBytes = 0;
+			uint32_t ChunkCount = 0;
+
+			// High-water marks over the lifetime of the queue
+			uint32_t PeakCommandCount = 0;
+			uint64_t PeakUsedBytes = 0;
+		};
+
+	public:
+		RenderCommandQueue() = default;
 		~RenderCommandQueue();
 
+		RenderCommandQueue(const RenderCommandQueue&) = delete;
+		RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+		// Returns CommandAlignment aligned storage for size bytes
 		void* Allocate(RenderCommandFn func, uint32_t size
 #ifdef SUBMIT_STACK_TRACES
 			, std::stacktrace&& st
 #endif
 		);
 
+		// Moves every command of other to the end of this queue without copying them, other is left empty
+		void Append(RenderCommandQueue& other);
+
 		void Execute();
 
+		const Statistics& GetStatistics() const { return m_Statistics; }
+
+		// True while a RenderCommandRecordingScope routes submissions into this queue
+		bool IsRecording() const { return m_RecordingScopeCount.load(std::memory_order_acquire) > 0; }
+
 	private:
-		uint8_t* m_CommandBuffer;
-		uint8_t* m_CommandBufferPtr;
-		uint32_t m_CommandCount = 0;
+		struct alignas(CommandAlignment) CommandHeader
+		{
+			RenderCommandFn Function;
+			uint32_t Size; // Payload size, a multiple of CommandAlignment
+		};
+
+		struct Chunk
+		{
+			uint8_t* Memory = nullptr;
+			uint32_t Capacity = 0;
+			uint32_t Size = 0;
+		};
+
+		Chunk& AddChunk(uint32_t minCapacity);
+		void ReleaseChunks(bool keepFirst);
+		void UpdatePeaks();
+
+	private:
+		std::vector<Chunk> m_Chunks; // In recording order, the last one is written to
+		Statistics m_Statistics;
+		std::atomic<uint32_t> m_RecordingScopeCount = 0;
 
 #ifdef SUBMIT_STACK_TRACES
-		eastl::fixed_vector<std::stacktrace, 500, false> m_StackTraces;
+		std::vector<std::stacktrace> m_StackTraces;
 #endif
-	};
-
 
+		friend class RenderCommandRecordingScope;
+	};
 
 }
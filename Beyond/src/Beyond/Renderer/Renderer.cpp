@@ -16,6 +16,7 @@
 #include "Beyond/Platform/Vulkan/VulkanContext.h"
 
 #include "Beyond/Project/Project.h"
+#include "Beyond/Asset/AssetManager.h"
 
 #include <filesystem>
 #include "Beyond/Core/Application.h"
@@ -184,6 +185,14 @@ namespace Beyond {
 	static std::atomic<uint32_t> s_RenderCommandQueueSubmissionIndex = 0;
 	static RenderCommandQueue s_ResourceFreeQueue[3];
 
+	// Recording contexts of the current frame in acquisition order, and the ones ready for reuse
+	static std::mutex s_RecordingContextMutex;
+	static std::vector<RenderCommandQueue*> s_RecordingContexts;      // Every context that was created
+	static std::vector<RenderCommandQueue*> s_FreeRecordingContexts;
+	static std::vector<RenderCommandQueue*> s_FrameRecordingContexts; // Acquired since the last EndFrame
+	static thread_local RenderCommandQueue* s_RecordingContext = nullptr;
+	static RenderCommandQueue::Statistics s_CommandQueueStatistics;
+
 	static RendererAPI* InitRendererAPI()
 	{
 		switch (RendererAPI::Current())
@@ -436,6 +445,10 @@ namespace Beyond {
 
 		s_Data->EmptyEnvironment = Ref<Environment>::Create(s_Data->BlackCubeTexture, s_Data->BlackCubeTexture);
 
+		// Stand-ins for assets that are still loading asynchronously
+		AssetManager::SetPlaceholderAsset(AssetType::Texture, s_Data->WhiteTexture);
+		AssetManager::SetPlaceholderAsset(AssetType::EnvMap, s_Data->EmptyEnvironment);
+
 		{
 			s_Data->DefaultUniformBuffer = UniformBuffer::Create(1, "Default Uniform Buffer");
 			StorageBufferSpecification storageBufferSpec;
@@ -501,6 +514,9 @@ namespace Beyond {
 		s_ShaderDependencies.clear();
 		s_RendererAPI->Shutdown();
 
+		AssetManager::SetPlaceholderAsset(AssetType::Texture, nullptr);
+		AssetManager::SetPlaceholderAsset(AssetType::EnvMap, nullptr);
+
 		delete s_Data;
 
 		// Resource release queue
@@ -512,6 +528,12 @@ namespace Beyond {
 
 		delete s_CommandQueue[0];
 		delete s_CommandQueue[1];
+
+		for (RenderCommandQueue* context : s_RecordingContexts)
+			delete context;
+		s_RecordingContexts.clear();
+		s_FreeRecordingContexts.clear();
+		s_FrameRecordingContexts.clear();
 	}
 
 	RendererCapabilities& Renderer::GetCapabilities()
@@ -664,7 +686,83 @@ namespace Beyond {
 
 	void Renderer::EndFrame()
 	{
+		// Contexts acquired this frame execute at their markers once the render thread gets to this frame's queue
+		RenderCommandQueue& queue = GetRenderCommandQueue();
+		{
+			std::scoped_lock lock(s_RecordingContextMutex);
+			for (RenderCommandQueue* context : s_FrameRecordingContexts)
+				BEY_CORE_ASSERT(!context->IsRecording(), "Render commands are still being recorded into a recording context!");
+			s_FrameRecordingContexts.clear();
+		}
+
 		s_RendererAPI->EndFrame();
+
+		// The two submission queues alternate, keep the high-water marks across both
+		const RenderCommandQueue::Statistics& queueStatistics = queue.GetStatistics();
+		const uint32_t peakCommandCount = std::max(s_CommandQueueStatistics.PeakCommandCount, queueStatistics.PeakCommandCount);
+		const uint64_t peakUsedBytes = std::max(s_CommandQueueStatistics.PeakUsedBytes, queueStatistics.PeakUsedBytes);
+		s_CommandQueueStatistics = queueStatistics;
+		s_CommandQueueStatistics.PeakCommandCount = peakCommandCount;
+		s_CommandQueueStatistics.PeakUsedBytes = peakUsedBytes;
+	}
+
+	RenderCommandQueue* Renderer::AcquireRecordingContext()
+	{
+		BEY_CORE_ASSERT(!s_RecordingContext, "Recording contexts are acquired on the main thread, outside of a recording scope");
+
+		RenderCommandQueue* context;
+		{
+			std::scoped_lock lock(s_RecordingContextMutex);
+			if (!s_FreeRecordingContexts.empty())
+			{
+				context = s_FreeRecordingContexts.back();
+				s_FreeRecordingContexts.pop_back();
+			}
+			else
+			{
+				context = hnew RenderCommandQueue();
+				s_RecordingContexts.push_back(context);
+			}
+
+			s_FrameRecordingContexts.push_back(context);
+		}
+
+		// Marker for the context's place in the frame, whatever gets recorded into it runs right here.
+		// The context is handed back for reuse once it has been executed.
+		Renderer::Submit([context]()
+		{
+			context->Execute();
+
+			std::scoped_lock lock(s_RecordingContextMutex);
+			s_FreeRecordingContexts.push_back(context);
+		});
+
+		return context;
+	}
+
+	void Renderer::SubmitRecordedCommands(RenderCommandQueue& commands)
+	{
+		BEY_CORE_ASSERT(!commands.IsRecording());
+		GetRenderCommandQueue().Append(commands);
+	}
+
+	const RenderCommandQueue::Statistics& Renderer::GetRenderCommandQueueStatistics()
+	{
+		return s_CommandQueueStatistics;
+	}
+
+	RenderCommandRecordingScope::RenderCommandRecordingScope(RenderCommandQueue* context)
+		: m_Context(context), m_PreviousContext(s_RecordingContext)
+	{
+		BEY_CORE_ASSERT(context);
+		s_RecordingContext = context;
+		m_Context->m_RecordingScopeCount++;
+	}
+
+	RenderCommandRecordingScope::~RenderCommandRecordingScope()
+	{
+		s_RecordingContext = m_PreviousContext;
+		m_Context->m_RecordingScopeCount--;
 	}
 
 	std::pair<Ref<TextureCube>, Ref<TextureCube>> Renderer::CreateEnvironmentMap(const std::string& filepath)
@@ -921,6 +1019,9 @@ namespace Beyond {
 
 	RenderCommandQueue& Renderer::GetRenderCommandQueue()
 	{
+		if (s_RecordingContext)
+			return *s_RecordingContext;
+
 		return *s_CommandQueue[s_RenderCommandQueueSubmissionIndex];
 	}
 
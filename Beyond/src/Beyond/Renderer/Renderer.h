@@ -70,6 +70,7 @@ namespace Beyond {
 		)
 		{
 			BEY_PROFILE_FUNC();
+			static_assert(alignof(FuncT) <= RenderCommandQueue::CommandAlignment, "FuncT is over-aligned for the render command queue");
 
 			auto renderCmd = [](void* ptr) {
 				auto pFunc = (FuncT*)ptr;
@@ -239,6 +240,16 @@ namespace Beyond {
 
 		static RenderCommandQueue& GetRenderResourceReleaseQueue(uint32_t index);
 
+		// Recording contexts let other threads record render commands. Acquire one on the main thread, which puts a marker
+		// into the render command queue, then Submit into it on any thread inside a RenderCommandRecordingScope.
+		// The recorded commands execute at the marker, i.e. after whatever was submitted before the context was acquired
+		// and before anything submitted after it. Recording has to be finished by EndFrame.
+		static RenderCommandQueue* AcquireRecordingContext();
+		// Moves commands recorded into a standalone queue (e.g. by an asset loader thread) to the current position
+		// of the render command queue. Main thread only.
+		static void SubmitRecordedCommands(RenderCommandQueue& commands);
+		static const RenderCommandQueue::Statistics& GetRenderCommandQueueStatistics();
+
 		// Add known macro from shader.
 		static const std::unordered_map<std::string, std::string>& GetGlobalShaderMacros();
 		static void AcknowledgeParsedGlobalMacros(const std::unordered_set<std::string>& macros, Ref<Shader> shader);
@@ -255,6 +266,21 @@ namespace Beyond {
 		static RenderCommandQueue& GetRenderCommandQueue();
 	};
 
+	// Routes Renderer::Submit on the calling thread into a recording context for the lifetime of the scope
+	class RenderCommandRecordingScope
+	{
+	public:
+		explicit RenderCommandRecordingScope(RenderCommandQueue* context);
+		~RenderCommandRecordingScope();
+
+		RenderCommandRecordingScope(const RenderCommandRecordingScope&) = delete;
+		RenderCommandRecordingScope& operator=(const RenderCommandRecordingScope&) = delete;
+
+	private:
+		RenderCommandQueue* m_Context = nullptr;
+		RenderCommandQueue* m_PreviousContext = nullptr;
+	};
+
 	namespace Utils {
 
 		inline void DumpGPUInfo()
@@ -2,6 +2,16 @@
 
 namespace Beyond {
 
+	// Per SceneRenderer CPU culling results for the last frame, counted in submeshes
+	struct CullingStatistics
+	{
+		uint32_t Tested = 0;
+		uint32_t GeometryVisible = 0;
+		uint32_t GeometryCulled = 0;
+		uint32_t ShadowVisible = 0;
+		uint32_t ShadowCulled = 0;
+	};
+
 	namespace RendererUtils {
 
 		struct ResourceAllocationCounts
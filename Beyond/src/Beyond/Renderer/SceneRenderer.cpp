@@ -1891,6 +1891,7 @@ namespace Beyond {
 		BEY_CORE_ASSERT(m_Scene);
 		BEY_CORE_ASSERT(!m_Active);
 		m_Active = true;
+		m_CullingEnabled = false;
 
 		if (m_ResourcesCreatedGPU)
 			m_ResourcesCreated = true;
@@ -2341,6 +2342,8 @@ namespace Beyond {
 		{
 			instance->m_UBSRendererData->RT_Get()->RT_SetData(&rendererData, sizeof(rendererData));
 		});
+
+		UpdateCullingFrusta(cascades);
 	}
 
 	void SceneRenderer::EndScene()
@@ -2348,6 +2351,9 @@ namespace Beyond {
 		BEY_PROFILE_FUNC();
 
 		BEY_CORE_ASSERT(m_Active);
+
+		CullMeshSubmissions();
+
 #if MULTI_THREAD
 		Ref<SceneRenderer> instance = this;
 		s_ThreadPool.emplace_back(([instance]() mutable
@@ -2383,16 +2389,58 @@ namespace Beyond {
 			m_MainRaytracer->AddDrawCommand(dc, material, transform);
 	}
 
-	void SceneRenderer::SubmitMesh(Ref<Mesh> mesh, uint32_t submeshIndex, Ref<MaterialTable> materialTable, const glm::mat4& transform, const std::vector<glm::mat4>& boneTransforms, Ref<Material> overrideMaterial)
+	void SceneRenderer::SubmitMesh(Ref<Mesh> mesh, uint32_t submeshIndex, Ref<MaterialTable> materialTable, const glm::mat4& transform, const std::vector<glm::mat4>& boneTransforms, Ref<Material> overrideMaterial, uint64_t instanceID)
 	{
 		BEY_PROFILE_FUNC();
 		BEY_SCOPE_PERF("SceneRenderer::SubmitMesh");
-		// TODO: Culling, sorting, etc.
 
-		const auto meshSource = mesh->GetMeshSource().Raw();
 		if (!mesh->IsReady())
 			return;
 
+		const auto& submesh = mesh->GetMeshSource()->GetSubmeshes()[submeshIndex];
+
+		// Rigged meshes are deformed by their bones so the bind pose bounds don't hold, and
+		// their bone transforms are indexed per instance, skip culling for them.
+		if (!m_CullingEnabled || submesh.IsRigged)
+		{
+			AddMeshToDrawLists(mesh, submeshIndex, materialTable, transform, boneTransforms, overrideMaterial, InstanceVisibility::All, instanceID);
+			return;
+		}
+
+		m_CullingBounds.Add(submesh.BoundingBox, transform);
+		m_MeshSubmissions.push_back({ mesh, nullptr, submeshIndex, materialTable, overrideMaterial, transform, instanceID });
+	}
+
+	void SceneRenderer::SubmitStaticMesh(Ref<StaticMesh> staticMesh, Ref<MaterialTable> materialTable, const glm::mat4& transform, Ref<Material> overrideMaterial, uint64_t instanceID)
+	{
+		BEY_PROFILE_FUNC();
+		BEY_SCOPE_PERF("SceneRenderer::SubmitStaticMesh");
+
+		const auto meshSource = staticMesh->GetMeshSource().Raw();
+		if (!staticMesh->IsReady())
+			return;
+		const auto& submeshData = meshSource->GetSubmeshes();
+		for (uint32_t submeshIndex : staticMesh->GetSubmeshes())
+		{
+			glm::mat4 submeshTransform = transform * submeshData[submeshIndex].Transform;
+
+			if (!m_CullingEnabled)
+			{
+				AddStaticMeshToDrawLists(staticMesh, submeshIndex, materialTable, submeshTransform, overrideMaterial, InstanceVisibility::All, instanceID);
+				continue;
+			}
+
+			m_CullingBounds.Add(submeshData[submeshIndex].BoundingBox, submeshTransform);
+			m_MeshSubmissions.push_back({ nullptr, staticMesh, submeshIndex, materialTable, overrideMaterial, submeshTransform, instanceID });
+		}
+	}
+
+	void SceneRenderer::AddMeshToDrawLists(Ref<Mesh> mesh, uint32_t submeshIndex, Ref<MaterialTable> materialTable, const glm::mat4& transform, const std::vector<glm::mat4>& boneTransforms, Ref<Material> overrideMaterial, InstanceVisibility visibility, uint64_t instanceID)
+	{
+		BEY_PROFILE_FUNC();
+
+		const auto meshSource = mesh->GetMeshSource().Raw();
+
 		const auto& submeshes = meshSource->GetSubmeshes();
 		const auto& submesh = submeshes[submeshIndex];
 		uint32_t materialIndex = submesh.MaterialIndex;
@@ -2401,105 +2449,178 @@ namespace Beyond {
 		AssetHandle materialHandle = materialTable->HasMaterial(materialIndex) ? materialTable->GetMaterial(materialIndex) : mesh->GetMaterials()->GetMaterial(materialIndex);
 		const Ref<MaterialAsset>& material = AssetManager::GetAsset<MaterialAsset>(materialHandle);
 
-		MeshKey meshKey = { mesh->Handle, materialHandle, submeshIndex, false };
+		if (visibility == InstanceVisibility::ShadowOnly && !material->IsShadowCasting())
+			visibility = InstanceVisibility::Culled;
 
-		TransformMapData& meshTransform = m_MeshTransformMap[meshKey];
-		TransformVertexData& transformStorage = meshTransform.Transforms.emplace_back();
+		// Culled instances are only needed by the raytracer
+		const bool isRaytracing = m_RaytracingSettings.Mode != RaytracingMode::None;
+		if (visibility == InstanceVisibility::Culled && !isRaytracing)
+			return;
 
-		transformStorage.MRow[0] = { transform[0][0], transform[1][0], transform[2][0], transform[3][0] };
-		transformStorage.MRow[1] = { transform[0][1], transform[1][1], transform[2][1], transform[3][1] };
-		transformStorage.MRow[2] = { transform[0][2], transform[1][2], transform[2][2], transform[3][2] };
+		DrawSubmission& submission = m_DrawSubmissions.emplace_back();
+		submission.MeshHandle = mesh->Handle;
+		submission.MaterialHandle = materialHandle;
+		submission.SubmeshIndex = submeshIndex;
+		submission.OverrideMaterial = overrideMaterial.Raw();
+		submission.Mesh = mesh.Raw();
+		submission.MaterialTable = materialTable.Raw();
+		submission.IsRigged = isRigged;  // TODO: would it be better to have separate draw list for rigged meshes, or this flag is OK?
+		submission.SetTransform(transform);
+		submission.InstanceID = instanceID;
 
 		if (isRigged)
-		{
-			CopyToBoneTransformStorage(meshKey, meshSource, boneTransforms);
-		}
+			submission.BoneTransformsIndex = CopyToBoneTransformStorage(meshSource, boneTransforms);
+
 		// Main geo
-		bool isTransparent = material->IsBlended();
-		auto& destDrawList = !isTransparent ? m_DrawList : m_TransparentDrawList;
-		auto& dc = destDrawList[meshKey];
-		{
-			dc.Mesh = mesh.Raw();
-			dc.SubmeshIndex = submeshIndex;
-			dc.MaterialTable = materialTable.Raw();
-			dc.OverrideMaterial = overrideMaterial.Raw();
-			dc.InstanceCount++;
-			dc.IsRigged = isRigged;  // TODO: would it be better to have separate draw list for rigged meshes, or this flag is OK?
-		}
+		if (visibility == InstanceVisibility::All)
+			submission.AddToList(material->IsBlended() ? DrawListFlag::Transparent : DrawListFlag::Geometry);
 
 		// Shadow pass
-		if (material->IsShadowCasting())
-		{
-			auto& dc = m_ShadowPassDrawList[meshKey];
-			dc.Mesh = mesh.Raw();
-			dc.SubmeshIndex = submeshIndex;
-			dc.MaterialTable = materialTable.Raw();
-			dc.OverrideMaterial = overrideMaterial.Raw();
-			dc.InstanceCount++;
-			dc.IsRigged = isRigged;
-		}
-		SubmitToRaytracer(dc, material.Raw(), *reinterpret_cast<glm::mat3x4*>(&transformStorage));
+		if (visibility != InstanceVisibility::Culled && material->IsShadowCasting())
+			submission.AddToList(DrawListFlag::Shadow);
+
+		DrawCommand raytracingDrawCommand{};
+		raytracingDrawCommand.Mesh = mesh.Raw();
+		raytracingDrawCommand.SubmeshIndex = submeshIndex;
+		SubmitToRaytracer(raytracingDrawCommand, material.Raw(), *reinterpret_cast<glm::mat3x4*>(&submission.Transform));
 	}
 
-	void SceneRenderer::SubmitStaticMesh(Ref<StaticMesh> staticMesh, Ref<MaterialTable> materialTable, const glm::mat4& transform, Ref<Material> overrideMaterial)
+	void SceneRenderer::AddStaticMeshToDrawLists(Ref<StaticMesh> staticMesh, uint32_t submeshIndex, Ref<MaterialTable> materialTable, const glm::mat4& transform, Ref<Material> overrideMaterial, InstanceVisibility visibility, uint64_t instanceID)
 	{
 		BEY_PROFILE_FUNC();
-		BEY_SCOPE_PERF("SceneRenderer::SubmitStaticMesh");
 
-		const auto meshSource = staticMesh->GetMeshSource().Raw();
-		if (!staticMesh->IsReady())
+		const auto& submeshes = staticMesh->GetMeshSource()->GetSubmeshes();
+		uint32_t materialIndex = submeshes[submeshIndex].MaterialIndex;
+
+		AssetHandle materialHandle = materialTable->HasMaterial(materialIndex) ? materialTable->GetMaterial(materialIndex) : staticMesh->GetMaterials()->GetMaterial(materialIndex);
+		BEY_CORE_VERIFY(materialHandle);
+		Ref<MaterialAsset> material = AssetManager::GetAsset<MaterialAsset>(materialHandle);
+
+		if (visibility == InstanceVisibility::ShadowOnly && !material->IsShadowCasting())
+			visibility = InstanceVisibility::Culled;
+
+		// Culled instances are only needed by the raytracer
+		const bool isRaytracing = m_RaytracingSettings.Mode != RaytracingMode::None;
+		if (visibility == InstanceVisibility::Culled && !isRaytracing)
 			return;
-		const auto& submeshData = meshSource->GetSubmeshes();
-		for (uint32_t submeshIndex : staticMesh->GetSubmeshes())
-		{
-			glm::mat4 submeshTransform = transform * submeshData[submeshIndex].Transform;
 
-			const auto& submeshes = staticMesh->GetMeshSource()->GetSubmeshes();
-			uint32_t materialIndex = submeshes[submeshIndex].MaterialIndex;
+		DrawSubmission& submission = m_DrawSubmissions.emplace_back();
+		submission.MeshHandle = staticMesh->Handle;
+		submission.MaterialHandle = materialHandle;
+		submission.SubmeshIndex = submeshIndex;
+		submission.IsStatic = true;
+		submission.OverrideMaterial = overrideMaterial.Raw();
+		submission.StaticMesh = staticMesh.Raw();
+		submission.MaterialTable = materialTable.Raw();
+		submission.SetTransform(transform);
+		submission.InstanceID = instanceID;
 
-			AssetHandle materialHandle = materialTable->HasMaterial(materialIndex) ? materialTable->GetMaterial(materialIndex) : staticMesh->GetMaterials()->GetMaterial(materialIndex);
-			BEY_CORE_VERIFY(materialHandle);
-			Ref<MaterialAsset> material = AssetManager::GetAsset<MaterialAsset>(materialHandle);
+		// Main geo
+		if (visibility == InstanceVisibility::All)
+			submission.AddToList(material->IsBlended() ? DrawListFlag::Transparent : DrawListFlag::Geometry);
 
-			MeshKey meshKey = { staticMesh->Handle, materialHandle, submeshIndex, false };
-			TransformMapData& meshTransform = m_MeshTransformMap[meshKey];
-			TransformVertexData& transformStorage = meshTransform.Transforms.emplace_back();
+		// Shadow pass
+		if (visibility != InstanceVisibility::Culled && material->IsShadowCasting())
+			submission.AddToList(DrawListFlag::Shadow);
 
-			transformStorage.MRow[0] = { submeshTransform[0][0], submeshTransform[1][0], submeshTransform[2][0], submeshTransform[3][0] };
-			transformStorage.MRow[1] = { submeshTransform[0][1], submeshTransform[1][1], submeshTransform[2][1], submeshTransform[3][1] };
-			transformStorage.MRow[2] = { submeshTransform[0][2], submeshTransform[1][2], submeshTransform[2][2], submeshTransform[3][2] };
+		StaticDrawCommand raytracingDrawCommand;
+		raytracingDrawCommand.StaticMesh = staticMesh;
+		raytracingDrawCommand.SubmeshIndex = submeshIndex;
+		SubmitToRaytracer(raytracingDrawCommand, material.Raw(), *reinterpret_cast<glm::mat3x4*>(&submission.Transform));
+	}
 
+	void SceneRenderer::UpdateCullingFrusta(const CascadeData* cascades)
+	{
+		BEY_PROFILE_FUNC();
 
-			// Main geo
-			bool isTransparent = material->IsBlended();
-			auto& destDrawList = !isTransparent ? m_StaticMeshDrawList : m_TransparentStaticMeshDrawList;
-			auto& dc = destDrawList[meshKey];
-			{
-				dc.StaticMesh = staticMesh;
-				dc.SubmeshIndex = submeshIndex;
-				dc.MaterialTable = materialTable;
-				dc.OverrideMaterial = overrideMaterial;
-				dc.InstanceCount++;
-			}
+		m_CullingEnabled = m_Options.EnableFrustumCulling;
+		if (!m_CullingEnabled)
+			return;
 
-			// Shadow pass
-			if (material->IsShadowCasting())
-			{
-				auto& dc = m_StaticMeshShadowPassDrawList[meshKey];
-				dc.StaticMesh = staticMesh;
-				dc.SubmeshIndex = submeshIndex;
-				dc.MaterialTable = materialTable;
-				dc.OverrideMaterial = overrideMaterial;
-				dc.InstanceCount++;
-			}
+		const auto& sceneCamera = m_SceneData.SceneCamera;
+		m_CameraFrustum = Frustum::FromViewProjection(sceneCamera.Camera->GetUnReversedProjectionMatrix() * sceneCamera.ViewMatrix);
+		m_CullingOrigin = glm::inverse(sceneCamera.ViewMatrix)[3];
 
+		const auto& lightEnvironment = m_SceneData.SceneLightEnvironment;
+		const auto& directionalLight = lightEnvironment.DirectionalLights[0];
+		const bool spotLightShadows = std::ranges::any_of(lightEnvironment.SpotLights, [](const SpotLight& light) { return light.CastsShadows; });
+		const bool shadowPassesRun = m_RaytracingSettings.Mode == RaytracingMode::None || m_RaytracingSettings.Mode == RaytracingMode::Raytracing;
+
+		if (!shadowPassesRun)
+			m_ShadowCasterCulling = ShadowCasterCulling::NoShadows;
+		else if (spotLightShadows)
+			m_ShadowCasterCulling = ShadowCasterCulling::None;
+		else if (directionalLight.Intensity > 0.0f && directionalLight.CastShadows)
+			m_ShadowCasterCulling = ShadowCasterCulling::Cascades;
+		else
+			m_ShadowCasterCulling = ShadowCasterCulling::NoShadows;
 
-			SubmitToRaytracer(dc, material.Raw(), *reinterpret_cast<glm::mat3x4*>(&transformStorage));
+		// Casters between the light and a cascade still cast into it, leave the near plane out
+		for (uint32_t i = 0; i < 4; i++)
+			m_CascadeFrusta[i] = Frustum::FromViewProjection(cascades[i].ViewProj, false);
+	}
+
+	void SceneRenderer::CullMeshSubmissions()
+	{
+		BEY_PROFILE_FUNC();
+		BEY_SCOPE_PERF("SceneRenderer::CullMeshSubmissions");
+
+		enum CullingFlags : uint8_t
+		{
+			CameraVisible = BIT(0),
+			ShadowVisible = BIT(1)
+		};
+
+		const uint32_t count = m_CullingBounds.GetCount();
+		m_CullingResults.assign(count, 0);
+
+		FrustumCuller::CullFrustum(m_CullingBounds, m_CameraFrustum, CameraVisible, m_CullingResults.data());
+		if (m_Options.MaxDrawDistance > 0.0f)
+			FrustumCuller::CullDistance(m_CullingBounds, m_CullingOrigin, m_Options.MaxDrawDistance, CameraVisible, m_CullingResults.data());
+
+		if (m_ShadowCasterCulling == ShadowCasterCulling::Cascades)
+		{
+			for (uint32_t i = 0; i < m_Specification.NumShadowCascades; i++)
+				FrustumCuller::CullFrustum(m_CullingBounds, m_CascadeFrusta[i], ShadowVisible, m_CullingResults.data());
+		}
+		else if (m_ShadowCasterCulling == ShadowCasterCulling::None)
+		{
+			for (uint8_t& result : m_CullingResults)
+				result |= ShadowVisible;
+		}
+
+		CullingStatistics& stats = m_Statistics.Culling;
+		stats = {};
+		stats.Tested = count;
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const uint8_t result = m_CullingResults[i];
+			InstanceVisibility visibility = InstanceVisibility::Culled;
+			if (result & CameraVisible)
+				visibility = InstanceVisibility::All;
+			else if (result & ShadowVisible)
+				visibility = InstanceVisibility::ShadowOnly;
+
+			const bool geometryVisible = visibility == InstanceVisibility::All;
+			const bool shadowVisible = visibility != InstanceVisibility::Culled && m_ShadowCasterCulling != ShadowCasterCulling::NoShadows;
+			stats.GeometryVisible += geometryVisible;
+			stats.GeometryCulled += !geometryVisible;
+			stats.ShadowVisible += shadowVisible;
+			stats.ShadowCulled += !shadowVisible;
+
+			const MeshSubmission& submission = m_MeshSubmissions[i];
+			if (submission.DynamicMesh)
+				AddMeshToDrawLists(submission.DynamicMesh, submission.SubmeshIndex, submission.MaterialTable, submission.Transform, {}, submission.OverrideMaterial, visibility, submission.InstanceID);
+			else
+				AddStaticMeshToDrawLists(submission.StaticMesh, submission.SubmeshIndex, submission.MaterialTable, submission.Transform, submission.OverrideMaterial, visibility, submission.InstanceID);
 		}
 
+		m_MeshSubmissions.clear();
+		m_CullingBounds.Clear();
 	}
 
-	void SceneRenderer::SubmitSelectedMesh(Ref<Mesh> mesh, uint32_t submeshIndex, Ref<MaterialTable> materialTable, const glm::mat4& transform, const std::vector<glm::mat4>& boneTransforms, Ref<Material> overrideMaterial)
+	void SceneRenderer::SubmitSelectedMesh(Ref<Mesh> mesh, uint32_t submeshIndex, Ref<MaterialTable> materialTable, const glm::mat4& transform, const std::vector<glm::mat4>& boneTransforms, Ref<Material> overrideMaterial, uint64_t instanceID)
 	{
 		BEY_PROFILE_FUNC();
 		BEY_SCOPE_PERF("SceneRenderer::SubmitStatSubmitSelectedMeshicMesh");
@@ -2518,64 +2639,35 @@ namespace Beyond {
 		BEY_CORE_VERIFY(materialHandle);
 		Ref<MaterialAsset> material = AssetManager::GetAsset<MaterialAsset>(materialHandle);
 
-		MeshKey meshKey = { mesh->Handle, materialHandle, submeshIndex, true };
-		TransformMapData& meshTransform = m_MeshTransformMap[meshKey];
-		TransformVertexData& transformStorage = meshTransform.Transforms.emplace_back();
-
-		transformStorage.MRow[0] = { transform[0][0], transform[1][0], transform[2][0], transform[3][0] };
-		transformStorage.MRow[1] = { transform[0][1], transform[1][1], transform[2][1], transform[3][1] };
-		transformStorage.MRow[2] = { transform[0][2], transform[1][2], transform[2][2], transform[3][2] };
+		DrawSubmission& submission = m_DrawSubmissions.emplace_back();
+		submission.MeshHandle = mesh->Handle;
+		submission.MaterialHandle = materialHandle;
+		submission.SubmeshIndex = submeshIndex;
+		submission.OverrideMaterial = overrideMaterial.Raw();
+		submission.Mesh = mesh.Raw();
+		submission.MaterialTable = materialTable.Raw();
+		submission.IsRigged = isRigged;
+		submission.SetTransform(transform);
+		submission.InstanceID = instanceID;
 
 		if (isRigged)
-		{
-			CopyToBoneTransformStorage(meshKey, meshSource, boneTransforms);
-		}
-
-		uint32_t instanceIndex = 0;
+			submission.BoneTransformsIndex = CopyToBoneTransformStorage(meshSource, boneTransforms);
 
-		// Main geo
-		bool isTransparent = material->IsBlended();
-		auto& destDrawList = !isTransparent ? m_DrawList : m_TransparentDrawList;
-		{
-			auto& dc = destDrawList[meshKey];
-			dc.Mesh = mesh.Raw();
-			dc.SubmeshIndex = submeshIndex;
-			dc.MaterialTable = materialTable.Raw();
-			dc.OverrideMaterial = overrideMaterial.Raw();
-			instanceIndex = dc.InstanceCount;
-			dc.InstanceCount++;
-			dc.IsRigged = isRigged;
-		}
-
-		// Selected mesh list
-		{
-			auto& dc = m_SelectedMeshDrawList[meshKey];
-			dc.Mesh = mesh.Raw();
-			dc.SubmeshIndex = submeshIndex;
-			dc.MaterialTable = materialTable.Raw();
-			dc.OverrideMaterial = overrideMaterial.Raw();
-			dc.InstanceCount++;
-			dc.InstanceOffset = instanceIndex;
-			dc.IsRigged = isRigged;
-		}
+		// Main geo and selected mesh list, selected instances are batched separately so the selected draw covers all of its instances
+		submission.AddToList(material->IsBlended() ? DrawListFlag::Transparent : DrawListFlag::Geometry);
+		submission.AddToList(DrawListFlag::Selected);
 
 		// Shadow pass
 		if (material->IsShadowCasting())
-		{
-			auto& dc = m_ShadowPassDrawList[meshKey];
-			dc.Mesh = mesh.Raw();
-			dc.SubmeshIndex = submeshIndex;
-			dc.MaterialTable = materialTable.Raw();
-			dc.OverrideMaterial = overrideMaterial.Raw();
-			dc.InstanceCount++;
-			dc.IsRigged = isRigged;
-		}
+			submission.AddToList(DrawListFlag::Shadow);
 
-		auto& dc = destDrawList[meshKey];
-		SubmitToRaytracer(dc, material.Raw(), *reinterpret_cast<glm::mat3x4*>(&transformStorage));
+		DrawCommand raytracingDrawCommand{};
+		raytracingDrawCommand.Mesh = mesh.Raw();
+		raytracingDrawCommand.SubmeshIndex = submeshIndex;
+		SubmitToRaytracer(raytracingDrawCommand, material.Raw(), *reinterpret_cast<glm::mat3x4*>(&submission.Transform));
 	}
 
-	void SceneRenderer::SubmitSelectedStaticMesh(Ref<StaticMesh> staticMesh, Ref<MaterialTable> materialTable, const glm::mat4& transform, Ref<Material> overrideMaterial)
+	void SceneRenderer::SubmitSelectedStaticMesh(Ref<StaticMesh> staticMesh, Ref<MaterialTable> materialTable, const glm::mat4& transform, Ref<Material> overrideMaterial, uint64_t instanceID)
 	{
 		BEY_PROFILE_FUNC();
 
@@ -2594,49 +2686,29 @@ namespace Beyond {
 			BEY_CORE_VERIFY(materialHandle);
 			Ref<MaterialAsset> material = AssetManager::GetAsset<MaterialAsset>(materialHandle);
 
-			MeshKey meshKey = { staticMesh->Handle, materialHandle, submeshIndex, true };
-			TransformMapData& meshTransform = m_MeshTransformMap[meshKey];
-			TransformVertexData& transformStorage = meshTransform.Transforms.emplace_back();
-
-			transformStorage.MRow[0] = { submeshTransform[0][0], submeshTransform[1][0], submeshTransform[2][0], submeshTransform[3][0] };
-			transformStorage.MRow[1] = { submeshTransform[0][1], submeshTransform[1][1], submeshTransform[2][1], submeshTransform[3][1] };
-			transformStorage.MRow[2] = { submeshTransform[0][2], submeshTransform[1][2], submeshTransform[2][2], submeshTransform[3][2] };
-
-			// Main geo
-			bool isTransparent = material->IsBlended();
-			auto& destDrawList = !isTransparent ? m_StaticMeshDrawList : m_TransparentStaticMeshDrawList;
-			{
-				auto& dc = destDrawList[meshKey];
-				dc.StaticMesh = staticMesh;
-				dc.SubmeshIndex = submeshIndex;
-				dc.MaterialTable = materialTable;
-				dc.OverrideMaterial = overrideMaterial;
-				dc.InstanceCount++;
-			}
-
-			// Selected mesh list
-			{
-				auto& dc = m_SelectedStaticMeshDrawList[meshKey];
-				dc.StaticMesh = staticMesh;
-				dc.SubmeshIndex = submeshIndex;
-				dc.MaterialTable = materialTable;
-				dc.OverrideMaterial = overrideMaterial;
-				dc.InstanceCount++;
-			}
+			DrawSubmission& submission = m_DrawSubmissions.emplace_back();
+			submission.MeshHandle = staticMesh->Handle;
+			submission.MaterialHandle = materialHandle;
+			submission.SubmeshIndex = submeshIndex;
+			submission.IsStatic = true;
+			submission.OverrideMaterial = overrideMaterial.Raw();
+			submission.StaticMesh = staticMesh.Raw();
+			submission.MaterialTable = materialTable.Raw();
+			submission.SetTransform(submeshTransform);
+			submission.InstanceID = instanceID;
+
+			// Main geo and selected mesh list
+			submission.AddToList(material->IsBlended() ? DrawListFlag::Transparent : DrawListFlag::Geometry);
+			submission.AddToList(DrawListFlag::Selected);
 
 			// Shadow pass
 			if (material->IsShadowCasting())
-			{
-				auto& dc = m_StaticMeshShadowPassDrawList[meshKey];
-				dc.StaticMesh = staticMesh;
-				dc.SubmeshIndex = submeshIndex;
-				dc.MaterialTable = materialTable;
-				dc.OverrideMaterial = overrideMaterial;
-				dc.InstanceCount++;
-			}
+				submission.AddToList(DrawListFlag::Shadow);
 
-			auto& dc = destDrawList[meshKey];
-			SubmitToRaytracer(dc, material.Raw(), *reinterpret_cast<glm::mat3x4*>(&transformStorage));
+			StaticDrawCommand raytracingDrawCommand;
+			raytracingDrawCommand.StaticMesh = staticMesh;
+			raytracingDrawCommand.SubmeshIndex = submeshIndex;
+			SubmitToRaytracer(raytracingDrawCommand, material.Raw(), *reinterpret_cast<glm::mat3x4*>(&submission.Transform));
 		}
 	}
 
@@ -2644,25 +2716,15 @@ namespace Beyond {
 	{
 		BEY_CORE_VERIFY(mesh->Handle);
 
-		Ref<MeshSource> meshSource = mesh->GetMeshSource();
 		if (!mesh->IsReady())
 			return;
-		const auto& submeshData = meshSource->GetSubmeshes();
-		glm::mat4 submeshTransform = transform * submeshData[submeshIndex].Transform;
-
-		MeshKey meshKey = { mesh->Handle, 5, submeshIndex, false };
-		auto& transformStorage = m_MeshTransformMap[meshKey].Transforms.emplace_back();
-
-		transformStorage.MRow[0] = { transform[0][0], transform[1][0], transform[2][0], transform[3][0] };
-		transformStorage.MRow[1] = { transform[0][1], transform[1][1], transform[2][1], transform[3][1] };
-		transformStorage.MRow[2] = { transform[0][2], transform[1][2], transform[2][2], transform[3][2] };
 
-		{
-			auto& dc = m_ColliderDrawList[meshKey];
-			dc.Mesh = mesh.Raw();
-			dc.SubmeshIndex = submeshIndex;
-			dc.InstanceCount++;
-		}
+		DrawSubmission& submission = m_DrawSubmissions.emplace_back();
+		submission.MeshHandle = mesh->Handle;
+		submission.SubmeshIndex = submeshIndex;
+		submission.Mesh = mesh.Raw();
+		submission.SetTransform(transform);
+		submission.AddToList(DrawListFlag::Collider);
 	}
 
 	void SceneRenderer::SubmitPhysicsStaticDebugMesh(Ref<StaticMesh> staticMesh, const glm::mat4& transform, const bool isPrimitiveCollider)
@@ -2676,21 +2738,14 @@ namespace Beyond {
 		{
 			glm::mat4 submeshTransform = transform * submeshData[submeshIndex].Transform;
 
-			MeshKey meshKey = { staticMesh->Handle, 5, submeshIndex, false };
-			auto& transformStorage = m_MeshTransformMap[meshKey].Transforms.emplace_back();
-
-			transformStorage.MRow[0] = { submeshTransform[0][0], submeshTransform[1][0], submeshTransform[2][0], submeshTransform[3][0] };
-			transformStorage.MRow[1] = { submeshTransform[0][1], submeshTransform[1][1], submeshTransform[2][1], submeshTransform[3][1] };
-			transformStorage.MRow[2] = { submeshTransform[0][2], submeshTransform[1][2], submeshTransform[2][2], submeshTransform[3][2] };
-
-			{
-				auto& dc = m_StaticColliderDrawList[meshKey];
-				dc.StaticMesh = staticMesh;
-				dc.SubmeshIndex = submeshIndex;
-				dc.OverrideMaterial = isPrimitiveCollider ? m_SimpleColliderMaterial : m_ComplexColliderMaterial;
-				dc.InstanceCount++;
-			}
-
+			DrawSubmission& submission = m_DrawSubmissions.emplace_back();
+			submission.MeshHandle = staticMesh->Handle;
+			submission.SubmeshIndex = submeshIndex;
+			submission.IsStatic = true;
+			submission.OverrideMaterial = isPrimitiveCollider ? m_SimpleColliderMaterial.Raw() : m_ComplexColliderMaterial.Raw();
+			submission.StaticMesh = staticMesh.Raw();
+			submission.SetTransform(submeshTransform);
+			submission.AddToList(DrawListFlag::Collider);
 		}
 	}
 #pragma endregion
@@ -2706,19 +2761,66 @@ namespace Beyond {
 	{
 		BEY_PROFILE_FUNC();
 
-		uint32_t framesInFlight = Renderer::GetConfig().FramesInFlight;
 		uint32_t frameIndex = Renderer::GetCurrentFrameIndex();
 		uint32_t offset = 0;
+		uint32_t index = 0;
 		{
-			for (auto& transformData : m_MeshTransformMap | std::views::values)
+			BEY_SCOPE_PERF("SceneRenderer::PreRender::BuildDrawLists");
+
+			const uint32_t submissionCount = (uint32_t)m_DrawSubmissions.size();
+			m_DrawSortEntries.resize(submissionCount);
+			for (uint32_t i = 0; i < submissionCount; i++)
+				m_DrawSortEntries[i] = { DrawKeySorter::MakeKey(m_DrawSubmissions[i]), i };
+
+			DrawKeySorter::Sort(m_DrawSortEntries, m_DrawSortScratch);
+
+			// Instances of a batch are adjacent after sorting, keys are hashed so the identity is compared as well
+			TransformVertexData* transforms = m_SubmeshTransformBuffers[frameIndex].Data;
+			TransformData* transformData = m_TransformBuffers[frameIndex].Data;
+			const uint32_t previousFrame = m_InstanceTransformFrame++;
+			uint32_t batchBegin = 0;
+			while (batchBegin < submissionCount)
 			{
-				transformData.TransformIndex = offset;
-				for (const auto& transform : transformData.Transforms)
+				const DrawSortEntry& batchEntry = m_DrawSortEntries[batchBegin];
+				const DrawSubmission& batchSubmission = m_DrawSubmissions[batchEntry.Index];
+
+				uint32_t batchEnd = batchBegin + 1;
+				while (batchEnd < submissionCount && m_DrawSortEntries[batchEnd].Key == batchEntry.Key && m_DrawSubmissions[m_DrawSortEntries[batchEnd].Index].IsSameBatch(batchSubmission))
+					batchEnd++;
+
+				const uint32_t transformIndex = offset;
+				const uint32_t boneTransformsBaseIndex = index;
+				for (uint32_t i = batchBegin; i < batchEnd; i++)
 				{
-					m_SubmeshTransformBuffers[frameIndex].Data[offset] = transform;
+					const DrawSubmission& submission = m_DrawSubmissions[m_DrawSortEntries[i].Index];
+					transforms[offset] = submission.Transform;
+
+					// Previous transform comes from wherever the instance was drawn last frame, instances that
+					// weren't drawn last frame (or aren't tracked) get no motion
+					TransformVertexData previousTransform = submission.Transform;
+					if (submission.InstanceID != 0)
+					{
+						PreviousInstanceTransform& previous = m_PreviousInstanceTransforms[{ submission.InstanceID, submission.SubmeshIndex }];
+						if (previous.Frame == previousFrame)
+							previousTransform = previous.Transform;
+
+						previous.Transform = submission.Transform;
+						previous.Frame = m_InstanceTransformFrame;
+					}
+					std::memcpy(transformData[offset].PreviousMRow, previousTransform.MRow, 48);
+
 					offset++;
+					if (submission.IsRigged)
+						m_BoneTransformsData[index++] = m_SubmittedBoneTransforms[submission.BoneTransformsIndex];
 				}
+
+				AddBatchToDrawLists(batchSubmission, batchEnd - batchBegin, transformIndex, boneTransformsBaseIndex);
+				batchBegin = batchEnd;
 			}
+
+			// Forget instances that haven't been drawn for a while (destroyed entities, ones outside of the view...)
+			if (m_InstanceTransformFrame % 64 == 0)
+				std::erase_if(m_PreviousInstanceTransforms, [this](const auto& entry) { return entry.second.Frame != m_InstanceTransformFrame; });
 		}
 
 		{
@@ -2726,32 +2828,14 @@ namespace Beyond {
 			{
 				//m_TransformBuffers[frameIndex].Data[offset].CurrentMRow = m_SubmeshTransformBuffers[frameIndex].Data[offset];
 				std::memcpy(m_TransformBuffers[frameIndex].Data[i].CurrentMRow, m_SubmeshTransformBuffers[frameIndex].Data[i].MRow, 48);
-				std::memcpy(m_TransformBuffers[frameIndex].Data[i].PreviousMRow, m_SubmeshTransformBuffers[(frameIndex + framesInFlight - 1) % framesInFlight].Data[i].MRow, 48);
 				if (m_RaytracingSettings.Mode != RaytracingMode::None)
 					m_MainRaytracer->GetObjDescs()[i].TransformIndex = i;
 			}
 
-			// Update prev transform after it's consumed. 
-			for (auto& [meshKey, transformData] : m_MeshTransformMap)
-			{
-				auto& historyTransform = m_TransformHistoryMap[meshKey];
-				historyTransform = transformData;
-			}
-
 			// Upload all transforms
 			m_SBSTransforms->Get()->SetData(m_TransformBuffers[frameIndex].Data, static_cast<uint32_t>(offset * sizeof(TransformData)));
 		}
 
-		uint32_t index = 0;
-		for (auto& [meshKey, boneTransformsData] : m_MeshBoneTransformsMap)
-		{
-			boneTransformsData.BoneTransformsBaseIndex = index;
-			for (const auto& boneTransforms : boneTransformsData.BoneTransformsData)
-			{
-				m_BoneTransformsData[index++] = boneTransforms;
-			}
-		}
-
 		if (index > 0)
 		{
 			Ref<SceneRenderer> instance = this;
@@ -2764,6 +2848,54 @@ namespace Beyond {
 
 	}
 
+	void SceneRenderer::AddBatchToDrawLists(const DrawSubmission& submission, uint32_t instanceCount, uint32_t transformIndex, uint32_t boneTransformsBaseIndex)
+	{
+		if (submission.IsStatic)
+		{
+			StaticDrawCommand dc;
+			dc.StaticMesh = submission.StaticMesh;
+			dc.SubmeshIndex = submission.SubmeshIndex;
+			dc.MaterialTable = submission.MaterialTable;
+			dc.OverrideMaterial = submission.OverrideMaterial;
+			dc.InstanceCount = instanceCount;
+			dc.TransformIndex = transformIndex;
+
+			if (submission.IsInList(DrawListFlag::Geometry))
+				m_StaticMeshDrawList.push_back(dc);
+			if (submission.IsInList(DrawListFlag::Transparent))
+				m_TransparentStaticMeshDrawList.push_back(dc);
+			if (submission.IsInList(DrawListFlag::Selected))
+				m_SelectedStaticMeshDrawList.push_back(dc);
+			if (submission.IsInList(DrawListFlag::Shadow))
+				m_StaticMeshShadowPassDrawList.push_back(dc);
+			if (submission.IsInList(DrawListFlag::Collider))
+				m_StaticColliderDrawList.push_back(dc);
+		}
+		else
+		{
+			DrawCommand dc{};
+			dc.Mesh = submission.Mesh;
+			dc.SubmeshIndex = submission.SubmeshIndex;
+			dc.MaterialTable = submission.MaterialTable;
+			dc.OverrideMaterial = submission.OverrideMaterial;
+			dc.InstanceCount = instanceCount;
+			dc.TransformIndex = transformIndex;
+			dc.BoneTransformsBaseIndex = boneTransformsBaseIndex;
+			dc.IsRigged = submission.IsRigged;
+
+			if (submission.IsInList(DrawListFlag::Geometry))
+				m_DrawList.push_back(dc);
+			if (submission.IsInList(DrawListFlag::Transparent))
+				m_TransparentDrawList.push_back(dc);
+			if (submission.IsInList(DrawListFlag::Selected))
+				m_SelectedMeshDrawList.push_back(dc);
+			if (submission.IsInList(DrawListFlag::Shadow))
+				m_ShadowPassDrawList.push_back(dc);
+			if (submission.IsInList(DrawListFlag::Collider))
+				m_ColliderDrawList.push_back(dc);
+		}
+	}
+
 	void SceneRenderer::BuildAccelerationStructures()
 	{
 		if (m_RaytracingSettings.Mode != RaytracingMode::None)
@@ -2831,18 +2963,14 @@ namespace Beyond {
 			{
 				// Render entities
 				const Buffer cascade(&i, sizeof(uint32_t));
-				for (auto& [mk, dc] : m_StaticMeshShadowPassDrawList)
+				for (auto& dc : m_StaticMeshShadowPassDrawList)
 				{
-					BEY_CORE_VERIFY(m_MeshTransformMap.find(mk) != m_MeshTransformMap.end());
-					const auto& transformData = m_MeshTransformMap.at(mk);
-					Renderer::RenderStaticMeshWithMaterial(m_MainCommandBuffer, m_ShadowPassPipelines[i], dc.StaticMesh, dc.SubmeshIndex, m_ShadowPassMaterial, transformData.TransformIndex, dc.InstanceCount, cascade);
+					Renderer::RenderStaticMeshWithMaterial(m_MainCommandBuffer, m_ShadowPassPipelines[i], dc.StaticMesh, dc.SubmeshIndex, m_ShadowPassMaterial, dc.TransformIndex, dc.InstanceCount, cascade);
 				}
-				for (auto& [mk, dc] : m_ShadowPassDrawList)
+				for (auto& dc : m_ShadowPassDrawList)
 				{
-					BEY_CORE_VERIFY(m_MeshTransformMap.find(mk) != m_MeshTransformMap.end());
-					const auto& transformData = m_MeshTransformMap.at(mk);
 					if (!dc.IsRigged)
-						Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_ShadowPassPipelines[i], dc.Mesh, dc.SubmeshIndex, 0, transformData.TransformIndex, dc.InstanceCount, m_ShadowPassMaterial, cascade);
+						Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_ShadowPassPipelines[i], dc.Mesh, dc.SubmeshIndex, 0, dc.TransformIndex, dc.InstanceCount, m_ShadowPassMaterial, cascade);
 				}
 			}
 			Renderer::EndRenderPass(m_MainCommandBuffer);
@@ -2855,14 +2983,11 @@ namespace Beyond {
 			{
 				// Render entities
 				const Buffer cascade(&i, sizeof(uint32_t));
-				for (auto& [mk, dc] : m_ShadowPassDrawList)
+				for (auto& dc : m_ShadowPassDrawList)
 				{
-					BEY_CORE_VERIFY(m_MeshTransformMap.find(mk) != m_MeshTransformMap.end());
-					const auto& transformData = m_MeshTransformMap.at(mk);
 					if (dc.IsRigged)
 					{
-						const auto& boneTransformsData = m_MeshBoneTransformsMap.at(mk);
-						Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_ShadowPassPipelinesAnim[i], dc.Mesh, dc.SubmeshIndex, boneTransformsData.BoneTransformsBaseIndex, transformData.TransformIndex, dc.InstanceCount, m_ShadowPassMaterial, cascade);
+						Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_ShadowPassPipelinesAnim[i], dc.Mesh, dc.SubmeshIndex, dc.BoneTransformsBaseIndex, dc.TransformIndex, dc.InstanceCount, m_ShadowPassMaterial, cascade);
 					}
 				}
 			}
@@ -2887,24 +3012,19 @@ namespace Beyond {
 			for (uint32_t i = 0; i < 1; i++)
 			{
 				const Buffer lightIndex(&i, sizeof(uint32_t));
-				for (auto& [mk, dc] : m_StaticMeshShadowPassDrawList)
+				for (auto& dc : m_StaticMeshShadowPassDrawList)
 				{
-					BEY_CORE_VERIFY(m_MeshTransformMap.find(mk) != m_MeshTransformMap.end());
-					const auto& transformData = m_MeshTransformMap.at(mk);
-					Renderer::RenderStaticMeshWithMaterial(m_MainCommandBuffer, m_SpotShadowPassPipeline, dc.StaticMesh, dc.SubmeshIndex, m_SpotShadowPassMaterial, transformData.TransformIndex, dc.InstanceCount, lightIndex);
+					Renderer::RenderStaticMeshWithMaterial(m_MainCommandBuffer, m_SpotShadowPassPipeline, dc.StaticMesh, dc.SubmeshIndex, m_SpotShadowPassMaterial, dc.TransformIndex, dc.InstanceCount, lightIndex);
 				}
-				for (auto& [mk, dc] : m_ShadowPassDrawList)
+				for (auto& dc : m_ShadowPassDrawList)
 				{
-					BEY_CORE_VERIFY(m_MeshTransformMap.find(mk) != m_MeshTransformMap.end());
-					const auto& transformData = m_MeshTransformMap.at(mk);
 					if (dc.IsRigged)
 					{
-						const auto& boneTransformsData = m_MeshBoneTransformsMap.at(mk);
-						Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_SpotShadowPassAnimPipeline, dc.Mesh, dc.SubmeshIndex, boneTransformsData.BoneTransformsBaseIndex, transformData.TransformIndex, dc.InstanceCount, m_SpotShadowPassMaterial, lightIndex);
+						Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_SpotShadowPassAnimPipeline, dc.Mesh, dc.SubmeshIndex, dc.BoneTransformsBaseIndex, dc.TransformIndex, dc.InstanceCount, m_SpotShadowPassMaterial, lightIndex);
 					}
 					else
 					{
-						Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_SpotShadowPassPipeline, dc.Mesh, dc.SubmeshIndex, 0, transformData.TransformIndex, dc.InstanceCount, m_SpotShadowPassMaterial, lightIndex);
+						Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_SpotShadowPassPipeline, dc.Mesh, dc.SubmeshIndex, 0, dc.TransformIndex, dc.InstanceCount, m_SpotShadowPassMaterial, lightIndex);
 					}
 				}
 			}
@@ -2924,30 +3044,26 @@ namespace Beyond {
 		m_GPUTimeQueries.DepthPrePassQuery = m_MainCommandBuffer->BeginTimestampQuery();
 		SceneRenderer::BeginGPUPerfMarker(m_MainCommandBuffer, "PreDepthPass");
 		Renderer::BeginRenderPass(m_MainCommandBuffer, m_PreDepthPass);
-		for (auto& [mk, dc] : m_StaticMeshDrawList)
+		for (auto& dc : m_StaticMeshDrawList)
 		{
-			const auto& transformData = m_MeshTransformMap.at(mk);
-			Renderer::RenderStaticMeshWithMaterial(m_MainCommandBuffer, m_PreDepthPipeline, dc.StaticMesh, dc.SubmeshIndex, m_PreDepthMaterial, transformData.TransformIndex, dc.InstanceCount);
+			Renderer::RenderStaticMeshWithMaterial(m_MainCommandBuffer, m_PreDepthPipeline, dc.StaticMesh, dc.SubmeshIndex, m_PreDepthMaterial, dc.TransformIndex, dc.InstanceCount);
 		}
-		for (auto& [mk, dc] : m_DrawList)
+		for (auto& dc : m_DrawList)
 		{
 			if (!dc.IsRigged)
 			{
-				const auto& transformData = m_MeshTransformMap.at(mk);
-				Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_PreDepthPipeline, dc.Mesh, dc.SubmeshIndex, 0, transformData.TransformIndex, dc.InstanceCount, m_PreDepthMaterial);
+				Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_PreDepthPipeline, dc.Mesh, dc.SubmeshIndex, 0, dc.TransformIndex, dc.InstanceCount, m_PreDepthMaterial);
 			}
 		}
 
 		Renderer::EndRenderPass(m_MainCommandBuffer);
 
 		Renderer::BeginRenderPass(m_MainCommandBuffer, m_PreDepthAnimPass);
-		for (auto& [mk, dc] : m_DrawList)
+		for (auto& dc : m_DrawList)
 		{
 			if (dc.IsRigged)
 			{
-				const auto& transformData = m_MeshTransformMap.at(mk);
-				const auto& boneTransformsData = m_MeshBoneTransformsMap.at(mk);
-				Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_PreDepthPipelineAnim, dc.Mesh, dc.SubmeshIndex, boneTransformsData.BoneTransformsBaseIndex, transformData.TransformIndex, dc.InstanceCount, m_PreDepthMaterial);
+				Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_PreDepthPipelineAnim, dc.Mesh, dc.SubmeshIndex, dc.BoneTransformsBaseIndex, dc.TransformIndex, dc.InstanceCount, m_PreDepthMaterial);
 			}
 		}
 
@@ -2955,17 +3071,15 @@ namespace Beyond {
 
 #if 1
 		Renderer::BeginRenderPass(m_MainCommandBuffer, m_PreDepthTransparentPass);
-		for (auto& [mk, dc] : m_TransparentStaticMeshDrawList)
+		for (auto& dc : m_TransparentStaticMeshDrawList)
 		{
-			const auto& transformData = m_MeshTransformMap.at(mk);
-			Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_PreDepthTransparentPipeline, dc.StaticMesh, dc.SubmeshIndex, 0, transformData.TransformIndex, dc.InstanceCount, m_PreDepthMaterial);
+			Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_PreDepthTransparentPipeline, dc.StaticMesh, dc.SubmeshIndex, 0, dc.TransformIndex, dc.InstanceCount, m_PreDepthMaterial);
 		}
-		for (auto& [mk, dc] : m_TransparentDrawList)
+		for (auto& dc : m_TransparentDrawList)
 		{
 			if (!dc.IsRigged)
 			{
-				const auto& transformData = m_MeshTransformMap.at(mk);
-				Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_PreDepthPipeline, dc.Mesh, dc.SubmeshIndex, 0, transformData.TransformIndex, dc.InstanceCount, m_PreDepthMaterial);
+				Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_PreDepthPipeline, dc.Mesh, dc.SubmeshIndex, 0, dc.TransformIndex, dc.InstanceCount, m_PreDepthMaterial);
 			}
 		}
 		Renderer::EndRenderPass(m_MainCommandBuffer);
@@ -3170,27 +3284,23 @@ namespace Beyond {
 		m_GPUTimeQueries.GeometryPassQuery = m_MainCommandBuffer->BeginTimestampQuery();
 
 		Renderer::BeginRenderPass(m_MainCommandBuffer, m_SelectedGeometryPass);
-		for (auto& [mk, dc] : m_SelectedStaticMeshDrawList)
+		for (auto& dc : m_SelectedStaticMeshDrawList)
 		{
-			const auto& transformData = m_MeshTransformMap.at(mk);
-			Renderer::RenderStaticMeshWithMaterial(m_MainCommandBuffer, m_SelectedGeometryPass->GetSpecification().Pipeline, dc.StaticMesh, dc.SubmeshIndex, m_SelectedGeometryMaterial, transformData.TransformIndex, dc.InstanceCount);
+			Renderer::RenderStaticMeshWithMaterial(m_MainCommandBuffer, m_SelectedGeometryPass->GetSpecification().Pipeline, dc.StaticMesh, dc.SubmeshIndex, m_SelectedGeometryMaterial, dc.TransformIndex, dc.InstanceCount);
 		}
-		for (auto& [mk, dc] : m_SelectedMeshDrawList)
+		for (auto& dc : m_SelectedMeshDrawList)
 		{
-			const auto& transformData = m_MeshTransformMap.at(mk);
 			if (!dc.IsRigged)
-				Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_SelectedGeometryPass->GetPipeline(), dc.Mesh, dc.SubmeshIndex, 0, transformData.TransformIndex, dc.InstanceCount, m_SelectedGeometryMaterial);
+				Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_SelectedGeometryPass->GetPipeline(), dc.Mesh, dc.SubmeshIndex, 0, dc.TransformIndex, dc.InstanceCount, m_SelectedGeometryMaterial);
 		}
 		Renderer::EndRenderPass(m_MainCommandBuffer);
 
 		Renderer::BeginRenderPass(m_MainCommandBuffer, m_SelectedGeometryAnimPass);
-		for (auto& [mk, dc] : m_SelectedMeshDrawList)
+		for (auto& dc : m_SelectedMeshDrawList)
 		{
-			const auto& transformData = m_MeshTransformMap.at(mk);
 			if (dc.IsRigged)
 			{
-				const auto& boneTransformsData = m_MeshBoneTransformsMap.at(mk);
-				Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_SelectedGeometryAnimPass->GetPipeline(), dc.Mesh, dc.SubmeshIndex, boneTransformsData.BoneTransformsBaseIndex + dc.InstanceOffset, transformData.TransformIndex, dc.InstanceCount, m_SelectedGeometryMaterial);
+				Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_SelectedGeometryAnimPass->GetPipeline(), dc.Mesh, dc.SubmeshIndex, dc.BoneTransformsBaseIndex + dc.InstanceOffset, dc.TransformIndex, dc.InstanceCount, m_SelectedGeometryMaterial);
 			}
 		}
 		Renderer::EndRenderPass(m_MainCommandBuffer);
@@ -3201,20 +3311,18 @@ namespace Beyond {
 
 			// Render static meshes
 			SceneRenderer::BeginGPUPerfMarker(m_MainCommandBuffer, "Static Meshes");
-			for (auto& [mk, dc] : m_StaticMeshDrawList)
+			for (auto& dc : m_StaticMeshDrawList)
 			{
-				const auto& transformData = m_MeshTransformMap.at(mk);
-				Renderer::RenderStaticMesh(m_MainCommandBuffer, m_GeometryPipeline, dc.StaticMesh, dc.SubmeshIndex, dc.MaterialTable ? dc.MaterialTable : dc.StaticMesh->GetMaterials(), transformData.TransformIndex, dc.InstanceCount);
+				Renderer::RenderStaticMesh(m_MainCommandBuffer, m_GeometryPipeline, dc.StaticMesh, dc.SubmeshIndex, dc.MaterialTable ? dc.MaterialTable : dc.StaticMesh->GetMaterials(), dc.TransformIndex, dc.InstanceCount);
 			}
 			SceneRenderer::EndGPUPerfMarker(m_MainCommandBuffer);
 
 			// Render dynamic meshes
 			SceneRenderer::BeginGPUPerfMarker(m_MainCommandBuffer, "Dynamic Meshes");
-			for (auto& [mk, dc] : m_DrawList)
+			for (auto& dc : m_DrawList)
 			{
-				const auto& transformData = m_MeshTransformMap.at(mk);
 				if (!dc.IsRigged)
-					Renderer::RenderSubmeshInstanced(m_MainCommandBuffer, m_GeometryPipeline, dc.Mesh, dc.SubmeshIndex, dc.MaterialTable ? dc.MaterialTable : dc.Mesh->GetMaterials(), 0, transformData.TransformIndex, dc.InstanceCount);
+					Renderer::RenderSubmeshInstanced(m_MainCommandBuffer, m_GeometryPipeline, dc.Mesh, dc.SubmeshIndex, dc.MaterialTable ? dc.MaterialTable : dc.Mesh->GetMaterials(), 0, dc.TransformIndex, dc.InstanceCount);
 			}
 			SceneRenderer::EndGPUPerfMarker(m_MainCommandBuffer);
 
@@ -3222,20 +3330,18 @@ namespace Beyond {
 			{
 				// Render static meshes
 				SceneRenderer::BeginGPUPerfMarker(m_MainCommandBuffer, "Static Transparent Meshes");
-				for (auto& [mk, dc] : m_TransparentStaticMeshDrawList)
+				for (auto& dc : m_TransparentStaticMeshDrawList)
 				{
-					const auto& transformData = m_MeshTransformMap.at(mk);
-					Renderer::RenderStaticMesh(m_MainCommandBuffer, m_TransparentGeometryPipeline, dc.StaticMesh, dc.SubmeshIndex, dc.MaterialTable ? dc.MaterialTable : dc.StaticMesh->GetMaterials(), transformData.TransformIndex, dc.InstanceCount);
+					Renderer::RenderStaticMesh(m_MainCommandBuffer, m_TransparentGeometryPipeline, dc.StaticMesh, dc.SubmeshIndex, dc.MaterialTable ? dc.MaterialTable : dc.StaticMesh->GetMaterials(), dc.TransformIndex, dc.InstanceCount);
 				}
 				SceneRenderer::EndGPUPerfMarker(m_MainCommandBuffer);
 
 				// Render dynamic meshes
 				SceneRenderer::BeginGPUPerfMarker(m_MainCommandBuffer, "Dynamic Transparent Meshes");
-				for (auto& [mk, dc] : m_TransparentDrawList)
+				for (auto& dc : m_TransparentDrawList)
 				{
-					const auto& transformData = m_MeshTransformMap.at(mk);
 					//Renderer::RenderSubmesh(m_MainCommandBuffer, m_GeometryPipeline, m_UniformBufferSet, m_StorageBufferSet, dc.Mesh, dc.SubmeshIndex, dc.MaterialTable ? dc.MaterialTable : dc.Mesh->GetMaterials(), dc.Transform);
-					Renderer::RenderSubmeshInstanced(m_MainCommandBuffer, m_TransparentGeometryPipeline, dc.Mesh, dc.SubmeshIndex, dc.MaterialTable ? dc.MaterialTable : dc.Mesh->GetMaterials(), 0, transformData.TransformIndex, dc.InstanceCount);
+					Renderer::RenderSubmeshInstanced(m_MainCommandBuffer, m_TransparentGeometryPipeline, dc.Mesh, dc.SubmeshIndex, dc.MaterialTable ? dc.MaterialTable : dc.Mesh->GetMaterials(), 0, dc.TransformIndex, dc.InstanceCount);
 				}
 				SceneRenderer::EndGPUPerfMarker(m_MainCommandBuffer);
 			}
@@ -3246,13 +3352,11 @@ namespace Beyond {
 		if (m_RaytracingSettings.Mode == RaytracingMode::None)
 		{
 			Renderer::BeginRenderPass(m_MainCommandBuffer, m_GeometryAnimPass);
-			for (auto& [mk, dc] : m_DrawList)
+			for (auto& dc : m_DrawList)
 			{
-				const auto& transformData = m_MeshTransformMap.at(mk);
 				if (dc.IsRigged)
 				{
-					const auto& boneTransformsData = m_MeshBoneTransformsMap.at(mk);
-					Renderer::RenderSubmeshInstanced(m_MainCommandBuffer, m_GeometryPipelineAnim, dc.Mesh, dc.SubmeshIndex, dc.MaterialTable ? dc.MaterialTable : dc.Mesh->GetMaterials(), boneTransformsData.BoneTransformsBaseIndex, transformData.TransformIndex, dc.InstanceCount);
+					Renderer::RenderSubmeshInstanced(m_MainCommandBuffer, m_GeometryPipelineAnim, dc.Mesh, dc.SubmeshIndex, dc.MaterialTable ? dc.MaterialTable : dc.Mesh->GetMaterials(), dc.BoneTransformsBaseIndex, dc.TransformIndex, dc.InstanceCount);
 				}
 			}
 
@@ -3934,18 +4038,16 @@ namespace Beyond {
 			Renderer::BeginRenderPass(m_MainCommandBuffer, m_GeometryWireframePass);
 
 			SceneRenderer::BeginGPUPerfMarker(m_MainCommandBuffer, "Static Meshes Wireframe");
-			for (auto& [mk, dc] : m_SelectedStaticMeshDrawList)
+			for (auto& dc : m_SelectedStaticMeshDrawList)
 			{
-				const auto& transformData = m_MeshTransformMap.at(mk);
-				Renderer::RenderStaticMeshWithMaterial(m_MainCommandBuffer, m_GeometryWireframePass->GetPipeline(), dc.StaticMesh, dc.SubmeshIndex, m_WireframeMaterial, transformData.TransformIndex, dc.InstanceCount);
+				Renderer::RenderStaticMeshWithMaterial(m_MainCommandBuffer, m_GeometryWireframePass->GetPipeline(), dc.StaticMesh, dc.SubmeshIndex, m_WireframeMaterial, dc.TransformIndex, dc.InstanceCount);
 			}
 
-			for (auto& [mk, dc] : m_SelectedMeshDrawList)
+			for (auto& dc : m_SelectedMeshDrawList)
 			{
 				if (!dc.IsRigged)
 				{
-					const auto& transformData = m_MeshTransformMap.at(mk);
-					Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_GeometryWireframePass->GetPipeline(), dc.Mesh, dc.SubmeshIndex, 0, transformData.TransformIndex, dc.InstanceCount, m_WireframeMaterial);
+					Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_GeometryWireframePass->GetPipeline(), dc.Mesh, dc.SubmeshIndex, 0, dc.TransformIndex, dc.InstanceCount, m_WireframeMaterial);
 				}
 			}
 
@@ -3954,13 +4056,11 @@ namespace Beyond {
 
 			Renderer::BeginRenderPass(m_MainCommandBuffer, m_GeometryWireframeAnimPass);
 			SceneRenderer::BeginGPUPerfMarker(m_MainCommandBuffer, "Dynamic Meshes Wireframe");
-			for (auto& [mk, dc] : m_SelectedMeshDrawList)
+			for (auto& dc : m_SelectedMeshDrawList)
 			{
-				const auto& transformData = m_MeshTransformMap.at(mk);
 				if (dc.IsRigged)
 				{
-					const auto& boneTransformsData = m_MeshBoneTransformsMap.at(mk);
-					Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_GeometryWireframeAnimPass->GetPipeline(), dc.Mesh, dc.SubmeshIndex, boneTransformsData.BoneTransformsBaseIndex + dc.InstanceOffset, transformData.TransformIndex, dc.InstanceCount, m_WireframeMaterial);
+					Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, m_GeometryWireframeAnimPass->GetPipeline(), dc.Mesh, dc.SubmeshIndex, dc.BoneTransformsBaseIndex + dc.InstanceOffset, dc.TransformIndex, dc.InstanceCount, m_WireframeMaterial);
 				}
 			}
 			SceneRenderer::EndGPUPerfMarker(m_MainCommandBuffer);
@@ -3975,19 +4075,15 @@ namespace Beyond {
 
 			SceneRenderer::BeginGPUPerfMarker(m_MainCommandBuffer, "Static Meshes Collider");
 			Renderer::BeginRenderPass(m_MainCommandBuffer, staticPass);
-			for (auto& [mk, dc] : m_StaticColliderDrawList)
+			for (auto& dc : m_StaticColliderDrawList)
 			{
-				BEY_CORE_VERIFY(m_MeshTransformMap.find(mk) != m_MeshTransformMap.end());
-				const auto& transformData = m_MeshTransformMap.at(mk);
-				Renderer::RenderStaticMeshWithMaterial(m_MainCommandBuffer, staticPass->GetPipeline(), dc.StaticMesh, dc.SubmeshIndex, dc.OverrideMaterial, transformData.TransformIndex, dc.InstanceCount);
+				Renderer::RenderStaticMeshWithMaterial(m_MainCommandBuffer, staticPass->GetPipeline(), dc.StaticMesh, dc.SubmeshIndex, dc.OverrideMaterial, dc.TransformIndex, dc.InstanceCount);
 			}
 
-			for (auto& [mk, dc] : m_ColliderDrawList)
+			for (auto& dc : m_ColliderDrawList)
 			{
-				BEY_CORE_VERIFY(m_MeshTransformMap.find(mk) != m_MeshTransformMap.end());
-				const auto& transformData = m_MeshTransformMap.at(mk);
 				if (!dc.IsRigged)
-					Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, staticPass->GetPipeline(), dc.Mesh, dc.SubmeshIndex, 0, transformData.TransformIndex, dc.InstanceCount, m_SimpleColliderMaterial);
+					Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, staticPass->GetPipeline(), dc.Mesh, dc.SubmeshIndex, 0, dc.TransformIndex, dc.InstanceCount, m_SimpleColliderMaterial);
 			}
 
 			Renderer::EndRenderPass(m_MainCommandBuffer);
@@ -3995,18 +4091,15 @@ namespace Beyond {
 
 			SceneRenderer::BeginGPUPerfMarker(m_MainCommandBuffer, "Animated Meshes Collider");
 			Renderer::BeginRenderPass(m_MainCommandBuffer, animPass);
-			for (auto& [mk, dc] : m_ColliderDrawList)
+			for (auto& dc : m_ColliderDrawList)
 			{
-				BEY_CORE_VERIFY(m_MeshTransformMap.find(mk) != m_MeshTransformMap.end());
-				const auto& transformData = m_MeshTransformMap.at(mk);
 				if (dc.IsRigged)
 				{
-					const auto& boneTransformsData = m_MeshBoneTransformsMap.at(mk);
-					Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, animPass->GetPipeline(), dc.Mesh, dc.SubmeshIndex, boneTransformsData.BoneTransformsBaseIndex, transformData.TransformIndex, dc.InstanceCount, m_SimpleColliderMaterial);
+					Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, animPass->GetPipeline(), dc.Mesh, dc.SubmeshIndex, dc.BoneTransformsBaseIndex, dc.TransformIndex, dc.InstanceCount, m_SimpleColliderMaterial);
 				}
 				else
 				{
-					Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, animPass->GetPipeline(), dc.Mesh, dc.SubmeshIndex, {}, transformData.TransformIndex, dc.InstanceCount, m_SimpleColliderMaterial);
+					Renderer::RenderMeshWithMaterial(m_MainCommandBuffer, animPass->GetPipeline(), dc.Mesh, dc.SubmeshIndex, {}, dc.TransformIndex, dc.InstanceCount, m_SimpleColliderMaterial);
 				}
 			}
 
@@ -4122,13 +4215,14 @@ namespace Beyond {
 		m_StaticColliderDrawList.clear();
 		m_SceneData = {};
 
-		m_MeshTransformMap.clear();
-		m_MeshBoneTransformsMap.clear();
+		m_DrawSubmissions.clear();
+		m_SubmittedBoneTransforms.clear();
 	}
 
-	void SceneRenderer::CopyToBoneTransformStorage(const MeshKey& meshKey, const Ref<MeshSource>& meshSource, const std::vector<glm::mat4>& boneTransforms)
+	uint32_t SceneRenderer::CopyToBoneTransformStorage(const Ref<MeshSource>& meshSource, const std::vector<glm::mat4>& boneTransforms)
 	{
-		auto& boneTransformStorage = m_MeshBoneTransformsMap[meshKey].BoneTransformsData.emplace_back();
+		const uint32_t index = (uint32_t)m_SubmittedBoneTransforms.size();
+		auto& boneTransformStorage = m_SubmittedBoneTransforms.emplace_back();
 		if (boneTransforms.empty())
 		{
 			boneTransformStorage.fill(glm::identity<glm::mat4>());
@@ -4143,6 +4237,8 @@ namespace Beyond {
 				boneTransformStorage[i] = submeshInvTransform * boneTransform * invBindPose;
 			}
 		}
+
+		return index;
 	}
 
 #pragma region CreateMaterials
@@ -4531,28 +4627,28 @@ namespace Beyond {
 		m_Statistics.Instances = 0;
 		m_Statistics.Meshes = 0;
 
-		for (auto& [mk, dc] : m_SelectedStaticMeshDrawList)
+		for (auto& dc : m_SelectedStaticMeshDrawList)
 		{
 			m_Statistics.Instances += dc.InstanceCount;
 			m_Statistics.DrawCalls++;
 			m_Statistics.Meshes++;
 		}
 
-		for (auto& [mk, dc] : m_StaticMeshDrawList)
+		for (auto& dc : m_StaticMeshDrawList)
 		{
 			m_Statistics.Instances += dc.InstanceCount;
 			m_Statistics.DrawCalls++;
 			m_Statistics.Meshes++;
 		}
 
-		for (auto& [mk, dc] : m_SelectedMeshDrawList)
+		for (auto& dc : m_SelectedMeshDrawList)
 		{
 			m_Statistics.Instances += dc.InstanceCount;
 			m_Statistics.DrawCalls++;
 			m_Statistics.Meshes++;
 		}
 
-		for (auto& [mk, dc] : m_DrawList)
+		for (auto& dc : m_DrawList)
 		{
 			m_Statistics.Instances += dc.InstanceCount;
 			m_Statistics.DrawCalls++;
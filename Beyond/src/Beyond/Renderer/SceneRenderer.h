@@ -24,8 +24,11 @@
 #include "DebugRenderer.h"
 #include "DLSS.h"
 #include "DrawCommands.h"
+#include "DrawList.h"
+#include "FrustumCulling.h"
 #include "GPUSemaphore.h"
 #include "Raytracer.h"
+#include "RendererStats.h"
 #include "EASTL/array.h"
 #include "rtxgi/ddgi/gfx/DDGIVolume_VK.h"
 
@@ -79,6 +82,10 @@ namespace Beyond {
 		// SSR
 		bool EnableSSR = false;
 		ShaderDef::AOMethod ReflectionOcclusionMethod = ShaderDef::AOMethod::None;
+
+		// CPU culling
+		bool EnableFrustumCulling = true;
+		float MaxDrawDistance = 0.0f; // 0 disables distance culling
 	};
 
 	struct SSROptionsUB
@@ -154,6 +161,8 @@ namespace Beyond {
 			uint32_t Instances = 0;
 			uint32_t SavedDraws = 0;
 
+			CullingStatistics Culling;
+
 			float TotalGPUTime = 0.0f;
 		};
 	public:
@@ -181,11 +190,12 @@ namespace Beyond {
 		static void BeginGPUPerfMarker(Ref<RenderCommandBuffer> renderCommandBuffer, const eastl::string& label, const glm::vec4& markerColor = {});
 		static void EndGPUPerfMarker(Ref<RenderCommandBuffer> renderCommandBuffer);
 
-		void SubmitMesh(Ref<Mesh> mesh, uint32_t submeshIndex, Ref<MaterialTable> materialTabl, const glm::mat4& transform = glm::mat4(1.0f), const std::vector<glm::mat4>& boneTransforms = {}, Ref<Material> overrideMaterial = nullptr);
-		void SubmitStaticMesh(Ref<StaticMesh> staticMesh, Ref<MaterialTable> materialTable, const glm::mat4& transform = glm::mat4(1.0f), Ref<Material> overrideMaterial = nullptr);
+		// instanceID identifies the submitting entity across frames for motion vectors, 0 draws the instance without motion
+		void SubmitMesh(Ref<Mesh> mesh, uint32_t submeshIndex, Ref<MaterialTable> materialTabl, const glm::mat4& transform = glm::mat4(1.0f), const std::vector<glm::mat4>& boneTransforms = {}, Ref<Material> overrideMaterial = nullptr, uint64_t instanceID = 0);
+		void SubmitStaticMesh(Ref<StaticMesh> staticMesh, Ref<MaterialTable> materialTable, const glm::mat4& transform = glm::mat4(1.0f), Ref<Material> overrideMaterial = nullptr, uint64_t instanceID = 0);
 
-		void SubmitSelectedMesh(Ref<Mesh> mesh, uint32_t submeshIndex, Ref<MaterialTable> materialTable, const glm::mat4& transform = glm::mat4(1.0f), const std::vector<glm::mat4>& boneTransforms = {}, Ref<Material> overrideMaterial = nullptr);
-		void SubmitSelectedStaticMesh(Ref<StaticMesh> staticMesh, Ref<MaterialTable> materialTable, const glm::mat4& transform = glm::mat4(1.0f), Ref<Material> overrideMaterial = nullptr);
+		void SubmitSelectedMesh(Ref<Mesh> mesh, uint32_t submeshIndex, Ref<MaterialTable> materialTable, const glm::mat4& transform = glm::mat4(1.0f), const std::vector<glm::mat4>& boneTransforms = {}, Ref<Material> overrideMaterial = nullptr, uint64_t instanceID = 0);
+		void SubmitSelectedStaticMesh(Ref<StaticMesh> staticMesh, Ref<MaterialTable> materialTable, const glm::mat4& transform = glm::mat4(1.0f), Ref<Material> overrideMaterial = nullptr, uint64_t instanceID = 0);
 
 		void SubmitPhysicsDebugMesh(Ref<Mesh> mesh, uint32_t submeshIndex, const glm::mat4& transform = glm::mat4(1.0f));
 		void SubmitPhysicsStaticDebugMesh(Ref<StaticMesh> mesh, const glm::mat4& transform = glm::mat4(1.0f), const bool isPrimitiveCollider = true);
@@ -246,7 +256,14 @@ namespace Beyond {
 
 
 
-		void CopyToBoneTransformStorage(const MeshKey& meshKey, const Ref<MeshSource>& meshSource, const std::vector<glm::mat4>& boneTransforms);
+		uint32_t CopyToBoneTransformStorage(const Ref<MeshSource>& meshSource, const std::vector<glm::mat4>& boneTransforms);
+		void AddBatchToDrawLists(const DrawSubmission& submission, uint32_t instanceCount, uint32_t transformIndex, uint32_t boneTransformsBaseIndex);
+
+		void AddMeshToDrawLists(Ref<Mesh> mesh, uint32_t submeshIndex, Ref<MaterialTable> materialTable, const glm::mat4& transform, const std::vector<glm::mat4>& boneTransforms, Ref<Material> overrideMaterial, InstanceVisibility visibility, uint64_t instanceID);
+		void AddStaticMeshToDrawLists(Ref<StaticMesh> staticMesh, uint32_t submeshIndex, Ref<MaterialTable> materialTable, const glm::mat4& transform, Ref<Material> overrideMaterial, InstanceVisibility visibility, uint64_t instanceID);
+
+		void UpdateCullingFrusta(const CascadeData* cascades);
+		void CullMeshSubmissions();
 
 		void CreateBloomPassMaterials();
 		void CreatePreConvolutionPassMaterials();
@@ -699,37 +716,77 @@ namespace Beyond {
 
 		std::vector<Ref<Framebuffer>> m_TempFramebuffers;
 
-		struct TransformMapData
+		// Per-frame instances in submission order, sorted by DrawKeySorter and batched into the draw lists in PreRender
+		std::vector<DrawSubmission> m_DrawSubmissions;
+		std::vector<DrawSortEntry> m_DrawSortEntries;
+		std::vector<DrawSortEntry> m_DrawSortScratch;
+		std::vector<BoneTransforms> m_SubmittedBoneTransforms;
+
+		// Last transform of every tracked instance (entity + submesh), for motion vectors. Culling and sorting
+		// move instances between transform buffer slots from frame to frame, so they can't be matched up by slot.
+		struct InstanceKey
 		{
-			std::vector<TransformVertexData> Transforms;
-			uint32_t TransformIndex = 0;
+			uint64_t InstanceID;
+			uint32_t SubmeshIndex;
+
+			bool operator==(const InstanceKey& other) const { return InstanceID == other.InstanceID && SubmeshIndex == other.SubmeshIndex; }
 		};
 
-		struct BoneTransformsMapData
+		struct InstanceKeyHash
 		{
-			std::vector<BoneTransforms> BoneTransformsData;
-			uint32_t BoneTransformsBaseIndex = 0;
+			size_t operator()(const InstanceKey& key) const { return std::hash<uint64_t>()(key.InstanceID ^ ((uint64_t)key.SubmeshIndex * 0x9E3779B97F4A7C15ull)); }
 		};
 
-		std::unordered_map<MeshKey, TransformMapData> m_MeshTransformMap;
-		std::unordered_map<MeshKey, TransformMapData> m_TransformHistoryMap;
-
-		eastl::hash_map<MeshKey, BoneTransformsMapData> m_MeshBoneTransformsMap;
+		struct PreviousInstanceTransform
+		{
+			TransformVertexData Transform;
+			uint32_t Frame = 0; // m_InstanceTransformFrame it was written in
+		};
 
+		std::unordered_map<InstanceKey, PreviousInstanceTransform, InstanceKeyHash> m_PreviousInstanceTransforms;
+		uint32_t m_InstanceTransformFrame = 1; // Entries start out at frame 0, so they never count as drawn last frame
 
-		eastl::hash_map<MeshKey, DrawCommand> m_DrawList;
-		eastl::hash_map<MeshKey, DrawCommand> m_TransparentDrawList;
-		eastl::hash_map<MeshKey, DrawCommand> m_SelectedMeshDrawList;
-		eastl::hash_map<MeshKey, DrawCommand> m_ShadowPassDrawList;
+		std::vector<DrawCommand> m_DrawList;
+		std::vector<DrawCommand> m_TransparentDrawList;
+		std::vector<DrawCommand> m_SelectedMeshDrawList;
+		std::vector<DrawCommand> m_ShadowPassDrawList;
 
-		eastl::hash_map<MeshKey, StaticDrawCommand> m_StaticMeshDrawList;
-		eastl::hash_map<MeshKey, StaticDrawCommand> m_TransparentStaticMeshDrawList;
-		eastl::hash_map<MeshKey, StaticDrawCommand> m_SelectedStaticMeshDrawList;
-		eastl::hash_map<MeshKey, StaticDrawCommand> m_StaticMeshShadowPassDrawList;
+		std::vector<StaticDrawCommand> m_StaticMeshDrawList;
+		std::vector<StaticDrawCommand> m_TransparentStaticMeshDrawList;
+		std::vector<StaticDrawCommand> m_SelectedStaticMeshDrawList;
+		std::vector<StaticDrawCommand> m_StaticMeshShadowPassDrawList;
 
 		// Debug
-		eastl::hash_map<MeshKey, StaticDrawCommand> m_StaticColliderDrawList;
-		eastl::hash_map<MeshKey, DrawCommand> m_ColliderDrawList;
+		std::vector<StaticDrawCommand> m_StaticColliderDrawList;
+		std::vector<DrawCommand> m_ColliderDrawList;
+
+		// CPU culling, non-rigged submissions are gathered here and culled in one batch at EndScene
+		struct MeshSubmission
+		{
+			Ref<Mesh> DynamicMesh;
+			Ref<StaticMesh> StaticMesh;
+			uint32_t SubmeshIndex = 0;
+			Ref<MaterialTable> MaterialTable;
+			Ref<Material> OverrideMaterial;
+			glm::mat4 Transform;
+			uint64_t InstanceID = 0;
+		};
+
+		enum class ShadowCasterCulling
+		{
+			None,     // Spot light shadows share the shadow draw lists, every caster is kept
+			Cascades, // Casters have to overlap one of the directional light cascades
+			NoShadows // No shadow pass runs this frame
+		};
+
+		std::vector<MeshSubmission> m_MeshSubmissions;
+		CullingBounds m_CullingBounds;
+		std::vector<uint8_t> m_CullingResults;
+		Frustum m_CameraFrustum;
+		Frustum m_CascadeFrusta[4];
+		glm::vec3 m_CullingOrigin = glm::vec3(0.0f);
+		ShadowCasterCulling m_ShadowCasterCulling = ShadowCasterCulling::None;
+		bool m_CullingEnabled = false;
 
 		// Grid
 		Ref<RenderPass> m_GridRenderPass;
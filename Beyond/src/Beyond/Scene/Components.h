@@ -15,6 +15,8 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtx/quaternion.hpp>
 
+#include <entt/entt.hpp>
+
 #include <limits>
 
 #include "Beyond/Renderer/Mesh.h"
@@ -209,6 +211,21 @@ namespace Beyond {
 		friend class SceneSerializer;
 	};
 
+	// Runtime cache of an entity's world space transform, maintained by Scene::UpdateWorldTransforms(). Not serialized.
+	struct WorldTransformComponent
+	{
+		glm::mat4 Transform = glm::mat4(1.0f);
+
+		// Local transform the cached world transform was computed from. TransformComponent fields
+		// are written directly all over the place, so changes are detected by comparing against these.
+		glm::vec3 LocalTranslation = { 0.0f, 0.0f, 0.0f };
+		glm::quat LocalRotation = { 1.0f, 0.0f, 0.0f, 0.0f };
+		glm::vec3 LocalScale = { 1.0f, 1.0f, 1.0f };
+
+		// Forces a recompute (and a recompute of all descendants) on the next update
+		bool Dirty = true;
+	};
+
 	struct MeshComponent
 	{
 		AssetHandle MeshAssetHandle;
@@ -251,6 +268,24 @@ namespace Beyond {
 		std::vector<UUID> BoneEntityIds; // AnimationGraph refers to a skeleton.  Skeleton has a collection of bones.  Each bone affects the transform of an entity. These are those entities.
 		Ref<AnimationGraph::AnimationGraph> AnimationGraph;
 
+		// Runtime cache of BoneEntityIds resolved to registry handles, (re)validated by Scene::UpdateAnimation. Not serialized.
+		std::vector<entt::entity> BoneEntityHandles;
+
+		// Runtime level of detail state, maintained by Scene::UpdateAnimation. Not serialized.
+		struct LODState
+		{
+			uint32_t Tier = 0;
+			uint32_t FramesSinceUpdate = 0;
+			float AccumulatedTime = 0.0f;   // Time that has passed since the graph was last processed
+			bool Evaluated = false;         // Graph was processed this frame
+
+			// The two most recent evaluated poses (root motion track excluded), interpolated in between updates of throttled tiers.
+			// If SkipsLeafBones is set they only hold the skeleton's non leaf bones.
+			std::vector<LocalTransform> PreviousBones;
+			std::vector<LocalTransform> CurrentBones;
+			bool SkipsLeafBones = false;
+		} LOD;
+
 		// Note: generally if you copy an AnimationComponent, then you will need to:
 		// a) Reset the bone entity ids (e.g.to point to copied entities that the copied component belongs to).  See Scene::DuplicateEntity()
 		// b) Create a new independent AnimationGraph instance.  See Scene::DuplicateEntity()
@@ -24,6 +24,8 @@
 #include "Beyond/Audio/AudioComponent.h"
 
 #include "Beyond/Math/Math.h"
+#include "Beyond/Animation/AnimationSampler.h"
+#include "Beyond/Animation/PoseBlending.h"
 #include "Beyond/Renderer/Renderer.h"
 #include "Beyond/Renderer/SceneRenderer.h"
 
@@ -91,6 +93,11 @@ namespace Beyond {
 		m_Registry.on_construct<RigidBodyComponent>().connect<&Scene::OnRigidBodyComponentConstruct>(this);
 		// m_Registry.on_destroy<RigidBodyComponent>().connect<&Scene::OnRigidBodyComponentDestroy>(this);
 
+		m_Registry.on_construct<TransformComponent>().connect<&Scene::OnTransformHierarchyChanged>(this);
+		m_Registry.on_destroy<TransformComponent>().connect<&Scene::OnTransformHierarchyChanged>(this);
+		m_Registry.on_construct<RelationshipComponent>().connect<&Scene::OnTransformHierarchyChanged>(this);
+		m_Registry.on_destroy<RelationshipComponent>().connect<&Scene::OnTransformHierarchyChanged>(this);
+
 		Init();
 	}
 
@@ -121,6 +128,11 @@ namespace Beyond {
 		m_Registry.on_construct<RigidBodyComponent>().disconnect();
 		// m_Registry.on_destroy<RigidBodyComponent>().disconnect();
 
+		m_Registry.on_construct<TransformComponent>().disconnect();
+		m_Registry.on_destroy<TransformComponent>().disconnect();
+		m_Registry.on_construct<RelationshipComponent>().disconnect();
+		m_Registry.on_destroy<RelationshipComponent>().disconnect();
+
 		s_ActiveScenes.erase(m_SceneID);
 		MiniAudioEngine::OnSceneDestruct(m_SceneID);
 	}
@@ -152,36 +164,14 @@ namespace Beyond {
 				{
 					BEY_PROFILE_FUNC("Scene::OnUpdate - C# OnUpdate");
 					Timer timer;
-
-					for (const auto& [entityID, entityInstance] : ScriptEngine::GetEntityInstances())
-					{
-						if (m_EntityIDMap.find(entityID) != m_EntityIDMap.end())
-						{
-							Entity entity = m_EntityIDMap.at(entityID);
-
-							if (ScriptEngine::IsEntityInstantiated(entity))
-								ScriptEngine::CallMethod<float>(entityInstance, "OnUpdate", ts);
-						}
-
-					}
+					ScriptEngine::OnUpdateEntities(ts);
 					m_PerformanceTimers.ScriptUpdate = timer.ElapsedMillis();
 				}
 
 				{
 					BEY_PROFILE_FUNC("Scene::OnUpdate - C# OnLateUpdate");
 					Timer timer;
-
-					for (const auto& [entityID, entityInstance] : ScriptEngine::GetEntityInstances())
-					{
-						if (m_EntityIDMap.find(entityID) != m_EntityIDMap.end())
-						{
-							Entity entity = m_EntityIDMap.at(entityID);
-
-							if (ScriptEngine::IsEntityInstantiated(entity))
-								ScriptEngine::CallMethod<float>(entityInstance, "OnLateUpdate", ts);
-						}
-
-					}
+					ScriptEngine::OnLateUpdateEntities(ts);
 					m_PerformanceTimers.ScriptLateUpdate = timer.ElapsedMillis();
 				}
 
@@ -203,6 +193,7 @@ namespace Beyond {
 			//		and subscribe to destroy and created events to update the handle?
 
 			BEY_PROFILE_SCOPE("Scene::OnUpdate - Update Audio Listener");
+			WorldTransformCacheScope worldTransformCache(this);
 			auto view = m_Registry.view<AudioListenerComponent>();
 			Entity listener;
 			for (auto entity : view)
@@ -283,9 +274,11 @@ namespace Beyond {
 					DestroyEntity(entityID);
 			}
 
+			WorldTransformCacheScope worldTransformCache(this);
 			auto view = m_Registry.view<AudioComponent>();
 
-			std::vector<SoundSourceUpdateData> updateData;
+			auto& updateData = m_SoundSourceUpdateData;
+			updateData.clear();
 			updateData.reserve(view.size());
 
 			for (auto entity : view)
@@ -313,7 +306,7 @@ namespace Beyond {
 
 			//--- Submit values to AudioEngine to update associated sound sources ---
 			//-----------------------------------------------------------------------
-			MiniAudioEngine::Get().SubmitSourceUpdateData(std::move(updateData));
+			MiniAudioEngine::Get().SubmitSourceUpdateData(updateData);
 		}
 
 	}
@@ -333,6 +326,7 @@ namespace Beyond {
 	void Scene::OnRenderRuntime(Ref<SceneRenderer> renderer, Timestep ts)
 	{
 		BEY_PROFILE_FUNC();
+		WorldTransformCacheScope worldTransformCache(this);
 
 		/////////////////////////////////////////////////////////////////////
 		// RENDER 3D SCENE
@@ -341,7 +335,9 @@ namespace Beyond {
 		if (!cameraEntity)
 			return;
 
-		glm::mat4 cameraViewMatrix = glm::inverse(GetWorldSpaceTransformMatrix(cameraEntity));
+		const glm::mat4 cameraTransform = GetWorldSpaceTransformMatrix(cameraEntity);
+		glm::mat4 cameraViewMatrix = glm::inverse(cameraTransform);
+		m_AnimationLODViewPosition = glm::vec3(cameraTransform[3]);
 		BEY_CORE_ASSERT(cameraEntity, "Scene does not contain any cameras!");
 		SceneCamera& camera = cameraEntity.GetComponent<CameraComponent>();
 		camera.SetViewportSize(m_ViewportWidth, m_ViewportHeight);
@@ -535,7 +531,7 @@ namespace Beyond {
 					{
 						Entity e = Entity(entity, this);
 						glm::mat4 transform = GetWorldSpaceTransformMatrix(e);
-						renderer->SubmitStaticMesh(staticMesh, staticMeshComponent.MaterialTable, transform);
+						renderer->SubmitStaticMesh(staticMesh, staticMeshComponent.MaterialTable, transform, nullptr, e.GetUUID());
 					}
 				}
 			}
@@ -558,7 +554,7 @@ namespace Beyond {
 					{
 						Entity e = Entity(entity, this);
 						glm::mat4 transform = GetWorldSpaceTransformMatrix(e);
-						renderer->SubmitMesh(mesh, meshComponent.SubmeshIndex, meshComponent.MaterialTable, transform, GetModelSpaceBoneTransforms(meshComponent.BoneEntityIds, mesh));
+						renderer->SubmitMesh(mesh, meshComponent.SubmeshIndex, meshComponent.MaterialTable, transform, GetModelSpaceBoneTransforms(meshComponent.BoneEntityIds, mesh), nullptr, e.GetUUID());
 					}
 				}
 			}
@@ -683,6 +679,7 @@ namespace Beyond {
 	void Scene::OnRenderEditor(Ref<SceneRenderer> renderer, Timestep ts, const EditorCamera& editorCamera)
 	{
 		BEY_PROFILE_FUNC();
+		WorldTransformCacheScope worldTransformCache(this);
 		BEY_SCOPE_PERF("Scene::OnRenderEditor");
 
 		/////////////////////////////////////////////////////////////////////
@@ -859,6 +856,7 @@ namespace Beyond {
 			}
 		}
 
+		m_AnimationLODViewPosition = editorCamera.GetPosition();
 		renderer->SetScene(this);
 		renderer->BeginScene({ std::make_shared<EditorCamera>(editorCamera), editorCamera.GetViewMatrix(), editorCamera.GetNearClip(), editorCamera.GetFarClip(), editorCamera.GetVerticalFOV() }, ts);
 
@@ -878,9 +876,9 @@ namespace Beyond {
 					glm::mat4 transform = GetWorldSpaceTransformMatrix(e);
 
 					if (SelectionManager::IsEntityOrAncestorSelected(e))
-						renderer->SubmitSelectedStaticMesh(staticMesh, staticMeshComponent.MaterialTable, transform);
+						renderer->SubmitSelectedStaticMesh(staticMesh, staticMeshComponent.MaterialTable, transform, nullptr, e.GetUUID());
 					else
-						renderer->SubmitStaticMesh(staticMesh, staticMeshComponent.MaterialTable, transform);
+						renderer->SubmitStaticMesh(staticMesh, staticMeshComponent.MaterialTable, transform, nullptr, e.GetUUID());
 				}
 			}
 		}
@@ -902,9 +900,9 @@ namespace Beyond {
 
 					// TODO: Should we render (logically)
 					if (SelectionManager::IsEntityOrAncestorSelected(e))
-						renderer->SubmitSelectedMesh(mesh, meshComponent.SubmeshIndex, meshComponent.MaterialTable, transform, GetModelSpaceBoneTransforms(meshComponent.BoneEntityIds, mesh));
+						renderer->SubmitSelectedMesh(mesh, meshComponent.SubmeshIndex, meshComponent.MaterialTable, transform, GetModelSpaceBoneTransforms(meshComponent.BoneEntityIds, mesh), nullptr, e.GetUUID());
 					else
-						renderer->SubmitMesh(mesh, meshComponent.SubmeshIndex, meshComponent.MaterialTable, transform, GetModelSpaceBoneTransforms(meshComponent.BoneEntityIds, mesh));
+						renderer->SubmitMesh(mesh, meshComponent.SubmeshIndex, meshComponent.MaterialTable, transform, GetModelSpaceBoneTransforms(meshComponent.BoneEntityIds, mesh), nullptr, e.GetUUID());
 				}
 			}
 		}
@@ -952,7 +950,8 @@ namespace Beyond {
 
 			std::vector<Entity> deadEntities;
 
-			std::vector<SoundSourceUpdateData> updateData;
+			auto& updateData = m_SoundSourceUpdateData;
+			updateData.clear();
 			updateData.reserve(view.size());
 
 			for (auto entity : view)
@@ -972,7 +971,7 @@ namespace Beyond {
 
 			//--- Submit values to AudioEngine to update associated sound sources ---
 			//-----------------------------------------------------------------------
-			MiniAudioEngine::Get().SubmitSourceUpdateData(std::move(updateData));
+			MiniAudioEngine::Get().SubmitSourceUpdateData(updateData);
 		}
 
 		// Render 2D
@@ -1083,6 +1082,7 @@ namespace Beyond {
 	void Scene::OnRenderSimulation(Ref<SceneRenderer> renderer, Timestep ts, const EditorCamera& editorCamera)
 	{
 		BEY_PROFILE_FUNC();
+		WorldTransformCacheScope worldTransformCache(this);
 
 		/////////////////////////////////////////////////////////////////////
 		// RENDER 3D SCENE
@@ -1255,6 +1255,7 @@ namespace Beyond {
 		}
 
 
+		m_AnimationLODViewPosition = editorCamera.GetPosition();
 		renderer->SetScene(this);
 		renderer->BeginScene({ std::make_shared<EditorCamera>(editorCamera), editorCamera.GetViewMatrix(), editorCamera.GetNearClip(), editorCamera.GetFarClip(), editorCamera.GetVerticalFOV() }, ts);
 
@@ -1276,9 +1277,9 @@ namespace Beyond {
 						glm::mat4 transform = GetWorldSpaceTransformMatrix(e);
 
 						if (SelectionManager::IsEntityOrAncestorSelected(e))
-							renderer->SubmitSelectedStaticMesh(staticMesh, staticMeshComponent.MaterialTable, transform);
+							renderer->SubmitSelectedStaticMesh(staticMesh, staticMeshComponent.MaterialTable, transform, nullptr, e.GetUUID());
 						else
-							renderer->SubmitStaticMesh(staticMesh, staticMeshComponent.MaterialTable, transform);
+							renderer->SubmitStaticMesh(staticMesh, staticMeshComponent.MaterialTable, transform, nullptr, e.GetUUID());
 					}
 				}
 			}
@@ -1302,9 +1303,9 @@ namespace Beyond {
 						glm::mat4 transform = GetWorldSpaceTransformMatrix(e);
 
 						if (SelectionManager::IsEntityOrAncestorSelected(e))
-							renderer->SubmitSelectedMesh(mesh, meshComponent.SubmeshIndex, meshComponent.MaterialTable, transform, GetModelSpaceBoneTransforms(meshComponent.BoneEntityIds, mesh));
+							renderer->SubmitSelectedMesh(mesh, meshComponent.SubmeshIndex, meshComponent.MaterialTable, transform, GetModelSpaceBoneTransforms(meshComponent.BoneEntityIds, mesh), nullptr, e.GetUUID());
 						else
-							renderer->SubmitMesh(mesh, meshComponent.SubmeshIndex, meshComponent.MaterialTable, transform, GetModelSpaceBoneTransforms(meshComponent.BoneEntityIds, mesh));
+							renderer->SubmitMesh(mesh, meshComponent.SubmeshIndex, meshComponent.MaterialTable, transform, GetModelSpaceBoneTransforms(meshComponent.BoneEntityIds, mesh), nullptr, e.GetUUID());
 					}
 				}
 			}
@@ -1685,7 +1686,8 @@ namespace Beyond {
 
 			auto view = m_Registry.view<AudioComponent>();
 
-			std::vector<SoundSourceUpdateData> updateData;
+			auto& updateData = m_SoundSourceUpdateData;
+			updateData.clear();
 			updateData.reserve(view.size());
 
 			for (auto entity : view)
@@ -1705,7 +1707,7 @@ namespace Beyond {
 
 			//--- Submit values to AudioEngine to update associated sound sources ---
 			//-----------------------------------------------------------------------
-			MiniAudioEngine::Get().SubmitSourceUpdateData(std::move(updateData));
+			MiniAudioEngine::Get().SubmitSourceUpdateData(updateData);
 		}
 
 		m_IsPlaying = true;
@@ -1840,33 +1842,223 @@ namespace Beyond {
 	void Scene::UpdateAnimation(Timestep ts, bool isRuntime)
 	{
 		BEY_PROFILE_FUNC();
+
+		// If animation component has no AnimationGraph, or no bone entities then there is nothing to do
+		m_AnimatedEntities.clear();
 		auto view = GetAllEntitiesWith<AnimationComponent>();
 		for (auto e : view)
 		{
-			Entity entity = { e, this };
-			auto& anim = entity.GetComponent<AnimationComponent>();
-
-			// If animation component has no AnimationGraph, or no bone entities then there is nothing to do
+			const auto& anim = view.get<AnimationComponent>(e);
 			if (anim.AnimationGraph && anim.BoneEntityIds.size() > 0)
+				m_AnimatedEntities.push_back(e);
+		}
+
+		// Clip samples cached by the previous frame's graphs are thrown away
+		AnimationSampler::NewFrame();
+
+		m_AnimationStatistics = {};
+		if (m_AnimatedEntities.empty())
+			return;
+
+		// 1. Pick the LOD tier of every entity and which graphs get processed this frame
+		{
+			BEY_PROFILE_SCOPE("Scene::UpdateAnimation - Schedule");
+
+			const AnimationLODSettings& settings = m_AnimationLODSettings;
+			m_AnimationEvaluations.clear();
+			m_AnimationDueUpdates.clear();
+
+			for (uint32_t index = 0; index < (uint32_t)m_AnimatedEntities.size(); ++index)
+			{
+				entt::entity e = m_AnimatedEntities[index];
+				auto& anim = m_Registry.get<AnimationComponent>(e);
+				auto& lod = anim.LOD;
+
+				uint32_t tier = 0;
+				if (settings.Enabled)
+				{
+					const auto* worldTransform = m_Registry.try_get<WorldTransformComponent>(e);
+					const glm::vec3 position = worldTransform ? glm::vec3(worldTransform->Transform[3]) : glm::vec3(GetWorldSpaceTransformMatrix({ e, this })[3]);
+					const float distance = glm::distance(position, m_AnimationLODViewPosition);
+					while (tier < AnimationLODTierCount - 1 && distance > settings.MaxDistance[tier])
+						++tier;
+				}
+
+				const uint32_t interval = glm::max(settings.UpdateInterval[tier], 1u);
+				if (tier != lod.Tier)
+				{
+					lod.Tier = tier;
+					lod.CurrentBones.clear();
+				}
+
+				lod.AccumulatedTime += ts;
+				lod.Evaluated = false;
+				++m_AnimationStatistics.EntitiesPerTier[tier];
+
+				// Throttled tiers need the previous pose to interpolate from, the graph is processed at once if there isn't one yet
+				if (interval == 1 || lod.CurrentBones.empty())
+					m_AnimationEvaluations.push_back(index);
+				else if (++lod.FramesSinceUpdate >= interval)
+					m_AnimationDueUpdates.push_back(index);
+			}
+
+			// Throttled updates are budgeted, the ones overdue the longest go first
+			if (m_AnimationDueUpdates.size() > settings.MaxThrottledUpdatesPerFrame)
 			{
-				anim.AnimationGraph->Process(ts);
+				auto overdue = [this, &settings](uint32_t index)
+				{
+					const auto& lod = m_Registry.get<AnimationComponent>(m_AnimatedEntities[index]).LOD;
+					return (int32_t)lod.FramesSinceUpdate - (int32_t)settings.UpdateInterval[lod.Tier];
+				};
+				std::nth_element(m_AnimationDueUpdates.begin(), m_AnimationDueUpdates.begin() + settings.MaxThrottledUpdatesPerFrame, m_AnimationDueUpdates.end(),
+					[&overdue](uint32_t a, uint32_t b) { return overdue(a) > overdue(b); });
+
+				m_AnimationStatistics.Deferred = (uint32_t)m_AnimationDueUpdates.size() - settings.MaxThrottledUpdatesPerFrame;
+				m_AnimationDueUpdates.resize(settings.MaxThrottledUpdatesPerFrame);
+			}
+			m_AnimationEvaluations.insert(m_AnimationEvaluations.end(), m_AnimationDueUpdates.begin(), m_AnimationDueUpdates.end());
+			m_AnimationStatistics.Evaluated = (uint32_t)m_AnimationEvaluations.size();
+		}
+
+		// 2. Evaluate poses
+		//    AnimationGraph instances don't share any state, so every graph can be processed on its own worker
+		{
+			BEY_PROFILE_SCOPE("Scene::UpdateAnimation - Evaluate Poses");
+			BEY_SCOPE_PERF("Scene::UpdateAnimation - Evaluate Poses");
+
+			Application::Get().GetJobSystem().ParallelFor((uint32_t)m_AnimationEvaluations.size(), 1, [this](uint32_t index)
+			{
+				const entt::entity e = m_AnimatedEntities[m_AnimationEvaluations[index]];
+				auto& anim = m_Registry.get<AnimationComponent>(e);
+				auto& lod = anim.LOD;
+
+				const Skeleton* skeleton = anim.AnimationGraph->GetSkeleton();
+				const bool skipLeafBones = m_AnimationLODSettings.SkipLeafBones[lod.Tier] && skeleton;
+
+				// Graph is processed with all of the time that has passed since its last update
+				{
+					AnimationSampler::SkippedBonesScope skippedBones(skipLeafBones ? &skeleton->GetLeafBones() : nullptr);
+					anim.AnimationGraph->Process(lod.AccumulatedTime);
+				}
+				lod.AccumulatedTime = 0.0f;
+				lod.FramesSinceUpdate = 0;
+				lod.Evaluated = true;
+
+				const uint32_t interval = m_AnimationLODSettings.UpdateInterval[lod.Tier];
+				if (interval > 1)
+				{
+					const Pose* pose = anim.AnimationGraph->GetPose();
+					const LocalTransform* bones = pose->BoneTransforms.data() + 1;
+					const size_t numBones = glm::min(anim.BoneEntityIds.size(), pose->BoneTransforms.size() - 1);
+					const bool firstUpdate = lod.CurrentBones.empty() || lod.SkipsLeafBones != skipLeafBones;
+
+					lod.PreviousBones.swap(lod.CurrentBones);
+					if (skipLeafBones)
+					{
+						// Only the bones that are written back are kept around to interpolate
+						const auto& nonLeafBones = skeleton->GetNonLeafBones();
+						const size_t numKept = std::lower_bound(nonLeafBones.begin(), nonLeafBones.end(), (uint32_t)numBones) - nonLeafBones.begin();
+						lod.CurrentBones.resize(numKept);
+						for (size_t i = 0; i < numKept; ++i)
+							lod.CurrentBones[i] = bones[nonLeafBones[i]];
+					}
+					else
+					{
+						lod.CurrentBones.assign(bones, bones + numBones);
+					}
+					lod.SkipsLeafBones = skipLeafBones;
+
+					if (firstUpdate || lod.PreviousBones.size() != lod.CurrentBones.size())
+					{
+						// First update in this tier. Spread the entities entering it across the interval,
+						// so they don't all come due on the same frame.
+						lod.FramesSinceUpdate = (uint32_t)e % interval;
+						lod.PreviousBones = lod.CurrentBones;
+					}
+				}
+			});
+		}
+
+		// 3. Apply poses to the bone entities, root motion and events
+		//    This touches physics and scripts so it stays on the main thread
+		{
+			BEY_PROFILE_SCOPE("Scene::UpdateAnimation - Apply Poses");
+			BEY_SCOPE_PERF("Scene::UpdateAnimation - Apply Poses");
+			for (auto e : m_AnimatedEntities)
+			{
+				Entity entity = { e, this };
+				auto& anim = entity.GetComponent<AnimationComponent>();
+				auto& lod = anim.LOD;
+
+				// Bone entity handles are resolved once and only looked up again if the bone entity
+				// went away or BoneEntityIds got changed underneath us
+				if (anim.BoneEntityHandles.size() != anim.BoneEntityIds.size())
+					anim.BoneEntityHandles.assign(anim.BoneEntityIds.size(), entt::null);
 
 				// Note: assumption here is that anim.BoneEntityIds[i] <=> AnimationGraph.Transform[i+1]  (0 being the artificial track for root transform)
 				// So there is no need to look up the mapping of mesh -> joint index
 				// index 0 is root motion
 				// index 1 is fake root bone
 				const Pose* pose = anim.AnimationGraph->GetPose();
-				for (size_t i = 0; i < anim.BoneEntityIds.size(); ++i)
+				const size_t numSkeletonBones = glm::min(anim.BoneEntityIds.size(), pose->BoneTransforms.size() - 1);
+				const LocalTransform* bones = pose->BoneTransforms.data() + 1;
+				size_t numBones = numSkeletonBones;
+				const uint32_t* boneIndices = nullptr;          // bones[k] is for bone boneIndices[k], or bone k if there are none
+				const std::vector<bool>* skippedBones = nullptr;
+				LocalTransform rootMotion = pose->RootMotion;
+
+				// Throttled tiers show the last two evaluated poses interpolated, lagging one update interval behind.
+				// Root motion and events are only there on the frames the graph was processed.
+				const Skeleton* skeleton = anim.AnimationGraph->GetSkeleton();
+				const uint32_t interval = glm::max(m_AnimationLODSettings.UpdateInterval[lod.Tier], 1u);
+				if (interval > 1 && !lod.CurrentBones.empty())
+				{
+					const float alpha = glm::min((float)lod.FramesSinceUpdate / (float)interval, 1.0f);
+					numBones = lod.CurrentBones.size();
+					if (m_InterpolatedBones.size() < numBones)
+						m_InterpolatedBones.resize(numBones);
+
+					PoseBlending::Blend(lod.PreviousBones.data(), lod.CurrentBones.data(), alpha, m_InterpolatedBones.data(), (uint32_t)numBones);
+					bones = m_InterpolatedBones.data();
+					if (lod.SkipsLeafBones)
+					{
+						boneIndices = skeleton->GetNonLeafBones().data();
+						m_AnimationStatistics.SkippedBones[lod.Tier] += (uint32_t)(numSkeletonBones - glm::min(numBones, numSkeletonBones));
+					}
+					if (!lod.Evaluated)
+						rootMotion = LocalTransform();
+					++m_AnimationStatistics.Interpolated;
+				}
+				else if (m_AnimationLODSettings.SkipLeafBones[lod.Tier] && skeleton)
 				{
-					auto boneTransformEntity = TryGetEntityWithUUID(anim.BoneEntityIds[i]);
-					if (boneTransformEntity)
+					skippedBones = &skeleton->GetLeafBones();
+				}
+
+				for (size_t k = 0; k < numBones; ++k)
+				{
+					const size_t i = boneIndices ? boneIndices[k] : k;
+					if (i >= numSkeletonBones)
+						break;
+
+					if (skippedBones && i < skippedBones->size() && (*skippedBones)[i])
+					{
+						++m_AnimationStatistics.SkippedBones[lod.Tier];
+						continue;
+					}
+
+					entt::entity& boneHandle = anim.BoneEntityHandles[i];
+					if (!m_Registry.valid(boneHandle) || m_Registry.get<IDComponent>(boneHandle).ID != anim.BoneEntityIds[i])
 					{
-						// Note: we're assuming there is always a transform component
-						auto& transform = boneTransformEntity.GetComponent<TransformComponent>();
-						transform.Translation = pose->BoneTransforms[i + 1].Translation;
-						transform.SetRotation(pose->BoneTransforms[i + 1].Rotation);
-						transform.Scale = pose->BoneTransforms[i + 1].Scale;
+						boneHandle = (entt::entity)TryGetEntityWithUUID(anim.BoneEntityIds[i]);
+						if (boneHandle == entt::null)
+							continue;
 					}
+
+					// Note: we're assuming there is always a transform component
+					auto& transform = m_Registry.get<TransformComponent>(boneHandle);
+					transform.Translation = bones[k].Translation;
+					transform.SetRotation(bones[k].Rotation);
+					transform.Scale = bones[k].Scale;
 				}
 
 				if (isRuntime)
@@ -1882,10 +2074,10 @@ namespace Beyond {
 						Ref<CharacterController> controller = GetPhysicsScene()->GetCharacterController(entity);
 						BEY_CORE_ASSERT(controller);
 						{
-							const glm::vec3 displacement = rs * pose->RootMotion.Translation;
+							const glm::vec3 displacement = rs * rootMotion.Translation;
 							controller->Move(displacement);
-							if (!glm::all(glm::equal(pose->RootMotion.Rotation, glm::identity<glm::quat>(), glm::epsilon<float>())))
-								controller->SetRotation(transform.GetRotation() * pose->RootMotion.Rotation);
+							if (!glm::all(glm::equal(rootMotion.Rotation, glm::identity<glm::quat>(), glm::epsilon<float>())))
+								controller->SetRotation(transform.GetRotation() * rootMotion.Rotation);
 						}
 					}
 					else if (m_ShouldSimulate && entity.HasComponent<RigidBodyComponent>())
@@ -1902,12 +2094,12 @@ namespace Beyond {
 					{
 						// 3. either we aren't simulating physics, or the target entity is not a physics body
 						//    => apply root motion directly to the target entity's transform
-						transform.Translation += rs * pose->RootMotion.Translation;
+						transform.Translation += rs * rootMotion.Translation;
 
 						// Setting rotation involves some expensive (and not necessarily robust) trignometry.
 						// Avoid it if the quaternion is identity.
-						if (!glm::all(glm::equal(pose->RootMotion.Rotation, glm::identity<glm::quat>(), glm::epsilon<float>())))
-							transform.SetRotation(transform.GetRotation() * pose->RootMotion.Rotation);
+						if (!glm::all(glm::equal(rootMotion.Rotation, glm::identity<glm::quat>(), glm::epsilon<float>())))
+							transform.SetRotation(transform.GetRotation() * rootMotion.Rotation);
 					}
 				}
 
@@ -1920,7 +2112,6 @@ namespace Beyond {
 					}
 				}
 				anim.AnimationGraph->HandleOutgoingEvents(nullptr, nullptr);
-
 			}
 		}
 	}
@@ -2675,6 +2866,12 @@ namespace Beyond {
 	{
 		BEY_PROFILE_FUNC();
 
+		if (m_WorldTransformsValid)
+		{
+			if (const auto* worldTransform = m_Registry.try_get<WorldTransformComponent>(entity))
+				return worldTransform->Transform;
+		}
+
 		glm::mat4 transform(1.0f);
 
 		Entity parent = TryGetEntityWithUUID(entity.GetParentUUID());
@@ -2684,7 +2881,6 @@ namespace Beyond {
 		return transform * entity.Transform().GetTransform();
 	}
 
-	// TODO: Definitely cache this at some point
 	TransformComponent Scene::GetWorldSpaceTransform(Entity entity)
 	{
 		BEY_PROFILE_FUNC();
@@ -2722,6 +2918,10 @@ namespace Beyond {
 		parent.Children().push_back(entity.GetUUID());
 
 		ConvertToLocalSpace(entity);
+
+		m_TransformHierarchyDirty = true;
+		if (auto* worldTransform = m_Registry.try_get<WorldTransformComponent>(entity))
+			worldTransform->Dirty = true;
 	}
 
 	void Scene::UnparentEntity(Entity entity, bool convertToWorldSpace)
@@ -2739,6 +2939,109 @@ namespace Beyond {
 			ConvertToWorldSpace(entity);
 
 		entity.SetParentUUID(0);
+
+		m_TransformHierarchyDirty = true;
+		if (auto* worldTransform = m_Registry.try_get<WorldTransformComponent>(entity))
+			worldTransform->Dirty = true;
+	}
+
+	void Scene::OnTransformHierarchyChanged(entt::registry& registry, entt::entity entity)
+	{
+		m_TransformHierarchyDirty = true;
+	}
+
+	void Scene::RebuildTransformHierarchy()
+	{
+		BEY_PROFILE_FUNC();
+
+		m_TransformHierarchy.clear();
+		m_TransformHierarchyDirty = false;
+
+		auto view = m_Registry.view<TransformComponent, RelationshipComponent>();
+
+		std::unordered_map<entt::entity, int32_t> nodeIndices;
+		nodeIndices.reserve(view.size());
+
+		std::vector<entt::entity> chain;
+		for (auto entity : view)
+		{
+			// Walk up until an ancestor that has already been placed (or a root) is found,
+			// then place the chain top-down so that parents always come first
+			chain.clear();
+			int32_t parentIndex = -1;
+			for (entt::entity current = entity; current != entt::null;)
+			{
+				if (auto it = nodeIndices.find(current); it != nodeIndices.end())
+				{
+					parentIndex = it->second;
+					break;
+				}
+
+				chain.push_back(current);
+
+				Entity parent = TryGetEntityWithUUID(view.get<RelationshipComponent>(current).ParentHandle);
+				current = parent && m_Registry.has<TransformComponent, RelationshipComponent>(parent) ? (entt::entity)parent : entt::null;
+			}
+
+			for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+			{
+				const int32_t index = (int32_t)m_TransformHierarchy.size();
+				m_TransformHierarchy.push_back({ *it, view.get<RelationshipComponent>(*it).ParentHandle, parentIndex });
+				nodeIndices[*it] = index;
+				parentIndex = index;
+			}
+		}
+
+		// Order changed, recompute everything
+		for (const auto& node : m_TransformHierarchy)
+			m_Registry.get_or_emplace<WorldTransformComponent>(node.Entity).Dirty = true;
+	}
+
+	void Scene::UpdateWorldTransforms()
+	{
+		BEY_PROFILE_FUNC();
+
+		if (m_TransformHierarchyDirty)
+			RebuildTransformHierarchy();
+
+		m_WorldTransformChanged.resize(m_TransformHierarchy.size());
+
+		for (size_t i = 0; i < m_TransformHierarchy.size(); i++)
+		{
+			const auto& node = m_TransformHierarchy[i];
+			const auto& [transform, relationship] = m_Registry.get<TransformComponent, RelationshipComponent>(node.Entity);
+
+			// Parent UUIDs are also written directly (serializer, prefabs, etc.), catch those here
+			if (relationship.ParentHandle != node.ParentID)
+			{
+				m_TransformHierarchyDirty = true;
+				UpdateWorldTransforms();
+				return;
+			}
+
+			auto& worldTransform = m_Registry.get<WorldTransformComponent>(node.Entity);
+			const glm::quat rotation = transform.GetRotation();
+
+			const bool parentChanged = node.ParentIndex >= 0 && m_WorldTransformChanged[node.ParentIndex];
+			const bool changed = worldTransform.Dirty || parentChanged
+				|| worldTransform.LocalTranslation != transform.Translation
+				|| worldTransform.LocalRotation != rotation
+				|| worldTransform.LocalScale != transform.Scale;
+
+			m_WorldTransformChanged[i] = changed;
+			if (!changed)
+				continue;
+
+			worldTransform.LocalTranslation = transform.Translation;
+			worldTransform.LocalRotation = rotation;
+			worldTransform.LocalScale = transform.Scale;
+			worldTransform.Dirty = false;
+
+			if (node.ParentIndex >= 0)
+				worldTransform.Transform = m_Registry.get<WorldTransformComponent>(m_TransformHierarchy[node.ParentIndex].Entity).Transform * transform.GetTransform();
+			else
+				worldTransform.Transform = transform.GetTransform();
+		}
 	}
 
 	// Copy to runtime
@@ -22,6 +22,7 @@ namespace Beyond {
 	class Renderer2D;
 	class Prefab;
 	class PhysicsScene;
+	struct SoundSourceUpdateData;
 
 	struct DirectionalLight
 	{
@@ -111,6 +112,30 @@ namespace Beyond {
 			float ScriptLateUpdate = 0.0f;
 			float PhysicsStep = 0.0f;
 		};
+
+		// Animation level of detail. Animated entities are put in a tier by their distance from the viewpoint of the last rendered frame.
+		// Tiers past the first process their graph every UpdateInterval frames and interpolate the bones in between.
+		// Tiers that skip leaf bones (fingers, toes...) don't sample, interpolate or write them, they stay where they were.
+		static constexpr uint32_t AnimationLODTierCount = 4;
+		struct AnimationLODSettings
+		{
+			bool Enabled = true;
+			float MaxDistance[AnimationLODTierCount] = { 15.0f, 30.0f, 60.0f, std::numeric_limits<float>::max() };
+			uint32_t UpdateInterval[AnimationLODTierCount] = { 1, 2, 4, 8 };
+			bool SkipLeafBones[AnimationLODTierCount] = { false, false, false, true };
+
+			// Most throttled graphs processed per frame, the ones overdue the longest go first and the rest wait for the next frame
+			uint32_t MaxThrottledUpdatesPerFrame = 32;
+		};
+
+		struct AnimationStatistics
+		{
+			uint32_t EntitiesPerTier[AnimationLODTierCount] = {};
+			uint32_t Evaluated = 0;
+			uint32_t Interpolated = 0;
+			uint32_t Deferred = 0;
+			uint32_t SkippedBones[AnimationLODTierCount] = {};
+		};
 	public:
 		Scene(const eastl::string& name = "UntitledScene", bool isEditorScene = false, bool initalize = true);
 		~Scene();
@@ -193,6 +218,9 @@ namespace Beyond {
 		glm::mat4 GetWorldSpaceTransformMatrix(Entity entity);
 		TransformComponent GetWorldSpaceTransform(Entity entity);
 
+		// Brings every WorldTransformComponent up to date, only entities whose local transform (or an ancestor's) changed are recomputed
+		void UpdateWorldTransforms();
+
 		void ParentEntity(Entity entity, Entity parent);
 		void UnparentEntity(Entity entity, bool convertToWorldSpace = true);
 
@@ -229,6 +257,9 @@ namespace Beyond {
 
 		const PerformanceTimers& GetPerformanceTimers() const { return m_PerformanceTimers; }
 
+		AnimationLODSettings& GetAnimationLODSettings() { return m_AnimationLODSettings; }
+		const AnimationStatistics& GetAnimationStatistics() const { return m_AnimationStatistics; }
+
 		template<typename TComponent>
 		void CopyComponentIfExists(entt::entity dst, entt::registry& dstRegistry, entt::entity src)
 		{
@@ -260,6 +291,9 @@ namespace Beyond {
 		void OnRigidBodyComponentDestroy(entt::registry& registry, entt::entity entity);
 		void OnRigidBodyComponentDestroy_ProEdition(Entity entity);
 
+		void OnTransformHierarchyChanged(entt::registry& registry, entt::entity entity);
+		void RebuildTransformHierarchy();
+
 		void BuildMeshEntityHierarchy(Entity parent, Ref<Mesh> mesh, const MeshNode& node, bool generateColliders);
 		void BuildBoneEntityIds(Entity entity);
 		void BuildMeshBoneEntityIds(Entity entity, Entity rootEntity);
@@ -276,6 +310,24 @@ namespace Beyond {
 		std::vector<glm::mat4> GetModelSpaceBoneTransforms(const std::vector<UUID>& boneEntityIds, Ref<Mesh> mesh);
 		void UpdateAnimation(Timestep ts, bool isRuntime);
 
+		// World transforms are served from the cache for the lifetime of the scope.
+		// Nothing may write to a TransformComponent while one is alive.
+		struct WorldTransformCacheScope
+		{
+			WorldTransformCacheScope(Scene* scene)
+				: m_Scene(scene), m_WasValid(scene->m_WorldTransformsValid)
+			{
+				if (!m_WasValid)
+					scene->UpdateWorldTransforms();
+				scene->m_WorldTransformsValid = true;
+			}
+
+			~WorldTransformCacheScope() { m_Scene->m_WorldTransformsValid = m_WasValid; }
+
+			Scene* m_Scene;
+			bool m_WasValid;
+		};
+
 	private:
 		UUID m_SceneID;
 		entt::entity m_SceneEntity = entt::null;
@@ -298,6 +350,32 @@ namespace Beyond {
 
 		std::vector<std::function<void()>> m_PostUpdateQueue;
 
+		// Scratch list for UpdateAnimation, kept around so it doesn't reallocate every frame
+		std::vector<entt::entity> m_AnimatedEntities;
+		std::vector<uint32_t> m_AnimationEvaluations; // Indices into m_AnimatedEntities
+		std::vector<uint32_t> m_AnimationDueUpdates;
+		std::vector<LocalTransform> m_InterpolatedBones;
+
+		AnimationLODSettings m_AnimationLODSettings;
+		AnimationStatistics m_AnimationStatistics;
+		glm::vec3 m_AnimationLODViewPosition = { 0.0f, 0.0f, 0.0f }; // Set while rendering, used by the next UpdateAnimation
+
+		// Sound source data submitted to the audio engine, swapped with the engine's buffer so it doesn't reallocate every frame
+		std::vector<SoundSourceUpdateData> m_SoundSourceUpdateData;
+
+		struct TransformHierarchyNode
+		{
+			entt::entity Entity;
+			UUID ParentID; // Parent the node was sorted under, if it doesn't match the RelationshipComponent anymore the order is rebuilt
+			int32_t ParentIndex; // -1 for roots
+		};
+
+		// Every entity with a transform, parents always come before their children
+		std::vector<TransformHierarchyNode> m_TransformHierarchy;
+		std::vector<uint8_t> m_WorldTransformChanged;
+		bool m_TransformHierarchyDirty = true;
+		bool m_WorldTransformsValid = false;
+
 		float m_SkyboxLod = 1.0f;
 		bool m_IsPlaying = false;
 		bool m_ShouldSimulate = false;
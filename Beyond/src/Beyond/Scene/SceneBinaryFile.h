@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace Beyond {
+
+	// Binary scene encoding used by asset packs, the editor keeps using YAML (see SceneSerializer).
+	//
+	//   Header
+	//   string SceneName
+	//   Entity table, one column per field, EntityCount entries each, sorted by UUID:
+	//     UUID ID[]
+	//     string column Tag                      (empty = no TagComponent)
+	//     UUID Parent[]
+	//     array column Children                  (UUID)
+	//     vec3 Translation[], vec3 RotationEuler[], quat Rotation[], vec3 Scale[]
+	//   ComponentBlock[BlockCount]
+	//   string SceneAudio                        (YAML, usually empty)
+	//
+	// Every component block covers one component type: a BlockHeader, uint32_t EntityIndex[Count] into the
+	// entity table, then one column per component field. Columns hold Count values back to back, bools are
+	// stored as uint8_t. Variable length columns (strings, arrays) are uint32_t Offsets[Count + 1] followed by
+	// the elements, Offsets are in elements. Blocks are written in ComponentType order, which is the order the
+	// YAML deserializer adds components in, and readers skip block types they don't know using BlockHeader::Size.
+	struct SceneBinaryFile
+	{
+		static constexpr uint32_t CurrentVersion = 1;
+
+		enum class ComponentType : uint32_t
+		{
+			None = 0,
+			Prefab,
+			Script,                 // YAML per entity, field storage depends on the script cache
+			Mesh,
+			StaticMesh,
+			Animation,              // YAML per entity, graph inputs depend on the graph instance
+			Camera,
+			DirectionalLight,
+			PointLight,
+			SpotLight,
+			SkyLight,
+			DDGIVolume,
+			SpriteRenderer,
+			Text,
+			RigidBody,
+			CharacterController,
+			FixedJoint,
+			CompoundCollider,
+			BoxCollider,
+			SphereCollider,
+			CapsuleCollider,
+			MeshCollider,
+			Audio,
+			AudioListener
+		};
+
+		struct Header
+		{
+			char HEADER[4] = { 'H','S','C','N' };
+			uint32_t Version = CurrentVersion;
+			uint32_t EntityCount = 0;
+			uint32_t BlockCount = 0;
+		};
+
+		struct BlockHeader
+		{
+			ComponentType Type = ComponentType::None;
+			uint32_t Count = 0;
+			uint64_t Size = 0; // Bytes following the block header
+		};
+	};
+
+}
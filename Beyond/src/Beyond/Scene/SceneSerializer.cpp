@@ -3,12 +3,14 @@
 
 #include "Beyond/Scene/Scene.h"
 #include "Components.h"
+#include "SceneBinaryFile.h"
 
 #include "Beyond/Animation/AnimationGraph.h"
 #include "Beyond/Animation/Skeleton.h"
 #include "Beyond/Asset/AssetManager.h"
 #include "Beyond/Audio/AudioComponent.h"
 #include "Beyond/Audio/AudioEngine.h"
+#include "Beyond/Debug/Profiler.h"
 #include "Beyond/Editor/NodeGraphEditor/AnimationGraph/AnimationGraphAsset.h" // TODO (0x): separate editor from runtime
 #include "Beyond/Physics/PhysicsSystem.h"
 
@@ -29,6 +31,8 @@
 
 #include <filesystem>
 #include <fstream>
+#include <span>
+#include <tuple>
 
 namespace Beyond {
 
@@ -91,253 +95,14 @@ namespace Beyond {
 
 			auto& transform = entity.GetComponent<TransformComponent>();
 			out << YAML::Key << "Position" << YAML::Value << transform.Translation;
-			out << YAML::Key << "Rotation" << YAML::Value << transform.RotationEuler;
+			out << YAML::Key << "Rotation" << YAML::Value << transform.GetRotationEuler();
 			out << YAML::Key << "Scale" << YAML::Value << transform.Scale;
 
 			out << YAML::EndMap; // TransformComponent
 		}
 
 		if (entity.HasComponent<ScriptComponent>())
-		{
-			out << YAML::Key << "ScriptComponent";
-			out << YAML::BeginMap; // ScriptComponent
-
-			const auto& sc = entity.GetComponent<ScriptComponent>();
-
-			ManagedClass* scriptClass = ScriptCache::GetManagedClassByID(ScriptEngine::GetScriptClassIDFromComponent(sc));
-			out << YAML::Key << "ClassHandle" << YAML::Value << sc.ScriptClassHandle;
-			out << YAML::Key << "Name" << YAML::Value << (scriptClass ? scriptClass->FullName : "Null");
-
-			if (sc.FieldIDs.size() > 0)
-			{
-				out << YAML::Key << "StoredFields" << YAML::Value;
-				out << YAML::BeginSeq;
-
-				for (auto fieldID : sc.FieldIDs)
-				{
-					FieldInfo* fieldInfo = ScriptCache::GetFieldByID(fieldID);
-
-					if (!fieldInfo->IsWritable())
-						continue;
-
-					Ref<FieldStorageBase> storage = ScriptEngine::GetFieldStorage(entity, fieldID);
-
-					if (!storage)
-						continue;
-
-					out << YAML::BeginMap; // Field
-					out << YAML::Key << "ID" << YAML::Value << fieldInfo->ID;
-					out << YAML::Key << "Name" << YAML::Value << fieldInfo->Name; // This is only here for the sake of debugging. All we need is the ID
-					out << YAML::Key << "Type" << YAML::Value << FieldUtils::FieldTypeToString(fieldInfo->Type);
-
-					if (fieldInfo->IsArray())
-						out << YAML::Key << "Length" << YAML::Value << storage.As<ArrayFieldStorage>()->GetLength(); // Not strictly necessary but useful for readability
-
-					out << YAML::Key << "Data" << YAML::Value;
-
-					if (fieldInfo->IsArray())
-					{
-						out << YAML::BeginSeq;
-
-						Ref<ArrayFieldStorage> arrayStorage = storage.As<ArrayFieldStorage>();
-
-						for (uint32_t i = 0; i < uint32_t(arrayStorage->GetLength()); i++)
-						{
-							switch (fieldInfo->Type)
-							{
-								case FieldType::Bool:
-								{
-									out << arrayStorage->GetValue<bool>(i);
-									break;
-								}
-								case FieldType::Int8:
-								{
-									out << arrayStorage->GetValue<int8_t>(i);
-									break;
-								}
-								case FieldType::Int16:
-								{
-									out << arrayStorage->GetValue<int16_t>(i);
-									break;
-								}
-								case FieldType::Int32:
-								{
-									out << arrayStorage->GetValue<int32_t>(i);
-									break;
-								}
-								case FieldType::Int64:
-								{
-									out << arrayStorage->GetValue<int64_t>(i);
-									break;
-								}
-								case FieldType::UInt8:
-								{
-									out << arrayStorage->GetValue<uint8_t>(i);
-									break;
-								}
-								case FieldType::UInt16:
-								{
-									out << arrayStorage->GetValue<uint16_t>(i);
-									break;
-								}
-								case FieldType::UInt32:
-								{
-									out << arrayStorage->GetValue<uint32_t>(i);
-									break;
-								}
-								case FieldType::UInt64:
-								{
-									out << arrayStorage->GetValue<uint64_t>(i);
-									break;
-								}
-								case FieldType::Float:
-								{
-									out << arrayStorage->GetValue<float>(i);
-									break;
-								}
-								case FieldType::Double:
-								{
-									out << arrayStorage->GetValue<double>(i);
-									break;
-								}
-								case FieldType::String:
-								{
-									out << arrayStorage->GetValue<std::string>(i);
-									break;
-								}
-								case FieldType::Vector2:
-								{
-									out << arrayStorage->GetValue<glm::vec2>(i);
-									break;
-								}
-								case FieldType::Vector3:
-								{
-									out << arrayStorage->GetValue<glm::vec3>(i);
-									break;
-								}
-								case FieldType::Vector4:
-								{
-									out << arrayStorage->GetValue<glm::vec4>(i);
-									break;
-								}
-								case FieldType::Prefab:
-								case FieldType::Entity:
-								case FieldType::Mesh:
-								case FieldType::StaticMesh:
-								case FieldType::Material:
-								case FieldType::PhysicsMaterial:
-								case FieldType::Scene:
-								case FieldType::Texture2D:
-								{
-									out << arrayStorage->GetValue<UUID>(i);
-									break;
-								}
-							}
-						}
-
-						out << YAML::EndSeq;
-					}
-					else
-					{
-						Ref<FieldStorage> fieldStorage = storage.As<FieldStorage>();
-						switch (fieldInfo->Type)
-						{
-							case FieldType::Bool:
-							{
-								out << fieldStorage->GetValue<bool>();
-								break;
-							}
-							case FieldType::Int8:
-							{
-								out << fieldStorage->GetValue<int8_t>();
-								break;
-							}
-							case FieldType::Int16:
-							{
-								out << fieldStorage->GetValue<int16_t>();
-								break;
-							}
-							case FieldType::Int32:
-							{
-								out << fieldStorage->GetValue<int32_t>();
-								break;
-							}
-							case FieldType::Int64:
-							{
-								out << fieldStorage->GetValue<int64_t>();
-								break;
-							}
-							case FieldType::UInt8:
-							{
-								out << fieldStorage->GetValue<uint8_t>();
-								break;
-							}
-							case FieldType::UInt16:
-							{
-								out << fieldStorage->GetValue<uint16_t>();
-								break;
-							}
-							case FieldType::UInt32:
-							{
-								out << fieldStorage->GetValue<uint32_t>();
-								break;
-							}
-							case FieldType::UInt64:
-							{
-								out << fieldStorage->GetValue<uint64_t>();
-								break;
-							}
-							case FieldType::Float:
-							{
-								out << fieldStorage->GetValue<float>();
-								break;
-							}
-							case FieldType::Double:
-							{
-								out << fieldStorage->GetValue<double>();
-								break;
-							}
-							case FieldType::String:
-							{
-								out << fieldStorage->GetValue<std::string>();
-								break;
-							}
-							case FieldType::Vector2:
-							{
-								out << fieldStorage->GetValue<glm::vec2>();
-								break;
-							}
-							case FieldType::Vector3:
-							{
-								out << fieldStorage->GetValue<glm::vec3>();
-								break;
-							}
-							case FieldType::Vector4:
-							{
-								out << fieldStorage->GetValue<glm::vec4>();
-								break;
-							}
-							case FieldType::Prefab:
-							case FieldType::Entity:
-							case FieldType::Mesh:
-							case FieldType::StaticMesh:
-							case FieldType::Material:
-							case FieldType::PhysicsMaterial:
-							case FieldType::Scene:
-							case FieldType::Texture2D:
-							{
-								out << fieldStorage->GetValue<UUID>();
-								break;
-							}
-						}
-					}
-					out << YAML::EndMap; // Field
-				}
-				out << YAML::EndSeq;
-			}
-
-			out << YAML::EndMap; // ScriptComponent
-		}
+			SerializeScriptComponent(out, entity);
 
 		if (entity.HasComponent<MeshComponent>())
 		{
@@ -395,43 +160,7 @@ namespace Beyond {
 		}
 
 		if (entity.HasComponent<AnimationComponent>())
-		{
-			out << YAML::Key << "AnimationComponent";
-			out << YAML::BeginMap; // AnimationComponent
-
-			auto& anim = entity.GetComponent<AnimationComponent>();
-			if (anim.AnimationGraph)
-			{
-				out << YAML::Key << "AnimationGraph" << YAML::Value << anim.AnimationGraphHandle;
-				{
-					out << YAML::Key << "GraphInputs";
-					out << YAML::BeginMap; // GraphInputs
-					if (anim.AnimationGraph)
-					{
-						for (auto [id, value] : anim.AnimationGraph->Ins)
-						{
-
-							// TODO: array inputs!
-
-							if (value.isBool())         out << YAML::Key << id << YAML::Value << value.getBool();
-							else if (value.isInt32())   out << YAML::Key << id << YAML::Value << value.getInt32();
-							else if (value.isInt64())   out << YAML::Key << id << YAML::Value << value.getInt64();
-							else if (value.isFloat32()) out << YAML::Key << id << YAML::Value << value.getFloat32();
-							else if (value.isFloat64()) out << YAML::Key << id << YAML::Value << value.getFloat64();
-							else if (value.isVoid());   // void value is for triggers.  No need to output anything;
-							else if (value.isObjectWithClassName(type::type_name<glm::vec3>())) out << YAML::Key << id << YAML::Value << *static_cast<glm::vec3*>(value.getRawData());
-							else
-							{
-								BEY_CORE_ASSERT(false, "Unknown type");
-								out << YAML::Value << 0;
-							}
-						}
-					}
-				}
-				out << YAML::EndMap; // GraphInputs
-			}
-			out << YAML::EndMap; // AnimationComponent
-		}
+			SerializeAnimationComponent(out, entity);
 
 		if (entity.HasComponent<CameraComponent>())
 		{
@@ -762,118 +491,403 @@ namespace Beyond {
 		out << YAML::EndMap; // Entity
 	}
 
-	void SceneSerializer::Serialize(const std::filesystem::path& filepath)
-	{
-		YAML::Emitter out;
-		SerializeToYAML(out);
-
-		std::ofstream fout(filepath);
-		fout << out.c_str();
-	}
-
-	void SceneSerializer::SerializeToYAML(YAML::Emitter& out)
+	void SceneSerializer::SerializeScriptComponent(YAML::Emitter& out, Entity entity)
 	{
-		// Re-initialise all animation components as otherwise each time we serialize then
-		// all of the bone entity transforms will be slightly different which is annoying
-		// (e.g. for version control of scene files)
-		auto entities = m_Scene->GetAllEntitiesWith<AnimationComponent>();
-		for (auto e : entities)
-		{
-			Entity entity = { e, m_Scene.Raw() };
-			auto& anim = entity.GetComponent<AnimationComponent>();
-			if (anim.AnimationGraph)
-			{
-				anim.AnimationGraph->Init();
-			}
-		}
-		m_Scene->UpdateAnimation(0.0f, false);
-
-		out << YAML::BeginMap;
-		out << YAML::Key << "Scene";
-		out << YAML::Value << m_Scene->GetName().c_str();
-
-		out << YAML::Key << "Entities";
-		out << YAML::Value << YAML::BeginSeq;
-
-		// Sort entities by UUID (for better serializing)
-		std::map<UUID, entt::entity> sortedEntityMap;
-		auto idComponentView = m_Scene->m_Registry.view<IDComponent>();
-		for (auto entity : idComponentView)
-			sortedEntityMap[idComponentView.get<IDComponent>(entity).ID] = entity;
+		out << YAML::Key << "ScriptComponent";
+		out << YAML::BeginMap; // ScriptComponent
 
-		// Serialize sorted entities
-		for (auto [id, entity] : sortedEntityMap)
-			SerializeEntity(out, { entity, m_Scene.Raw() });
-
-		out << YAML::EndSeq;
-
-		// Scene Audio
-		MiniAudioEngine::Get().SerializeSceneAudio(out, m_Scene);
+		const auto& sc = entity.GetComponent<ScriptComponent>();
 
-		out << YAML::EndMap;
-	}
+		ManagedClass* scriptClass = ScriptCache::GetManagedClassByID(ScriptEngine::GetScriptClassIDFromComponent(sc));
+		out << YAML::Key << "ClassHandle" << YAML::Value << sc.ScriptClassHandle;
+		out << YAML::Key << "Name" << YAML::Value << (scriptClass ? scriptClass->FullName : "Null");
 
-	bool SceneSerializer::DeserializeFromYAML(const std::string& yamlString)
-	{
-		YAML::Node data = YAML::Load(yamlString);
-		if (!data["Scene"])
-			return false;
+		if (sc.FieldIDs.size() > 0)
+		{
+			out << YAML::Key << "StoredFields" << YAML::Value;
+			out << YAML::BeginSeq;
 
-		const char* sceneName = data["Scene"].as<std::string>().c_str();
-		BEY_CORE_INFO_TAG("AssetManager", "Deserializing scene '{0}'", sceneName);
-		m_Scene->SetName(sceneName);
+			for (auto fieldID : sc.FieldIDs)
+			{
+				FieldInfo* fieldInfo = ScriptCache::GetFieldByID(fieldID);
 
-		auto entities = data["Entities"];
-		if (entities)
-			DeserializeEntities(entities, m_Scene);
+				if (!fieldInfo->IsWritable())
+					continue;
 
-		auto view = m_Scene->GetAllEntitiesWith<TagComponent>();
-		for (auto entity : view)
-		{
-			Entity e = { entity, m_Scene.Raw() };
-			if (!e.GetParent())
-				m_Scene->BuildBoneEntityIds(e);
-		}
+				Ref<FieldStorageBase> storage = ScriptEngine::GetFieldStorage(entity, fieldID);
 
-		auto sceneAudio = data["SceneAudio"];
-		if (sceneAudio)
-			MiniAudioEngine::Get().DeserializeSceneAudio(sceneAudio);
+				if (!storage)
+					continue;
 
-		// Sort IdComponent by by entity handle (which is essentially the order in which they were created)
-		// This ensures a consistent ordering when iterating IdComponent (for example: when rendering scene hierarchy panel)
-		m_Scene->m_Registry.sort<IDComponent>([this](const auto lhs, const auto rhs)
-		{
-			auto lhsEntity = m_Scene->m_EntityIDMap.find(lhs.ID);
-			auto rhsEntity = m_Scene->m_EntityIDMap.find(rhs.ID);
-			return static_cast<uint32_t>(lhsEntity->second) < static_cast<uint32_t>(rhsEntity->second);
-		});
+				out << YAML::BeginMap; // Field
+				out << YAML::Key << "ID" << YAML::Value << fieldInfo->ID;
+				out << YAML::Key << "Name" << YAML::Value << fieldInfo->Name; // This is only here for the sake of debugging. All we need is the ID
+				out << YAML::Key << "Type" << YAML::Value << FieldUtils::FieldTypeToString(fieldInfo->Type);
 
-		for (auto entity : m_Scene->GetAllEntitiesWith<AnimationComponent>())
-		{
-			Entity e = { entity, m_Scene.Raw() };
-			auto& anim = e.GetComponent<AnimationComponent>();
-			if (anim.AnimationGraph)
-			{
-				anim.BoneEntityIds = m_Scene->FindBoneEntityIds(e, e, anim.AnimationGraph);
-			}
-		}
+				if (fieldInfo->IsArray())
+					out << YAML::Key << "Length" << YAML::Value << storage.As<ArrayFieldStorage>()->GetLength(); // Not strictly necessary but useful for readability
 
-		return true;
-	}
+				out << YAML::Key << "Data" << YAML::Value;
 
-	void SceneSerializer::SerializeRuntime(AssetHandle scene)
-	{
-		// Not implemented
-		BEY_CORE_ASSERT(false);
-	}
+				if (fieldInfo->IsArray())
+				{
+					out << YAML::BeginSeq;
 
-	void SceneSerializer::DeserializeEntities(YAML::Node& entitiesNode, Ref<Scene> scene)
-	{
-		for (auto entity : entitiesNode)
-		{
-			uint64_t uuid = entity["Entity"].as<uint64_t>();
+					Ref<ArrayFieldStorage> arrayStorage = storage.As<ArrayFieldStorage>();
 
-			std::string name;
+					for (uint32_t i = 0; i < uint32_t(arrayStorage->GetLength()); i++)
+					{
+						switch (fieldInfo->Type)
+						{
+							case FieldType::Bool:
+							{
+								out << arrayStorage->GetValue<bool>(i);
+								break;
+							}
+							case FieldType::Int8:
+							{
+								out << arrayStorage->GetValue<int8_t>(i);
+								break;
+							}
+							case FieldType::Int16:
+							{
+								out << arrayStorage->GetValue<int16_t>(i);
+								break;
+							}
+							case FieldType::Int32:
+							{
+								out << arrayStorage->GetValue<int32_t>(i);
+								break;
+							}
+							case FieldType::Int64:
+							{
+								out << arrayStorage->GetValue<int64_t>(i);
+								break;
+							}
+							case FieldType::UInt8:
+							{
+								out << arrayStorage->GetValue<uint8_t>(i);
+								break;
+							}
+							case FieldType::UInt16:
+							{
+								out << arrayStorage->GetValue<uint16_t>(i);
+								break;
+							}
+							case FieldType::UInt32:
+							{
+								out << arrayStorage->GetValue<uint32_t>(i);
+								break;
+							}
+							case FieldType::UInt64:
+							{
+								out << arrayStorage->GetValue<uint64_t>(i);
+								break;
+							}
+							case FieldType::Float:
+							{
+								out << arrayStorage->GetValue<float>(i);
+								break;
+							}
+							case FieldType::Double:
+							{
+								out << arrayStorage->GetValue<double>(i);
+								break;
+							}
+							case FieldType::String:
+							{
+								out << arrayStorage->GetValue<std::string>(i);
+								break;
+							}
+							case FieldType::Vector2:
+							{
+								out << arrayStorage->GetValue<glm::vec2>(i);
+								break;
+							}
+							case FieldType::Vector3:
+							{
+								out << arrayStorage->GetValue<glm::vec3>(i);
+								break;
+							}
+							case FieldType::Vector4:
+							{
+								out << arrayStorage->GetValue<glm::vec4>(i);
+								break;
+							}
+							case FieldType::Prefab:
+							case FieldType::Entity:
+							case FieldType::Mesh:
+							case FieldType::StaticMesh:
+							case FieldType::Material:
+							case FieldType::PhysicsMaterial:
+							case FieldType::Scene:
+							case FieldType::Texture2D:
+							{
+								out << arrayStorage->GetValue<UUID>(i);
+								break;
+							}
+						}
+					}
+
+					out << YAML::EndSeq;
+				}
+				else
+				{
+					Ref<FieldStorage> fieldStorage = storage.As<FieldStorage>();
+					switch (fieldInfo->Type)
+					{
+						case FieldType::Bool:
+						{
+							out << fieldStorage->GetValue<bool>();
+							break;
+						}
+						case FieldType::Int8:
+						{
+							out << fieldStorage->GetValue<int8_t>();
+							break;
+						}
+						case FieldType::Int16:
+						{
+							out << fieldStorage->GetValue<int16_t>();
+							break;
+						}
+						case FieldType::Int32:
+						{
+							out << fieldStorage->GetValue<int32_t>();
+							break;
+						}
+						case FieldType::Int64:
+						{
+							out << fieldStorage->GetValue<int64_t>();
+							break;
+						}
+						case FieldType::UInt8:
+						{
+							out << fieldStorage->GetValue<uint8_t>();
+							break;
+						}
+						case FieldType::UInt16:
+						{
+							out << fieldStorage->GetValue<uint16_t>();
+							break;
+						}
+						case FieldType::UInt32:
+						{
+							out << fieldStorage->GetValue<uint32_t>();
+							break;
+						}
+						case FieldType::UInt64:
+						{
+							out << fieldStorage->GetValue<uint64_t>();
+							break;
+						}
+						case FieldType::Float:
+						{
+							out << fieldStorage->GetValue<float>();
+							break;
+						}
+						case FieldType::Double:
+						{
+							out << fieldStorage->GetValue<double>();
+							break;
+						}
+						case FieldType::String:
+						{
+							out << fieldStorage->GetValue<std::string>();
+							break;
+						}
+						case FieldType::Vector2:
+						{
+							out << fieldStorage->GetValue<glm::vec2>();
+							break;
+						}
+						case FieldType::Vector3:
+						{
+							out << fieldStorage->GetValue<glm::vec3>();
+							break;
+						}
+						case FieldType::Vector4:
+						{
+							out << fieldStorage->GetValue<glm::vec4>();
+							break;
+						}
+						case FieldType::Prefab:
+						case FieldType::Entity:
+						case FieldType::Mesh:
+						case FieldType::StaticMesh:
+						case FieldType::Material:
+						case FieldType::PhysicsMaterial:
+						case FieldType::Scene:
+						case FieldType::Texture2D:
+						{
+							out << fieldStorage->GetValue<UUID>();
+							break;
+						}
+					}
+				}
+				out << YAML::EndMap; // Field
+			}
+			out << YAML::EndSeq;
+		}
+
+		out << YAML::EndMap; // ScriptComponent
+	}
+
+	void SceneSerializer::SerializeAnimationComponent(YAML::Emitter& out, Entity entity)
+	{
+		out << YAML::Key << "AnimationComponent";
+		out << YAML::BeginMap; // AnimationComponent
+
+		auto& anim = entity.GetComponent<AnimationComponent>();
+		if (anim.AnimationGraph)
+		{
+			out << YAML::Key << "AnimationGraph" << YAML::Value << anim.AnimationGraphHandle;
+			{
+				out << YAML::Key << "GraphInputs";
+				out << YAML::BeginMap; // GraphInputs
+				if (anim.AnimationGraph)
+				{
+					for (auto [id, value] : anim.AnimationGraph->Ins)
+					{
+
+						// TODO: array inputs!
+
+						if (value.isBool())         out << YAML::Key << id << YAML::Value << value.getBool();
+						else if (value.isInt32())   out << YAML::Key << id << YAML::Value << value.getInt32();
+						else if (value.isInt64())   out << YAML::Key << id << YAML::Value << value.getInt64();
+						else if (value.isFloat32()) out << YAML::Key << id << YAML::Value << value.getFloat32();
+						else if (value.isFloat64()) out << YAML::Key << id << YAML::Value << value.getFloat64();
+						else if (value.isVoid());   // void value is for triggers.  No need to output anything;
+						else if (value.isObjectWithClassName(type::type_name<glm::vec3>())) out << YAML::Key << id << YAML::Value << *static_cast<glm::vec3*>(value.getRawData());
+						else
+						{
+							BEY_CORE_ASSERT(false, "Unknown type");
+							out << YAML::Value << 0;
+						}
+					}
+				}
+			}
+			out << YAML::EndMap; // GraphInputs
+		}
+		out << YAML::EndMap; // AnimationComponent
+	}
+
+	void SceneSerializer::Serialize(const std::filesystem::path& filepath)
+	{
+		YAML::Emitter out;
+		SerializeToYAML(out);
+
+		std::ofstream fout(filepath);
+		fout << out.c_str();
+	}
+
+	void SceneSerializer::SerializeToYAML(YAML::Emitter& out)
+	{
+		// Re-initialise all animation components as otherwise each time we serialize then
+		// all of the bone entity transforms will be slightly different which is annoying
+		// (e.g. for version control of scene files)
+		auto entities = m_Scene->GetAllEntitiesWith<AnimationComponent>();
+		for (auto e : entities)
+		{
+			Entity entity = { e, m_Scene.Raw() };
+			auto& anim = entity.GetComponent<AnimationComponent>();
+			if (anim.AnimationGraph)
+			{
+				anim.AnimationGraph->Init();
+			}
+		}
+		m_Scene->UpdateAnimation(0.0f, false);
+
+		out << YAML::BeginMap;
+		out << YAML::Key << "Scene";
+		out << YAML::Value << m_Scene->GetName().c_str();
+
+		out << YAML::Key << "Entities";
+		out << YAML::Value << YAML::BeginSeq;
+
+		// Sort entities by UUID (for better serializing)
+		std::map<UUID, entt::entity> sortedEntityMap;
+		auto idComponentView = m_Scene->m_Registry.view<IDComponent>();
+		for (auto entity : idComponentView)
+			sortedEntityMap[idComponentView.get<IDComponent>(entity).ID] = entity;
+
+		// Serialize sorted entities
+		for (auto [id, entity] : sortedEntityMap)
+			SerializeEntity(out, { entity, m_Scene.Raw() });
+
+		out << YAML::EndSeq;
+
+		// Scene Audio
+		MiniAudioEngine::Get().SerializeSceneAudio(out, m_Scene);
+
+		out << YAML::EndMap;
+	}
+
+	bool SceneSerializer::DeserializeFromYAML(const std::string& yamlString)
+	{
+		YAML::Node data = YAML::Load(yamlString);
+		if (!data["Scene"])
+			return false;
+
+		const char* sceneName = data["Scene"].as<std::string>().c_str();
+		BEY_CORE_INFO_TAG("AssetManager", "Deserializing scene '{0}'", sceneName);
+		m_Scene->SetName(sceneName);
+
+		auto entities = data["Entities"];
+		if (entities)
+			DeserializeEntities(entities, m_Scene);
+
+		auto sceneAudio = data["SceneAudio"];
+		if (sceneAudio)
+			MiniAudioEngine::Get().DeserializeSceneAudio(sceneAudio);
+
+		FinishDeserialization();
+		return true;
+	}
+
+	void SceneSerializer::FinishDeserialization()
+	{
+		auto view = m_Scene->GetAllEntitiesWith<TagComponent>();
+		for (auto entity : view)
+		{
+			Entity e = { entity, m_Scene.Raw() };
+			if (!e.GetParent())
+				m_Scene->BuildBoneEntityIds(e);
+		}
+
+		// Sort IdComponent by by entity handle (which is essentially the order in which they were created)
+		// This ensures a consistent ordering when iterating IdComponent (for example: when rendering scene hierarchy panel)
+		m_Scene->m_Registry.sort<IDComponent>([this](const auto lhs, const auto rhs)
+		{
+			auto lhsEntity = m_Scene->m_EntityIDMap.find(lhs.ID);
+			auto rhsEntity = m_Scene->m_EntityIDMap.find(rhs.ID);
+			return static_cast<uint32_t>(lhsEntity->second) < static_cast<uint32_t>(rhsEntity->second);
+		});
+
+		for (auto entity : m_Scene->GetAllEntitiesWith<AnimationComponent>())
+		{
+			Entity e = { entity, m_Scene.Raw() };
+			auto& anim = e.GetComponent<AnimationComponent>();
+			if (anim.AnimationGraph)
+			{
+				anim.BoneEntityIds = m_Scene->FindBoneEntityIds(e, e, anim.AnimationGraph);
+			}
+		}
+	}
+
+	void SceneSerializer::SerializeRuntime(AssetHandle scene)
+	{
+		// Not implemented
+		BEY_CORE_ASSERT(false);
+	}
+
+	void SceneSerializer::DeserializeEntities(YAML::Node& entitiesNode, Ref<Scene> scene)
+	{
+		for (auto entity : entitiesNode)
+		{
+			uint64_t uuid = entity["Entity"].as<uint64_t>();
+
+			std::string name;
 			auto tagComponent = entity["TagComponent"];
 			if (tagComponent)
 				name = tagComponent["Tag"].as<std::string>();
@@ -930,255 +944,12 @@ namespace Beyond {
 
 			auto scriptComponent = entity["ScriptComponent"];
 			if (scriptComponent)
-			{
-				AssetHandle scriptAssetHandle = scriptComponent["ClassHandle"] ? scriptComponent["ClassHandle"].as<AssetHandle>(AssetHandle(0)) : AssetHandle(0);
-				std::string moduleName = scriptComponent["ModuleName"] ? scriptComponent["ModuleName"].as<std::string>("") : "";
-				std::string name = scriptComponent["Name"].as<std::string>("");
+				DeserializeScriptComponent(scriptComponent, deserializedEntity);
 
-				if (scriptAssetHandle == 0 && !moduleName.empty())
-					scriptAssetHandle = BEY_SCRIPT_CLASS_ID(moduleName);
-
-				if (scriptAssetHandle != 0)
-				{
-					ScriptComponent& sc = deserializedEntity.AddComponent<ScriptComponent>(scriptAssetHandle);
-					ScriptEngine::InitializeScriptEntity(deserializedEntity);
-
-					if (sc.FieldIDs.size() > 0)
-					{
-						auto storedFields = scriptComponent["StoredFields"];
-						if (storedFields)
-						{
-							for (auto field : storedFields)
-							{
-								uint32_t id = field["ID"].as<uint32_t>(0);
-								std::string fullName = field["Name"].as<std::string>();
-								std::string name = Utils::String::SubStr(fullName, fullName.find(':') + 1);
-								std::string typeStr = field["Type"].as<std::string>("");
-								FieldInfo* fieldData = ScriptCache::GetFieldByID(id);
-								Ref<FieldStorageBase> storage = ScriptEngine::GetFieldStorage(deserializedEntity, id);
-
-								if (storage == nullptr)
-								{
-									id = Hash::GenerateFNVHash(name);
-									storage = ScriptEngine::GetFieldStorage(deserializedEntity, id);
-								}
-
-								if (storage == nullptr)
-								{
-									BEY_CONSOLE_LOG_WARN("Serialized C# field {0} doesn't exist in script cache! This could be because the script field no longer exists or because it's been renamed.", name);
-								}
-								else
-								{
-									auto dataNode = field["Data"];
-
-									if (fieldData->IsArray() && dataNode.IsSequence())
-									{
-										Ref<ArrayFieldStorage> arrayStorage = storage.As<ArrayFieldStorage>();
-										arrayStorage->Resize(uint32_t(dataNode.size()));
-
-										for (uint32_t i = 0; i < uint32_t(dataNode.size()); i++)
-										{
-											switch (fieldData->Type)
-											{
-												case FieldType::Bool:
-												{
-													arrayStorage->SetValue(i, dataNode[i].as<bool>());
-													break;
-												}
-												case FieldType::Int8:
-												{
-													arrayStorage->SetValue(i, static_cast<int8_t>(dataNode[i].as<int16_t>()));
-													break;
-												}
-												case FieldType::Int16:
-												{
-													arrayStorage->SetValue(i, dataNode[i].as<int16_t>());
-													break;
-												}
-												case FieldType::Int32:
-												{
-													arrayStorage->SetValue(i, dataNode[i].as<int32_t>());
-													break;
-												}
-												case FieldType::Int64:
-												{
-													arrayStorage->SetValue(i, dataNode[i].as<int64_t>());
-													break;
-												}
-												case FieldType::UInt8:
-												{
-													arrayStorage->SetValue(i, dataNode[i].as<uint8_t>());
-													break;
-												}
-												case FieldType::UInt16:
-												{
-													arrayStorage->SetValue(i, dataNode[i].as<uint16_t>());
-													break;
-												}
-												case FieldType::UInt32:
-												{
-													arrayStorage->SetValue(i, dataNode[i].as<uint32_t>());
-													break;
-												}
-												case FieldType::UInt64:
-												{
-													arrayStorage->SetValue(i, dataNode[i].as<uint64_t>());
-													break;
-												}
-												case FieldType::Float:
-												{
-													arrayStorage->SetValue(i, dataNode[i].as<float>());
-													break;
-												}
-												case FieldType::Double:
-												{
-													arrayStorage->SetValue(i, dataNode[i].as<double>());
-													break;
-												}
-												case FieldType::String:
-												{
-													arrayStorage->SetValue(i, dataNode[i].as<std::string>());
-													break;
-												}
-												case FieldType::Vector2:
-												{
-													arrayStorage->SetValue(i, dataNode[i].as<glm::vec2>());
-													break;
-												}
-												case FieldType::Vector3:
-												{
-													arrayStorage->SetValue(i, dataNode[i].as<glm::vec3>());
-													break;
-												}
-												case FieldType::Vector4:
-												{
-													arrayStorage->SetValue(i, dataNode[i].as<glm::vec4>());
-													break;
-												}
-												case FieldType::Prefab:
-												case FieldType::Entity:
-												case FieldType::Mesh:
-												case FieldType::StaticMesh:
-												case FieldType::Material:
-												case FieldType::PhysicsMaterial:
-												case FieldType::Scene:
-												case FieldType::Texture2D:
-												{
-													arrayStorage->SetValue(i, dataNode[i].as<UUID>());
-													break;
-												}
-											}
-										}
-									}
-									else
-									{
-										Ref<FieldStorage> fieldStorage = storage.As<FieldStorage>();
-										switch (fieldData->Type)
-										{
-											case FieldType::Bool:
-											{
-												fieldStorage->SetValue(dataNode.as<bool>());
-												break;
-											}
-											case FieldType::Int8:
-											{
-												fieldStorage->SetValue(static_cast<int8_t>(dataNode.as<int16_t>()));
-												break;
-											}
-											case FieldType::Int16:
-											{
-												fieldStorage->SetValue(dataNode.as<int16_t>());
-												break;
-											}
-											case FieldType::Int32:
-											{
-												fieldStorage->SetValue(dataNode.as<int32_t>());
-												break;
-											}
-											case FieldType::Int64:
-											{
-												fieldStorage->SetValue(dataNode.as<int64_t>());
-												break;
-											}
-											case FieldType::UInt8:
-											{
-												fieldStorage->SetValue(dataNode.as<uint8_t>());
-												break;
-											}
-											case FieldType::UInt16:
-											{
-												fieldStorage->SetValue(dataNode.as<uint16_t>());
-												break;
-											}
-											case FieldType::UInt32:
-											{
-												fieldStorage->SetValue(dataNode.as<uint32_t>());
-												break;
-											}
-											case FieldType::UInt64:
-											{
-												fieldStorage->SetValue(dataNode.as<uint64_t>());
-												break;
-											}
-											case FieldType::Float:
-											{
-												fieldStorage->SetValue(dataNode.as<float>());
-												break;
-											}
-											case FieldType::Double:
-											{
-												fieldStorage->SetValue(dataNode.as<double>());
-												break;
-											}
-											case FieldType::String:
-											{
-												fieldStorage->SetValue(dataNode.as<std::string>());
-												break;
-											}
-											case FieldType::Vector2:
-											{
-												fieldStorage->SetValue(dataNode.as<glm::vec2>());
-												break;
-											}
-											case FieldType::Vector3:
-											{
-												fieldStorage->SetValue(dataNode.as<glm::vec3>());
-												break;
-											}
-											case FieldType::Vector4:
-											{
-												fieldStorage->SetValue(dataNode.as<glm::vec4>());
-												break;
-											}
-											case FieldType::Prefab:
-											case FieldType::Entity:
-											case FieldType::Mesh:
-											case FieldType::StaticMesh:
-											case FieldType::Material:
-											case FieldType::PhysicsMaterial:
-											case FieldType::Scene:
-											case FieldType::Texture2D:
-											{
-												fieldStorage->SetValue(dataNode.as<UUID>());
-												break;
-											}
-										}
-									}
-								}
-							}
-						}
-					}
-				}
-				else
-				{
-					BEY_CORE_ERROR("Failed to deserialize ScriptComponent for entity '{0}'! Couldn't find a valid ModuleName or ClassHandle field/value!", deserializedEntity.Name());
-				}
-			}
-
-			auto meshComponent = entity["MeshComponent"];
-			if (meshComponent)
-			{
-				auto& component = deserializedEntity.AddComponent<MeshComponent>();
+			auto meshComponent = entity["MeshComponent"];
+			if (meshComponent)
+			{
+				auto& component = deserializedEntity.AddComponent<MeshComponent>();
 
 				AssetHandle assetHandle = meshComponent["AssetID"].as<uint64_t>();
 				if (AssetManager::IsAssetHandleValid(assetHandle))
@@ -1247,58 +1018,7 @@ namespace Beyond {
 
 			auto animationComponent = entity["AnimationComponent"];
 			if (animationComponent)
-			{
-				auto& component = deserializedEntity.AddComponent<AnimationComponent>();
-				AssetHandle animationGraphHandle = animationComponent["AnimationGraph"].as<uint64_t>(0);
-				if (AssetManager::IsAssetHandleValid(animationGraphHandle))
-				{
-					AssetType type = AssetManager::GetAssetType(animationGraphHandle);
-					if (type == AssetType::AnimationGraph)
-					{
-						component.AnimationGraphHandle = animationGraphHandle;
-						Ref<AnimationGraphAsset> animGraph = AssetManager::GetAsset<AnimationGraphAsset>(animationGraphHandle);
-						if (animGraph)
-						{
-							component.AnimationGraph = animGraph->CreateInstance();
-						}
-					}
-				}
-				auto graphInputs = animationComponent["GraphInputs"];
-				if (graphInputs && component.AnimationGraph)
-				{
-					for (auto input : graphInputs)
-					{
-						auto id = input.first.as<uint32_t>();
-						try
-						{
-							auto value = component.AnimationGraph->InValue(id);
-							if (value.isBool())         value.set(input.second.as<bool>());
-							else if (value.isInt32())   value.set(input.second.as<int32_t>());
-							else if (value.isInt64())   value.set(input.second.as<int64_t>());
-							else if(value.isFloat32())  value.set(input.second.as<float>());
-							else if (value.isFloat64()) value.set(input.second.as<double>());
-							else if (value.isObjectWithClassName(type::type_name<glm::vec3>()))
-							{
-								glm::vec3 v = input.second.as<glm::vec3>();
-								value.getObjectMemberAt(0).value.set(v.x);
-								value.getObjectMemberAt(1).value.set(v.y);
-								value.getObjectMemberAt(2).value.set(v.z);
-							}
-						}
-						catch (const YAML::Exception& e)
-						{
-							// data type of input has changed since the graph was serialized.
-							BEY_CONSOLE_LOG_WARN("Input with id {0}: {1} while derializing animation component.", id, e.what());
-						}
-						catch (const std::out_of_range&)
-						{
-							// id in scene is not present in animation graph.  This can happen if animation graph has been changed since scene was serialized.
-							// Just ignore it.
-							BEY_CONSOLE_LOG_WARN("Input with id {0} was not found in animation graph, while deserializing animation component.", id);
-						}
-					}
-				}
-			}
+				DeserializeAnimationComponent(animationComponent, deserializedEntity);
 
 			auto cameraComponent = entity["CameraComponent"];
 			if (cameraComponent)
@@ -1496,262 +1216,1374 @@ namespace Beyond {
 				component.MaxLinearVelocity = rigidBodyComponent["MaxLinearVelocity"].as<float>(500.0f);
 				component.MaxAngularVelocity = rigidBodyComponent["MaxAngularVelocity"].as<float>(50.0f);
 
-				auto lockedAxesNode = rigidBodyComponent["LockedAxes"] ? rigidBodyComponent["LockedAxes"] : rigidBodyComponent["LockFlags"];
-				component.LockedAxes = (EActorAxis)lockedAxesNode.as<uint32_t>(0);
+				auto lockedAxesNode = rigidBodyComponent["LockedAxes"] ? rigidBodyComponent["LockedAxes"] : rigidBodyComponent["LockFlags"];
+				component.LockedAxes = (EActorAxis)lockedAxesNode.as<uint32_t>(0);
+			}
+
+			auto characterControllerComponent = entity["CharacterControllerComponent"];
+			if (characterControllerComponent)
+			{
+				auto& component = deserializedEntity.AddComponent<CharacterControllerComponent>();
+				component.LayerID = characterControllerComponent["Layer"].as<uint32_t>(0);
+				component.DisableGravity = characterControllerComponent["DisableGravity"].as<bool>(false);
+				component.SlopeLimitDeg = characterControllerComponent["SlopeLimit"].as<float>(0.0f);
+				component.StepOffset = characterControllerComponent["StepOffset"].as<float>(0.0f);
+			}
+
+			auto fixedJointComponent = entity["FixedJointComponent"];
+			if (fixedJointComponent)
+			{
+				auto& component = deserializedEntity.AddComponent<FixedJointComponent>();
+				component.ConnectedEntity = fixedJointComponent["ConnectedEntity"].as<UUID>(0);
+				component.IsBreakable = fixedJointComponent["IsBreakable"].as<bool>(true);
+				component.BreakForce = fixedJointComponent["BreakForce"].as<float>(100.0f);
+				component.BreakTorque = fixedJointComponent["BreakTorque"].as<float>(10.0f);
+				component.EnableCollision = fixedJointComponent["EnableCollision"].as<bool>(false);
+				component.EnablePreProcessing = fixedJointComponent["EnablePreProcessing"].as<bool>(true);
+			}
+
+			auto compoundColliderComponent = entity["CompoundColliderComponent"];
+			if (compoundColliderComponent)
+			{
+				auto& component = deserializedEntity.AddComponent<CompoundColliderComponent>();
+				component.IncludeStaticChildColliders = compoundColliderComponent["IncludeStaticChildColliders"].as<bool>(false);
+				component.IsImmutable = compoundColliderComponent["IsImmutable"].as<bool>(false);
+
+				auto compoundedChildEntities = compoundColliderComponent["CompoundedColliderEntities"];
+				if (compoundedChildEntities)
+				{
+					for (auto childID : compoundedChildEntities)
+					{
+						component.CompoundedColliderEntities.push_back(childID["ID"].as<UUID>(0));
+					}
+				}
+			}
+
+			auto boxColliderComponent = entity["BoxColliderComponent"];
+			if (boxColliderComponent)
+			{
+				auto& component = deserializedEntity.AddComponent<BoxColliderComponent>();
+				component.Offset = boxColliderComponent["Offset"].as<glm::vec3>();
+				if (boxColliderComponent["Size"])
+					component.HalfSize = boxColliderComponent["Size"].as<glm::vec3>() / 2.0f;
+				else
+					component.HalfSize = boxColliderComponent["HalfSize"].as<glm::vec3>(glm::vec3(0.5f));
+
+				if (boxColliderComponent["IsTrigger"] && deserializedEntity.HasComponent<RigidBodyComponent>())
+					deserializedEntity.GetComponent<RigidBodyComponent>().IsTrigger = boxColliderComponent["IsTrigger"].as<bool>(false);
+
+				component.Material.Friction = boxColliderComponent["Friction"].as<float>(0.5f);
+				component.Material.Restitution = boxColliderComponent["Restitution"].as<float>(0.15f);
+			}
+
+			auto sphereColliderComponent = entity["SphereColliderComponent"];
+			if (sphereColliderComponent)
+			{
+				auto& component = deserializedEntity.AddComponent<SphereColliderComponent>();
+				component.Radius = sphereColliderComponent["Radius"].as<float>();
+				component.Offset = sphereColliderComponent["Offset"].as<glm::vec3>(glm::vec3(0.0f));
+
+				if (sphereColliderComponent["IsTrigger"] && deserializedEntity.HasComponent<RigidBodyComponent>())
+					deserializedEntity.GetComponent<RigidBodyComponent>().IsTrigger = sphereColliderComponent["IsTrigger"].as<bool>(false);
+
+				component.Material.Friction = sphereColliderComponent["Friction"].as<float>(0.5f);
+				component.Material.Restitution = sphereColliderComponent["Restitution"].as<float>(0.15f);
+			}
+
+			auto capsuleColliderComponent = entity["CapsuleColliderComponent"];
+			if (capsuleColliderComponent)
+			{
+				auto& component = deserializedEntity.AddComponent<CapsuleColliderComponent>();
+				component.Radius = capsuleColliderComponent["Radius"].as<float>(0.5f);
+
+				if (capsuleColliderComponent["Height"])
+					component.HalfHeight = capsuleColliderComponent["Height"].as<float>(1.0f) / 2.0f;
+				else
+					component.HalfHeight = capsuleColliderComponent["HalfHeight"].as<float>(0.5f);
+
+				component.Offset = capsuleColliderComponent["Offset"].as<glm::vec3>(glm::vec3{ 0.0f, 0.0f, 0.0f });
+
+				if (capsuleColliderComponent["IsTrigger"] && deserializedEntity.HasComponent<RigidBodyComponent>())
+					deserializedEntity.GetComponent<RigidBodyComponent>().IsTrigger = capsuleColliderComponent["IsTrigger"].as<bool>(false);
+
+				component.Material.Friction = capsuleColliderComponent["Friction"].as<float>(0.5f);
+				component.Material.Restitution = capsuleColliderComponent["Restitution"].as<float>(0.15f);
+			}
+
+			auto meshColliderComponent = entity["MeshColliderComponent"];
+			if (meshColliderComponent)
+			{
+				auto& component = deserializedEntity.AddComponent<MeshColliderComponent>();
+
+				if (meshColliderComponent["ColliderHandle"])
+				{
+					component.ColliderAsset = meshColliderComponent["ColliderHandle"].as<AssetHandle>(0);
+					component.UseSharedShape = meshColliderComponent["UseSharedShape"].as<bool>(false);
+					//component.OverrideMaterial = meshColliderComponent["OverrideMaterial"].as<AssetHandle>(0);
+					component.CollisionComplexity = (ECollisionComplexity)meshColliderComponent["CollisionComplexity"].as<uint8_t>(0);
+
+					LoadMeshColliderAsset(deserializedEntity, component);
+				}
+				else
+				{
+					AssetHandle colliderMesh = 0;
+
+					if (deserializedEntity.HasComponent<MeshComponent>())
+						colliderMesh = deserializedEntity.GetComponent<MeshComponent>().MeshAssetHandle;
+					else if (deserializedEntity.HasComponent<StaticMeshComponent>())
+						colliderMesh = deserializedEntity.GetComponent<StaticMeshComponent>().StaticMeshAssetHandle;
+
+					bool overrideMesh = meshColliderComponent["OverrideMesh"].as<bool>(false);
+					if (overrideMesh)
+					{
+						AssetHandle tempHandle = meshColliderComponent["AssetID"].as<uint64_t>(0);
+						overrideMesh = AssetManager::IsAssetHandleValid(tempHandle);
+						colliderMesh = overrideMesh ? tempHandle : colliderMesh;
+					}
+
+					component.ColliderAsset = AssetManager::CreateMemoryOnlyAsset<MeshColliderAsset>(colliderMesh);
+
+					if (AssetManager::IsAssetHandleValid(component.ColliderAsset))
+						PhysicsSystem::GetMeshCookingFactory()->CookMesh(component.ColliderAsset);
+					else
+						BEY_CORE_WARN("MeshColliderComponent in use without valid mesh!");
+
+					component.Material.Friction = meshColliderComponent["Friction"].as<float>(0.5f);
+					component.Material.Restitution = meshColliderComponent["Restitution"].as<float>(0.15f);
+				}
+
+				if (meshColliderComponent["IsTrigger"] && deserializedEntity.HasComponent<RigidBodyComponent>())
+					deserializedEntity.GetComponent<RigidBodyComponent>().IsTrigger = meshColliderComponent["IsTrigger"].as<bool>(false);
+			}
+
+			// NOTE: This can probably be removed eventually
+			auto physicsLayerComponent = entity["PhysicsLayerComponent"];
+			if (physicsLayerComponent)
+			{
+				if (!deserializedEntity.HasComponent<RigidBodyComponent>() && deserializedEntity.HasAny<BoxColliderComponent, SphereColliderComponent, CapsuleColliderComponent, MeshColliderComponent>())
+					deserializedEntity.AddComponent<RigidBodyComponent>();
+
+				if (deserializedEntity.HasComponent<RigidBodyComponent>())
+					deserializedEntity.GetComponent<RigidBodyComponent>().LayerID = physicsLayerComponent["LayerID"].as<uint32_t>(0);
+			}
+
+			auto audioComponent = entity["AudioComponent"];
+			if (audioComponent)
+			{
+				auto& component = deserializedEntity.AddComponent<AudioComponent>();
+
+				BEY_DESERIALIZE_PROPERTY(StartEvent, component.StartEvent, audioComponent, std::string(""));
+				component.StartCommandID = audioComponent["StartCommandID"] ? Audio::CommandID::FromUnsignedInt(audioComponent["StartCommandID"].as<uint32_t>()) : Audio::CommandID::InvalidID();
+
+				BEY_DESERIALIZE_PROPERTY(PlayOnAwake, component.bPlayOnAwake, audioComponent, false);
+				BEY_DESERIALIZE_PROPERTY(StopIfEntityDestroyed, component.bStopWhenEntityDestroyed, audioComponent, true);
+				BEY_DESERIALIZE_PROPERTY(VolumeMultiplier, component.VolumeMultiplier, audioComponent, 1.0f);
+				BEY_DESERIALIZE_PROPERTY(PitchMultiplier, component.PitchMultiplier, audioComponent, 1.0f);
+				BEY_DESERIALIZE_PROPERTY(AutoDestroy, component.bAutoDestroy, audioComponent, false);
+			}
+
+			auto audioListener = entity["AudioListenerComponent"];
+			if (audioListener)
+			{
+				auto& component = deserializedEntity.AddComponent<AudioListenerComponent>();
+				component.Active = audioListener["Active"] ? audioListener["Active"].as<bool>() : false;
+				component.ConeInnerAngleInRadians = audioListener["ConeInnerAngle"] ? audioListener["ConeInnerAngle"].as<float>() : 6.283185f;
+				component.ConeOuterAngleInRadians = audioListener["ConeOuterAngle"] ? audioListener["ConeOuterAngle"].as<float>() : 6.283185f;
+				component.ConeOuterGain = audioListener["ConeOuterGain"] ? audioListener["ConeOuterGain"].as<float>() : 1.0f;
+			}
+		}
+
+		scene->SortEntities();
+	}
+
+	void SceneSerializer::LoadMeshColliderAsset(Entity entity, MeshColliderComponent& component)
+	{
+		if (entity.HasComponent<MeshComponent>())
+		{
+			const auto& mc = entity.GetComponent<MeshComponent>();
+			component.SubmeshIndex = mc.SubmeshIndex;
+		}
+
+		Ref<MeshColliderAsset> colliderAsset = AssetManager::GetAsset<MeshColliderAsset>(component.ColliderAsset);
+
+		// Most likely a memory only asset from a previous session, re-create the asset
+		if (!colliderAsset)
+		{
+			if (entity.HasComponent<MeshComponent>())
+			{
+				const auto& mc = entity.GetComponent<MeshComponent>();
+				component.ColliderAsset = AssetManager::CreateMemoryOnlyAsset<MeshColliderAsset>(mc.MeshAssetHandle);
+			}
+			else if (entity.HasComponent<StaticMeshComponent>())
+			{
+				component.ColliderAsset = AssetManager::CreateMemoryOnlyAsset<MeshColliderAsset>(entity.GetComponent<StaticMeshComponent>().StaticMeshAssetHandle);
+			}
+
+			colliderAsset = AssetManager::GetAsset<MeshColliderAsset>(component.ColliderAsset);
+			colliderAsset->CollisionComplexity = component.CollisionComplexity;
+		}
+
+		if (colliderAsset && !PhysicsSystem::GetMeshCache().Exists(colliderAsset))
+			PhysicsSystem::GetMeshCookingFactory()->CookMesh(colliderAsset);
+	}
+
+	void SceneSerializer::DeserializeScriptComponent(YAML::Node& scriptComponent, Entity entity)
+	{
+		AssetHandle scriptAssetHandle = scriptComponent["ClassHandle"] ? scriptComponent["ClassHandle"].as<AssetHandle>(AssetHandle(0)) : AssetHandle(0);
+		std::string moduleName = scriptComponent["ModuleName"] ? scriptComponent["ModuleName"].as<std::string>("") : "";
+		std::string name = scriptComponent["Name"].as<std::string>("");
+
+		if (scriptAssetHandle == 0 && !moduleName.empty())
+			scriptAssetHandle = BEY_SCRIPT_CLASS_ID(moduleName);
+
+		if (scriptAssetHandle != 0)
+		{
+			ScriptComponent& sc = entity.AddComponent<ScriptComponent>(scriptAssetHandle);
+			ScriptEngine::InitializeScriptEntity(entity);
+
+			if (sc.FieldIDs.size() > 0)
+			{
+				auto storedFields = scriptComponent["StoredFields"];
+				if (storedFields)
+				{
+					for (auto field : storedFields)
+					{
+						uint32_t id = field["ID"].as<uint32_t>(0);
+						std::string fullName = field["Name"].as<std::string>();
+						std::string name = Utils::String::SubStr(fullName, fullName.find(':') + 1);
+						std::string typeStr = field["Type"].as<std::string>("");
+						FieldInfo* fieldData = ScriptCache::GetFieldByID(id);
+						Ref<FieldStorageBase> storage = ScriptEngine::GetFieldStorage(entity, id);
+
+						if (storage == nullptr)
+						{
+							id = Hash::GenerateFNVHash(name);
+							storage = ScriptEngine::GetFieldStorage(entity, id);
+						}
+
+						if (storage == nullptr)
+						{
+							BEY_CONSOLE_LOG_WARN("Serialized C# field {0} doesn't exist in script cache! This could be because the script field no longer exists or because it's been renamed.", name);
+						}
+						else
+						{
+							auto dataNode = field["Data"];
+
+							if (fieldData->IsArray() && dataNode.IsSequence())
+							{
+								Ref<ArrayFieldStorage> arrayStorage = storage.As<ArrayFieldStorage>();
+								arrayStorage->Resize(uint32_t(dataNode.size()));
+
+								for (uint32_t i = 0; i < uint32_t(dataNode.size()); i++)
+								{
+									switch (fieldData->Type)
+									{
+										case FieldType::Bool:
+										{
+											arrayStorage->SetValue(i, dataNode[i].as<bool>());
+											break;
+										}
+										case FieldType::Int8:
+										{
+											arrayStorage->SetValue(i, static_cast<int8_t>(dataNode[i].as<int16_t>()));
+											break;
+										}
+										case FieldType::Int16:
+										{
+											arrayStorage->SetValue(i, dataNode[i].as<int16_t>());
+											break;
+										}
+										case FieldType::Int32:
+										{
+											arrayStorage->SetValue(i, dataNode[i].as<int32_t>());
+											break;
+										}
+										case FieldType::Int64:
+										{
+											arrayStorage->SetValue(i, dataNode[i].as<int64_t>());
+											break;
+										}
+										case FieldType::UInt8:
+										{
+											arrayStorage->SetValue(i, dataNode[i].as<uint8_t>());
+											break;
+										}
+										case FieldType::UInt16:
+										{
+											arrayStorage->SetValue(i, dataNode[i].as<uint16_t>());
+											break;
+										}
+										case FieldType::UInt32:
+										{
+											arrayStorage->SetValue(i, dataNode[i].as<uint32_t>());
+											break;
+										}
+										case FieldType::UInt64:
+										{
+											arrayStorage->SetValue(i, dataNode[i].as<uint64_t>());
+											break;
+										}
+										case FieldType::Float:
+										{
+											arrayStorage->SetValue(i, dataNode[i].as<float>());
+											break;
+										}
+										case FieldType::Double:
+										{
+											arrayStorage->SetValue(i, dataNode[i].as<double>());
+											break;
+										}
+										case FieldType::String:
+										{
+											arrayStorage->SetValue(i, dataNode[i].as<std::string>());
+											break;
+										}
+										case FieldType::Vector2:
+										{
+											arrayStorage->SetValue(i, dataNode[i].as<glm::vec2>());
+											break;
+										}
+										case FieldType::Vector3:
+										{
+											arrayStorage->SetValue(i, dataNode[i].as<glm::vec3>());
+											break;
+										}
+										case FieldType::Vector4:
+										{
+											arrayStorage->SetValue(i, dataNode[i].as<glm::vec4>());
+											break;
+										}
+										case FieldType::Prefab:
+										case FieldType::Entity:
+										case FieldType::Mesh:
+										case FieldType::StaticMesh:
+										case FieldType::Material:
+										case FieldType::PhysicsMaterial:
+										case FieldType::Scene:
+										case FieldType::Texture2D:
+										{
+											arrayStorage->SetValue(i, dataNode[i].as<UUID>());
+											break;
+										}
+									}
+								}
+							}
+							else
+							{
+								Ref<FieldStorage> fieldStorage = storage.As<FieldStorage>();
+								switch (fieldData->Type)
+								{
+									case FieldType::Bool:
+									{
+										fieldStorage->SetValue(dataNode.as<bool>());
+										break;
+									}
+									case FieldType::Int8:
+									{
+										fieldStorage->SetValue(static_cast<int8_t>(dataNode.as<int16_t>()));
+										break;
+									}
+									case FieldType::Int16:
+									{
+										fieldStorage->SetValue(dataNode.as<int16_t>());
+										break;
+									}
+									case FieldType::Int32:
+									{
+										fieldStorage->SetValue(dataNode.as<int32_t>());
+										break;
+									}
+									case FieldType::Int64:
+									{
+										fieldStorage->SetValue(dataNode.as<int64_t>());
+										break;
+									}
+									case FieldType::UInt8:
+									{
+										fieldStorage->SetValue(dataNode.as<uint8_t>());
+										break;
+									}
+									case FieldType::UInt16:
+									{
+										fieldStorage->SetValue(dataNode.as<uint16_t>());
+										break;
+									}
+									case FieldType::UInt32:
+									{
+										fieldStorage->SetValue(dataNode.as<uint32_t>());
+										break;
+									}
+									case FieldType::UInt64:
+									{
+										fieldStorage->SetValue(dataNode.as<uint64_t>());
+										break;
+									}
+									case FieldType::Float:
+									{
+										fieldStorage->SetValue(dataNode.as<float>());
+										break;
+									}
+									case FieldType::Double:
+									{
+										fieldStorage->SetValue(dataNode.as<double>());
+										break;
+									}
+									case FieldType::String:
+									{
+										fieldStorage->SetValue(dataNode.as<std::string>());
+										break;
+									}
+									case FieldType::Vector2:
+									{
+										fieldStorage->SetValue(dataNode.as<glm::vec2>());
+										break;
+									}
+									case FieldType::Vector3:
+									{
+										fieldStorage->SetValue(dataNode.as<glm::vec3>());
+										break;
+									}
+									case FieldType::Vector4:
+									{
+										fieldStorage->SetValue(dataNode.as<glm::vec4>());
+										break;
+									}
+									case FieldType::Prefab:
+									case FieldType::Entity:
+									case FieldType::Mesh:
+									case FieldType::StaticMesh:
+									case FieldType::Material:
+									case FieldType::PhysicsMaterial:
+									case FieldType::Scene:
+									case FieldType::Texture2D:
+									{
+										fieldStorage->SetValue(dataNode.as<UUID>());
+										break;
+									}
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+		else
+		{
+			BEY_CORE_ERROR("Failed to deserialize ScriptComponent for entity '{0}'! Couldn't find a valid ModuleName or ClassHandle field/value!", entity.Name());
+		}
+	}
+
+	void SceneSerializer::DeserializeAnimationComponent(YAML::Node& animationComponent, Entity entity)
+	{
+		auto& component = entity.AddComponent<AnimationComponent>();
+		AssetHandle animationGraphHandle = animationComponent["AnimationGraph"].as<uint64_t>(0);
+		if (AssetManager::IsAssetHandleValid(animationGraphHandle))
+		{
+			AssetType type = AssetManager::GetAssetType(animationGraphHandle);
+			if (type == AssetType::AnimationGraph)
+			{
+				component.AnimationGraphHandle = animationGraphHandle;
+				Ref<AnimationGraphAsset> animGraph = AssetManager::GetAsset<AnimationGraphAsset>(animationGraphHandle);
+				if (animGraph)
+				{
+					component.AnimationGraph = animGraph->CreateInstance();
+				}
+			}
+		}
+		auto graphInputs = animationComponent["GraphInputs"];
+		if (graphInputs && component.AnimationGraph)
+		{
+			for (auto input : graphInputs)
+			{
+				auto id = input.first.as<uint32_t>();
+				try
+				{
+					auto value = component.AnimationGraph->InValue(id);
+					if (value.isBool())         value.set(input.second.as<bool>());
+					else if (value.isInt32())   value.set(input.second.as<int32_t>());
+					else if (value.isInt64())   value.set(input.second.as<int64_t>());
+					else if(value.isFloat32())  value.set(input.second.as<float>());
+					else if (value.isFloat64()) value.set(input.second.as<double>());
+					else if (value.isObjectWithClassName(type::type_name<glm::vec3>()))
+					{
+						glm::vec3 v = input.second.as<glm::vec3>();
+						value.getObjectMemberAt(0).value.set(v.x);
+						value.getObjectMemberAt(1).value.set(v.y);
+						value.getObjectMemberAt(2).value.set(v.z);
+					}
+				}
+				catch (const YAML::Exception& e)
+				{
+					// data type of input has changed since the graph was serialized.
+					BEY_CONSOLE_LOG_WARN("Input with id {0}: {1} while derializing animation component.", id, e.what());
+				}
+				catch (const std::out_of_range&)
+				{
+					// id in scene is not present in animation graph.  This can happen if animation graph has been changed since scene was serialized.
+					// Just ignore it.
+					BEY_CONSOLE_LOG_WARN("Input with id {0} was not found in animation graph, while deserializing animation component.", id);
+				}
+			}
+		}
+	}
+
+	bool SceneSerializer::Deserialize(const std::filesystem::path& filepath)
+	{
+		std::ifstream stream(filepath);
+		BEY_CORE_ASSERT(stream);
+		std::stringstream strStream;
+		strStream << stream.rdbuf();
+
+		try
+		{
+			DeserializeFromYAML(strStream.str());
+		}
+		catch (const YAML::Exception& e)
+		{
+			BEY_CONSOLE_LOG_ERROR("Failed to deserialize scene '{0}': {1}", filepath.string(), e.what());
+			return false;
+		}
+
+		// Asset handle
+		const auto& metadata = Project::GetEditorAssetManager()->GetMetadata(filepath);
+		m_Scene->Handle = metadata.Handle;
+
+		// NOTE: Fix for "UntitledScene" name, hardcoded which isn't good
+		if (m_Scene->GetName() == "UntitledScene")
+			m_Scene->SetName(Utils::RemoveExtension(filepath.filename().string()).c_str());
+
+		return true;
+	}
+
+	bool SceneSerializer::DeserializeRuntime(AssetHandle scene)
+	{
+		// Not implemented
+		BEY_CORE_ASSERT(false);
+		return false;
+	}
+
+	//==============================================================================
+	/// Binary scene encoding, see SceneBinaryFile.h
+
+	namespace Utils {
+
+		template<typename T> struct SceneColumnType { using Type = T; };
+		template<> struct SceneColumnType<bool> { using Type = uint8_t; }; // std::vector<bool> can't be read into directly
+		template<> struct SceneColumnType<UUID> { using Type = uint64_t; };
+
+		template<typename T>
+		static void WriteColumn(StreamWriter& stream, const std::vector<T>& column)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			if (!column.empty())
+				stream.WriteData((const char*)column.data(), sizeof(T) * column.size());
+		}
+
+		template<typename T>
+		static bool ReadColumn(StreamReader& stream, uint64_t count, std::vector<T>& column)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			column.resize(count);
+			return count == 0 || stream.ReadData((char*)column.data(), sizeof(T) * count);
+		}
+
+		// Variable length column, Offsets[i]..Offsets[i + 1] are the elements of entry i
+		template<typename T>
+		struct ArrayColumn
+		{
+			std::vector<uint32_t> Offsets = { 0 };
+			std::vector<T> Elements;
+
+			template<typename TRange>
+			void Add(const TRange& range)
+			{
+				for (const auto& element : range)
+					Elements.push_back((T)element);
+				Offsets.push_back((uint32_t)Elements.size());
+			}
+
+			std::span<const T> Get(uint32_t index) const
+			{
+				return { Elements.data() + Offsets[index], Offsets[index + 1] - Offsets[index] };
+			}
+
+			std::string GetString(uint32_t index) const requires std::is_same_v<T, char>
+			{
+				return std::string(Elements.data() + Offsets[index], Offsets[index + 1] - Offsets[index]);
+			}
+
+			void Write(StreamWriter& stream) const
+			{
+				WriteColumn(stream, Offsets);
+				WriteColumn(stream, Elements);
+			}
+
+			bool Read(StreamReader& stream, uint32_t count)
+			{
+				if (!ReadColumn(stream, (uint64_t)count + 1, Offsets) || Offsets[0] != 0)
+					return false;
+
+				for (uint32_t i = 0; i < count; i++)
+				{
+					if (Offsets[i] > Offsets[i + 1])
+						return false;
+				}
+
+				return ReadColumn(stream, Offsets[count], Elements);
+			}
+		};
+
+		template<typename T, typename TComponent, typename TGetter>
+		static void WriteComponentColumn(StreamWriter& stream, const std::vector<const TComponent*>& components, TGetter&& getter)
+		{
+			std::vector<T> column;
+			column.reserve(components.size());
+			for (const TComponent* component : components)
+				column.push_back((T)getter(*component));
+			WriteColumn(stream, column);
+		}
+
+		template<typename T, typename TComponent, typename TSetter>
+		static bool ReadComponentColumn(StreamReader& stream, const std::vector<TComponent*>& components, TSetter&& setter)
+		{
+			std::vector<T> column;
+			if (!ReadColumn(stream, components.size(), column))
+				return false;
+
+			for (size_t i = 0; i < components.size(); i++)
+				setter(*components[i], column[i]);
+			return true;
+		}
+
+		// Fields that are stored as they are, one column each in the order listed. Fields that need
+		// conversion or validation (asset handles, strings, ...) are written next to them by SceneSerializer.
+		template<typename TComponent> struct SceneComponentFields;
+
+		template<> struct SceneComponentFields<PrefabComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&PrefabComponent::PrefabID, &PrefabComponent::EntityID);
+		};
+
+		template<> struct SceneComponentFields<MeshComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&MeshComponent::SubmeshIndex, &MeshComponent::Visible);
+		};
+
+		template<> struct SceneComponentFields<StaticMeshComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&StaticMeshComponent::Visible);
+		};
+
+		template<> struct SceneComponentFields<CameraComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&CameraComponent::Primary);
+		};
+
+		template<> struct SceneComponentFields<DirectionalLightComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&DirectionalLightComponent::Radiance, &DirectionalLightComponent::Intensity, &DirectionalLightComponent::SoftShadows,
+				&DirectionalLightComponent::CastShadows, &DirectionalLightComponent::SourceSize, &DirectionalLightComponent::ShadowAmount);
+		};
+
+		template<> struct SceneComponentFields<PointLightComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&PointLightComponent::Radiance, &PointLightComponent::Intensity, &PointLightComponent::SourceSize,
+				&PointLightComponent::Radius, &PointLightComponent::CastShadows, &PointLightComponent::SoftShadows, &PointLightComponent::Falloff);
+		};
+
+		template<> struct SceneComponentFields<SpotLightComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&SpotLightComponent::Radiance, &SpotLightComponent::Intensity, &SpotLightComponent::SourceSize,
+				&SpotLightComponent::Range, &SpotLightComponent::CastShadows, &SpotLightComponent::SoftShadows, &SpotLightComponent::Falloff,
+				&SpotLightComponent::Angle, &SpotLightComponent::AngleAttenuation);
+		};
+
+		template<> struct SceneComponentFields<SkyLightComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&SkyLightComponent::Intensity, &SkyLightComponent::Lod, &SkyLightComponent::DynamicSky,
+				&SkyLightComponent::TurbidityAzimuthInclination);
+		};
+
+		// Same fields as the YAML, the debug toggles (ShowProbes, ...) aren't saved
+		template<> struct SceneComponentFields<DDGIVolumeComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&DDGIVolumeComponent::Enable, &DDGIVolumeComponent::Index, &DDGIVolumeComponent::RngSeed,
+				&DDGIVolumeComponent::InsertPerfMarkers, &DDGIVolumeComponent::ProbeRelocationEnabled, &DDGIVolumeComponent::ProbeClassificationEnabled,
+				&DDGIVolumeComponent::ProbeVariabilityEnabled, &DDGIVolumeComponent::InfiniteScrollingEnabled, &DDGIVolumeComponent::ProbeSpacing,
+				&DDGIVolumeComponent::ProbeCounts, &DDGIVolumeComponent::ProbeNumRays, &DDGIVolumeComponent::ProbeNumIrradianceTexels,
+				&DDGIVolumeComponent::ProbeNumDistanceTexels, &DDGIVolumeComponent::ProbeHysteresis, &DDGIVolumeComponent::ProbeMaxRayDistance,
+				&DDGIVolumeComponent::ProbeNormalBias, &DDGIVolumeComponent::ProbeViewBias, &DDGIVolumeComponent::ProbeIrradianceThreshold,
+				&DDGIVolumeComponent::ProbeBrightnessThreshold, &DDGIVolumeComponent::ProbeVariabilityThreshold, &DDGIVolumeComponent::ProbeMinFrontfaceDistance,
+				&DDGIVolumeComponent::ProbeDistanceExponent, &DDGIVolumeComponent::ProbeIrradianceEncodingGamma, &DDGIVolumeComponent::ProbeRandomRayBackfaceThreshold,
+				&DDGIVolumeComponent::ProbeFixedRayBackfaceThreshold);
+		};
+
+		template<> struct SceneComponentFields<SpriteRendererComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&SpriteRendererComponent::Color, &SpriteRendererComponent::Texture, &SpriteRendererComponent::TilingFactor,
+				&SpriteRendererComponent::UVStart, &SpriteRendererComponent::UVEnd);
+		};
+
+		template<> struct SceneComponentFields<TextComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&TextComponent::Color, &TextComponent::LineSpacing, &TextComponent::Kerning, &TextComponent::MaxWidth,
+				&TextComponent::ScreenSpace, &TextComponent::DropShadow, &TextComponent::ShadowDistance, &TextComponent::ShadowColor);
+		};
+
+		template<> struct SceneComponentFields<RigidBodyComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&RigidBodyComponent::BodyType, &RigidBodyComponent::LayerID, &RigidBodyComponent::EnableDynamicTypeChange,
+				&RigidBodyComponent::Mass, &RigidBodyComponent::LinearDrag, &RigidBodyComponent::AngularDrag, &RigidBodyComponent::DisableGravity,
+				&RigidBodyComponent::IsTrigger, &RigidBodyComponent::CollisionDetection, &RigidBodyComponent::InitialLinearVelocity,
+				&RigidBodyComponent::InitialAngularVelocity, &RigidBodyComponent::MaxLinearVelocity, &RigidBodyComponent::MaxAngularVelocity,
+				&RigidBodyComponent::LockedAxes);
+		};
+
+		template<> struct SceneComponentFields<CharacterControllerComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&CharacterControllerComponent::SlopeLimitDeg, &CharacterControllerComponent::StepOffset,
+				&CharacterControllerComponent::LayerID, &CharacterControllerComponent::DisableGravity);
+		};
+
+		template<> struct SceneComponentFields<FixedJointComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&FixedJointComponent::ConnectedEntity, &FixedJointComponent::IsBreakable, &FixedJointComponent::BreakForce,
+				&FixedJointComponent::BreakTorque, &FixedJointComponent::EnableCollision, &FixedJointComponent::EnablePreProcessing);
+		};
+
+		template<> struct SceneComponentFields<CompoundColliderComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&CompoundColliderComponent::IncludeStaticChildColliders, &CompoundColliderComponent::IsImmutable);
+		};
+
+		template<> struct SceneComponentFields<BoxColliderComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&BoxColliderComponent::HalfSize, &BoxColliderComponent::Offset, &BoxColliderComponent::Material);
+		};
+
+		template<> struct SceneComponentFields<SphereColliderComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&SphereColliderComponent::Radius, &SphereColliderComponent::Offset, &SphereColliderComponent::Material);
+		};
+
+		template<> struct SceneComponentFields<CapsuleColliderComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&CapsuleColliderComponent::Radius, &CapsuleColliderComponent::HalfHeight, &CapsuleColliderComponent::Offset,
+				&CapsuleColliderComponent::Material);
+		};
+
+		template<> struct SceneComponentFields<MeshColliderComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&MeshColliderComponent::ColliderAsset, &MeshColliderComponent::UseSharedShape, &MeshColliderComponent::Material,
+				&MeshColliderComponent::CollisionComplexity);
+		};
+
+		template<> struct SceneComponentFields<AudioComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&AudioComponent::bPlayOnAwake, &AudioComponent::bStopWhenEntityDestroyed, &AudioComponent::VolumeMultiplier,
+				&AudioComponent::PitchMultiplier, &AudioComponent::bAutoDestroy);
+		};
+
+		template<> struct SceneComponentFields<AudioListenerComponent>
+		{
+			static constexpr auto Fields = std::make_tuple(&AudioListenerComponent::Active, &AudioListenerComponent::ConeInnerAngleInRadians,
+				&AudioListenerComponent::ConeOuterAngleInRadians, &AudioListenerComponent::ConeOuterGain);
+		};
+
+		template<typename TComponent>
+		static void WriteComponentFields(StreamWriter& stream, const std::vector<const TComponent*>& components)
+		{
+			std::apply([&](auto... fields)
+			{
+				auto writeField = [&](auto field)
+				{
+					using TField = std::remove_cvref_t<decltype(std::declval<const TComponent&>().*field)>;
+					using TStored = typename SceneColumnType<TField>::Type;
+					WriteComponentColumn<TStored>(stream, components, [field](const TComponent& component) { return component.*field; });
+				};
+				(writeField(fields), ...);
+			}, SceneComponentFields<TComponent>::Fields);
+		}
+
+		template<typename TComponent>
+		static bool ReadComponentFields(StreamReader& stream, const std::vector<TComponent*>& components)
+		{
+			return std::apply([&](auto... fields)
+			{
+				auto readField = [&](auto field)
+				{
+					using TField = std::remove_cvref_t<decltype(std::declval<TComponent&>().*field)>;
+					using TStored = typename SceneColumnType<TField>::Type;
+					return ReadComponentColumn<TStored>(stream, components, [field](TComponent& component, const TStored& value) { component.*field = (TField)value; });
+				};
+				return (readField(fields) && ...);
+			}, SceneComponentFields<TComponent>::Fields);
+		}
+
+		static void WriteMaterialTableColumn(StreamWriter& stream, const std::vector<Ref<MaterialTable>>& materialTables)
+		{
+			ArrayColumn<uint64_t> materials;
+			std::vector<uint64_t> handles;
+			for (const Ref<MaterialTable>& materialTable : materialTables)
+			{
+				handles.clear();
+				for (uint32_t i = 0; i < materialTable->GetMaterialCount(); i++)
+					handles.push_back(materialTable->HasMaterial(i) ? (uint64_t)materialTable->GetMaterial(i) : 0);
+				materials.Add(handles);
+			}
+			materials.Write(stream);
+		}
+
+		static bool ReadMaterialTableColumn(StreamReader& stream, std::vector<Ref<MaterialTable>>& materialTables)
+		{
+			ArrayColumn<uint64_t> materials;
+			if (!materials.Read(stream, (uint32_t)materialTables.size()))
+				return false;
+
+			for (uint32_t i = 0; i < (uint32_t)materialTables.size(); i++)
+			{
+				std::span<const uint64_t> handles = materials.Get(i);
+				for (uint32_t materialIndex = 0; materialIndex < (uint32_t)handles.size(); materialIndex++)
+				{
+					AssetHandle materialAsset = handles[materialIndex];
+					if (materialAsset && AssetManager::IsAssetHandleValid(materialAsset))
+						materialTables[i]->SetMaterial(materialIndex, materialAsset);
+				}
+			}
+			return true;
+		}
+
+	}
+
+	template<typename TComponent, typename TWriteColumns>
+	static void WriteComponentBlock(StreamWriter& stream, Scene* scene, const std::vector<entt::entity>& entities, SceneBinaryFile::ComponentType type, uint32_t& blockCount, TWriteColumns&& writeColumns)
+	{
+		std::vector<uint32_t> indices;
+		std::vector<const TComponent*> components;
+		for (uint32_t i = 0; i < (uint32_t)entities.size(); i++)
+		{
+			Entity entity = { entities[i], scene };
+			if (entity.HasComponent<TComponent>())
+			{
+				indices.push_back(i);
+				components.push_back(&entity.GetComponent<TComponent>());
+			}
+		}
+
+		if (components.empty())
+			return;
+
+		SceneBinaryFile::BlockHeader header;
+		header.Type = type;
+		header.Count = (uint32_t)components.size();
+
+		const uint64_t headerPosition = stream.GetStreamPosition();
+		stream.WriteRaw(header);
+		Utils::WriteColumn(stream, indices);
+		writeColumns(indices, components);
+
+		// Patch in the size now that it's known
+		const uint64_t endPosition = stream.GetStreamPosition();
+		header.Size = endPosition - headerPosition - sizeof(SceneBinaryFile::BlockHeader);
+		stream.SetStreamPosition(headerPosition);
+		stream.WriteRaw(header);
+		stream.SetStreamPosition(endPosition);
+		blockCount++;
+	}
+
+	// Components are added to every entity of the block before any of them is read into, component pointers are only
+	// taken once the pool stopped growing
+	template<typename TComponent, typename TReadColumns>
+	static bool ReadComponentBlock(std::vector<Entity>& entities, const std::vector<uint32_t>& indices, TReadColumns&& readColumns)
+	{
+		for (uint32_t index : indices)
+			entities[index].AddComponent<TComponent>();
+
+		std::vector<TComponent*> components;
+		components.reserve(indices.size());
+		for (uint32_t index : indices)
+			components.push_back(&entities[index].GetComponent<TComponent>());
+
+		return readColumns(components);
+	}
+
+	void SceneSerializer::SerializeToBinary(StreamWriter& stream)
+	{
+		BEY_PROFILE_FUNC();
+
+		using ComponentType = SceneBinaryFile::ComponentType;
+
+		// Sort entities by UUID, same as the YAML
+		std::map<UUID, entt::entity> sortedEntityMap;
+		auto idComponentView = m_Scene->m_Registry.view<IDComponent>();
+		for (auto entity : idComponentView)
+			sortedEntityMap[idComponentView.get<IDComponent>(entity).ID] = entity;
+
+		std::vector<entt::entity> entities;
+		entities.reserve(sortedEntityMap.size());
+		for (auto [id, entity] : sortedEntityMap)
+			entities.push_back(entity);
+
+		SceneBinaryFile::Header header;
+		header.EntityCount = (uint32_t)entities.size();
+
+		const uint64_t headerPosition = stream.GetStreamPosition();
+		stream.WriteRaw(header);
+		stream.WriteString(m_Scene->GetName());
+
+		// Entity table
+		{
+			std::vector<uint64_t> ids, parents;
+			Utils::ArrayColumn<char> tags;
+			Utils::ArrayColumn<uint64_t> children;
+			std::vector<glm::vec3> translations, rotationsEuler, scales;
+			std::vector<glm::quat> rotations;
+			for (entt::entity handle : entities)
+			{
+				Entity entity = { handle, m_Scene.Raw() };
+				ids.push_back(entity.GetUUID());
+
+				const TagComponent* tag = m_Scene->m_Registry.try_get<TagComponent>(handle);
+				tags.Add(tag ? std::string_view(tag->Tag) : std::string_view());
+
+				const RelationshipComponent* relationship = m_Scene->m_Registry.try_get<RelationshipComponent>(handle);
+				parents.push_back(relationship ? (uint64_t)relationship->ParentHandle : 0);
+				children.Add(relationship ? relationship->Children : std::vector<UUID>());
+
+				const TransformComponent& transform = entity.GetComponent<TransformComponent>();
+				translations.push_back(transform.Translation);
+				rotationsEuler.push_back(transform.GetRotationEuler());
+				rotations.push_back(transform.GetRotation());
+				scales.push_back(transform.Scale);
 			}
 
-			auto characterControllerComponent = entity["CharacterControllerComponent"];
-			if (characterControllerComponent)
-			{
-				auto& component = deserializedEntity.AddComponent<CharacterControllerComponent>();
-				component.LayerID = characterControllerComponent["Layer"].as<uint32_t>(0);
-				component.DisableGravity = characterControllerComponent["DisableGravity"].as<bool>(false);
-				component.SlopeLimitDeg = characterControllerComponent["SlopeLimit"].as<float>(0.0f);
-				component.StepOffset = characterControllerComponent["StepOffset"].as<float>(0.0f);
-			}
+			Utils::WriteColumn(stream, ids);
+			tags.Write(stream);
+			Utils::WriteColumn(stream, parents);
+			children.Write(stream);
+			Utils::WriteColumn(stream, translations);
+			Utils::WriteColumn(stream, rotationsEuler);
+			Utils::WriteColumn(stream, rotations);
+			Utils::WriteColumn(stream, scales);
+		}
 
-			auto fixedJointComponent = entity["FixedJointComponent"];
-			if (fixedJointComponent)
-			{
-				auto& component = deserializedEntity.AddComponent<FixedJointComponent>();
-				component.ConnectedEntity = fixedJointComponent["ConnectedEntity"].as<UUID>(0);
-				component.IsBreakable = fixedJointComponent["IsBreakable"].as<bool>(true);
-				component.BreakForce = fixedJointComponent["BreakForce"].as<float>(100.0f);
-				component.BreakTorque = fixedJointComponent["BreakTorque"].as<float>(10.0f);
-				component.EnableCollision = fixedJointComponent["EnableCollision"].as<bool>(false);
-				component.EnablePreProcessing = fixedJointComponent["EnablePreProcessing"].as<bool>(true);
-			}
+		// Component blocks, in ComponentType order
+		Scene* scene = m_Scene.Raw();
+		auto writeFields = [&stream](const std::vector<uint32_t>&, const auto& components) { Utils::WriteComponentFields(stream, components); };
 
-			auto compoundColliderComponent = entity["CompoundColliderComponent"];
-			if (compoundColliderComponent)
+		// Script fields and animation graph inputs are only understood by the script cache and the graph instance,
+		// they are stored as the same YAML the editor writes
+		auto writeYAML = [&](void (*serializeComponent)(YAML::Emitter&, Entity))
+		{
+			return [&stream, &entities, scene, serializeComponent](const std::vector<uint32_t>& indices, const auto&)
 			{
-				auto& component = deserializedEntity.AddComponent<CompoundColliderComponent>();
-				component.IncludeStaticChildColliders = compoundColliderComponent["IncludeStaticChildColliders"].as<bool>(false);
-				component.IsImmutable = compoundColliderComponent["IsImmutable"].as<bool>(false);
-
-				auto compoundedChildEntities = compoundColliderComponent["CompoundedColliderEntities"];
-				if (compoundedChildEntities)
+				Utils::ArrayColumn<char> yaml;
+				for (uint32_t index : indices)
 				{
-					for (auto childID : compoundedChildEntities)
-					{
-						component.CompoundedColliderEntities.push_back(childID["ID"].as<UUID>(0));
-					}
+					YAML::Emitter out;
+					out << YAML::BeginMap;
+					serializeComponent(out, { entities[index], scene });
+					out << YAML::EndMap;
+					yaml.Add(std::string_view(out.c_str(), out.size()));
 				}
-			}
+				yaml.Write(stream);
+			};
+		};
 
-			auto boxColliderComponent = entity["BoxColliderComponent"];
-			if (boxColliderComponent)
-			{
-				auto& component = deserializedEntity.AddComponent<BoxColliderComponent>();
-				component.Offset = boxColliderComponent["Offset"].as<glm::vec3>();
-				if (boxColliderComponent["Size"])
-					component.HalfSize = boxColliderComponent["Size"].as<glm::vec3>() / 2.0f;
-				else
-					component.HalfSize = boxColliderComponent["HalfSize"].as<glm::vec3>(glm::vec3(0.5f));
+		WriteComponentBlock<PrefabComponent>(stream, scene, entities, ComponentType::Prefab, header.BlockCount, writeFields);
+		WriteComponentBlock<ScriptComponent>(stream, scene, entities, ComponentType::Script, header.BlockCount, writeYAML(&SerializeScriptComponent));
 
-				if (boxColliderComponent["IsTrigger"] && deserializedEntity.HasComponent<RigidBodyComponent>())
-					deserializedEntity.GetComponent<RigidBodyComponent>().IsTrigger = boxColliderComponent["IsTrigger"].as<bool>(false);
+		WriteComponentBlock<MeshComponent>(stream, scene, entities, ComponentType::Mesh, header.BlockCount, [&stream](const std::vector<uint32_t>&, const std::vector<const MeshComponent*>& components)
+		{
+			Utils::WriteComponentFields(stream, components);
+			Utils::WriteComponentColumn<uint64_t>(stream, components, [](const MeshComponent& component) { return (uint64_t)component.MeshAssetHandle; });
 
-				component.Material.Friction = boxColliderComponent["Friction"].as<float>(0.5f);
-				component.Material.Restitution = boxColliderComponent["Restitution"].as<float>(0.15f);
-			}
+			std::vector<Ref<MaterialTable>> materialTables;
+			for (const MeshComponent* component : components)
+				materialTables.push_back(component->MaterialTable);
+			Utils::WriteMaterialTableColumn(stream, materialTables);
+		});
 
-			auto sphereColliderComponent = entity["SphereColliderComponent"];
-			if (sphereColliderComponent)
-			{
-				auto& component = deserializedEntity.AddComponent<SphereColliderComponent>();
-				component.Radius = sphereColliderComponent["Radius"].as<float>();
-				component.Offset = sphereColliderComponent["Offset"].as<glm::vec3>(glm::vec3(0.0f));
+		WriteComponentBlock<StaticMeshComponent>(stream, scene, entities, ComponentType::StaticMesh, header.BlockCount, [&stream](const std::vector<uint32_t>&, const std::vector<const StaticMeshComponent*>& components)
+		{
+			Utils::WriteComponentFields(stream, components);
+			Utils::WriteComponentColumn<uint64_t>(stream, components, [](const StaticMeshComponent& component) { return (uint64_t)component.StaticMeshAssetHandle; });
 
-				if (sphereColliderComponent["IsTrigger"] && deserializedEntity.HasComponent<RigidBodyComponent>())
-					deserializedEntity.GetComponent<RigidBodyComponent>().IsTrigger = sphereColliderComponent["IsTrigger"].as<bool>(false);
+			std::vector<Ref<MaterialTable>> materialTables;
+			for (const StaticMeshComponent* component : components)
+				materialTables.push_back(component->MaterialTable);
+			Utils::WriteMaterialTableColumn(stream, materialTables);
+		});
 
-				component.Material.Friction = sphereColliderComponent["Friction"].as<float>(0.5f);
-				component.Material.Restitution = sphereColliderComponent["Restitution"].as<float>(0.15f);
-			}
+		WriteComponentBlock<AnimationComponent>(stream, scene, entities, ComponentType::Animation, header.BlockCount, writeYAML(&SerializeAnimationComponent));
 
-			auto capsuleColliderComponent = entity["CapsuleColliderComponent"];
-			if (capsuleColliderComponent)
+		WriteComponentBlock<CameraComponent>(stream, scene, entities, ComponentType::Camera, header.BlockCount, [&stream](const std::vector<uint32_t>&, const std::vector<const CameraComponent*>& components)
+		{
+			Utils::WriteComponentFields(stream, components);
+			Utils::WriteComponentColumn<int32_t>(stream, components, [](const CameraComponent& component) { return (int32_t)component.Camera.GetProjectionType(); });
+			Utils::WriteComponentColumn<float>(stream, components, [](const CameraComponent& component) { return component.Camera.GetDegPerspectiveVerticalFOV(); });
+			Utils::WriteComponentColumn<float>(stream, components, [](const CameraComponent& component) { return component.Camera.GetPerspectiveNearClip(); });
+			Utils::WriteComponentColumn<float>(stream, components, [](const CameraComponent& component) { return component.Camera.GetPerspectiveFarClip(); });
+			Utils::WriteComponentColumn<float>(stream, components, [](const CameraComponent& component) { return component.Camera.GetOrthographicSize(); });
+			Utils::WriteComponentColumn<float>(stream, components, [](const CameraComponent& component) { return component.Camera.GetOrthographicNearClip(); });
+			Utils::WriteComponentColumn<float>(stream, components, [](const CameraComponent& component) { return component.Camera.GetOrthographicFarClip(); });
+		});
+
+		WriteComponentBlock<DirectionalLightComponent>(stream, scene, entities, ComponentType::DirectionalLight, header.BlockCount, writeFields);
+		WriteComponentBlock<PointLightComponent>(stream, scene, entities, ComponentType::PointLight, header.BlockCount, writeFields);
+		WriteComponentBlock<SpotLightComponent>(stream, scene, entities, ComponentType::SpotLight, header.BlockCount, writeFields);
+
+		WriteComponentBlock<SkyLightComponent>(stream, scene, entities, ComponentType::SkyLight, header.BlockCount, [&stream](const std::vector<uint32_t>&, const std::vector<const SkyLightComponent*>& components)
+		{
+			Utils::WriteComponentFields(stream, components);
+			Utils::WriteComponentColumn<uint64_t>(stream, components, [](const SkyLightComponent& component)
 			{
-				auto& component = deserializedEntity.AddComponent<CapsuleColliderComponent>();
-				component.Radius = capsuleColliderComponent["Radius"].as<float>(0.5f);
+				return AssetManager::IsMemoryAsset(component.SceneEnvironment) ? (uint64_t)0 : (uint64_t)component.SceneEnvironment;
+			});
+		});
 
-				if (capsuleColliderComponent["Height"])
-					component.HalfHeight = capsuleColliderComponent["Height"].as<float>(1.0f) / 2.0f;
-				else
-					component.HalfHeight = capsuleColliderComponent["HalfHeight"].as<float>(0.5f);
+		WriteComponentBlock<DDGIVolumeComponent>(stream, scene, entities, ComponentType::DDGIVolume, header.BlockCount, writeFields);
+		WriteComponentBlock<SpriteRendererComponent>(stream, scene, entities, ComponentType::SpriteRenderer, header.BlockCount, writeFields);
 
-				component.Offset = capsuleColliderComponent["Offset"].as<glm::vec3>(glm::vec3{ 0.0f, 0.0f, 0.0f });
+		WriteComponentBlock<TextComponent>(stream, scene, entities, ComponentType::Text, header.BlockCount, [&stream](const std::vector<uint32_t>&, const std::vector<const TextComponent*>& components)
+		{
+			Utils::WriteComponentFields(stream, components);
+			Utils::WriteComponentColumn<uint64_t>(stream, components, [](const TextComponent& component) { return (uint64_t)component.FontHandle; });
 
-				if (capsuleColliderComponent["IsTrigger"] && deserializedEntity.HasComponent<RigidBodyComponent>())
-					deserializedEntity.GetComponent<RigidBodyComponent>().IsTrigger = capsuleColliderComponent["IsTrigger"].as<bool>(false);
+			Utils::ArrayColumn<char> strings;
+			for (const TextComponent* component : components)
+				strings.Add(component->TextString);
+			strings.Write(stream);
+		});
 
-				component.Material.Friction = capsuleColliderComponent["Friction"].as<float>(0.5f);
-				component.Material.Restitution = capsuleColliderComponent["Restitution"].as<float>(0.15f);
-			}
+		WriteComponentBlock<RigidBodyComponent>(stream, scene, entities, ComponentType::RigidBody, header.BlockCount, writeFields);
+		WriteComponentBlock<CharacterControllerComponent>(stream, scene, entities, ComponentType::CharacterController, header.BlockCount, writeFields);
+		WriteComponentBlock<FixedJointComponent>(stream, scene, entities, ComponentType::FixedJoint, header.BlockCount, writeFields);
 
-			auto meshColliderComponent = entity["MeshColliderComponent"];
-			if (meshColliderComponent)
-			{
-				auto& component = deserializedEntity.AddComponent<MeshColliderComponent>();
+		WriteComponentBlock<CompoundColliderComponent>(stream, scene, entities, ComponentType::CompoundCollider, header.BlockCount, [&stream](const std::vector<uint32_t>&, const std::vector<const CompoundColliderComponent*>& components)
+		{
+			Utils::WriteComponentFields(stream, components);
 
-				if (meshColliderComponent["ColliderHandle"])
-				{
-					component.ColliderAsset = meshColliderComponent["ColliderHandle"].as<AssetHandle>(0);
-					component.UseSharedShape = meshColliderComponent["UseSharedShape"].as<bool>(false);
-					//component.OverrideMaterial = meshColliderComponent["OverrideMaterial"].as<AssetHandle>(0);
-					component.CollisionComplexity = (ECollisionComplexity)meshColliderComponent["CollisionComplexity"].as<uint8_t>(0);
+			Utils::ArrayColumn<uint64_t> colliderEntities;
+			for (const CompoundColliderComponent* component : components)
+				colliderEntities.Add(component->CompoundedColliderEntities);
+			colliderEntities.Write(stream);
+		});
 
-					if (deserializedEntity.HasComponent<MeshComponent>())
-					{
-						const auto& mc = deserializedEntity.GetComponent<MeshComponent>();
-						component.SubmeshIndex = mc.SubmeshIndex;
-					}
+		WriteComponentBlock<BoxColliderComponent>(stream, scene, entities, ComponentType::BoxCollider, header.BlockCount, writeFields);
+		WriteComponentBlock<SphereColliderComponent>(stream, scene, entities, ComponentType::SphereCollider, header.BlockCount, writeFields);
+		WriteComponentBlock<CapsuleColliderComponent>(stream, scene, entities, ComponentType::CapsuleCollider, header.BlockCount, writeFields);
+		WriteComponentBlock<MeshColliderComponent>(stream, scene, entities, ComponentType::MeshCollider, header.BlockCount, writeFields);
 
-					Ref<MeshColliderAsset> colliderAsset = AssetManager::GetAsset<MeshColliderAsset>(component.ColliderAsset);
+		WriteComponentBlock<AudioComponent>(stream, scene, entities, ComponentType::Audio, header.BlockCount, [&stream](const std::vector<uint32_t>&, const std::vector<const AudioComponent*>& components)
+		{
+			Utils::WriteComponentFields(stream, components);
+			Utils::WriteComponentColumn<uint32_t>(stream, components, [](const AudioComponent& component) { return (uint32_t)component.StartCommandID; });
 
-					// Most likely a memory only asset from a previous session, re-create the asset
-					if (!colliderAsset)
-					{
-						if (deserializedEntity.HasComponent<MeshComponent>())
-						{
-							const auto& mc = deserializedEntity.GetComponent<MeshComponent>();
-							component.ColliderAsset = AssetManager::CreateMemoryOnlyAsset<MeshColliderAsset>(mc.MeshAssetHandle);
-						}
-						else if (deserializedEntity.HasComponent<StaticMeshComponent>())
-						{
-							component.ColliderAsset = AssetManager::CreateMemoryOnlyAsset<MeshColliderAsset>(deserializedEntity.GetComponent<StaticMeshComponent>().StaticMeshAssetHandle);
-						}
+			Utils::ArrayColumn<char> startEvents;
+			for (const AudioComponent* component : components)
+				startEvents.Add(component->StartEvent);
+			startEvents.Write(stream);
+		});
 
-						colliderAsset = AssetManager::GetAsset<MeshColliderAsset>(component.ColliderAsset);
-						colliderAsset->CollisionComplexity = component.CollisionComplexity;
-					}
+		WriteComponentBlock<AudioListenerComponent>(stream, scene, entities, ComponentType::AudioListener, header.BlockCount, writeFields);
 
-					if (colliderAsset && !PhysicsSystem::GetMeshCache().Exists(colliderAsset))
-						PhysicsSystem::GetMeshCookingFactory()->CookMesh(colliderAsset);
-				}
-				else
-				{
-					AssetHandle colliderMesh = 0;
+		// Scene Audio
+		YAML::Emitter out;
+		out << YAML::BeginMap;
+		MiniAudioEngine::Get().SerializeSceneAudio(out, m_Scene);
+		out << YAML::EndMap;
+		stream.WriteString(std::string(out.c_str(), out.size()));
 
-					if (deserializedEntity.HasComponent<MeshComponent>())
-						colliderMesh = deserializedEntity.GetComponent<MeshComponent>().MeshAssetHandle;
-					else if (deserializedEntity.HasComponent<StaticMeshComponent>())
-						colliderMesh = deserializedEntity.GetComponent<StaticMeshComponent>().StaticMeshAssetHandle;
+		const uint64_t endPosition = stream.GetStreamPosition();
+		stream.SetStreamPosition(headerPosition);
+		stream.WriteRaw(header);
+		stream.SetStreamPosition(endPosition);
+	}
 
-					bool overrideMesh = meshColliderComponent["OverrideMesh"].as<bool>(false);
-					if (overrideMesh)
-					{
-						AssetHandle tempHandle = meshColliderComponent["AssetID"].as<uint64_t>(0);
-						overrideMesh = AssetManager::IsAssetHandleValid(tempHandle);
-						colliderMesh = overrideMesh ? tempHandle : colliderMesh;
-					}
+	bool SceneSerializer::DeserializeFromBinary(StreamReader& stream)
+	{
+		BEY_PROFILE_FUNC();
 
-					component.ColliderAsset = AssetManager::CreateMemoryOnlyAsset<MeshColliderAsset>(colliderMesh);
+		using ComponentType = SceneBinaryFile::ComponentType;
 
-					if (AssetManager::IsAssetHandleValid(component.ColliderAsset))
-						PhysicsSystem::GetMeshCookingFactory()->CookMesh(component.ColliderAsset);
-					else
-						BEY_CORE_WARN("MeshColliderComponent in use without valid mesh!");
+		SceneBinaryFile::Header header;
+		stream.ReadRaw(header);
+		if (memcmp(header.HEADER, SceneBinaryFile::Header().HEADER, sizeof(header.HEADER)) != 0 || header.Version != SceneBinaryFile::CurrentVersion)
+		{
+			BEY_CORE_ERROR_TAG("AssetManager", "Scene isn't a binary scene of version {} (version {}), rebuild the asset pack", SceneBinaryFile::CurrentVersion, header.Version);
+			return false;
+		}
 
-					component.Material.Friction = meshColliderComponent["Friction"].as<float>(0.5f);
-					component.Material.Restitution = meshColliderComponent["Restitution"].as<float>(0.15f);
-				}
+		std::string sceneName;
+		stream.ReadString(sceneName);
+		BEY_CORE_INFO_TAG("AssetManager", "Deserializing scene '{0}'", sceneName);
+		m_Scene->SetName(sceneName.c_str());
 
-				if (meshColliderComponent["IsTrigger"] && deserializedEntity.HasComponent<RigidBodyComponent>())
-					deserializedEntity.GetComponent<RigidBodyComponent>().IsTrigger = meshColliderComponent["IsTrigger"].as<bool>(false);
+		const uint32_t entityCount = header.EntityCount;
+		std::vector<Entity> entities(entityCount);
+
+		// Entity table
+		{
+			std::vector<uint64_t> ids, parents;
+			Utils::ArrayColumn<char> tags;
+			Utils::ArrayColumn<uint64_t> children;
+			std::vector<glm::vec3> translations, rotationsEuler, scales;
+			std::vector<glm::quat> rotations;
+
+			bool success = Utils::ReadColumn(stream, entityCount, ids) && tags.Read(stream, entityCount)
+				&& Utils::ReadColumn(stream, entityCount, parents) && children.Read(stream, entityCount)
+				&& Utils::ReadColumn(stream, entityCount, translations) && Utils::ReadColumn(stream, entityCount, rotationsEuler)
+				&& Utils::ReadColumn(stream, entityCount, rotations) && Utils::ReadColumn(stream, entityCount, scales);
+			if (!success)
+			{
+				BEY_CORE_ERROR_TAG("AssetManager", "Scene '{}' is truncated", sceneName);
+				return false;
 			}
 
-			// NOTE: This can probably be removed eventually
-			auto physicsLayerComponent = entity["PhysicsLayerComponent"];
-			if (physicsLayerComponent)
+			m_Scene->m_EntityIDMap.reserve(m_Scene->m_EntityIDMap.size() + entityCount);
+			for (uint32_t i = 0; i < entityCount; i++)
 			{
-				if (!deserializedEntity.HasComponent<RigidBodyComponent>() && deserializedEntity.HasAny<BoxColliderComponent, SphereColliderComponent, CapsuleColliderComponent, MeshColliderComponent>())
-					deserializedEntity.AddComponent<RigidBodyComponent>();
+				Entity entity = m_Scene->CreateEntityWithID(ids[i], tags.GetString(i), false);
+				entities[i] = entity;
+
+				auto& relationshipComponent = entity.GetComponent<RelationshipComponent>();
+				relationshipComponent.ParentHandle = parents[i];
+				std::span<const uint64_t> entityChildren = children.Get(i);
+				relationshipComponent.Children.assign(entityChildren.begin(), entityChildren.end());
+
+				// Both rotations are stored, the quaternion doesn't have to be rebuilt from the Euler angles
+				auto& transform = entity.GetComponent<TransformComponent>();
+				transform.Translation = translations[i];
+				transform.RotationEuler = rotationsEuler[i];
+				transform.Rotation = rotations[i];
+				transform.Scale = scales[i];
+			}
+		}
 
-				if (deserializedEntity.HasComponent<RigidBodyComponent>())
-					deserializedEntity.GetComponent<RigidBodyComponent>().LayerID = physicsLayerComponent["LayerID"].as<uint32_t>(0);
+		auto readFields = [&stream](const auto& components) { return Utils::ReadComponentFields(stream, components); };
+		auto readYAML = [&](const std::vector<uint32_t>& indices, const char* componentName, void (*deserializeComponent)(YAML::Node&, Entity))
+		{
+			Utils::ArrayColumn<char> yaml;
+			if (!yaml.Read(stream, (uint32_t)indices.size()))
+				return false;
+
+			for (uint32_t i = 0; i < (uint32_t)indices.size(); i++)
+			{
+				YAML::Node data = YAML::Load(yaml.GetString(i));
+				YAML::Node componentNode = data[componentName];
+				if (componentNode)
+					deserializeComponent(componentNode, entities[indices[i]]);
 			}
+			return true;
+		};
 
-			auto audioComponent = entity["AudioComponent"];
-			if (audioComponent)
+		std::set<ComponentType> readBlockTypes;
+		for (uint32_t blockIndex = 0; blockIndex < header.BlockCount; blockIndex++)
+		{
+			SceneBinaryFile::BlockHeader blockHeader;
+			stream.ReadRaw(blockHeader);
+			const uint64_t blockEnd = stream.GetStreamPosition() + blockHeader.Size;
+
+			std::vector<uint32_t> indices;
+			bool success = stream.IsStreamGood() && blockHeader.Count <= entityCount && readBlockTypes.insert(blockHeader.Type).second
+				&& Utils::ReadColumn(stream, blockHeader.Count, indices);
+			for (uint32_t i = 0; success && i < blockHeader.Count; i++)
+				success = indices[i] < entityCount && (i == 0 || indices[i - 1] < indices[i]);
+
+			if (success)
 			{
-				auto& component = deserializedEntity.AddComponent<AudioComponent>();
+				switch (blockHeader.Type)
+				{
+					case ComponentType::Prefab:           success = ReadComponentBlock<PrefabComponent>(entities, indices, readFields); break;
+					case ComponentType::Script:           success = readYAML(indices, "ScriptComponent", &DeserializeScriptComponent); break;
+					case ComponentType::Mesh:
+					{
+						success = ReadComponentBlock<MeshComponent>(entities, indices, [&](const std::vector<MeshComponent*>& components)
+						{
+							std::vector<Ref<MaterialTable>> materialTables;
+							for (MeshComponent* component : components)
+								materialTables.push_back(component->MaterialTable);
 
-				BEY_DESERIALIZE_PROPERTY(StartEvent, component.StartEvent, audioComponent, std::string(""));
-				component.StartCommandID = audioComponent["StartCommandID"] ? Audio::CommandID::FromUnsignedInt(audioComponent["StartCommandID"].as<uint32_t>()) : Audio::CommandID::InvalidID();
+							return Utils::ReadComponentFields(stream, components)
+								&& Utils::ReadComponentColumn<uint64_t>(stream, components, [](MeshComponent& component, uint64_t assetHandle)
+								{
+									if (AssetManager::IsAssetHandleValid(assetHandle) && AssetManager::GetAssetType(assetHandle) == AssetType::Mesh)
+										component.MeshAssetHandle = assetHandle;
+								})
+								&& Utils::ReadMaterialTableColumn(stream, materialTables);
+						});
+						break;
+					}
+					case ComponentType::StaticMesh:
+					{
+						success = ReadComponentBlock<StaticMeshComponent>(entities, indices, [&](const std::vector<StaticMeshComponent*>& components)
+						{
+							std::vector<Ref<MaterialTable>> materialTables;
+							for (StaticMeshComponent* component : components)
+								materialTables.push_back(component->MaterialTable);
 
-				BEY_DESERIALIZE_PROPERTY(PlayOnAwake, component.bPlayOnAwake, audioComponent, false);
-				BEY_DESERIALIZE_PROPERTY(StopIfEntityDestroyed, component.bStopWhenEntityDestroyed, audioComponent, true);
-				BEY_DESERIALIZE_PROPERTY(VolumeMultiplier, component.VolumeMultiplier, audioComponent, 1.0f);
-				BEY_DESERIALIZE_PROPERTY(PitchMultiplier, component.PitchMultiplier, audioComponent, 1.0f);
-				BEY_DESERIALIZE_PROPERTY(AutoDestroy, component.bAutoDestroy, audioComponent, false);
+							return Utils::ReadComponentFields(stream, components)
+								&& Utils::ReadComponentColumn<uint64_t>(stream, components, [](StaticMeshComponent& component, uint64_t assetHandle)
+								{
+									if (AssetManager::IsAssetHandleValid(assetHandle))
+										component.StaticMeshAssetHandle = assetHandle;
+								})
+								&& Utils::ReadMaterialTableColumn(stream, materialTables);
+						});
+						break;
+					}
+					case ComponentType::Animation:        success = readYAML(indices, "AnimationComponent", &DeserializeAnimationComponent); break;
+					case ComponentType::Camera:
+					{
+						success = ReadComponentBlock<CameraComponent>(entities, indices, [&](const std::vector<CameraComponent*>& components)
+						{
+							return Utils::ReadComponentFields(stream, components)
+								&& Utils::ReadComponentColumn<int32_t>(stream, components, [](CameraComponent& component, int32_t value) { component.Camera.SetProjectionType((SceneCamera::ProjectionType)value); })
+								&& Utils::ReadComponentColumn<float>(stream, components, [](CameraComponent& component, float value) { component.Camera.SetDegPerspectiveVerticalFOV(value); })
+								&& Utils::ReadComponentColumn<float>(stream, components, [](CameraComponent& component, float value) { component.Camera.SetPerspectiveNearClip(value); })
+								&& Utils::ReadComponentColumn<float>(stream, components, [](CameraComponent& component, float value) { component.Camera.SetPerspectiveFarClip(value); })
+								&& Utils::ReadComponentColumn<float>(stream, components, [](CameraComponent& component, float value) { component.Camera.SetOrthographicSize(value); })
+								&& Utils::ReadComponentColumn<float>(stream, components, [](CameraComponent& component, float value) { component.Camera.SetOrthographicNearClip(value); })
+								&& Utils::ReadComponentColumn<float>(stream, components, [](CameraComponent& component, float value) { component.Camera.SetOrthographicFarClip(value); });
+						});
+						break;
+					}
+					case ComponentType::DirectionalLight: success = ReadComponentBlock<DirectionalLightComponent>(entities, indices, readFields); break;
+					case ComponentType::PointLight:       success = ReadComponentBlock<PointLightComponent>(entities, indices, readFields); break;
+					case ComponentType::SpotLight:        success = ReadComponentBlock<SpotLightComponent>(entities, indices, readFields); break;
+					case ComponentType::SkyLight:
+					{
+						success = ReadComponentBlock<SkyLightComponent>(entities, indices, [&](const std::vector<SkyLightComponent*>& components)
+						{
+							return Utils::ReadComponentFields(stream, components)
+								&& Utils::ReadComponentColumn<uint64_t>(stream, components, [](SkyLightComponent& component, uint64_t assetHandle)
+								{
+									if (AssetManager::IsAssetHandleValid(assetHandle))
+										component.SceneEnvironment = assetHandle;
+									else
+										BEY_CORE_ERROR("Tried to load invalid environment map {0}", assetHandle);
+								});
+						});
+						break;
+					}
+					case ComponentType::DDGIVolume:       success = ReadComponentBlock<DDGIVolumeComponent>(entities, indices, readFields); break;
+					case ComponentType::SpriteRenderer:   success = ReadComponentBlock<SpriteRendererComponent>(entities, indices, readFields); break;
+					case ComponentType::Text:
+					{
+						success = ReadComponentBlock<TextComponent>(entities, indices, [&](const std::vector<TextComponent*>& components)
+						{
+							Utils::ArrayColumn<char> strings;
+							bool columnsRead = Utils::ReadComponentFields(stream, components)
+								&& Utils::ReadComponentColumn<uint64_t>(stream, components, [](TextComponent& component, uint64_t fontHandle)
+								{
+									component.FontHandle = AssetManager::IsAssetHandleValid(fontHandle) ? AssetHandle(fontHandle) : Font::GetDefaultFont()->Handle;
+								})
+								&& strings.Read(stream, (uint32_t)components.size());
+
+							for (uint32_t i = 0; columnsRead && i < (uint32_t)components.size(); i++)
+							{
+								components[i]->TextString = strings.GetString(i);
+								components[i]->TextHash = std::hash<std::string>()(components[i]->TextString);
+							}
+							return columnsRead;
+						});
+						break;
+					}
+					case ComponentType::RigidBody:           success = ReadComponentBlock<RigidBodyComponent>(entities, indices, readFields); break;
+					case ComponentType::CharacterController: success = ReadComponentBlock<CharacterControllerComponent>(entities, indices, readFields); break;
+					case ComponentType::FixedJoint:          success = ReadComponentBlock<FixedJointComponent>(entities, indices, readFields); break;
+					case ComponentType::CompoundCollider:
+					{
+						success = ReadComponentBlock<CompoundColliderComponent>(entities, indices, [&](const std::vector<CompoundColliderComponent*>& components)
+						{
+							Utils::ArrayColumn<uint64_t> colliderEntities;
+							bool columnsRead = Utils::ReadComponentFields(stream, components) && colliderEntities.Read(stream, (uint32_t)components.size());
+							for (uint32_t i = 0; columnsRead && i < (uint32_t)components.size(); i++)
+							{
+								std::span<const uint64_t> ids = colliderEntities.Get(i);
+								components[i]->CompoundedColliderEntities.assign(ids.begin(), ids.end());
+							}
+							return columnsRead;
+						});
+						break;
+					}
+					case ComponentType::BoxCollider:      success = ReadComponentBlock<BoxColliderComponent>(entities, indices, readFields); break;
+					case ComponentType::SphereCollider:   success = ReadComponentBlock<SphereColliderComponent>(entities, indices, readFields); break;
+					case ComponentType::CapsuleCollider:  success = ReadComponentBlock<CapsuleColliderComponent>(entities, indices, readFields); break;
+					case ComponentType::MeshCollider:
+					{
+						success = ReadComponentBlock<MeshColliderComponent>(entities, indices, readFields);
+						for (uint32_t i = 0; success && i < (uint32_t)indices.size(); i++)
+						{
+							Entity entity = entities[indices[i]];
+							LoadMeshColliderAsset(entity, entity.GetComponent<MeshColliderComponent>());
+						}
+						break;
+					}
+					case ComponentType::Audio:
+					{
+						success = ReadComponentBlock<AudioComponent>(entities, indices, [&](const std::vector<AudioComponent*>& components)
+						{
+							Utils::ArrayColumn<char> startEvents;
+							bool columnsRead = Utils::ReadComponentFields(stream, components)
+								&& Utils::ReadComponentColumn<uint32_t>(stream, components, [](AudioComponent& component, uint32_t commandID) { component.StartCommandID = Audio::CommandID::FromUnsignedInt(commandID); })
+								&& startEvents.Read(stream, (uint32_t)components.size());
+
+							for (uint32_t i = 0; columnsRead && i < (uint32_t)components.size(); i++)
+								components[i]->StartEvent = startEvents.GetString(i);
+							return columnsRead;
+						});
+						break;
+					}
+					case ComponentType::AudioListener:    success = ReadComponentBlock<AudioListenerComponent>(entities, indices, readFields); break;
+					default:
+						BEY_CORE_WARN_TAG("AssetManager", "Skipping unknown component block {} in scene '{}'", (uint32_t)blockHeader.Type, sceneName);
+						break;
+				}
 			}
 
-			auto audioListener = entity["AudioListenerComponent"];
-			if (audioListener)
+			if (!success || stream.GetStreamPosition() > blockEnd)
 			{
-				auto& component = deserializedEntity.AddComponent<AudioListenerComponent>();
-				component.Active = audioListener["Active"] ? audioListener["Active"].as<bool>() : false;
-				component.ConeInnerAngleInRadians = audioListener["ConeInnerAngle"] ? audioListener["ConeInnerAngle"].as<float>() : 6.283185f;
-				component.ConeOuterAngleInRadians = audioListener["ConeOuterAngle"] ? audioListener["ConeOuterAngle"].as<float>() : 6.283185f;
-				component.ConeOuterGain = audioListener["ConeOuterGain"] ? audioListener["ConeOuterGain"].as<float>() : 1.0f;
+				BEY_CORE_ERROR_TAG("AssetManager", "Scene '{}' has an invalid component block {}", sceneName, (uint32_t)blockHeader.Type);
+				return false;
 			}
+			stream.SetStreamPosition(blockEnd);
 		}
 
-		scene->SortEntities();
-	}
-
-	bool SceneSerializer::Deserialize(const std::filesystem::path& filepath)
-	{
-		std::ifstream stream(filepath);
-		BEY_CORE_ASSERT(stream);
-		std::stringstream strStream;
-		strStream << stream.rdbuf();
-
-		try
-		{
-			DeserializeFromYAML(strStream.str());
-		}
-		catch (const YAML::Exception& e)
+		std::string sceneAudioYAML;
+		stream.ReadString(sceneAudioYAML);
+		if (!sceneAudioYAML.empty())
 		{
-			BEY_CONSOLE_LOG_ERROR("Failed to deserialize scene '{0}': {1}", filepath.string(), e.what());
-			return false;
+			YAML::Node data = YAML::Load(sceneAudioYAML);
+			auto sceneAudio = data["SceneAudio"];
+			if (sceneAudio)
+				MiniAudioEngine::Get().DeserializeSceneAudio(sceneAudio);
 		}
 
-		// Asset handle
-		const auto& metadata = Project::GetEditorAssetManager()->GetMetadata(filepath);
-		m_Scene->Handle = metadata.Handle;
-
-		// NOTE: Fix for "UntitledScene" name, hardcoded which isn't good
-		if (m_Scene->GetName() == "UntitledScene")
-			m_Scene->SetName(Utils::RemoveExtension(filepath.filename().string()).c_str());
-
+		m_Scene->SortEntities();
+		FinishDeserialization();
 		return true;
 	}
 
-	bool SceneSerializer::DeserializeRuntime(AssetHandle scene)
-	{
-		// Not implemented
-		BEY_CORE_ASSERT(false);
-		return false;
-	}
-
-	bool SceneSerializer::SerializeToAssetPack(FileStreamWriter& stream, AssetSerializationInfo& outInfo)
+	bool SceneSerializer::SerializeToAssetPack(StreamWriter& stream, AssetSerializationInfo& outInfo)
 	{
-		YAML::Emitter out;
-		SerializeToYAML(out);
-
 		outInfo.Offset = stream.GetStreamPosition();
-		std::string yamlString = out.c_str();
-		stream.WriteString(yamlString);
+		SerializeToBinary(stream);
 		outInfo.Size = stream.GetStreamPosition() - outInfo.Offset;
 		return true;
 	}
 
-	bool SceneSerializer::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::SceneInfo& sceneInfo)
+	bool SceneSerializer::DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::SceneInfo& sceneInfo)
 	{
+		// Packs built before the binary encoding store the scene as a YAML string
+		char magic[4] = {};
 		stream.SetStreamPosition(sceneInfo.PackedOffset);
+		stream.ReadData(magic, sizeof(magic));
+		stream.SetStreamPosition(sceneInfo.PackedOffset);
+		if (memcmp(magic, SceneBinaryFile::Header().HEADER, sizeof(magic)) == 0)
+			return DeserializeFromBinary(stream);
+
 		std::string sceneYAML;
 		stream.ReadString(sceneYAML);
 
@@ -27,8 +27,12 @@ namespace Beyond {
 		bool Deserialize(const std::filesystem::path& filepath);
 		bool DeserializeRuntime(AssetHandle scene);
 
-		bool SerializeToAssetPack(FileStreamWriter& stream, AssetSerializationInfo& outInfo);
-		bool DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::SceneInfo& sceneInfo);
+		bool SerializeToAssetPack(StreamWriter& stream, AssetSerializationInfo& outInfo);
+		bool DeserializeFromAssetPack(StreamReader& stream, const AssetPackFile::SceneInfo& sceneInfo);
+
+		// Binary encoding used by asset packs, see SceneBinaryFile.h
+		void SerializeToBinary(StreamWriter& stream);
+		bool DeserializeFromBinary(StreamReader& stream);
 
 		bool DeserializeReferencedPrefabs(const std::filesystem::path& filepath, std::unordered_set<AssetHandle>& outPrefabs);
 	public:
@@ -38,6 +42,15 @@ namespace Beyond {
 		inline static std::string_view FileFilter = "Beyond Scene (*.hscene)\0*.hscene\0";
 		inline static std::string_view DefaultExtension = ".hscene";
 
+	private:
+		// Shared by the YAML and binary paths
+		static void SerializeScriptComponent(YAML::Emitter& out, Entity entity);
+		static void SerializeAnimationComponent(YAML::Emitter& out, Entity entity);
+		static void DeserializeScriptComponent(YAML::Node& scriptComponent, Entity entity);
+		static void DeserializeAnimationComponent(YAML::Node& animationComponent, Entity entity);
+		static void LoadMeshColliderAsset(Entity entity, MeshColliderComponent& component);
+
+		void FinishDeserialization();
 	private:
 		Ref<Scene> m_Scene;
 	};
@@ -199,7 +199,7 @@ namespace Beyond {
 #ifndef BEY_DIST
 				// TODO: fix this for runtime
 				if (!Application::IsRuntime())
-					Project::GetEditorAssetManager()->GetMutableMetadata(handle).FilePath = managedClass.FullName;
+					Project::GetEditorAssetManager()->SetMetadataFilePath(handle, managedClass.FullName);
 #endif
 			}
 		}
@@ -33,6 +33,30 @@ namespace Beyond {
 	using WatcherString = std::string;
 #endif
 
+	// Instantiated entities of one script class, along with the class's per-frame callbacks resolved to unmanaged thunks
+	struct ScriptClassGroup
+	{
+		uint32_t ClassID = 0;
+		std::string ClassName;
+
+		// Method is null if the class doesn't override the callback
+		ManagedMethodThunk<MonoObject*, float> OnUpdate;
+		ManagedMethodThunk<MonoObject*, float> OnLateUpdate;
+		ManagedMethodThunk<MonoObject*, float> OnPhysicsUpdate;
+
+		std::vector<UUID> EntityIDs;
+		std::vector<entt::entity> Entities; // entt::null for entities removed while the groups were iterated
+		std::vector<GCHandle> Instances;
+
+		bool HasRemovedEntities = false;
+	};
+
+	struct ScriptClassGroupEntry
+	{
+		uint32_t GroupIndex;
+		uint32_t Index;
+	};
+
 	struct ScriptEngineState
 	{
 		MonoDomain* RootDomain = nullptr;
@@ -58,10 +82,162 @@ namespace Beyond {
 
 		std::unordered_map<UUID, std::unordered_map<uint32_t, Ref<FieldStorageBase>>> FieldMap;
 
+		// Groups are only ever emptied, not removed, until the app assembly is unloaded
+		std::vector<ScriptClassGroup> ScriptClassGroups;
+		std::unordered_map<uint32_t, uint32_t> ScriptClassGroupIndices; // Class ID -> index into ScriptClassGroups
+		std::unordered_map<UUID, ScriptClassGroupEntry> ScriptClassGroupEntries;
+		bool IteratingScriptClassGroups = false;
+
 		std::unique_ptr<filewatch::FileWatch<WatcherString>> WatcherHandle = nullptr;
 	};
 
 	static ScriptEngineState* s_State = nullptr;
+
+	static void ResolveEntityCallback(ManagedClass* managedClass, const std::string& methodName, ManagedMethodThunk<MonoObject*, float>& thunk)
+	{
+		// Entity's own callbacks are empty, so there is nothing to call unless the class (or one of its parents) overrides them
+		const ManagedMethod* baseMethod = BEY_CACHED_METHOD("Beyond.Entity", methodName, 1);
+		const ManagedMethod* method = ScriptCache::GetSpecificManagedMethod(managedClass, methodName, 1);
+		if (method && baseMethod && method->Method != baseMethod->Method)
+			thunk.SetThunkFromMethod(method);
+	}
+
+	static void RemoveFromScriptClassGroup(UUID entityID);
+
+	static void AddToScriptClassGroup(Entity entity, uint32_t classID, GCHandle instance)
+	{
+		// Entity might be initialized again without being shut down first
+		RemoveFromScriptClassGroup(entity.GetUUID());
+
+		auto [groupIt, isNewGroup] = s_State->ScriptClassGroupIndices.try_emplace(classID, (uint32_t)s_State->ScriptClassGroups.size());
+		if (isNewGroup)
+		{
+			ScriptClassGroup& group = s_State->ScriptClassGroups.emplace_back();
+			group.ClassID = classID;
+
+			ManagedClass* managedClass = ScriptCache::GetManagedClassByID(classID);
+			if (managedClass)
+			{
+				group.ClassName = managedClass->FullName;
+				ResolveEntityCallback(managedClass, "OnUpdate", group.OnUpdate);
+				ResolveEntityCallback(managedClass, "OnLateUpdate", group.OnLateUpdate);
+				ResolveEntityCallback(managedClass, "OnPhysicsUpdate", group.OnPhysicsUpdate);
+			}
+		}
+
+		ScriptClassGroup& group = s_State->ScriptClassGroups[groupIt->second];
+		s_State->ScriptClassGroupEntries[entity.GetUUID()] = { groupIt->second, (uint32_t)group.EntityIDs.size() };
+		group.EntityIDs.push_back(entity.GetUUID());
+		group.Entities.push_back((entt::entity)entity);
+		group.Instances.push_back(instance);
+	}
+
+	static void RemoveFromScriptClassGroup(UUID entityID)
+	{
+		auto entryIt = s_State->ScriptClassGroupEntries.find(entityID);
+		if (entryIt == s_State->ScriptClassGroupEntries.end())
+			return;
+
+		const ScriptClassGroupEntry entry = entryIt->second;
+		s_State->ScriptClassGroupEntries.erase(entryIt);
+
+		ScriptClassGroup& group = s_State->ScriptClassGroups[entry.GroupIndex];
+		if (s_State->IteratingScriptClassGroups)
+		{
+			// Swapping now would move an entity that hasn't been called yet behind the iteration,
+			// leave an empty slot and compact the group once the callbacks are done
+			group.Entities[entry.Index] = entt::null;
+			group.Instances[entry.Index] = nullptr;
+			group.HasRemovedEntities = true;
+			return;
+		}
+
+		// Swap with the last entity of the group
+		const uint32_t lastIndex = (uint32_t)group.EntityIDs.size() - 1;
+		if (entry.Index != lastIndex)
+		{
+			group.EntityIDs[entry.Index] = group.EntityIDs[lastIndex];
+			group.Entities[entry.Index] = group.Entities[lastIndex];
+			group.Instances[entry.Index] = group.Instances[lastIndex];
+			s_State->ScriptClassGroupEntries.at(group.EntityIDs[entry.Index]).Index = entry.Index;
+		}
+
+		group.EntityIDs.pop_back();
+		group.Entities.pop_back();
+		group.Instances.pop_back();
+	}
+
+	static void CompactScriptClassGroup(ScriptClassGroup& group)
+	{
+		// Walk backwards so the entity swapped into an empty slot has already been checked
+		for (uint32_t index = (uint32_t)group.Entities.size(); index-- > 0;)
+		{
+			if (group.Entities[index] != entt::null)
+				continue;
+
+			const uint32_t lastIndex = (uint32_t)group.Entities.size() - 1;
+			if (index != lastIndex)
+			{
+				group.EntityIDs[index] = group.EntityIDs[lastIndex];
+				group.Entities[index] = group.Entities[lastIndex];
+				group.Instances[index] = group.Instances[lastIndex];
+				s_State->ScriptClassGroupEntries.at(group.EntityIDs[index]).Index = index;
+			}
+
+			group.EntityIDs.pop_back();
+			group.Entities.pop_back();
+			group.Instances.pop_back();
+		}
+
+		group.HasRemovedEntities = false;
+	}
+
+	static void ClearScriptClassGroups()
+	{
+		s_State->ScriptClassGroups.clear();
+		s_State->ScriptClassGroupIndices.clear();
+		s_State->ScriptClassGroupEntries.clear();
+	}
+
+	static void InvokeEntityCallbacks(ManagedMethodThunk<MonoObject*, float> ScriptClassGroup::* callback, float ts, bool rigidBodiesOnly)
+	{
+		Scene* scene = s_State->SceneContext.Raw();
+		if (!scene || !scene->IsPlaying())
+			return;
+
+		// Indices and sizes are re-read every iteration, callbacks are allowed to instantiate scripted entities.
+		// Entities destroyed by a callback only leave an empty slot until the end, so no other entity is skipped.
+		s_State->IteratingScriptClassGroups = true;
+		for (size_t groupIndex = 0; groupIndex < s_State->ScriptClassGroups.size(); ++groupIndex)
+		{
+			if (!(s_State->ScriptClassGroups[groupIndex].*callback).Method || s_State->ScriptClassGroups[groupIndex].Instances.empty())
+				continue;
+
+			BEY_PROFILE_SCOPE_DYNAMIC(s_State->ScriptClassGroups[groupIndex].ClassName.c_str());
+
+			for (size_t i = 0; i < s_State->ScriptClassGroups[groupIndex].Instances.size(); ++i)
+			{
+				ScriptClassGroup& group = s_State->ScriptClassGroups[groupIndex];
+				if (group.Entities[i] == entt::null)
+					continue;
+
+				if (rigidBodiesOnly && !Entity(group.Entities[i], scene).HasComponent<RigidBodyComponent>())
+					continue;
+
+				MonoException* exception = nullptr;
+				(group.*callback).Invoke(GCManager::GetReferencedObject(group.Instances[i]), ts, &exception);
+				ScriptUtils::HandleException((MonoObject*)exception);
+			}
+		}
+		s_State->IteratingScriptClassGroups = false;
+
+		for (ScriptClassGroup& group : s_State->ScriptClassGroups)
+		{
+			if (group.HasRemovedEntities)
+				CompactScriptClassGroup(group);
+		}
+	}
+
 	void ScriptEngine::Init(const ScriptEngineConfig& config)
 	{
 		BEY_CORE_ASSERT(!s_State, "[ScriptEngine]: Trying to call ScriptEngine::Init multiple times!");
@@ -163,6 +339,8 @@ namespace Beyond {
 		while (s_State->RuntimeDuplicatedScriptEntities.size() > 0)
 			s_State->RuntimeDuplicatedScriptEntities.pop();
 
+		ClearScriptClassGroups();
+
 		GCManager::CollectGarbage();
 	}
 
@@ -173,6 +351,7 @@ namespace Beyond {
 
 		const auto scriptComponent = entity.GetComponent<ScriptComponent>();
 
+		RemoveFromScriptClassGroup(entity.GetUUID());
 		CallMethod(scriptComponent.ManagedInstance, "OnDestroyInternal");
 
 		for (auto fieldID : scriptComponent.FieldIDs)
@@ -316,6 +495,7 @@ namespace Beyond {
 			entityInstances.clear();
 		}
 		s_State->ScriptInstances.clear();
+		ClearScriptClassGroups();
 
 		ScriptCache::ClearCache();
 		UnloadAssembly(s_State->AppAssemblyInfo);
@@ -583,6 +763,7 @@ namespace Beyond {
 		//				If OnCreate spawns a lot of entities we would loose our reference
 		//				to the script component...
 		entity.GetComponent<ScriptComponent>().IsRuntimeInitialized = true;
+		AddToScriptClassGroup(entity, GetScriptClassIDFromComponent(scriptComponent), instanceHandle);
 	}
 
 	void ScriptEngine::DuplicateScriptInstance(Entity entity, Entity targetEntity)
@@ -758,6 +939,24 @@ namespace Beyond {
 
 	const std::unordered_map<UUID, GCHandle>& ScriptEngine::GetEntityInstances() { return s_State->ScriptInstances; }
 
+	void ScriptEngine::OnUpdateEntities(float ts)
+	{
+		BEY_PROFILE_FUNC();
+		InvokeEntityCallbacks(&ScriptClassGroup::OnUpdate, ts, false);
+	}
+
+	void ScriptEngine::OnLateUpdateEntities(float ts)
+	{
+		BEY_PROFILE_FUNC();
+		InvokeEntityCallbacks(&ScriptClassGroup::OnLateUpdate, ts, false);
+	}
+
+	void ScriptEngine::OnPhysicsUpdateEntities(float ts)
+	{
+		BEY_PROFILE_FUNC();
+		InvokeEntityCallbacks(&ScriptClassGroup::OnPhysicsUpdate, ts, true);
+	}
+
 	uint32_t ScriptEngine::GetScriptClassIDFromComponent(const ScriptComponent& sc)
 	{
 		if (!AssetManager::IsAssetHandleValid(sc.ScriptClassHandle))
@@ -72,6 +72,12 @@ namespace Beyond {
 		static GCHandle GetEntityInstance(UUID entityID);
 		static const std::unordered_map<UUID, GCHandle>& GetEntityInstances();
 
+		// Per-frame callbacks of the instantiated entities. Entities are grouped by script class, classes that don't override
+		// a callback are skipped, and the rest are called through unmanaged thunks resolved once per class.
+		static void OnUpdateEntities(float ts);
+		static void OnLateUpdateEntities(float ts);
+		static void OnPhysicsUpdateEntities(float ts); // Only entities with a RigidBodyComponent
+
 		static uint32_t GetScriptClassIDFromComponent(const ScriptComponent& sc);
 		static bool IsModuleValid(AssetHandle scriptAssetHandle);
 
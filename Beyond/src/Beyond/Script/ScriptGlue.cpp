@@ -214,6 +214,7 @@ namespace Beyond {
 		BEY_ADD_INTERNAL_CALL(Scene_GetChildrenIDs);
 		BEY_ADD_INTERNAL_CALL(Scene_SetTimeScale);
 
+		BEY_ADD_INTERNAL_CALL(Entity_GetNativeHandle);
 		BEY_ADD_INTERNAL_CALL(Entity_GetParent);
 		BEY_ADD_INTERNAL_CALL(Entity_SetParent);
 		BEY_ADD_INTERNAL_CALL(Entity_GetChildren);
@@ -236,6 +237,10 @@ namespace Beyond {
 		BEY_ADD_INTERNAL_CALL(TransformComponent_GetTransformMatrix);
 		BEY_ADD_INTERNAL_CALL(TransformComponent_SetTransformMatrix);
 		BEY_ADD_INTERNAL_CALL(TransformComponent_SetRotationQuat);
+		BEY_ADD_INTERNAL_CALL(TransformComponent_GetTranslations);
+		BEY_ADD_INTERNAL_CALL(TransformComponent_SetTranslations);
+		BEY_ADD_INTERNAL_CALL(TransformComponent_GetRotations);
+		BEY_ADD_INTERNAL_CALL(TransformComponent_SetRotations);
 		BEY_ADD_INTERNAL_CALL(TransformMultiply_Native);
 
 		BEY_ADD_INTERNAL_CALL(MeshComponent_GetMesh);
@@ -602,6 +607,17 @@ namespace Beyond {
 			return scene->TryGetEntityWithUUID(entityID);
 		};
 
+		// Resolves the entity through the native handle cached on the managed Entity, only falling back to the UUID lookup
+		// when the handle has gone stale (e.g the entity was destroyed and its handle reused)
+		static inline Entity GetEntity(Scene* scene, uint64_t entityID, uint32_t nativeHandle)
+		{
+			Entity entity((entt::entity)nativeHandle, scene);
+			if (entity && entity.GetUUID() == entityID)
+				return entity;
+
+			return scene->TryGetEntityWithUUID(entityID);
+		}
+
 #pragma region AssetHandle
 
 		bool AssetHandle_IsValid(AssetHandle* assetHandle)
@@ -868,6 +884,12 @@ namespace Beyond {
 
 #pragma region Entity
 
+		uint32_t Entity_GetNativeHandle(uint64_t entityID)
+		{
+			auto entity = GetEntity(entityID);
+			return entity ? (uint32_t)entity : (uint32_t)entt::entity(entt::null);
+		}
+
 		uint64_t Entity_GetParent(uint64_t entityID)
 		{
 			auto entity = GetEntity(entityID);
@@ -1277,6 +1299,90 @@ namespace Beyond {
 			entity.Transform().SetTransform(*inTransform);
 		}
 
+		// Batched transform access, one scene lookup and one pass over pinned arrays instead of an internal call per entity.
+		// nativeHandles is optional (may be null), and holds the handles cached on the managed Entity objects.
+		template<typename TValue, typename TFunc>
+		static void ForEachTransformInBatch(MonoArray* entityIDs, MonoArray* nativeHandles, MonoArray* values, std::string_view functionName, TFunc&& func)
+		{
+			if (entityIDs == nullptr || values == nullptr)
+			{
+				ErrorWithTrace("{} called with a null array", functionName);
+				return;
+			}
+
+			Ref<Scene> scene = ScriptEngine::GetSceneContext();
+			BEY_CORE_VERIFY(scene, "No active scene!");
+
+			const uintptr_t count = mono_array_length(entityIDs);
+			if (mono_array_length(values) < count || (nativeHandles && mono_array_length(nativeHandles) < count))
+			{
+				ErrorWithTrace("{} called with arrays shorter than the {} entity IDs passed in", functionName, count);
+				return;
+			}
+
+			if (count == 0)
+				return;
+
+			const uint64_t* ids = mono_array_addr(entityIDs, uint64_t, 0);
+			const uint32_t* handles = nativeHandles ? mono_array_addr(nativeHandles, uint32_t, 0) : nullptr;
+			TValue* data = mono_array_addr(values, TValue, 0);
+
+			uint32_t invalidEntities = 0;
+			for (uintptr_t i = 0; i < count; i++)
+			{
+				Entity entity = handles ? GetEntity(scene.Raw(), ids[i], handles[i]) : scene->TryGetEntityWithUUID(ids[i]);
+				if (!entity)
+				{
+					invalidEntities++;
+					continue;
+				}
+
+				func(entity, ids[i], data[i]);
+			}
+
+			if (invalidEntities > 0)
+				ErrorWithTrace("{} skipped {} invalid entities out of {}", functionName, invalidEntities, count);
+		}
+
+		void TransformComponent_GetTranslations(MonoArray* entityIDs, MonoArray* nativeHandles, MonoArray* outTranslations)
+		{
+			ForEachTransformInBatch<glm::vec3>(entityIDs, nativeHandles, outTranslations, BEY_FUNCTION_NAME, [](Entity entity, uint64_t, glm::vec3& translation)
+			{
+				translation = entity.GetComponent<TransformComponent>().Translation;
+			});
+		}
+
+		void TransformComponent_SetTranslations(MonoArray* entityIDs, MonoArray* nativeHandles, MonoArray* inTranslations)
+		{
+			ForEachTransformInBatch<glm::vec3>(entityIDs, nativeHandles, inTranslations, BEY_FUNCTION_NAME, [](Entity entity, uint64_t entityID, glm::vec3& translation)
+			{
+				// Physics bodies and character controllers have to go through the checks of the single entity version
+				if (entity.HasAny<RigidBodyComponent, CharacterControllerComponent>())
+					TransformComponent_SetTranslation(entityID, &translation);
+				else
+					entity.GetComponent<TransformComponent>().Translation = translation;
+			});
+		}
+
+		void TransformComponent_GetRotations(MonoArray* entityIDs, MonoArray* nativeHandles, MonoArray* outRotations)
+		{
+			ForEachTransformInBatch<glm::quat>(entityIDs, nativeHandles, outRotations, BEY_FUNCTION_NAME, [](Entity entity, uint64_t, glm::quat& rotation)
+			{
+				rotation = entity.GetComponent<TransformComponent>().GetRotation();
+			});
+		}
+
+		void TransformComponent_SetRotations(MonoArray* entityIDs, MonoArray* nativeHandles, MonoArray* inRotations)
+		{
+			ForEachTransformInBatch<glm::quat>(entityIDs, nativeHandles, inRotations, BEY_FUNCTION_NAME, [](Entity entity, uint64_t entityID, glm::quat& rotation)
+			{
+				if (entity.HasAny<RigidBodyComponent, CharacterControllerComponent>())
+					TransformComponent_SetRotationQuat(entityID, &rotation);
+				else
+					entity.GetComponent<TransformComponent>().SetRotation(rotation);
+			});
+		}
+
 		void TransformMultiply_Native(Transform* inA, Transform* inB, Transform* outResult)
 		{
 			TransformComponent a;
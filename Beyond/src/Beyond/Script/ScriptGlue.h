@@ -88,6 +88,7 @@ namespace Beyond {
 
 #pragma region Entity
 
+		uint32_t Entity_GetNativeHandle(uint64_t entityID);
 		uint64_t Entity_GetParent(uint64_t entityID);
 		void Entity_SetParent(uint64_t entityID, uint64_t parentID);
 
@@ -127,6 +128,10 @@ namespace Beyond {
 		void TransformComponent_GetTransformMatrix(uint64_t entityID, glm::mat4* outTransform);
 		void TransformComponent_SetTransformMatrix(uint64_t entityID, glm::mat4* inTransform);
 		void TransformComponent_SetRotationQuat(uint64_t entityID, glm::quat* inRotation);
+		void TransformComponent_GetTranslations(MonoArray* entityIDs, MonoArray* nativeHandles, MonoArray* outTranslations);
+		void TransformComponent_SetTranslations(MonoArray* entityIDs, MonoArray* nativeHandles, MonoArray* inTranslations);
+		void TransformComponent_GetRotations(MonoArray* entityIDs, MonoArray* nativeHandles, MonoArray* outRotations);
+		void TransformComponent_SetRotations(MonoArray* entityIDs, MonoArray* nativeHandles, MonoArray* inRotations);
 		void TransformMultiply_Native(Transform* inA, Transform* inB, Transform* outResult);
 
 #pragma endregion
@@ -7,6 +7,8 @@
 #include "Beyond/Scene/Scene.h"
 #include "Beyond/Scene/SceneSerializer.h"
 #include "Beyond/Scene/Prefab.h"
+#include "Beyond/Serialization/AssetPackCompression.h"
+#include "Beyond/Serialization/MemoryStream.h"
 
 #include "Beyond/Audio/AudioEvents/AudioCommandRegistry.h"
 #include "Beyond/Editor/NodeGraphEditor/SoundGraph/SoundGraphAsset.h"
@@ -46,58 +48,58 @@ namespace Beyond {
 
 	Ref<Scene> AssetPack::LoadScene(AssetHandle sceneHandle)
 	{
-		auto it = m_File.Index.Scenes.find(sceneHandle);
-		if (it == m_File.Index.Scenes.end())
+		const AssetPackFile::SceneEntry* sceneEntry = m_Index.FindScene(sceneHandle);
+		if (!sceneEntry)
 			return nullptr;
 
-		const AssetPackFile::SceneInfo& sceneInfo = it->second;
+		AssetPackFile::SceneInfo sceneInfo;
+		sceneInfo.PackedOffset = sceneEntry->PackedOffset;
+		sceneInfo.PackedSize = sceneEntry->PackedSize;
+		sceneInfo.Flags = sceneEntry->Flags;
 
-		FileStreamReader stream(m_Path);
+		MemoryMappedStreamReader stream(m_MappedFile);
 		Ref<Scene> scene = AssetImporter::DeserializeSceneFromAssetPack(stream, sceneInfo);
 		scene->Handle = sceneHandle;
 		return scene;
 	}
 
+	const AssetPackFile::AssetInfo* AssetPack::FindAssetInfo(AssetHandle assetHandle) const
+	{
+		const AssetPackFile::AssetEntry* assetEntry = m_Index.FindAsset(assetHandle);
+		return assetEntry ? &assetEntry->Info : nullptr;
+	}
+
 	Ref<Asset> AssetPack::LoadAsset(AssetHandle sceneHandle, AssetHandle assetHandle)
 	{
-		const AssetPackFile::AssetInfo* assetInfo = nullptr;
+		const AssetPackFile::AssetInfo* assetInfo = FindAssetInfo(assetHandle);
+		if (!assetInfo)
+			return nullptr;
 
-		bool foundAsset = false;
-		if (sceneHandle)
+		Ref<Asset> asset;
+		if (assetInfo->GetCompression() != AssetPackFile::Compression::None)
 		{
-			// Fast(er) path
-			auto it = m_File.Index.Scenes.find(sceneHandle);
-			if (it != m_File.Index.Scenes.end())
+			// Asset serializers read at assetInfo.PackedOffset, the decompressed data starts at 0
+			Buffer data;
+			if (!AssetPackCompression::Decompress(m_MappedFile->GetView(assetInfo->PackedOffset, assetInfo->PackedSize), assetInfo->GetCompression(), data))
 			{
-				const AssetPackFile::SceneInfo& sceneInfo = it->second;
-				auto assetIt = sceneInfo.Assets.find(assetHandle);
-				if (assetIt != sceneInfo.Assets.end())
-				{
-					foundAsset = true;
-					assetInfo = &assetIt->second;
-				}
+				BEY_CORE_ERROR("Failed to decompress asset {} from {}", assetHandle, m_Path.string());
+				return nullptr;
 			}
-		}
 
-		if (!foundAsset)
-		{
-			// Slow(er) path
-			for (const auto& [handle, sceneInfo] : m_File.Index.Scenes)
-			{
-				auto assetIt = sceneInfo.Assets.find(assetHandle);
-				if (assetIt != sceneInfo.Assets.end())
-				{
-					assetInfo = &assetIt->second;
-					break;
-				}
-			}
+			AssetPackFile::AssetInfo decompressedInfo = *assetInfo;
+			decompressedInfo.PackedOffset = 0;
+			decompressedInfo.PackedSize = data.Size;
+			decompressedInfo.SetCompression(AssetPackFile::Compression::None);
 
-			if (!assetInfo)
-				return nullptr;
+			MemoryStreamReader stream(data);
+			asset = AssetImporter::DeserializeFromAssetPack(stream, decompressedInfo);
+			data.Release();
+		}
+		else
+		{
+			MemoryMappedStreamReader stream(m_MappedFile);
+			asset = AssetImporter::DeserializeFromAssetPack(stream, *assetInfo);
 		}
-
-		FileStreamReader stream(m_Path);
-		Ref<Asset> asset = AssetImporter::DeserializeFromAssetPack(stream, *assetInfo);
 		//BEY_CORE_VERIFY(asset);
 		if (!asset)
 			return nullptr;
@@ -106,34 +108,36 @@ namespace Beyond {
 		return asset;
 	}
 
+	AssetType AssetPack::GetAssetType(AssetHandle sceneHandle, AssetHandle assetHandle) const
+	{
+		const AssetPackFile::AssetInfo* assetInfo = FindAssetInfo(assetHandle);
+		return assetInfo ? (AssetType)assetInfo->Type : AssetType::None;
+	}
+
 	bool AssetPack::IsAssetHandleValid(AssetHandle assetHandle) const
 	{
-		return m_AssetHandleIndex.find(assetHandle) != m_AssetHandleIndex.end();
+		return m_Index.FindAsset(assetHandle) || m_Index.FindScene(assetHandle);
 	}
 
 	bool AssetPack::IsAssetHandleValid(AssetHandle sceneHandle, AssetHandle assetHandle) const
 	{
-		auto sceneIterator = m_File.Index.Scenes.find(sceneHandle);
-		if (sceneIterator == m_File.Index.Scenes.end())
-			return false;
-
-		const auto& sceneInfo = sceneIterator->second;
-		return sceneInfo.Assets.find(assetHandle) != sceneInfo.Assets.end();
+		const AssetPackFile::SceneEntry* sceneEntry = m_Index.FindScene(sceneHandle);
+		return sceneEntry && m_Index.SceneContainsAsset(*sceneEntry, assetHandle);
 	}
 
 	Buffer AssetPack::ReadAppBinary()
 	{
-		FileStreamReader stream(m_Path);
-		stream.SetStreamPosition(m_File.Index.PackedAppBinaryOffset);
+		MemoryMappedStreamReader stream(m_MappedFile);
+		stream.SetStreamPosition(m_Index.GetAppBinaryOffset());
 		Buffer buffer;
 		stream.ReadBuffer(buffer);
-		BEY_CORE_VERIFY(m_File.Index.PackedAppBinarySize == (buffer.Size + sizeof(uint32_t)));
+		BEY_CORE_VERIFY(m_Index.GetAppBinarySize() == (buffer.Size + sizeof(uint32_t)));
 		return buffer;
 	}
 
 	uint64_t AssetPack::GetBuildVersion()
 	{
-		return m_File.Header.BuildVersion;
+		return m_Header.BuildVersion;
 	}
 
 	Ref<AssetPack> AssetPack::CreateFromActiveProject(std::atomic<float>& progress)
@@ -282,44 +286,33 @@ namespace Beyond {
 	{
 		Ref<AssetPack> assetPack = Ref<AssetPack>::Create();
 		assetPack->m_Path = path;
-		bool success = AssetPackSerializer::DeserializeIndex(assetPack->m_Path, assetPack->m_File);
+		assetPack->m_MappedFile = Ref<MemoryMappedFile>::Create(path);
+
+		MemoryMappedStreamReader stream(assetPack->m_MappedFile);
+		bool success = AssetPackSerializer::DeserializeIndex(stream, assetPack->m_Header, assetPack->m_Index);
 		BEY_CORE_VERIFY(success);
 		if (!success)
 			return nullptr;
 
-		// Populate asset handle index
-		const auto& index = assetPack->m_File.Index;
-		for (const auto& [sceneHandle, sceneInfo] : index.Scenes)
-		{
-			assetPack->m_AssetHandleIndex.insert(sceneHandle);
-			for (const auto& [assetHandle, assetInfo] : sceneInfo.Assets)
-			{
-				assetPack->m_AssetHandleIndex.insert(assetHandle);
-			}
-		}
-
 		// Debug log
 #ifndef BEY_DIST
 		{
+			const AssetPackIndex& index = assetPack->m_Index;
 			BEY_CORE_INFO("-----------------------------------------------------");
 			BEY_CORE_INFO("AssetPack Dump {}", assetPack->m_Path);
 			BEY_CORE_INFO("-----------------------------------------------------");
-			std::unordered_map<AssetType, uint32_t> typeCounts;
-			std::unordered_set<AssetHandle> duplicatePreventionSet;
-			for (const auto& [sceneHandle, sceneInfo] : index.Scenes)
+			std::span<const AssetPackFile::AssetEntry> assets = index.GetAssets();
+			for (const AssetPackFile::SceneEntry& scene : index.GetScenes())
 			{
-				BEY_CORE_INFO("Scene {}:", sceneHandle);
-				for (const auto& [assetHandle, assetInfo] : sceneInfo.Assets)
-				{
-					BEY_CORE_INFO("  {} - {}", Utils::AssetTypeToString((AssetType)assetInfo.Type), assetHandle);
-
-					if (duplicatePreventionSet.find(assetHandle) == duplicatePreventionSet.end())
-					{
-						duplicatePreventionSet.insert(assetHandle);
-						typeCounts[(AssetType)assetInfo.Type]++;
-					}
-				}
+				BEY_CORE_INFO("Scene {}:", scene.Handle);
+				for (uint32_t assetIndex : index.GetSceneAssetIndices(scene))
+					BEY_CORE_INFO("  {} - {}", Utils::AssetTypeToString((AssetType)assets[assetIndex].Info.Type), assets[assetIndex].Handle);
 			}
+
+			std::unordered_map<AssetType, uint32_t> typeCounts;
+			for (const AssetPackFile::AssetEntry& asset : assets)
+				typeCounts[(AssetType)asset.Info.Type]++;
+
 			BEY_CORE_INFO("-----------------------------------------------------");
 			BEY_CORE_INFO("Summary:");
 			for (const auto& [type, count] : typeCounts)
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <filesystem>
-#include <map>
 #include <unordered_set>
 
 #include "Beyond/Core/UUID.h"
@@ -9,6 +8,8 @@
 
 #include "AssetPackSerializer.h"
 #include "AssetPackFile.h"
+#include "AssetPackIndex.h"
+#include "MemoryMappedStream.h"
 
 namespace Beyond {
 	class Scene;
@@ -25,10 +26,12 @@ namespace Beyond {
 
 		Ref<Scene> LoadScene(AssetHandle sceneHandle);
 		Ref<Asset> LoadAsset(AssetHandle sceneHandle, AssetHandle assetHandle);
+		AssetType GetAssetType(AssetHandle sceneHandle, AssetHandle assetHandle) const;
 		
 		bool IsAssetHandleValid(AssetHandle assetHandle) const;
 		bool IsAssetHandleValid(AssetHandle sceneHandle, AssetHandle assetHandle) const;
 
+		// Copy of the app binary, owned by the caller
 		Buffer ReadAppBinary();
 		uint64_t GetBuildVersion();
 
@@ -39,13 +42,17 @@ namespace Beyond {
 		static Ref<AssetPack> CreateFromActiveProject(std::atomic<float>& progress);
 		static Ref<AssetPack> Load(const std::filesystem::path& path);
 		static Ref<AssetPack> LoadActiveProject();
+	private:
+		// Assets are stored once, whichever scenes use them
+		const AssetPackFile::AssetInfo* FindAssetInfo(AssetHandle assetHandle) const;
 	private:
 		std::filesystem::path m_Path;
-		AssetPackFile m_File;
-
-		AssetPackSerializer m_Serializer;
+		AssetPackFile::FileHeader m_Header;
+		AssetPackIndex m_Index;
 
-		std::unordered_set<AssetHandle> m_AssetHandleIndex;
+		// Kept open for the lifetime of the pack, every load reads from it through its own MemoryMappedStreamReader.
+		// m_Index points into it for current version packs.
+		Ref<MemoryMappedFile> m_MappedFile;
 	};
 
 }
@@ -0,0 +1,266 @@
+#include "pch.h"
+#include "AssetPackCompression.h"
+
+#include "Beyond/Core/Application.h"
+#include "Beyond/Debug/Profiler.h"
+
+#include <common/tracy_lz4.hpp>
+#include <common/tracy_lz4hc.hpp>
+#include <tracy/tracy/zstd/zstd.h>
+
+namespace Beyond {
+
+	namespace Utils {
+
+		static const char* CompressionToString(AssetPackFile::Compression compression)
+		{
+			switch (compression)
+			{
+				case AssetPackFile::Compression::None: return "None";
+				case AssetPackFile::Compression::LZ4:  return "LZ4";
+				case AssetPackFile::Compression::Zstd: return "Zstd";
+			}
+			return "Unknown";
+		}
+
+		static uint64_t GetCompressBound(AssetPackFile::Compression compression, uint32_t size)
+		{
+			switch (compression)
+			{
+				case AssetPackFile::Compression::LZ4:  return (uint64_t)tracy::LZ4_compressBound((int)size);
+				case AssetPackFile::Compression::Zstd: return (uint64_t)ZSTD_compressBound(size);
+			}
+			return 0;
+		}
+
+		// Returns the compressed size, 0 on failure
+		static uint64_t CompressBlock(AssetPackFile::Compression compression, const uint8_t* source, uint32_t sourceSize, uint8_t* destination, uint64_t destinationCapacity)
+		{
+			switch (compression)
+			{
+				case AssetPackFile::Compression::LZ4:
+				{
+					int result = tracy::LZ4_compress_HC((const char*)source, (char*)destination, (int)sourceSize, (int)destinationCapacity, AssetPackCompression::LZ4Level);
+					return result > 0 ? (uint64_t)result : 0;
+				}
+				case AssetPackFile::Compression::Zstd:
+				{
+					size_t result = ZSTD_compress(destination, destinationCapacity, source, sourceSize, AssetPackCompression::ZstdLevel);
+					return ZSTD_isError(result) ? 0 : (uint64_t)result;
+				}
+			}
+			return 0;
+		}
+
+		static bool DecompressBlock(AssetPackFile::Compression compression, const uint8_t* source, uint32_t sourceSize, uint8_t* destination, uint32_t destinationSize)
+		{
+			switch (compression)
+			{
+				case AssetPackFile::Compression::LZ4:
+				{
+					int result = tracy::LZ4_decompress_safe((const char*)source, (char*)destination, (int)sourceSize, (int)destinationSize);
+					return result == (int)destinationSize;
+				}
+				case AssetPackFile::Compression::Zstd:
+				{
+					// One context per thread, creating one per block would cost more than decoding small blocks
+					struct DecompressionContext
+					{
+						ZSTD_DCtx* Context = ZSTD_createDCtx();
+						~DecompressionContext() { ZSTD_freeDCtx(Context); }
+					};
+					static thread_local DecompressionContext context;
+
+					size_t result = ZSTD_decompressDCtx(context.Context, destination, destinationSize, source, sourceSize);
+					return !ZSTD_isError(result) && result == destinationSize;
+				}
+			}
+			return false;
+		}
+
+	}
+
+	void AssetPackBuildStatistics::Log() const
+	{
+		BEY_CONSOLE_LOG_INFO("AssetPack compression:");
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			const CompressionStatistics& stats = Compression[i];
+			if (stats.AssetCount == 0)
+				continue;
+
+			const float ratio = stats.RawSize > 0 ? (float)stats.PackedSize / (float)stats.RawSize : 1.0f;
+			const float rawMB = (float)stats.RawSize / (1024.0f * 1024.0f);
+			if ((AssetPackFile::Compression)i == AssetPackFile::Compression::None)
+			{
+				BEY_CONSOLE_LOG_INFO("  {}: {} assets, {:.2f} MB", Utils::CompressionToString((AssetPackFile::Compression)i), stats.AssetCount, rawMB);
+				continue;
+			}
+
+			const float compressThroughput = stats.CompressMs > 0.0f ? rawMB / (stats.CompressMs / 1000.0f) : 0.0f;
+			const float decompressThroughput = stats.DecompressMs > 0.0f ? rawMB / (stats.DecompressMs / 1000.0f) : 0.0f;
+			BEY_CONSOLE_LOG_INFO("  {}: {} assets, {:.2f} MB -> {:.2f} MB ({:.1f}%), compress {:.1f} MB/s, decompress {:.1f} MB/s",
+				Utils::CompressionToString((AssetPackFile::Compression)i), stats.AssetCount, rawMB, (float)stats.PackedSize / (1024.0f * 1024.0f),
+				ratio * 100.0f, compressThroughput, decompressThroughput);
+		}
+
+		if (UncompressibleAssetCount > 0)
+			BEY_CONSOLE_LOG_INFO("  {} assets didn't compress well enough and are stored uncompressed", UncompressibleAssetCount);
+	}
+
+	AssetPackFile::Compression AssetPackCompression::GetCompressionForAssetType(AssetType type)
+	{
+		switch (type)
+		{
+			case AssetType::MeshSource:
+			case AssetType::Texture:
+			case AssetType::EnvMap:
+			case AssetType::MeshCollider:
+			case AssetType::Animation:
+				return AssetPackFile::Compression::LZ4;
+			case AssetType::Prefab:
+			case AssetType::Material:
+			case AssetType::SoundConfig:
+			case AssetType::SoundGraphSound:
+			case AssetType::Skeleton:
+			case AssetType::AnimationGraph:
+			case AssetType::Font:
+				return AssetPackFile::Compression::Zstd;
+			default:
+				// Audio is compressed already, the rest is too small to bother
+				return AssetPackFile::Compression::None;
+		}
+	}
+
+	bool AssetPackCompression::Compress(Buffer data, AssetPackFile::Compression compression, Buffer& packed)
+	{
+		BEY_PROFILE_FUNC();
+
+		if (compression == AssetPackFile::Compression::None || data.Size == 0)
+			return false;
+
+		AssetPackFile::CompressedDataHeader header;
+		header.RawSize = data.Size;
+		header.BlockSize = BlockSize;
+		header.BlockCount = (uint32_t)((data.Size + BlockSize - 1) / BlockSize);
+
+		std::vector<Buffer> blocks(header.BlockCount);
+		std::vector<uint32_t> blockSizes(header.BlockCount);
+		std::atomic<bool> failed = false;
+
+		auto compressBlock = [&](uint32_t blockIndex)
+		{
+			const uint64_t offset = (uint64_t)blockIndex * BlockSize;
+			const uint32_t rawSize = (uint32_t)std::min<uint64_t>(BlockSize, data.Size - offset);
+			const uint8_t* source = (const uint8_t*)data.Data + offset;
+
+			Buffer& block = blocks[blockIndex];
+			block.Allocate(Utils::GetCompressBound(compression, rawSize));
+			uint64_t compressedSize = Utils::CompressBlock(compression, source, rawSize, (uint8_t*)block.Data, block.Size);
+			if (compressedSize == 0)
+			{
+				failed = true;
+				return;
+			}
+
+			// Blocks that don't shrink are stored as they are
+			if (compressedSize >= rawSize)
+			{
+				memcpy(block.Data, source, rawSize);
+				compressedSize = rawSize;
+			}
+			blockSizes[blockIndex] = (uint32_t)compressedSize;
+		};
+
+		if (header.BlockCount > 1)
+			Application::Get().GetJobSystem().ParallelFor(header.BlockCount, 1, compressBlock);
+		else
+			compressBlock(0);
+
+		uint64_t packedSize = sizeof(AssetPackFile::CompressedDataHeader) + sizeof(uint32_t) * header.BlockCount;
+		for (uint32_t blockSize : blockSizes)
+			packedSize += blockSize;
+
+		if (!failed && packedSize <= (uint64_t)((double)data.Size * (1.0 - MinSavings)))
+		{
+			packed.Allocate(packedSize);
+			uint64_t offset = 0;
+			packed.Write(&header, sizeof(header), offset);
+			offset += sizeof(header);
+			packed.Write(blockSizes.data(), sizeof(uint32_t) * header.BlockCount, offset);
+			offset += sizeof(uint32_t) * header.BlockCount;
+			for (uint32_t i = 0; i < header.BlockCount; i++)
+			{
+				packed.Write(blocks[i].Data, blockSizes[i], offset);
+				offset += blockSizes[i];
+			}
+		}
+
+		for (Buffer& block : blocks)
+			block.Release();
+
+		return packed.Data != nullptr;
+	}
+
+	bool AssetPackCompression::Decompress(Buffer packed, AssetPackFile::Compression compression, Buffer& data)
+	{
+		BEY_PROFILE_FUNC();
+
+		if (packed.Size < sizeof(AssetPackFile::CompressedDataHeader))
+			return false;
+
+		// Packed data isn't necessarily aligned within the pack
+		AssetPackFile::CompressedDataHeader header;
+		memcpy(&header, packed.Data, sizeof(header));
+		if (header.BlockSize == 0 || header.BlockCount != (header.RawSize + header.BlockSize - 1) / header.BlockSize)
+			return false;
+
+		const uint64_t blockTableSize = sizeof(uint32_t) * (uint64_t)header.BlockCount;
+		if (packed.Size - sizeof(header) < blockTableSize)
+			return false;
+
+		// Block sizes are read into a local table so the offsets can be validated before any work is handed out
+		std::vector<uint32_t> blockSizes(header.BlockCount);
+		std::vector<uint64_t> blockOffsets(header.BlockCount);
+		memcpy(blockSizes.data(), (const uint8_t*)packed.Data + sizeof(header), blockTableSize);
+
+		uint64_t offset = sizeof(header) + blockTableSize;
+		for (uint32_t i = 0; i < header.BlockCount; i++)
+		{
+			blockOffsets[i] = offset;
+			offset += blockSizes[i];
+		}
+		if (offset > packed.Size)
+			return false;
+
+		data.Allocate(header.RawSize);
+		std::atomic<bool> failed = false;
+
+		auto decompressBlock = [&](uint32_t blockIndex)
+		{
+			const uint64_t rawOffset = (uint64_t)blockIndex * header.BlockSize;
+			const uint32_t rawSize = (uint32_t)std::min<uint64_t>(header.BlockSize, header.RawSize - rawOffset);
+			const uint8_t* source = (const uint8_t*)packed.Data + blockOffsets[blockIndex];
+			uint8_t* destination = (uint8_t*)data.Data + rawOffset;
+
+			if (blockSizes[blockIndex] == rawSize)
+				memcpy(destination, source, rawSize);
+			else if (!Utils::DecompressBlock(compression, source, blockSizes[blockIndex], destination, rawSize))
+				failed = true;
+		};
+
+		if (header.BlockCount > 1)
+			Application::Get().GetJobSystem().ParallelFor(header.BlockCount, 1, decompressBlock);
+		else if (header.BlockCount == 1)
+			decompressBlock(0);
+
+		if (failed)
+		{
+			data.Release();
+			return false;
+		}
+
+		return true;
+	}
+
+}
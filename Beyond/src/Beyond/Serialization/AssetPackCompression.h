@@ -0,0 +1,51 @@
+#pragma once
+
+#include "AssetPackFile.h"
+
+#include "Beyond/Core/Buffer.h"
+
+namespace Beyond {
+
+	struct AssetPackBuildStatistics
+	{
+		struct CompressionStatistics
+		{
+			uint32_t AssetCount = 0;
+			uint64_t RawSize = 0;
+			uint64_t PackedSize = 0;
+			float CompressMs = 0.0f;
+			float DecompressMs = 0.0f; // Decoding every asset once after the build, see AssetPackSerializer::Serialize
+		};
+
+		CompressionStatistics Compression[3]; // Indexed by AssetPackFile::Compression
+		uint32_t UncompressibleAssetCount = 0; // Type asks for compression, but it didn't save enough
+
+		void Log() const;
+	};
+
+	/// Block based asset compression for asset packs. Blocks are compressed and decompressed independently,
+	/// so large payloads (meshes, textures) are spread over the job system.
+	class AssetPackCompression
+	{
+	public:
+		static constexpr uint32_t BlockSize = 256 * 1024;
+
+		// Payloads that would save less than this are stored uncompressed
+		static constexpr float MinSavings = 0.05f;
+
+		static constexpr int LZ4Level = 9; // LZ4 HC, decompression speed doesn't depend on the level
+		static constexpr int ZstdLevel = 19;
+
+	public:
+		// LZ4 for large binary payloads, Zstd for small text (YAML) ones
+		static AssetPackFile::Compression GetCompressionForAssetType(AssetType type);
+
+		// Returns false if compressing didn't pay off (see MinSavings), packed is left empty then.
+		// packed is owned by the caller.
+		static bool Compress(Buffer data, AssetPackFile::Compression compression, Buffer& packed);
+
+		// data is owned by the caller
+		static bool Decompress(Buffer packed, AssetPackFile::Compression compression, Buffer& data);
+	};
+
+}
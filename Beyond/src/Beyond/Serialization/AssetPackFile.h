@@ -8,14 +8,40 @@ namespace Beyond {
 
 	struct AssetPackFile
 	{
+		// v5 can contain compressed assets, otherwise it has the same layout as v4
+		static constexpr uint32_t CurrentVersion = 5;
+
+		enum class Compression : uint16_t
+		{
+			None = 0,
+			LZ4 = 1,
+			Zstd = 2
+		};
+
+		static constexpr uint16_t CompressionFlagMask = 0xf;
+
 		struct AssetInfo
 		{
 			uint64_t PackedOffset;
 			uint64_t PackedSize;
 			uint16_t Type;
 			uint16_t Flags; // compressed type, etc.
+
+			Compression GetCompression() const { return (Compression)(Flags & CompressionFlagMask); }
+			void SetCompression(Compression compression) { Flags = (uint16_t)((Flags & ~CompressionFlagMask) | (uint16_t)compression); }
 		};
-		
+
+		// Starts the packed data of a compressed asset, followed by uint32_t CompressedBlockSizes[BlockCount]
+		// and the blocks. Every block but the last one holds BlockSize bytes once decompressed, a block whose
+		// compressed size equals its decompressed size is stored uncompressed.
+		struct CompressedDataHeader
+		{
+			uint64_t RawSize = 0;
+			uint32_t BlockSize = 0;
+			uint32_t BlockCount = 0;
+		};
+
+		// Used to build a pack and to read v3 packs, packs are looked up through an AssetPackIndex
 		struct SceneInfo
 		{
 			uint64_t PackedOffset = 0;
@@ -31,10 +57,45 @@ namespace Beyond {
 			std::map<uint64_t, SceneInfo> Scenes; // AssetHandle->SceneInfo
 		};
 
+		// v4 index layout, written right after the file header:
+		//   IndexHeader
+		//   SceneEntry[SceneCount]                sorted by handle
+		//   AssetEntry[AssetCount]                sorted by handle, every asset once
+		//   uint32_t[SceneAssetIndexCount]        indices into the asset table, each scene's range ascending
+		// Every table starts 8 byte aligned so it can be used in place from a memory mapped pack.
+		struct IndexHeader
+		{
+			uint64_t PackedAppBinaryOffset = 0;
+			uint64_t PackedAppBinarySize = 0;
+			uint32_t SceneCount = 0;
+			uint32_t AssetCount = 0;
+			uint32_t SceneAssetIndexCount = 0;
+			uint32_t Reserved = 0;
+		};
+
+		struct SceneEntry
+		{
+			uint64_t Handle = 0;
+			uint64_t PackedOffset = 0;
+			uint64_t PackedSize = 0;
+			uint32_t FirstAssetIndex = 0; // Into the scene asset index list
+			uint32_t AssetCount = 0;
+			uint16_t Flags = 0;
+			uint16_t Reserved[3] = {};
+		};
+
+		struct AssetEntry
+		{
+			uint64_t Handle = 0;
+			AssetInfo Info = {};
+		};
+
+		static_assert(sizeof(IndexHeader) % 8 == 0 && sizeof(SceneEntry) % 8 == 0 && sizeof(AssetEntry) % 8 == 0);
+
 		struct FileHeader
 		{
 			const char HEADER[4] = {'H','Z','A','P'};
-			uint32_t Version = 3;
+			uint32_t Version = CurrentVersion;
 			uint64_t BuildVersion = 0; // Usually date/time format (eg. 202210061535)
 		};
 
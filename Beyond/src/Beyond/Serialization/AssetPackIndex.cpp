@@ -0,0 +1,158 @@
+#include "pch.h"
+#include "AssetPackIndex.h"
+
+namespace Beyond {
+
+	namespace Utils {
+
+		// Handles are random 64 bit UUIDs, so interpolating between the first and last handle lands on or right next to
+		// the entry and the lookup is usually done after a step or two. Bisects if a few guesses didn't narrow it down.
+		template<typename TEntry>
+		static const TEntry* FindSortedEntry(std::span<const TEntry> entries, uint64_t handle)
+		{
+			constexpr uint32_t MaxInterpolationSteps = 4;
+
+			size_t low = 0, high = entries.size();
+			for (uint32_t step = 0; low < high; step++)
+			{
+				const uint64_t lowHandle = entries[low].Handle;
+				const uint64_t highHandle = entries[high - 1].Handle;
+				if (handle < lowHandle || handle > highHandle)
+					return nullptr;
+
+				size_t middle;
+				if (step < MaxInterpolationSteps && highHandle != lowHandle)
+					middle = low + (size_t)((double)(handle - lowHandle) / (double)(highHandle - lowHandle) * (double)(high - 1 - low));
+				else
+					middle = low + (high - low) / 2;
+
+				middle = std::min(middle, high - 1);
+				if (entries[middle].Handle == handle)
+					return &entries[middle];
+
+				if (entries[middle].Handle < handle)
+					low = middle + 1;
+				else
+					high = middle;
+			}
+
+			return nullptr;
+		}
+
+	}
+
+	AssetPackIndex AssetPackIndex::Build(const AssetPackFile::IndexTable& table)
+	{
+		// Shared assets are listed by every scene that uses them, the asset table keeps one entry per handle
+		std::map<uint64_t, AssetPackFile::AssetInfo> uniqueAssets;
+		uint32_t sceneAssetIndexCount = 0;
+		for (const auto& [sceneHandle, sceneInfo] : table.Scenes)
+		{
+			uniqueAssets.insert(sceneInfo.Assets.begin(), sceneInfo.Assets.end());
+			sceneAssetIndexCount += (uint32_t)sceneInfo.Assets.size();
+		}
+
+		OwnedTables tables;
+		std::vector<AssetPackFile::AssetEntry>& assets = tables.Assets;
+		assets.reserve(uniqueAssets.size());
+		for (const auto& [handle, info] : uniqueAssets)
+			assets.push_back({ handle, info });
+
+		std::vector<AssetPackFile::SceneEntry>& scenes = tables.Scenes;
+		std::vector<uint32_t>& sceneAssetIndices = tables.SceneAssetIndices;
+		scenes.reserve(table.Scenes.size());
+		sceneAssetIndices.reserve(sceneAssetIndexCount);
+		for (const auto& [sceneHandle, sceneInfo] : table.Scenes)
+		{
+			AssetPackFile::SceneEntry& scene = scenes.emplace_back();
+			scene.Handle = sceneHandle;
+			scene.PackedOffset = sceneInfo.PackedOffset;
+			scene.PackedSize = sceneInfo.PackedSize;
+			scene.Flags = sceneInfo.Flags;
+			scene.FirstAssetIndex = (uint32_t)sceneAssetIndices.size();
+			scene.AssetCount = (uint32_t)sceneInfo.Assets.size();
+
+			// Both maps are sorted by handle, so the indices come out ascending
+			auto assetIt = assets.begin();
+			for (const auto& [assetHandle, assetInfo] : sceneInfo.Assets)
+			{
+				assetIt = std::lower_bound(assetIt, assets.end(), assetHandle, [](const AssetPackFile::AssetEntry& entry, uint64_t handle) { return entry.Handle < handle; });
+				sceneAssetIndices.push_back((uint32_t)(assetIt - assets.begin()));
+			}
+		}
+
+		AssetPackFile::IndexHeader header;
+		header.PackedAppBinaryOffset = table.PackedAppBinaryOffset;
+		header.PackedAppBinarySize = table.PackedAppBinarySize;
+		header.SceneCount = (uint32_t)scenes.size();
+		header.AssetCount = (uint32_t)assets.size();
+		header.SceneAssetIndexCount = (uint32_t)sceneAssetIndices.size();
+
+		AssetPackIndex index;
+		index.SetTables(header, scenes, assets, sceneAssetIndices, std::move(tables));
+		return index;
+	}
+
+	const AssetPackFile::AssetEntry* AssetPackIndex::FindAsset(AssetHandle handle) const
+	{
+		return Utils::FindSortedEntry(m_Assets, (uint64_t)handle);
+	}
+
+	const AssetPackFile::SceneEntry* AssetPackIndex::FindScene(AssetHandle handle) const
+	{
+		return Utils::FindSortedEntry(m_Scenes, (uint64_t)handle);
+	}
+
+	bool AssetPackIndex::SceneContainsAsset(const AssetPackFile::SceneEntry& scene, AssetHandle handle) const
+	{
+		const AssetPackFile::AssetEntry* asset = FindAsset(handle);
+		if (!asset)
+			return false;
+
+		const uint32_t assetIndex = (uint32_t)(asset - m_Assets.data());
+		std::span<const uint32_t> sceneAssets = GetSceneAssetIndices(scene);
+		return std::binary_search(sceneAssets.begin(), sceneAssets.end(), assetIndex);
+	}
+
+	std::span<const uint32_t> AssetPackIndex::GetSceneAssetIndices(const AssetPackFile::SceneEntry& scene) const
+	{
+		return m_SceneAssetIndices.subspan(scene.FirstAssetIndex, scene.AssetCount);
+	}
+
+	void AssetPackIndex::SetTables(const AssetPackFile::IndexHeader& header, std::span<const AssetPackFile::SceneEntry> scenes, std::span<const AssetPackFile::AssetEntry> assets, std::span<const uint32_t> sceneAssetIndices, OwnedTables&& ownedTables)
+	{
+		m_Header = header;
+		m_Scenes = scenes;
+		m_Assets = assets;
+		m_SceneAssetIndices = sceneAssetIndices;
+		m_OwnedTables = std::move(ownedTables);
+	}
+
+	bool AssetPackIndex::Validate() const
+	{
+		for (size_t i = 1; i < m_Assets.size(); i++)
+		{
+			if (m_Assets[i - 1].Handle >= m_Assets[i].Handle)
+				return false;
+		}
+
+		for (size_t i = 0; i < m_Scenes.size(); i++)
+		{
+			const AssetPackFile::SceneEntry& scene = m_Scenes[i];
+			if (i > 0 && m_Scenes[i - 1].Handle >= scene.Handle)
+				return false;
+
+			if ((uint64_t)scene.FirstAssetIndex + scene.AssetCount > m_SceneAssetIndices.size())
+				return false;
+		}
+
+		for (uint32_t assetIndex : m_SceneAssetIndices)
+		{
+			if (assetIndex >= m_Assets.size())
+				return false;
+		}
+
+		return true;
+	}
+
+}
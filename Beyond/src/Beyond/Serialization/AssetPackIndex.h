@@ -0,0 +1,58 @@
+#pragma once
+
+#include "AssetPackFile.h"
+
+#include <span>
+
+namespace Beyond {
+
+	/// Flat, deduplicated index of an asset pack. The tables point straight into the memory
+	/// mapped pack when possible, otherwise (v3 packs, plain streams) into the storage owned here.
+	class AssetPackIndex
+	{
+	public:
+		AssetPackIndex() = default;
+		AssetPackIndex(AssetPackIndex&&) = default;
+		AssetPackIndex& operator=(AssetPackIndex&&) = default;
+
+		AssetPackIndex(const AssetPackIndex&) = delete;
+		AssetPackIndex& operator=(const AssetPackIndex&) = delete;
+
+		// Builds owned tables from a nested index table (v3 packs and pack creation)
+		static AssetPackIndex Build(const AssetPackFile::IndexTable& table);
+
+		const AssetPackFile::AssetEntry* FindAsset(AssetHandle handle) const;
+		const AssetPackFile::SceneEntry* FindScene(AssetHandle handle) const;
+		bool SceneContainsAsset(const AssetPackFile::SceneEntry& scene, AssetHandle handle) const;
+
+		std::span<const AssetPackFile::SceneEntry> GetScenes() const { return m_Scenes; }
+		std::span<const AssetPackFile::AssetEntry> GetAssets() const { return m_Assets; }
+		std::span<const uint32_t> GetSceneAssetIndices(const AssetPackFile::SceneEntry& scene) const;
+
+		uint64_t GetAppBinaryOffset() const { return m_Header.PackedAppBinaryOffset; }
+		uint64_t GetAppBinarySize() const { return m_Header.PackedAppBinarySize; }
+
+		struct OwnedTables
+		{
+			std::vector<AssetPackFile::SceneEntry> Scenes;
+			std::vector<AssetPackFile::AssetEntry> Assets;
+			std::vector<uint32_t> SceneAssetIndices;
+		};
+
+		// The tables either point into memory that outlives the index (a mapped pack) or into ownedTables,
+		// which is moved into the index so the spans stay valid
+		void SetTables(const AssetPackFile::IndexHeader& header, std::span<const AssetPackFile::SceneEntry> scenes, std::span<const AssetPackFile::AssetEntry> assets, std::span<const uint32_t> sceneAssetIndices, OwnedTables&& ownedTables = {});
+
+		// Sorted, unique handles and scene ranges/indices in bounds
+		bool Validate() const;
+
+	private:
+		AssetPackFile::IndexHeader m_Header;
+		std::span<const AssetPackFile::SceneEntry> m_Scenes;
+		std::span<const AssetPackFile::AssetEntry> m_Assets;
+		std::span<const uint32_t> m_SceneAssetIndices;
+
+		OwnedTables m_OwnedTables;
+	};
+
+}
@@ -3,7 +3,10 @@
 #include "AssetPackSerializer.h"
 #include "Beyond/Asset/AssetImporter.h"
 
+#include "Beyond/Core/Timer.h"
+#include "Beyond/Serialization/AssetPackCompression.h"
 #include "Beyond/Serialization/FileStream.h"
+#include "Beyond/Serialization/MemoryStream.h"
 
 #include <filesystem>
 #include <fstream>
@@ -36,11 +39,21 @@ namespace Beyond {
 		// Write index
 		// ===============
 		// Write dummy data for index (come back later to fill in)
+		std::unordered_set<AssetHandle> uniqueAssets;
+		uint32_t sceneAssetIndexCount = 0;
+		for (const auto& [sceneHandle, sceneInfo] : file.Index.Scenes)
+		{
+			for (const auto& [assetHandle, assetInfo] : sceneInfo.Assets)
+				uniqueAssets.insert(assetHandle);
+			sceneAssetIndexCount += (uint32_t)sceneInfo.Assets.size();
+		}
+
 		uint64_t indexPos = serializer.GetStreamPosition();
-		uint64_t indexTableSize = CalculateIndexTableSize(file);
+		uint64_t indexTableSize = CalculateIndexTableSize((uint32_t)file.Index.Scenes.size(), (uint32_t)uniqueAssets.size(), sceneAssetIndexCount);
 		serializer.WriteZero(indexTableSize);
 
-		std::unordered_map<AssetHandle, AssetSerializationInfo> serializedAssets;
+		std::unordered_map<AssetHandle, AssetPackFile::AssetInfo> serializedAssets;
+		AssetPackBuildStatistics statistics;
 
 		float progressIncrement = 0.4f / (float)file.Index.Scenes.size();
 
@@ -51,6 +64,7 @@ namespace Beyond {
 		appBinary.Release();
 
 		// Write asset data + fill in offset + size
+		std::unordered_set<AssetHandle> failedAssets;
 		for (auto& [sceneHandle, sceneInfo] : file.Index.Scenes)
 		{
 			// Serialize Scene
@@ -62,25 +76,25 @@ namespace Beyond {
 			// Serialize Assets
 			for (auto& [assetHandle, assetInfo] : sceneInfo.Assets)
 			{
+				if (failedAssets.contains(assetHandle))
+					continue;
+
 				if (serializedAssets.find(assetHandle) != serializedAssets.end())
 				{
 					// Has already been serialized
-					serializationInfo = serializedAssets.at(assetHandle);
-					file.Index.Scenes[sceneHandle].Assets[assetHandle].PackedOffset = serializationInfo.Offset;
-					file.Index.Scenes[sceneHandle].Assets[assetHandle].PackedSize = serializationInfo.Size;
+					assetInfo = serializedAssets.at(assetHandle);
 				}
 				else
 				{
 					// Serialize asset
-					if (AssetImporter::SerializeToAssetPack(assetHandle, serializer, serializationInfo))
+					if (SerializeAsset(assetHandle, serializer, assetInfo, statistics))
 					{
-						file.Index.Scenes[sceneHandle].Assets[assetHandle].PackedOffset = serializationInfo.Offset;
-						file.Index.Scenes[sceneHandle].Assets[assetHandle].PackedSize = serializationInfo.Size;
-						serializedAssets[assetHandle] = serializationInfo;
+						serializedAssets[assetHandle] = assetInfo;
 					}
 					else
 					{
 						BEY_CORE_ERROR("Failed to serialize asset with handle {}", assetHandle);
+						failedAssets.insert(assetHandle);
 					}
 				}
 			}
@@ -89,51 +103,218 @@ namespace Beyond {
 		}
 
 		BEY_CORE_TRACE("Serialized {} assets into AssetPack", serializedAssets.size());
+		statistics.Log();
+
+		// Assets that failed to serialize have no data in the pack, they are left out of the index
+		for (auto& [sceneHandle, sceneInfo] : file.Index.Scenes)
+			std::erase_if(sceneInfo.Assets, [&failedAssets](const auto& entry) { return failedAssets.contains(entry.first); });
+
+		AssetPackIndex index = AssetPackIndex::Build(file.Index);
+		std::span<const AssetPackFile::SceneEntry> scenes = index.GetScenes();
+		std::span<const AssetPackFile::AssetEntry> assets = index.GetAssets();
+
+		AssetPackFile::IndexHeader indexHeader;
+		indexHeader.PackedAppBinaryOffset = file.Index.PackedAppBinaryOffset;
+		indexHeader.PackedAppBinarySize = file.Index.PackedAppBinarySize;
+		indexHeader.SceneCount = (uint32_t)scenes.size();
+		indexHeader.AssetCount = (uint32_t)assets.size();
+		for (const AssetPackFile::SceneEntry& scene : scenes)
+			indexHeader.SceneAssetIndexCount += scene.AssetCount;
 
 		serializer.SetStreamPosition(indexPos);
-		serializer.WriteRaw<uint64_t>(file.Index.PackedAppBinaryOffset);
-		serializer.WriteRaw<uint64_t>(file.Index.PackedAppBinarySize);
+		serializer.WriteRaw<AssetPackFile::IndexHeader>(indexHeader);
+		serializer.WriteData((const char*)scenes.data(), scenes.size_bytes());
+		serializer.WriteData((const char*)assets.data(), assets.size_bytes());
+		for (const AssetPackFile::SceneEntry& scene : scenes)
+		{
+			std::span<const uint32_t> sceneAssetIndices = index.GetSceneAssetIndices(scene);
+			serializer.WriteData((const char*)sceneAssetIndices.data(), sceneAssetIndices.size_bytes());
+		}
 
-		uint64_t begin = indexPos;
-		serializer.WriteRaw<uint32_t>((uint32_t)file.Index.Scenes.size()); // Write scene map size
-		for (auto& [sceneHandle, sceneInfo] : file.Index.Scenes)
+		BEY_CORE_VERIFY(serializer.GetStreamPosition() <= indexPos + indexTableSize);
+		BEY_CORE_TRACE("  {} unique assets, {} scene asset references", indexHeader.AssetCount, indexHeader.SceneAssetIndexCount);
+
+		progress = progress + 0.1f;
+	}
+
+	bool AssetPackSerializer::SerializeAsset(AssetHandle handle, StreamWriter& stream, AssetPackFile::AssetInfo& assetInfo, AssetPackBuildStatistics& statistics)
+	{
+		const AssetPackFile::Compression compression = AssetPackCompression::GetCompressionForAssetType((AssetType)assetInfo.Type);
+		AssetSerializationInfo serializationInfo;
+
+		if (compression == AssetPackFile::Compression::None)
 		{
-			serializer.WriteRaw<uint64_t>(sceneHandle);
-			serializer.WriteRaw<uint64_t>(sceneInfo.PackedOffset);
-			serializer.WriteRaw<uint64_t>(sceneInfo.PackedSize);
-			serializer.WriteRaw<uint16_t>(sceneInfo.Flags);
+			if (!AssetImporter::SerializeToAssetPack(handle, stream, serializationInfo))
+				return false;
 
-			serializer.WriteMap(file.Index.Scenes[sceneHandle].Assets);
+			assetInfo.PackedOffset = serializationInfo.Offset;
+			assetInfo.PackedSize = serializationInfo.Size;
+			assetInfo.SetCompression(AssetPackFile::Compression::None);
+
+			auto& stats = statistics.Compression[(uint32_t)AssetPackFile::Compression::None];
+			stats.AssetCount++;
+			stats.RawSize += serializationInfo.Size;
+			stats.PackedSize += serializationInfo.Size;
+			return true;
 		}
 
-		progress = progress + 0.1f;
+		// Serialized into memory first, stream positions the serializer uses are relative to the start of the asset.
+		// AssetPack::LoadAsset reads decompressed assets from memory the same way.
+		Buffer serializedData;
+		MemoryStreamWriter memoryStream(serializedData, 64 * 1024);
+		if (!AssetImporter::SerializeToAssetPack(handle, memoryStream, serializationInfo))
+		{
+			serializedData.Release();
+			return false;
+		}
+		BEY_CORE_VERIFY(serializationInfo.Offset == 0);
+
+		Buffer data(serializedData.Data, serializationInfo.Size);
+		Buffer packed;
+		Timer timer;
+		const bool compressed = AssetPackCompression::Compress(data, compression, packed);
+		const float compressMs = timer.ElapsedMillis();
+
+		assetInfo.PackedOffset = stream.GetStreamPosition();
+		if (compressed)
+		{
+			// Decoded once to measure it and to make sure what goes into the pack can be read back
+			Buffer decompressed;
+			timer.Reset();
+			bool success = AssetPackCompression::Decompress(packed, compression, decompressed);
+			const float decompressMs = timer.ElapsedMillis();
+			success = success && decompressed.Size == data.Size && memcmp(decompressed.Data, data.Data, data.Size) == 0;
+			decompressed.Release();
+			BEY_CORE_VERIFY(success, "Compressed asset {} doesn't decompress to the serialized data", handle);
+
+			stream.WriteData((const char*)packed.Data, packed.Size);
+			assetInfo.PackedSize = packed.Size;
+			assetInfo.SetCompression(compression);
+
+			auto& stats = statistics.Compression[(uint32_t)compression];
+			stats.AssetCount++;
+			stats.RawSize += data.Size;
+			stats.PackedSize += packed.Size;
+			stats.CompressMs += compressMs;
+			stats.DecompressMs += decompressMs;
+			packed.Release();
+		}
+		else
+		{
+			stream.WriteData((const char*)data.Data, data.Size);
+			assetInfo.PackedSize = data.Size;
+			assetInfo.SetCompression(AssetPackFile::Compression::None);
+
+			auto& stats = statistics.Compression[(uint32_t)AssetPackFile::Compression::None];
+			stats.AssetCount++;
+			stats.RawSize += data.Size;
+			stats.PackedSize += data.Size;
+			statistics.UncompressibleAssetCount++;
+		}
+
+		serializedData.Release();
+		return true;
 	}
 
-	bool AssetPackSerializer::DeserializeIndex(const std::filesystem::path& path, AssetPackFile& file)
+	namespace Utils {
+
+		// Points table at the next count entries of the stream, or reads them into storage if the stream can't
+		// hand out views or the view isn't aligned for T
+		template<typename T>
+		static bool ReadIndexTable(StreamReader& stream, uint32_t count, std::span<const T>& table, std::vector<T>& storage)
+		{
+			Buffer view;
+			if (stream.ReadView(view, (uint64_t)count * sizeof(T)))
+			{
+				if ((uintptr_t)view.Data % alignof(T) == 0)
+				{
+					table = std::span<const T>((const T*)view.Data, count);
+					return true;
+				}
+
+				storage.resize(count);
+				memcpy(storage.data(), view.Data, view.Size);
+				table = storage;
+				return true;
+			}
+
+			storage.resize(count);
+			if (count > 0 && !stream.ReadData((char*)storage.data(), (uint64_t)count * sizeof(T)))
+				return false;
+
+			table = storage;
+			return stream.IsStreamGood();
+		}
+
+	}
+
+	bool AssetPackSerializer::DeserializeIndex(const std::filesystem::path& path, AssetPackFile::FileHeader& header, AssetPackIndex& index)
 	{
 		// Print Info
 		BEY_CORE_TRACE("Deserializing AssetPack from {}", path.string());
 
 		FileStreamReader stream(path);
+		return DeserializeIndex(stream, header, index);
+	}
+
+	bool AssetPackSerializer::DeserializeIndex(StreamReader& stream, AssetPackFile::FileHeader& header, AssetPackIndex& index)
+	{
 		if (!stream.IsStreamGood())
 			return false;
 
-		stream.ReadRaw<AssetPackFile::FileHeader>(file.Header);
-		bool validHeader = memcmp(file.Header.HEADER, "HZAP", 4) == 0;
+		stream.ReadRaw<AssetPackFile::FileHeader>(header);
+		bool validHeader = memcmp(header.HEADER, "HZAP", 4) == 0;
 		BEY_CORE_ASSERT(validHeader);
 		if (!validHeader)
 			return false;
 
-		AssetPackFile current;
-		if (file.Header.Version != current.Header.Version)
+		if (header.Version == 3)
 		{
-			BEY_CORE_ERROR("AssetPack version {} is not compatible with current version {}", file.Header.Version, current.Header.Version);
+			BEY_CORE_WARN("AssetPack version 3 is outdated (current version is {}), rebuild the asset pack to load it faster", AssetPackFile::CurrentVersion);
+			return DeserializeIndexV3(stream, index);
+		}
+
+		// v4 has the same layout, it just never contains compressed assets
+		if (header.Version != 4 && header.Version != AssetPackFile::CurrentVersion)
+		{
+			BEY_CORE_ERROR("AssetPack version {} is not compatible with current version {}", header.Version, AssetPackFile::CurrentVersion);
 			return false;
 		}
 
+		AssetPackFile::IndexHeader indexHeader;
+		stream.ReadRaw<AssetPackFile::IndexHeader>(indexHeader);
+
+		std::span<const AssetPackFile::SceneEntry> scenes;
+		std::span<const AssetPackFile::AssetEntry> assets;
+		std::span<const uint32_t> sceneAssetIndices;
+		AssetPackIndex::OwnedTables ownedTables;
+		bool success = Utils::ReadIndexTable(stream, indexHeader.SceneCount, scenes, ownedTables.Scenes)
+			&& Utils::ReadIndexTable(stream, indexHeader.AssetCount, assets, ownedTables.Assets)
+			&& Utils::ReadIndexTable(stream, indexHeader.SceneAssetIndexCount, sceneAssetIndices, ownedTables.SceneAssetIndices);
+		if (!success)
+		{
+			BEY_CORE_ERROR("AssetPack index is truncated");
+			return false;
+		}
+
+		index.SetTables(indexHeader, scenes, assets, sceneAssetIndices, std::move(ownedTables));
+		if (!index.Validate())
+		{
+			BEY_CORE_ERROR("AssetPack index is corrupt");
+			return false;
+		}
+
+		BEY_CORE_TRACE("Deserialized index with {} scenes and {} assets from AssetPack", indexHeader.SceneCount, indexHeader.AssetCount);
+		return true;
+	}
+
+	bool AssetPackSerializer::DeserializeIndexV3(StreamReader& stream, AssetPackIndex& index)
+	{
+		AssetPackFile::IndexTable table;
+
 		// Read app binary info
-		stream.ReadRaw<uint64_t>(file.Index.PackedAppBinaryOffset);
-		stream.ReadRaw<uint64_t>(file.Index.PackedAppBinarySize);
+		stream.ReadRaw<uint64_t>(table.PackedAppBinaryOffset);
+		stream.ReadRaw<uint64_t>(table.PackedAppBinarySize);
 
 		uint32_t sceneCount = 0;
 		stream.ReadRaw<uint32_t>(sceneCount); // Read scene map size
@@ -142,7 +323,7 @@ namespace Beyond {
 			uint64_t sceneHandle = 0;
 			stream.ReadRaw<uint64_t>(sceneHandle);
 
-			AssetPackFile::SceneInfo& sceneInfo = file.Index.Scenes[sceneHandle];
+			AssetPackFile::SceneInfo& sceneInfo = table.Scenes[sceneHandle];
 			stream.ReadRaw<uint64_t>(sceneInfo.PackedOffset);
 			stream.ReadRaw<uint64_t>(sceneInfo.PackedSize);
 			stream.ReadRaw<uint16_t>(sceneInfo.Flags);
@@ -150,19 +331,23 @@ namespace Beyond {
 			stream.ReadMap(sceneInfo.Assets);
 		}
 
-		BEY_CORE_TRACE("Deserialized index with {} scenes from AssetPack", sceneCount);
+		if (!stream.IsStreamGood())
+			return false;
+
+		index = AssetPackIndex::Build(table);
+		BEY_CORE_TRACE("Deserialized v3 index with {} scenes from AssetPack", sceneCount);
 		return true;
 	}
 
-	uint64_t AssetPackSerializer::CalculateIndexTableSize(const AssetPackFile& file)
+	uint64_t AssetPackSerializer::CalculateIndexTableSize(uint32_t sceneCount, uint32_t assetCount, uint32_t sceneAssetIndexCount)
 	{
-		uint64_t appInfoSize = sizeof(uint64_t) * 2;
-		uint64_t sceneMapSize = sizeof(uint32_t) + (sizeof(AssetHandle) + sizeof(uint64_t) * 2 + sizeof(uint16_t)) * file.Index.Scenes.size();
-		uint64_t assetMapSize = 0;
-		for (const auto& [sceneHandle, sceneInfo] : file.Index.Scenes)
-			assetMapSize += sizeof(uint32_t) + (sizeof(AssetHandle) + sizeof(AssetPackFile::AssetInfo)) * sceneInfo.Assets.size();
+		uint64_t size = sizeof(AssetPackFile::IndexHeader)
+			+ sizeof(AssetPackFile::SceneEntry) * sceneCount
+			+ sizeof(AssetPackFile::AssetEntry) * assetCount
+			+ sizeof(uint32_t) * sceneAssetIndexCount;
 
-		return appInfoSize + sceneMapSize + assetMapSize;
+		// Keeps whatever follows the index 8 byte aligned as well
+		return (size + 7) & ~7ull;
 	}
 
 }
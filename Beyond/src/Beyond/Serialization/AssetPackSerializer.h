@@ -1,6 +1,9 @@
 #pragma once
 
 #include "AssetPackFile.h"
+#include "AssetPackIndex.h"
+#include "StreamReader.h"
+#include "StreamWriter.h"
 
 #include "Beyond/Core/Buffer.h"
 
@@ -8,13 +11,22 @@
 
 namespace Beyond {
 
+	struct AssetPackBuildStatistics;
+
 	class AssetPackSerializer
 	{
 	public:
 		static void Serialize(const std::filesystem::path& path, AssetPackFile& file, Buffer appBinary, std::atomic<float>& progress);
-		static bool DeserializeIndex(const std::filesystem::path& path, AssetPackFile& file);
+		static bool DeserializeIndex(const std::filesystem::path& path, AssetPackFile::FileHeader& header, AssetPackIndex& index);
+
+		// Uses the index tables in place if the stream supports views (see MemoryMappedStreamReader)
+		static bool DeserializeIndex(StreamReader& stream, AssetPackFile::FileHeader& header, AssetPackIndex& index);
 	private:
-		static uint64_t CalculateIndexTableSize(const AssetPackFile& file);
+		// Compresses the asset if its type asks for it and it pays off, assetInfo.Type has to be set
+		static bool SerializeAsset(AssetHandle handle, StreamWriter& stream, AssetPackFile::AssetInfo& assetInfo, AssetPackBuildStatistics& statistics);
+
+		static bool DeserializeIndexV3(StreamReader& stream, AssetPackIndex& index);
+		static uint64_t CalculateIndexTableSize(uint32_t sceneCount, uint32_t assetCount, uint32_t sceneAssetIndexCount);
 	};
 
 }
@@ -38,7 +38,7 @@ namespace Beyond
 	bool FileStreamReader::ReadData(char* destination, size_t size)
 	{
 		m_Stream.read(destination, size);
-		return true;
+		return !m_Stream.fail();
 	}
 
 } // namespace Beyond
@@ -0,0 +1,143 @@
+#include "pch.h"
+#include "MemoryMappedStream.h"
+
+#ifdef BEY_PLATFORM_LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Beyond
+{
+	//==============================================================================
+	/// MemoryMappedFile
+	MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& path)
+		: m_Path(path)
+	{
+#ifdef BEY_PLATFORM_WINDOWS
+		HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			BEY_CORE_ERROR_TAG("MemoryMappedFile", "Failed to open {}", path.string());
+			return;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return;
+		}
+
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping)
+		{
+			BEY_CORE_ERROR_TAG("MemoryMappedFile", "Failed to map {}", path.string());
+			CloseHandle(file);
+			return;
+		}
+
+		m_Data = (const uint8_t*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (!m_Data)
+		{
+			BEY_CORE_ERROR_TAG("MemoryMappedFile", "Failed to map {}", path.string());
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return;
+		}
+
+		m_FileHandle = file;
+		m_MappingHandle = mapping;
+		m_Size = (uint64_t)fileSize.QuadPart;
+#elif defined(BEY_PLATFORM_LINUX)
+		int file = open(path.c_str(), O_RDONLY);
+		if (file == -1)
+		{
+			BEY_CORE_ERROR_TAG("MemoryMappedFile", "Failed to open {}", path.string());
+			return;
+		}
+
+		struct stat fileStat;
+		if (fstat(file, &fileStat) != 0 || fileStat.st_size == 0)
+		{
+			close(file);
+			return;
+		}
+
+		// The mapping keeps its own reference to the file
+		void* data = mmap(nullptr, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+		close(file);
+		if (data == MAP_FAILED)
+		{
+			BEY_CORE_ERROR_TAG("MemoryMappedFile", "Failed to map {}", path.string());
+			return;
+		}
+
+		m_Data = (const uint8_t*)data;
+		m_Size = (uint64_t)fileStat.st_size;
+#endif
+	}
+
+	MemoryMappedFile::~MemoryMappedFile()
+	{
+		if (!m_Data)
+			return;
+
+#ifdef BEY_PLATFORM_WINDOWS
+		UnmapViewOfFile(m_Data);
+		CloseHandle((HANDLE)m_MappingHandle);
+		CloseHandle((HANDLE)m_FileHandle);
+#elif defined(BEY_PLATFORM_LINUX)
+		munmap((void*)m_Data, (size_t)m_Size);
+#endif
+	}
+
+	Buffer MemoryMappedFile::GetView(uint64_t offset, uint64_t size) const
+	{
+		if (offset > m_Size || size > m_Size - offset)
+			return Buffer();
+
+		return Buffer(m_Data + offset, size);
+	}
+
+	//==============================================================================
+	/// MemoryMappedStreamReader
+	MemoryMappedStreamReader::MemoryMappedStreamReader(Ref<MemoryMappedFile> file)
+		: m_File(file), m_Good(file && file->IsValid())
+	{
+	}
+
+	void MemoryMappedStreamReader::SetStreamPosition(uint64_t position)
+	{
+		m_ReadPos = position;
+		m_Good = m_File && m_File->IsValid() && position <= m_File->GetSize();
+	}
+
+	bool MemoryMappedStreamReader::ReadData(char* destination, size_t size)
+	{
+		Buffer view;
+		if (!ReadView(view, size))
+			return false;
+
+		memcpy(destination, view.Data, size);
+		return true;
+	}
+
+	bool MemoryMappedStreamReader::ReadView(Buffer& view, uint64_t size)
+	{
+		if (!m_Good)
+			return false;
+
+		view = m_File->GetView(m_ReadPos, size);
+		if (!view.Data && size > 0)
+		{
+			m_Good = false;
+			return false;
+		}
+
+		m_ReadPos += size;
+		return true;
+	}
+
+} // namespace Beyond
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "StreamReader.h"
+#include "Beyond/Core/Buffer.h"
+#include "Beyond/Core/Ref.h"
+
+#include <filesystem>
+
+namespace Beyond
+{
+	//==============================================================================
+	/// MemoryMappedFile
+	/// Read-only mapping of a whole file, shared by any number of readers. Pages are
+	/// faulted in by the OS on first access, so mapping a large file is cheap.
+	class MemoryMappedFile : public RefCounted
+	{
+	public:
+		MemoryMappedFile(const std::filesystem::path& path);
+		MemoryMappedFile(const MemoryMappedFile&) = delete;
+		~MemoryMappedFile();
+
+		bool IsValid() const { return m_Data != nullptr; }
+		const std::filesystem::path& GetPath() const { return m_Path; }
+
+		const uint8_t* GetData() const { return m_Data; }
+		uint64_t GetSize() const { return m_Size; }
+
+		// Non-owning view into the mapping, valid for as long as the mapping is alive.
+		// Returns an empty buffer if the range is out of bounds.
+		Buffer GetView(uint64_t offset, uint64_t size) const;
+
+	private:
+		std::filesystem::path m_Path;
+		const uint8_t* m_Data = nullptr;
+		uint64_t m_Size = 0;
+
+#ifdef BEY_PLATFORM_WINDOWS
+		void* m_FileHandle = nullptr;
+		void* m_MappingHandle = nullptr;
+#endif
+	};
+
+	//==============================================================================
+	/// MemoryMappedStreamReader
+	/// Cheap to construct, each reader only owns its read position so readers over
+	/// the same mapping can be used from different threads.
+	class MemoryMappedStreamReader : public StreamReader
+	{
+	public:
+		MemoryMappedStreamReader(Ref<MemoryMappedFile> file);
+		MemoryMappedStreamReader(const MemoryMappedStreamReader&) = delete;
+		~MemoryMappedStreamReader() = default;
+
+		bool IsStreamGood() const final { return m_Good; }
+		uint64_t GetStreamPosition() final { return m_ReadPos; }
+		void SetStreamPosition(uint64_t position) final;
+		bool ReadData(char* destination, size_t size) final;
+		bool SupportsViews() const final { return true; }
+		bool ReadView(Buffer& view, uint64_t size) final;
+
+	private:
+		Ref<MemoryMappedFile> m_File;
+		uint64_t m_ReadPos = 0;
+		bool m_Good = false;
+	};
+
+} // namespace Beyond
@@ -19,9 +19,19 @@ namespace Beyond
 	bool MemoryStreamWriter::WriteData(const char* data, size_t size)
 	{
 		if (m_WritePos + size > m_Buffer.Size)
-			return false;
+		{
+			Buffer grown;
+			grown.Allocate(std::max<uint64_t>(m_WritePos + size, m_Buffer.Size * 2));
+			if (m_Buffer.Data)
+				memcpy(grown.Data, m_Buffer.Data, m_Buffer.Size);
+
+			m_Buffer.Release();
+			m_Buffer = grown;
+		}
 
-		m_Buffer.Write(data, (uint32_t)size, (uint32_t)m_WritePos);
+		m_Buffer.Write(data, size, m_WritePos);
+		m_WritePos += size;
+		m_WrittenSize = std::max(m_WrittenSize, m_WritePos);
 		return true;
 	}
 
@@ -42,6 +52,17 @@ namespace Beyond
 			return false;
 
 		memcpy(destination, (char*)m_Buffer.Data + m_ReadPos, size);
+		m_ReadPos += size;
+		return true;
+	}
+
+	bool MemoryStreamReader::ReadView(Buffer& view, uint64_t size)
+	{
+		if (m_ReadPos + size > m_Buffer.Size)
+			return false;
+
+		view = Buffer((char*)m_Buffer.Data + m_ReadPos, size);
+		m_ReadPos += size;
 		return true;
 	}
 
@@ -8,6 +8,8 @@ namespace Beyond
 {
 	//==============================================================================
 	/// MemoryStreamWriter
+	/// Writes into buffer, which is (re)allocated to at least size bytes and grows as needed.
+	/// buffer.Size is the capacity, GetWrittenSize() is how much of it holds data.
 	class MemoryStreamWriter : public StreamWriter
 	{
 	public:
@@ -15,14 +17,17 @@ namespace Beyond
 		MemoryStreamWriter(const MemoryStreamWriter&) = delete;
 		~MemoryStreamWriter();
 
-		bool IsStreamGood() const final { return m_WritePos < m_Buffer.Size; }
+		bool IsStreamGood() const final { return m_WritePos <= m_Buffer.Size; }
 		uint64_t GetStreamPosition() final { return m_WritePos; }
 		void SetStreamPosition(uint64_t position) final { m_WritePos = position; }
 		bool WriteData(const char* data, size_t size) final;
 
+		uint64_t GetWrittenSize() const { return m_WrittenSize; }
+
 	private:
 		Buffer& m_Buffer;
 		size_t m_WritePos = 0;
+		size_t m_WrittenSize = 0;
 	};
 
 	//==============================================================================
@@ -34,11 +39,15 @@ namespace Beyond
 		MemoryStreamReader(const MemoryStreamReader&) = delete;
 		~MemoryStreamReader();
 
-		bool IsStreamGood() const final { return m_ReadPos < m_Buffer.Size; }
+		bool IsStreamGood() const final { return m_ReadPos <= m_Buffer.Size; }
 		uint64_t GetStreamPosition() final { return m_ReadPos; }
 		void SetStreamPosition(uint64_t position) final { m_ReadPos = position; }
 		bool ReadData(char* destination, size_t size) final;
 
+		// The buffer outlives the reader
+		bool SupportsViews() const final { return true; }
+		bool ReadView(Buffer& view, uint64_t size) final;
+
 	private:
 		const Buffer& m_Buffer;
 		size_t m_ReadPos = 0;
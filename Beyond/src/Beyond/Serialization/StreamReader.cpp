@@ -13,6 +13,34 @@ namespace Beyond
 		ReadData((char*)buffer.Data, buffer.Size);
 	}
 
+	bool StreamReader::ReadBufferView(Buffer& buffer, bool& ownsBuffer, uint32_t size)
+	{
+		buffer = Buffer();
+		ownsBuffer = false;
+
+		if (size == 0 && !ReadData((char*)&size, sizeof(uint32_t)))
+			return false;
+
+		if (SupportsViews())
+		{
+			if (ReadView(buffer, size))
+				return true;
+
+			buffer = Buffer();
+			return false;
+		}
+
+		buffer.Allocate(size);
+		if (!ReadData((char*)buffer.Data, buffer.Size))
+		{
+			buffer.Release();
+			return false;
+		}
+
+		ownsBuffer = true;
+		return true;
+	}
+
 	void StreamReader::ReadString(std::string& string)
 	{
 		size_t size;
@@ -18,9 +18,19 @@ namespace Beyond
 		virtual void SetStreamPosition(uint64_t position) = 0;
 		virtual bool ReadData(char* destination, size_t size) = 0;
 
+		// Points view at the next size bytes without copying them, only supported by readers
+		// backed by memory that outlives them (see MemoryMappedStreamReader)
+		virtual bool SupportsViews() const { return false; }
+		virtual bool ReadView(Buffer& view, uint64_t size) { return false; }
+
 		operator bool() const { return IsStreamGood(); }
 
 		void ReadBuffer(Buffer& buffer, uint32_t size = 0);
+
+		// Like ReadBuffer, but returns a view when the reader supports it. Sets ownsBuffer if the data
+		// was copied into buffer, which then has to be released by the caller.
+		// Returns false (with buffer left empty) if the data couldn't be read.
+		bool ReadBufferView(Buffer& buffer, bool& ownsBuffer, uint32_t size = 0);
 		void ReadString(std::string& string);
 		void ReadString(eastl::string& string);
 
@@ -162,11 +172,17 @@ namespace Beyond
 
 			array.resize(size);
 
-			for (uint32_t i = 0; i < size; i++)
+			if constexpr (std::is_trivial<T>())
 			{
-				if constexpr (std::is_trivial<T>())
-					ReadRaw<T>(array[i]);
-				else
+				if (size > 0)
+				{
+					bool success = ReadData((char*)array.data(), sizeof(T) * size);
+					BEY_CORE_ASSERT(success);
+				}
+			}
+			else
+			{
+				for (uint32_t i = 0; i < size; i++)
 					ReadObject<T>(array[i]);
 			}
 		}
@@ -7,7 +7,7 @@
 
 namespace Beyond {
 
-	uint64_t TextureRuntimeSerializer::SerializeToFile(Ref<TextureCube> textureCube, FileStreamWriter& stream)
+	uint64_t TextureRuntimeSerializer::SerializeToFile(Ref<TextureCube> textureCube, StreamWriter& stream)
 	{
 		struct TextureCubeMetadata
 		{
@@ -48,7 +48,7 @@ namespace Beyond {
 		return stream.GetStreamPosition() - startPosition;
 	}
 
-	Ref<TextureCube> TextureRuntimeSerializer::DeserializeTextureCube(FileStreamReader& stream)
+	Ref<TextureCube> TextureRuntimeSerializer::DeserializeTextureCube(StreamReader& stream)
 	{
 		struct TextureCubeMetadata
 		{
@@ -61,8 +61,14 @@ namespace Beyond {
 		TextureCubeMetadata metadata;
 		stream.ReadRaw<TextureCubeMetadata>(metadata);
 
+		// Points straight into the pack when it is memory mapped, CopyFromBuffer copies it to staging
 		Buffer buffer;
-		stream.ReadBuffer(buffer);
+		bool ownsBuffer;
+		if (!stream.ReadBufferView(buffer, ownsBuffer))
+		{
+			BEY_CORE_ERROR_TAG("TextureRuntimeSerializer", "Failed to read texture cube data");
+			return nullptr;
+		}
 
 		TextureSpecification spec;
 		spec.Width = metadata.Width;
@@ -71,10 +77,13 @@ namespace Beyond {
 
 		Ref<TextureCube> textureCube = TextureCube::Create(spec);
 		textureCube.As<VulkanTextureCube>()->CopyFromBuffer(buffer, metadata.Mips);
+
+		if (ownsBuffer)
+			buffer.Release();
 		return textureCube;
 	}
 
-	uint64_t TextureRuntimeSerializer::SerializeTexture2DToFile(const std::filesystem::path& filepath, FileStreamWriter& stream)
+	uint64_t TextureRuntimeSerializer::SerializeTexture2DToFile(const std::filesystem::path& filepath, StreamWriter& stream)
 	{
 		BEY_CORE_VERIFY(false, "Unimplemented!");
 		// NOTE: serializing/deserializing mips is not support atm
@@ -89,7 +98,7 @@ namespace Beyond {
 		return 0;
 	}
 
-	uint64_t TextureRuntimeSerializer::SerializeTexture2DToFile(Ref<Texture2D> texture, FileStreamWriter& stream)
+	uint64_t TextureRuntimeSerializer::SerializeTexture2DToFile(Ref<Texture2D> texture, StreamWriter& stream)
 	{
 		// NOTE: serializing/deserializing mips is not support atm
 		Texture2DMetadata metadata;
@@ -105,7 +114,7 @@ namespace Beyond {
 		return writtenSize;
 	}
 
-	uint64_t TextureRuntimeSerializer::SerializeTexture2DToFile(Buffer imageBuffer, const Texture2DMetadata& metadata, FileStreamWriter& stream)
+	uint64_t TextureRuntimeSerializer::SerializeTexture2DToFile(Buffer imageBuffer, const Texture2DMetadata& metadata, StreamWriter& stream)
 	{
 		uint64_t startPosition = stream.GetStreamPosition();
 
@@ -116,13 +125,18 @@ namespace Beyond {
 		return stream.GetStreamPosition() - startPosition;
 	}
 
-	Ref<Texture2D> TextureRuntimeSerializer::DeserializeTexture2D(FileStreamReader& stream)
+	Ref<Texture2D> TextureRuntimeSerializer::DeserializeTexture2D(StreamReader& stream)
 	{
 		Texture2DMetadata metadata;
 		stream.ReadRaw<Texture2DMetadata>(metadata);
 
 		Buffer buffer;
-		stream.ReadBuffer(buffer);
+		bool ownsBuffer;
+		if (!stream.ReadBufferView(buffer, ownsBuffer))
+		{
+			BEY_CORE_ERROR_TAG("TextureRuntimeSerializer", "Failed to read texture data");
+			return nullptr;
+		}
 
 		TextureSpecification spec;
 		spec.Width = metadata.Width;
@@ -130,8 +144,10 @@ namespace Beyond {
 		spec.Format = (ImageFormat)metadata.Format;
 		spec.GenerateMips = true;
 
+		// Texture2D::Create copies the image data, so a view into the pack is enough
 		Ref<Texture2D> texture = Texture2D::Create(spec, buffer);
-		buffer.Release();
+		if (ownsBuffer)
+			buffer.Release();
 		return texture;
 	}
 
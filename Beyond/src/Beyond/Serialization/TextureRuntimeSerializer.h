@@ -16,13 +16,13 @@ namespace Beyond {
 			uint8_t Mips;
 		};
 	public:
-		static uint64_t SerializeToFile(Ref<TextureCube> textureCube, FileStreamWriter& stream);
-		static Ref<TextureCube> DeserializeTextureCube(FileStreamReader& stream);
+		static uint64_t SerializeToFile(Ref<TextureCube> textureCube, StreamWriter& stream);
+		static Ref<TextureCube> DeserializeTextureCube(StreamReader& stream);
 
-		static uint64_t SerializeTexture2DToFile(const std::filesystem::path& filepath, FileStreamWriter& stream);
-		static uint64_t SerializeTexture2DToFile(Ref<Texture2D> texture, FileStreamWriter& stream);
-		static uint64_t SerializeTexture2DToFile(Buffer imageBuffer, const Texture2DMetadata& metadata, FileStreamWriter& stream);
-		static Ref<Texture2D> DeserializeTexture2D(FileStreamReader& stream);
+		static uint64_t SerializeTexture2DToFile(const std::filesystem::path& filepath, StreamWriter& stream);
+		static uint64_t SerializeTexture2DToFile(Ref<Texture2D> texture, StreamWriter& stream);
+		static uint64_t SerializeTexture2DToFile(Buffer imageBuffer, const Texture2DMetadata& metadata, StreamWriter& stream);
+		static Ref<Texture2D> DeserializeTexture2D(StreamReader& stream);
 	};
 
 }
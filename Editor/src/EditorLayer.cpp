@@ -6,6 +6,8 @@
 #include "Panels/PhysicsStatsPanel.h"
 #include "Panels/SceneRendererPanel.h"
 
+#include "Beyond/Animation/AnimationSampler.h"
+
 #include "Beyond/Asset/AnimationAssetSerializer.h"
 #include "Beyond/Audio/AudioEngine.h"
 #include "Beyond/Audio/AudioEvents/AudioCommandRegistry.h"
@@ -13,6 +15,8 @@
 
 #include "Beyond/Core/Events/EditorEvents.h"
 
+#include "Beyond/Debug/Benchmarks.h"
+
 #include "Beyond/Editor/AssetEditorPanel.h"
 #include "Beyond/Editor/EditorApplicationSettings.h"
 #include "Beyond/Editor/NodeGraphEditor/AnimationGraph/AnimationGraphAsset.h"
@@ -607,6 +611,44 @@ namespace Beyond {
 					ImGui::MenuItem("ImGui Stack Tool", nullptr, &m_ShowStackTool);
 					ImGui::MenuItem("ImGui Style Editor", nullptr, &m_ShowStyleEditor);
 
+					ImGui::Separator();
+
+#ifndef BEY_DIST
+					if (ImGui::BeginMenu("Benchmarks"))
+					{
+						if (ImGui::MenuItem("Scene Load (20k entities)"))
+							Benchmarks::RunSceneLoad(20000);
+
+						if (ImGui::MenuItem("SoundGraph Block Processing (64 voices)"))
+							Benchmarks::RunSoundGraphBlockProcessing(64);
+
+						if (ImGui::MenuItem("Reverb Block Processing"))
+							Benchmarks::RunReverbBlockProcessing();
+
+						if (ImGui::MenuItem("Pose Blending"))
+							Benchmarks::RunPoseBlending();
+
+						if (ImGui::MenuItem("Animation Graph Evaluation (current scene)"))
+							Benchmarks::RunAnimationEvaluation(m_CurrentScene);
+
+						if (ImGui::MenuItem("Animation Crowd"))
+							Benchmarks::RunAnimationCrowd();
+
+						if (ImGui::MenuItem("Script Callbacks (10k entities)"))
+							Benchmarks::RunEntityCallbacks();
+
+						ImGui::EndMenu();
+					}
+#endif
+
+					if (ImGui::MenuItem("Render Scene Audio Offline (10 s)"))
+					{
+						Audio::OfflineRenderSettings settings;
+						settings.Duration = 10.0;
+						settings.OutputFile = Project::GetCacheDirectory() / "OfflineAudioRender.wav";
+						MiniAudioEngine::RenderOffline(settings);
+					}
+
 					ImGui::PopStyleColor();
 					ImGui::EndMenu();
 				}
@@ -3134,6 +3176,30 @@ namespace Beyond {
 						ImGui::Text("Samplers: %d", renderResourceAllocationCounts.Samplers.load());
 					}
 					ImGui::Separator();
+					{
+						UI::ScopedFont boldFont(ImGui::GetIO().Fonts->Fonts[0]);
+						ImGui::Text("Render Command Queue");
+					}
+					{
+						const auto& queueStats = Renderer::GetRenderCommandQueueStatistics();
+						std::string usedStr = Utils::BytesToString(queueStats.UsedBytes);
+						std::string peakUsedStr = Utils::BytesToString(queueStats.PeakUsedBytes);
+						ImGui::Text("Commands: %u (peak %u)", queueStats.CommandCount, queueStats.PeakCommandCount);
+						ImGui::Text("Memory Used: %s (peak %s)", usedStr.c_str(), peakUsedStr.c_str());
+						ImGui::Text("Chunks: %u", queueStats.ChunkCount);
+					}
+					ImGui::Separator();
+					{
+						UI::ScopedFont boldFont(ImGui::GetIO().Fonts->Fonts[0]);
+						ImGui::Text("Async Asset Loads");
+					}
+					{
+						const AssetLoaderStatistics loadStats = AssetManager::GetAsyncLoadStatistics();
+						ImGui::Text("Queued: %u", loadStats.Queued);
+						ImGui::Text("In Flight: %u", loadStats.InFlight);
+						ImGui::Text("Completed: %llu (failed %llu, cancelled %llu)", loadStats.Completed, loadStats.Failed, loadStats.Cancelled);
+					}
+					ImGui::Separator();
 					bool vsync = app.GetWindow().IsVSync();
 					if (UI::Checkbox("##Vsync", &vsync))
 						app.GetWindow().SetVSync(vsync);
@@ -3179,15 +3245,63 @@ namespace Beyond {
 					std::string max = std::to_string(audioStats.TotalSources);
 					std::string ramEn = Utils::BytesToString(audioStats.MemEngine);
 					std::string ramRM = Utils::BytesToString(audioStats.MemResManager);
+					std::string ramStreaming = Utils::BytesToString(audioStats.MemStreaming);
 					ImGui::Text("Audio Objects: %s", objects.c_str());
 					ImGui::Text("Active Events: %s", events.c_str());
 					ImGui::Text("Active Sources: %s", active.c_str());
 					ImGui::Text("Max Sources: %s", max.c_str());
+					ImGui::Text("Real Voices: %u", audioStats.RealVoices);
+					ImGui::Text("Virtual Voices: %u", audioStats.VirtualVoices);
 					ImGui::Separator();
 
 					ImGui::Text("Frame Time: %.3fms\n", audioStats.FrameTime);
+					ImGui::Text("Command Queue Depth: %u", audioStats.CommandQueueDepth);
+					ImGui::Text("Dropped Commands: %llu", (unsigned long long)audioStats.DroppedCommands);
 					ImGui::Text("Used RAM (Engine - backend): %s", ramEn.c_str());
 					ImGui::Text("Used RAM (Resource Manager): %s", ramRM.c_str());
+					ImGui::Separator();
+
+					ImGui::Text("Active Streams: %u", audioStats.ActiveStreams);
+					ImGui::Text("Used RAM (Streaming): %s", ramStreaming.c_str());
+					ImGui::Text("Starved Stream Frames: %llu", (unsigned long long)audioStats.StreamingStarvedFrames);
+					ImGui::EndTabItem();
+				}
+				if (m_CurrentScene && ImGui::BeginTabItem("Animation"))
+				{
+					Scene::AnimationLODSettings& lodSettings = m_CurrentScene->GetAnimationLODSettings();
+					const Scene::AnimationStatistics& animationStats = m_CurrentScene->GetAnimationStatistics();
+
+					UI::Checkbox("##AnimationLOD", &lodSettings.Enabled);
+					ImGui::SameLine();
+					ImGui::TextUnformatted("Animation LOD");
+					ImGui::Separator();
+
+					for (uint32_t tier = 0; tier < Scene::AnimationLODTierCount; ++tier)
+					{
+						ImGui::Text("Tier %u (every %u frame(s)%s): %u", tier, lodSettings.UpdateInterval[tier], lodSettings.SkipLeafBones[tier] ? ", no leaf bones" : "", animationStats.EntitiesPerTier[tier]);
+						if (lodSettings.SkipLeafBones[tier])
+							ImGui::Text("Skipped Bones: %u", animationStats.SkippedBones[tier]);
+						if (tier < Scene::AnimationLODTierCount - 1)
+						{
+							ImGui::PushID(tier);
+							ImGui::DragFloat("Max Distance", &lodSettings.MaxDistance[tier], 0.5f, 0.0f, 10000.0f);
+							ImGui::PopID();
+						}
+					}
+					ImGui::Separator();
+
+					ImGui::Text("Evaluated: %u", animationStats.Evaluated);
+					ImGui::Text("Interpolated: %u", animationStats.Interpolated);
+					ImGui::Text("Deferred: %u", animationStats.Deferred);
+					int maxUpdates = (int)lodSettings.MaxThrottledUpdatesPerFrame;
+					if (ImGui::DragInt("Max Throttled Updates / Frame", &maxUpdates, 1.0f, 1, 4096))
+						lodSettings.MaxThrottledUpdatesPerFrame = (uint32_t)maxUpdates;
+					ImGui::Separator();
+
+					const AnimationSampler::Statistics samplerStats = AnimationSampler::GetStatistics();
+					ImGui::Text("Sample Cache Hits: %u", samplerStats.Hits);
+					ImGui::Text("Sample Cache Misses: %u", samplerStats.Misses);
+					ImGui::Text("Cached Samples: %u / %u", samplerStats.CachedSamples, AnimationSampler::MaxCachedSamples);
 					ImGui::EndTabItem();
 				}
 				if (ImGui::BeginTabItem("Performance"))
@@ -178,6 +178,18 @@ namespace Beyond {
 					userConfig.FileStreamingDurationThreshold = glm::max(2.0, userConfig.FileStreamingDurationThreshold);
 					MiniAudioEngine::Get().SetUserConfiguration(userConfig);
 				}
+
+				if (UI::Property("Streaming memory budget (MB)", userConfig.StreamingMemoryBudgetMB, 1u, 1024u))
+					MiniAudioEngine::Get().SetUserConfiguration(userConfig);
+
+				if (UI::Property("Stream buffer duration (seconds)", userConfig.StreamingBufferDuration, 0.05f, 0.1, 10.0))
+					MiniAudioEngine::Get().SetUserConfiguration(userConfig);
+
+				if (UI::Property("Max real voices", userConfig.MaxRealVoices, 1u, 128u, "Voices processed at the same time, the rest of the playing voices is virtual."))
+					MiniAudioEngine::Get().SetUserConfiguration(userConfig);
+
+				if (UI::Property("Virtualize voices quieter than (dB)", userConfig.VirtualizationThresholdDB, 0.5f, -120.0f, 0.0f))
+					MiniAudioEngine::Get().SetUserConfiguration(userConfig);
 			}
 			UI::EndPropertyGrid();
 
@@ -366,6 +366,22 @@ namespace Beyond {
 			else
 				UI::ShiftCursorY(headerSpacingOffset);
 
+			if (UI::PropertyGridHeader("Culling", false))
+			{
+				UI::BeginPropertyGrid();
+				UI::Property("Frustum Culling", options.EnableFrustumCulling);
+				UI::Property("Max Draw Distance", options.MaxDrawDistance, 1.0f, 0.0f, FLT_MAX, "0 disables distance culling.");
+				UI::EndPropertyGrid();
+
+				const CullingStatistics& cullingStats = m_Context->GetStatistics().Culling;
+				ImGui::Text("Tested Submeshes: %u", cullingStats.Tested);
+				ImGui::Text("Geometry Pass: %u visible, %u culled", cullingStats.GeometryVisible, cullingStats.GeometryCulled);
+				ImGui::Text("Shadow Passes: %u visible, %u culled", cullingStats.ShadowVisible, cullingStats.ShadowCulled);
+				UI::EndTreeNode();
+			}
+			else
+				UI::ShiftCursorY(headerSpacingOffset);
+
 #if 0
 			if (UI::PropertyGridHeader("Edge Detection"))
 			{
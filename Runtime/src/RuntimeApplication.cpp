@@ -10,20 +10,22 @@
 class RuntimeApplication : public Beyond::Application
 {
 public:
-	RuntimeApplication(const Beyond::ApplicationSpecification& specification, std::string_view projectPath)
+	RuntimeApplication(const Beyond::ApplicationSpecification& specification, std::string_view projectPath, std::optional<Beyond::Audio::OfflineRenderSettings> audioRender)
 		: Application(specification)
 		, m_ProjectPath(projectPath)
+		, m_AudioRender(std::move(audioRender))
 	{
 		s_IsRuntime = true;
 	}
 
 	virtual void OnInit() override
 	{
-		PushLayer(new Beyond::RuntimeLayer(m_ProjectPath));
+		PushLayer(new Beyond::RuntimeLayer(m_ProjectPath, m_AudioRender));
 	}
 
 private:
 	std::string m_ProjectPath;
+	std::optional<Beyond::Audio::OfflineRenderSettings> m_AudioRender;
 };
 
 Beyond::Application* Beyond::CreateApplication(int argc, char** argv)
@@ -34,7 +36,24 @@ Beyond::Application* Beyond::CreateApplication(int argc, char** argv)
 		projectPath = argv[1];
 	}
 
+	// Runtime.exe <project> --render-audio <seconds> [output.wav]
+	// Renders the audio of the start scene without a playback device, logs the time spent per node and quits.
+	// Runs headless (no window or GPU, the scene's scripts and physics don't run), so it works on CI machines.
+	std::optional<Beyond::Audio::OfflineRenderSettings> audioRender;
+	for (int i = 2; i < argc; i++)
+	{
+		if (std::string_view(argv[i]) == "--render-audio" && i + 1 < argc)
+		{
+			audioRender.emplace();
+			audioRender->Duration = std::atof(argv[++i]);
+			if (i + 1 < argc && argv[i + 1][0] != '-')
+				audioRender->OutputFile = argv[++i];
+		}
+	}
+
 	Beyond::ApplicationSpecification specification;
+	specification.OfflineAudio = audioRender.has_value();
+	specification.Headless = audioRender.has_value();
 	specification.Fullscreen = true;
 
 	specification.Name = "Beyond Runtime";
@@ -60,5 +79,5 @@ Beyond::Application* Beyond::CreateApplication(int argc, char** argv)
 
 	specification.CoreThreadingPolicy = ThreadingPolicy::SingleThreaded;
 
-	return new RuntimeApplication(specification, projectPath);
+	return new RuntimeApplication(specification, projectPath, std::move(audioRender));
 }
@@ -2,6 +2,7 @@
 
 #include "Beyond/Asset/AssetManager.h"
 
+#include "Beyond/Audio/AudioEngine.h"
 #include "Beyond/Audio/SoundObject.h"
 #include "Beyond/Audio/AudioEvents/AudioCommandRegistry.h"
 
@@ -27,9 +28,10 @@ namespace Beyond {
 
 	static bool s_AudioDisabled = true;
 
-	RuntimeLayer::RuntimeLayer(std::string_view projectPath)
+	RuntimeLayer::RuntimeLayer(std::string_view projectPath, std::optional<Audio::OfflineRenderSettings> audioRender)
 		: m_EditorCamera(45.0f, 1280.0f, 720.0f, 0.1f, 1000.0f)
 		, m_ProjectPath(projectPath)
+		, m_AudioRender(std::move(audioRender))
 	{
 	}
 
@@ -41,6 +43,13 @@ namespace Beyond {
 	{
 		OpenProject();
 
+		// Only the scene's audio runs, there's no renderer to draw it with
+		if (Application::Get().IsHeadless())
+		{
+			MiniAudioEngine::StartSceneAudio(m_RuntimeScene);
+			return;
+		}
+
 		SceneRendererSpecification spec;
 		spec.JumpFloodPass = false; // Should always be false for runtime
 		spec.NumShadowCascades = 2; 
@@ -89,6 +98,14 @@ namespace Beyond {
 
 	void RuntimeLayer::OnDetach()
 	{
+		if (Application::Get().IsHeadless())
+		{
+			MiniAudioEngine::SetSceneContext(nullptr);
+			ScriptEngine::SetSceneContext(nullptr, nullptr);
+			m_RuntimeScene = nullptr;
+			return;
+		}
+
 		OnSceneStop();
 
 		ScriptEngine::SetSceneContext(nullptr, nullptr);
@@ -323,6 +340,19 @@ namespace Beyond {
 
 	void RuntimeLayer::OnUpdate(Timestep ts)
 	{
+		if (m_AudioRender)
+		{
+			Audio::OfflineRenderResult result = MiniAudioEngine::RenderOffline(*m_AudioRender);
+			if (!result.Success)
+				BEY_CORE_ERROR("Offline audio render failed");
+
+			m_AudioRender.reset();
+			Application::Get().Close();
+		}
+
+		if (Application::Get().IsHeadless())
+			return;
+
 		m_UpdateFPSTimer -= ts;
 		if (m_UpdateFPSTimer <= 0.0f)
 		{
@@ -359,6 +389,7 @@ namespace Beyond {
 			m_EditorCamera.OnUpdate(ts);
 
 		m_RuntimeScene->OnUpdateRuntime(ts);
+
 		m_RuntimeScene->OnRenderRuntime(m_SceneRenderer, ts);
 
 		OnRender2D();
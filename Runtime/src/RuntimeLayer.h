@@ -2,12 +2,14 @@
 
 #include "Beyond.h"
 
+#include "Beyond/Audio/OfflineRender.h"
 #include "Beyond/ImGui/ImGuiLayer.h"
 #include "Beyond/Editor/EditorCamera.h"
 #include "imgui/imgui_internal.h"
 
 #include <glm/glm.hpp>
 
+#include <optional>
 #include <string>
 
 #include "Beyond/Editor/SceneHierarchyPanel.h"
@@ -17,7 +19,7 @@ namespace Beyond {
 	class RuntimeLayer : public Layer
 	{
 	public:
-		RuntimeLayer(std::string_view projectPath);
+		RuntimeLayer(std::string_view projectPath, std::optional<Audio::OfflineRenderSettings> audioRender = {});
 		virtual ~RuntimeLayer();
 
 		virtual void OnAttach() override;
@@ -67,6 +69,9 @@ namespace Beyond {
 		std::string m_ProjectPath;
 		bool m_ReloadScriptOnPlay = true;
 
+		// Rendered on the first update of the headless application, which is closed afterwards
+		std::optional<Audio::OfflineRenderSettings> m_AudioRender;
+
 		std::vector<std::function<void()>> m_PostSceneUpdateQueue;
 
 		glm::mat4 m_Renderer2DProj;
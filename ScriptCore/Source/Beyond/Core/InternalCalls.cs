@@ -82,6 +82,8 @@ namespace Beyond
 
 		#region Entity
 
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern uint Entity_GetNativeHandle(ulong entityID);
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern ulong Entity_GetParent(ulong entityID);
 		[MethodImpl(MethodImplOptions.InternalCall)]
@@ -132,6 +134,14 @@ namespace Beyond
 		internal static extern void TransformComponent_SetTransformMatrix(ulong entityID, ref Matrix4 outTransformMatrix);
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern void TransformComponent_SetRotationQuat(ulong entityID, ref Quaternion inRotation);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void TransformComponent_GetTranslations(ulong[] entityIDs, uint[] nativeHandles, Vector3[] outTranslations);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void TransformComponent_SetTranslations(ulong[] entityIDs, uint[] nativeHandles, Vector3[] inTranslations);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void TransformComponent_GetRotations(ulong[] entityIDs, uint[] nativeHandles, Quaternion[] outRotations);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void TransformComponent_SetRotations(ulong[] entityIDs, uint[] nativeHandles, Quaternion[] inRotations);
 
 		#endregion
 
@@ -93,6 +93,15 @@ namespace Beyond
 			InternalCalls.TransformComponent_SetRotationQuat(Entity.ID, ref rotation);
 		}
 
+		/// <summary>
+		/// Reads the local translation of every entity in entityIDs into translations (which must be at least as long) with a single internal call.
+		/// Use a <see cref="TransformBatch"/> when the same set of entities is moved every frame.
+		/// </summary>
+		public static void GetTranslations(ulong[] entityIDs, Vector3[] translations) => InternalCalls.TransformComponent_GetTranslations(entityIDs, null, translations);
+		public static void SetTranslations(ulong[] entityIDs, Vector3[] translations) => InternalCalls.TransformComponent_SetTranslations(entityIDs, null, translations);
+		public static void GetRotations(ulong[] entityIDs, Quaternion[] rotations) => InternalCalls.TransformComponent_GetRotations(entityIDs, null, rotations);
+		public static void SetRotations(ulong[] entityIDs, Quaternion[] rotations) => InternalCalls.TransformComponent_SetRotations(entityIDs, null, rotations);
+
 	}
 
 	public class MeshComponent : Component, IEquatable<MeshComponent>
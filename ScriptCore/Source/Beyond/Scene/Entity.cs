@@ -20,6 +20,9 @@ namespace Beyond
 		private Entity m_Parent;
 		private Dictionary<Type, Component> m_ComponentCache = new Dictionary<Type, Component>();
 		private TransformComponent m_TransformComponent;
+		private uint m_NativeHandle = InvalidNativeHandle;
+
+		internal const uint InvalidNativeHandle = uint.MaxValue;
 
 		protected Entity() { ID = 0; }
 
@@ -29,6 +32,22 @@ namespace Beyond
 		}
 
 		public readonly ulong ID;
+
+		/// <summary>
+		/// Handle of this entity in the native scene, fetched once and then cached.
+		/// The native side checks it against ID and falls back to looking the entity up by ID if it has gone stale.
+		/// </summary>
+		internal uint NativeHandle
+		{
+			get
+			{
+				if (m_NativeHandle == InvalidNativeHandle)
+					m_NativeHandle = InternalCalls.Entity_GetNativeHandle(ID);
+
+				return m_NativeHandle;
+			}
+		}
+
 		public string Tag => GetComponent<TagComponent>().Tag;
 		public TransformComponent Transform
 		{
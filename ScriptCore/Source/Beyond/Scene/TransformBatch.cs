@@ -0,0 +1,37 @@
+﻿using System;
+using System.Collections.Generic;
+
+namespace Beyond
+{
+	/// <summary>
+	/// A fixed set of entities whose transforms are read and written together, one internal call for the whole set.
+	/// Entity IDs and native handles are gathered once when the batch is created, so each call is a single array copy
+	/// rather than a UUID lookup and interop transition per entity and per field.
+	/// </summary>
+	public sealed class TransformBatch
+	{
+		private readonly ulong[] m_EntityIDs;
+		private readonly uint[] m_NativeHandles;
+
+		public TransformBatch(IReadOnlyList<Entity> entities)
+		{
+			m_EntityIDs = new ulong[entities.Count];
+			m_NativeHandles = new uint[entities.Count];
+
+			for (int i = 0; i < entities.Count; i++)
+			{
+				m_EntityIDs[i] = entities[i].ID;
+				m_NativeHandles[i] = entities[i].NativeHandle;
+			}
+		}
+
+		public int Count => m_EntityIDs.Length;
+
+		// Arrays passed in must hold at least Count elements, element i belongs to the i'th entity the batch was created with
+
+		public void GetTranslations(Vector3[] translations) => InternalCalls.TransformComponent_GetTranslations(m_EntityIDs, m_NativeHandles, translations);
+		public void SetTranslations(Vector3[] translations) => InternalCalls.TransformComponent_SetTranslations(m_EntityIDs, m_NativeHandles, translations);
+		public void GetRotations(Quaternion[] rotations) => InternalCalls.TransformComponent_GetRotations(m_EntityIDs, m_NativeHandles, rotations);
+		public void SetRotations(Quaternion[] rotations) => InternalCalls.TransformComponent_SetRotations(m_EntityIDs, m_NativeHandles, rotations);
+	}
+}